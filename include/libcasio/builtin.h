@@ -57,12 +57,27 @@ CASIO_EXTERN int CASIO_EXPORT casio_open_stream_fd
 #  define LIBCASIO_DISABLED_STREAMS
 # endif
 
-/* Make a stream using libusb. */
+/* Make a stream using libusb.
+ * The libusb context and the table of the connected calculators are shared
+ * by the whole process; the table is kept up to date using hotplug events
+ * when available. `casio_exit_libusb` frees them once no stream uses
+ * them anymore. */
 
 # ifndef LIBCASIO_DISABLED_LIBUSB
 CASIO_EXTERN int CASIO_EXPORT casio_openusb_libusb
 	OF((casio_stream_t **casio__stream,
 		int casio__bus, int casio__address));
+CASIO_EXTERN int CASIO_EXPORT casio_openusb_libusb_serial
+	OF((casio_stream_t **casio__stream, const char *casio__serial));
+
+typedef void CASIO_EXPORT casio_list_libusb_t
+	OF((void *casio__cookie, int casio__bus, int casio__address,
+		const char *casio__serial));
+
+CASIO_EXTERN int CASIO_EXPORT casio_list_libusb
+	OF((casio_list_libusb_t *casio__callback, void *casio__cookie));
+CASIO_EXTERN int CASIO_EXPORT casio_exit_libusb
+	OF((void));
 # endif
 
 /* Make a stream using the Microsoft Windows API. */
@@ -98,6 +113,15 @@ CASIO_EXTERN int CASIO_EXPORT casio_open_windows_fs
 	OF((casio_fs_t **casio__filesystem));
 # endif
 
+/* Make a read-only filesystem interface out of a storage memory image
+ * (as in G1S files), which starts at the current position in the stream.
+ * The stream must be seekable, and stay opened while the filesystem is,
+ * unless the filesystem is told to close it itself. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_open_storage_fs
+	OF((casio_fs_t **casio__filesystem, casio_stream_t *casio__stream,
+		int casio__stream_cl));
+
 /* ---
  * Built-in serial devices listing.
  * --- */
@@ -137,6 +161,17 @@ CASIO_EXTERN void CASIO_EXPORT casio_set_sleep
 CASIO_EXTERN int  CASIO_EXPORT casio_sleep
 	OF((unsigned long casio__ms));
 
+/* The same goes for monotonic clocks, which are used for timing exchanges.
+ * The callback returns a value in milliseconds, which origin is
+ * unspecified (only differences between two values are meaningful). */
+
+typedef unsigned long casio_clock_t OF((void));
+
+CASIO_EXTERN void          CASIO_EXPORT casio_set_clock
+	OF((casio_clock_t *casio__func));
+CASIO_EXTERN unsigned long CASIO_EXPORT casio_clock
+	OF((void));
+
 /* And here are cross-platform allocation functions.
  * They are defined just in case. */
 
@@ -60,7 +60,13 @@
  *
  * By the way, FONTCHAR-8 is the FONTCHARACTER encoding with variable
  * character length (1 to 2 bytes) and FONTCHAR-16 is the FONTCHARACTER
- * encoding with fixed-width big-endian 16-bit characters. */
+ * encoding with fixed-width big-endian 16-bit characters.
+ *
+ * Some FONTCHARACTER characters represent several Unicode characters
+ * (e.g. "sin "); they are converted to all of them, but only the
+ * characters representing one Unicode character are converted back.
+ * Characters without an Unicode equivalent are converted to the Private
+ * Use Area, to U+F0000 plus their code, and back. */
 
 CASIO_EXTERN int CASIO_EXPORT casio_fontchar8_to_utf32
 	OF((casio_uint8_t **casio__inbuf, size_t *casio__inleft,
@@ -78,4 +84,25 @@ CASIO_EXTERN int CASIO_EXPORT casio_utf32_to_fontchar16
 	OF((casio_uint32_t **casio__inbuf, size_t *casio__inleft,
 		FONTCHARACTER **casio__outbuf, size_t *casio__outleft));
 
+/* The same, with UTF-8. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_fontchar8_to_utf8
+	OF((casio_uint8_t **casio__inbuf, size_t *casio__inleft,
+		casio_uint8_t **casio__outbuf, size_t *casio__outleft));
+
+CASIO_EXTERN int CASIO_EXPORT casio_utf8_to_fontchar8
+	OF((casio_uint8_t **casio__inbuf, size_t *casio__inleft,
+		casio_uint8_t **casio__outbuf, size_t *casio__outleft));
+
+/* BASIC programs are made of tokens, which are FONTCHAR-8 characters;
+ * these convert them from and to UTF-8 text. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_detokenize
+	OF((casio_uint8_t **casio__inbuf, size_t *casio__inleft,
+		casio_uint8_t **casio__outbuf, size_t *casio__outleft));
+
+CASIO_EXTERN int CASIO_EXPORT casio_tokenize
+	OF((casio_uint8_t **casio__inbuf, size_t *casio__inleft,
+		casio_uint8_t **casio__outbuf, size_t *casio__outleft));
+
 #endif /* LIBCASIO_CHAR_H */
@@ -20,6 +20,7 @@
 # define LIBCASIO_FILE_H
 # include "cdefs.h"
 # include "mcs.h"
+# include "fs.h"
 # include "version.h"
 # include "date.h"
 
@@ -70,10 +71,13 @@ typedef struct casio_file_s {
 	casio_filetype_t casio_file_type;
 	casio_filefor_t  casio_file_for;
 
-	/* Add-in related data */
+	/* Add-in related data (when lazily decoded, the content is NULL until
+	 * loaded, and is at the given offset in the given stream) */
 	time_t           casio_file_creation_date;
 	unsigned char   *casio_file_content;
 	size_t           casio_file_size;
+	casio_stream_t  *casio_file_content_stream;
+	casio_off_t      casio_file_content_offset;
 
 	/* Lists for various purposes */
 	int               casio_file_count;
@@ -84,6 +88,9 @@ typedef struct casio_file_s {
 	/* Main memory */
 	casio_mcs_t    *casio_file_mcs;
 
+	/* Storage memory */
+	casio_fs_t     *casio_file_fs;
+
 	/* Picture-related data (also used for add-in icons) */
 	int             casio_file_width;
 	int             casio_file_height;
@@ -129,12 +136,29 @@ CASIO_EXTERN int CASIO_EXPORT casio_make_addin
 CASIO_EXTERN void CASIO_EXPORT casio_free_file
 	OF((casio_file_t *casio__handle));
 
-/* Decode a file. */
+/* Decode a file.
+ *
+ * With the `CASIO_DECODE_LAZY` flag, the content of add-ins isn't read
+ * if the stream is seekable: only the headers are read (title, internal
+ * name, version, icons), and the content is read from the stream when
+ * `casio_load_file_content()` is called, so the stream must stay open
+ * until then. The checksums covering the content aren't checked.
+ * Storage memory images are then read from the stream instead of being
+ * copied in memory, so the stream must stay open while the handle is. */
+
+# define CASIO_DECODE_LAZY 0x0001
 
 CASIO_EXTERN int CASIO_EXPORT casio_decode
 	OF((casio_file_t **casio__handle,
 		const char *casio__path, casio_stream_t *casio__buffer,
 		casio_filetype_t casio__expected_types));
+CASIO_EXTERN int CASIO_EXPORT casio_decode_flags
+	OF((casio_file_t **casio__handle,
+		const char *casio__path, casio_stream_t *casio__buffer,
+		casio_filetype_t casio__expected_types, unsigned long casio__flags));
+
+CASIO_EXTERN int CASIO_EXPORT casio_load_file_content
+	OF((casio_file_t *casio__handle));
 
 /* Open and decode a file. */
 
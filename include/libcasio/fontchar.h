@@ -26,11 +26,15 @@ typedef casio_uint16_t FONTCHARACTER;
 
 # define CASIO_FONTCHAR_MULTI_MAX 16
 
+/* Check if a byte is a leader, and convert one character from and to
+ * a zero-terminated Unicode sequence (which should be able to hold
+ * `CASIO_FONTCHAR_MULTI_MAX + 1` code points). */
+
 CASIO_EXTERN int CASIO_EXPORT casio_is_fontchar_lead
 	OF((int casio__code));
 CASIO_EXTERN int CASIO_EXPORT casio_fontchar_to_uni
 	OF((casio_uint16_t casio__code, casio_uint32_t *casio__uni));
 CASIO_EXTERN int CASIO_EXPORT casio_uni_to_fontchar
-	OF((casio_uint32_t const *casio__uni, casio_uint16_t casio__code));
+	OF((casio_uint32_t const *casio__uni, casio_uint16_t *casio__code));
 
 #endif /* LIBCASIO_CHAR_H */
@@ -92,6 +92,62 @@ typedef void CASIO_EXPORT casio_link_progress_t
 	OF((void *casio__cookie, unsigned int casio__id,
 		unsigned int casio__total));
 
+/* As calling the progress callback for each packet gets costly at high
+ * speeds, a progress tracker can be used as the cookie of the
+ * `casio_progress` callback above: it computes the transferred bytes, the
+ * rates and the estimated remaining time, and calls the following callback
+ * at most once every `interval` milliseconds and every `step` hundredths of
+ * percent (zero for no limit), plus when the transfer starts and ends.
+ * The transferred bytes are computed using the size of the packets, which
+ * is `block` bytes (zero for full protocol 7.00 data packets), the last
+ * one being smaller if the total number of bytes is known.
+ * The rates are in bytes per second, the times in milliseconds. */
+
+typedef struct casio_progress_info_s {
+	unsigned int  casio_progress_info_id;    /* packets transferred */
+	unsigned int  casio_progress_info_total; /* total number of packets */
+
+	unsigned long casio_progress_info_size;       /* bytes transferred */
+	unsigned long casio_progress_info_total_size; /* total number of bytes */
+
+	unsigned long casio_progress_info_rate;    /* since the last call */
+	unsigned long casio_progress_info_average; /* since the beginning */
+	unsigned long casio_progress_info_elapsed;
+	unsigned long casio_progress_info_eta;
+} casio_progress_info_t;
+
+typedef void CASIO_EXPORT casio_progress_func_t
+	OF((void *casio__cookie, const casio_progress_info_t *casio__info));
+
+typedef struct casio_progress_s {
+	casio_progress_func_t *casio_progress_func;
+	void                  *casio_progress_cookie;
+	unsigned long          casio_progress_interval;
+	unsigned int           casio_progress_step;
+	unsigned long          casio_progress_block;
+
+	/* Internal state. */
+
+	unsigned long          casio_progress_start;
+	unsigned long          casio_progress_last;
+	unsigned int           casio_progress_last_id;
+	unsigned long          casio_progress_last_size;
+	casio_progress_info_t  casio_progress_info;
+} casio_progress_t;
+
+CASIO_BEGIN_DECLS
+
+CASIO_EXTERN void CASIO_EXPORT casio_init_progress
+	OF((casio_progress_t *casio__progress,
+		casio_progress_func_t *casio__func, void *casio__cookie,
+		unsigned long casio__interval, unsigned int casio__step,
+		unsigned long casio__size, unsigned long casio__block));
+CASIO_EXTERN void CASIO_EXPORT casio_progress
+	OF((void *casio__progress, unsigned int casio__id,
+		unsigned int casio__total));
+
+CASIO_END_DECLS
+
 /* List files. */
 
 typedef void CASIO_EXPORT casio_link_list_t
@@ -141,12 +197,36 @@ CASIO_EXTERN int CASIO_EXPORT casio_open_com
 		char const *casio__path,
 		casio_streamattrs_t const *casio__attributes));
 
-/* Initialize a handle using a custom stream. */
+# ifndef LIBCASIO_DISABLED_LIBUSB
+CASIO_EXTERN int CASIO_EXPORT casio_open_usb_serial
+	OF((casio_link_t **casio__h, unsigned long casio__flags,
+		const char *casio__serial));
+# endif
+
+/* Initialize a handle using a custom stream.
+ * With `casio_open_link_key`, the key identifies the device (e.g. using its
+ * serial number) in the device information cache, if enabled; the identity,
+ * if known, is what the device should be recognized with (e.g. its model),
+ * and the cached information for the key is dropped if it differs. */
 
 CASIO_EXTERN int CASIO_EXPORT casio_open_link
 	OF((casio_link_t **casio__h,
 		unsigned long casio__flags, casio_stream_t *casio__stream,
 		casio_streamattrs_t const *casio__attributes));
+CASIO_EXTERN int CASIO_EXPORT casio_open_link_key
+	OF((casio_link_t **casio__h,
+		unsigned long casio__flags, casio_stream_t *casio__stream,
+		casio_streamattrs_t const *casio__attributes,
+		const char *casio__key, const char *casio__ident));
+
+/* Enable the device information cache.
+ * The information the calculator gives when discovering its environment is
+ * stored in the given file, and used instead of making the discovery again
+ * the next time a link to the same device is opened with a key.
+ * The path is NULL to disable the cache (default). */
+
+CASIO_EXTERN int CASIO_EXPORT casio_set_link_cache
+	OF((const char *casio__path));
 
 /* De-initialize. */
 
@@ -203,6 +283,12 @@ CASIO_EXTERN int CASIO_EXPORT casio_backup_rom_file
 		void *casio__pcookie));
 # endif
 
+/* Backup the main memory. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_backup_mcs
+	OF((casio_link_t *casio__handle, casio_mcs_t *casio__mcs,
+		casio_link_progress_t *casio__progress, void *casio__pcookie));
+
 /* Upload and run an executable. */
 
 CASIO_EXTERN int CASIO_EXPORT casio_upload_and_run
@@ -218,6 +304,92 @@ CASIO_EXTERN int CASIO_EXPORT casio_upload_and_run_file
 		casio_link_progress_t *casio__disp, void *casio__pcookie));
 # endif
 
+/* ---
+ * Deployment on several calculators.
+ * --- */
+
+/* The deployment engine opens every calculator connected through USB and
+ * runs a job on each of them, with one worker thread per calculator when
+ * threads are available. The job is called concurrently with the same
+ * cookie, so it should only read from it; it fills in the number of bytes
+ * it has transferred and of files it has skipped (e.g. because they were
+ * already there) in the result, the engine fills in the rest. */
+
+typedef struct casio_deploy_result_s {
+	int           casio_deploy_result_bus;
+	int           casio_deploy_result_address;
+	int           casio_deploy_result_error;
+
+	unsigned long casio_deploy_result_size; /* transferred bytes */
+	unsigned long casio_deploy_result_time; /* in milliseconds */
+	int           casio_deploy_result_skipped; /* skipped files */
+} casio_deploy_result_t;
+
+typedef int CASIO_EXPORT casio_deploy_job_t
+	OF((void *casio__cookie, casio_link_t *casio__handle,
+		casio_deploy_result_t *casio__result));
+
+/* Once every job is done, the results are aggregated in a report. */
+
+typedef struct casio_deploy_report_s {
+	int           casio_deploy_report_count;  /* number of calculators */
+	int           casio_deploy_report_failed; /* number of failures */
+	int           casio_deploy_report_skipped; /* total skipped files */
+
+	unsigned long casio_deploy_report_size; /* total transferred bytes */
+	unsigned long casio_deploy_report_time; /* total time, in ms */
+
+	casio_deploy_result_t *casio_deploy_report_results;
+} casio_deploy_report_t;
+
+CASIO_BEGIN_DECLS
+
+CASIO_EXTERN int  CASIO_EXPORT casio_deploy
+	OF((casio_deploy_report_t **casio__report, unsigned long casio__flags,
+		casio_deploy_job_t *casio__job, void *casio__cookie));
+CASIO_EXTERN void CASIO_EXPORT casio_free_deploy_report
+	OF((casio_deploy_report_t *casio__report));
+
+CASIO_END_DECLS
+
+/* Built-in jobs.
+ * `casio_deploy_send` sends files, its cookie is a `casio_deploy_files_t`;
+ * the file data is shared by all of the workers, so it is only read once.
+ * Here are the flags:
+ * `CASIO_DEPLOY_OPTIMIZE`: optimize the storage if there isn't enough space;
+ * `CASIO_DEPLOY_OW`: overwrite the files that already exist.
+ *
+ * `casio_deploy_optimize` optimizes a storage device, its cookie is the
+ * device name (e.g. "fls0"). */
+
+# define CASIO_DEPLOY_OPTIMIZE 0x0001
+# define CASIO_DEPLOY_OW       0x0002
+
+typedef struct casio_deploy_file_s {
+	const char *casio_deploy_file_device;
+	const char *casio_deploy_file_dirname;
+	const char *casio_deploy_file_filename;
+
+	const void *casio_deploy_file_data;
+	size_t      casio_deploy_file_size;
+} casio_deploy_file_t;
+
+typedef struct casio_deploy_files_s {
+	unsigned int casio_deploy_files_flags;
+	int          casio_deploy_files_count;
+
+	const casio_deploy_file_t *casio_deploy_files_files;
+} casio_deploy_files_t;
+
+CASIO_BEGIN_DECLS
+
+CASIO_EXTERN int CASIO_EXPORT casio_deploy_send
+	OF((void *casio__cookie, casio_link_t *casio__handle,
+		casio_deploy_result_t *casio__result));
+CASIO_EXTERN int CASIO_EXPORT casio_deploy_optimize
+	OF((void *casio__cookie, casio_link_t *casio__handle,
+		casio_deploy_result_t *casio__result));
+
 CASIO_END_DECLS
 CASIO_END_NAMESPACE
 # include "protocol/legacy.h"
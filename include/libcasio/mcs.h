@@ -100,6 +100,34 @@ CASIO_EXTERN int CASIO_EXPORT casio_transfer_mcsfile
 	OF((casio_mcs_t *casio__dest, casio_mcs_t *casio__source,
 		casio_mcshead_t *casio__mcshead));
 
+/* Synchronize a main memory with another one: only the files that were
+ * added or modified on the source are transferred to the destination.
+ * Files are considered modified when their heads (type, size, dimensions)
+ * differ, or, with `CASIO_MCSSYNC_CONTENT`, when their content fingerprints
+ * differ (which requires getting the file from both sides, but spares
+ * writing it to the destination). With `CASIO_MCSSYNC_DELETE`, the files
+ * which are not on the source anymore are deleted from the destination. */
+
+# define CASIO_MCSSYNC_CONTENT 0x0001
+# define CASIO_MCSSYNC_DELETE  0x0002
+
+typedef struct casio_mcssync_report_s {
+	int casio_mcssync_report_added;
+	int casio_mcssync_report_modified;
+	int casio_mcssync_report_unchanged;
+	int casio_mcssync_report_deleted;
+
+	/* Bytes written to the destination, and bytes which were not
+	 * (the size of the unchanged files). */
+
+	unsigned long casio_mcssync_report_transferred;
+	unsigned long casio_mcssync_report_saved;
+} casio_mcssync_report_t;
+
+CASIO_EXTERN int CASIO_EXPORT casio_sync_mcs
+	OF((casio_mcs_t *casio__dest, casio_mcs_t *casio__source,
+		unsigned long casio__flags, casio_mcssync_report_t *casio__report));
+
 /* Delete an MCS file. */
 
 CASIO_EXTERN int CASIO_EXPORT casio_delete_mcsfile
@@ -22,6 +22,7 @@
 # include "number.h"
 # include "picture.h"
 # include "setup.h"
+# include "iter.h"
 
 # define casio_theta 27
 # define casio_r     28
@@ -130,6 +131,7 @@ typedef unsigned long casio_mcstype_t;
 # define casio_mcsflag_unfinished 0x00000008 /* still parts to read. */
 # define casio_mcsflag_multiple   0x00000010 /* is a set of files */
 # define casio_mcsflag_request    0x00000020 /* is a request (link) */
+# define casio_mcsflag_keyed      0x00000040 /* the key is up to date. */
 
 /* Then comes the platform for which the MCS file is made.
  * The most obvious one is the entries in an MCS archive (G1M, G1R), but
@@ -172,6 +174,38 @@ typedef struct casio_mcscell_s {
 	casio_bcd_t  casio_mcscell_imgn;
 } casio_mcscell_t;
 
+/* Lists, matrixes, vectors and spreadsheets can have up to 999x999 cells,
+ * so instead of cell structures, their files store the cells as planes,
+ * row after row: the flags of the cells, then their real parts, then their
+ * imaginary parts, which is only allocated if at least one of the cells
+ * is complex (when its real part has the special bit set).
+ *
+ * The planes can be used directly, using the following macro to get the
+ * index of a cell, or through the `casio_get_mcscell()` and
+ * `casio_set_mcscell()` functions.
+ *
+ * Spreadsheets are mostly empty, so their planes only contain the used
+ * cells (the head count is their number), column after column, and two
+ * other arrays tell where the cells are: the row of each cell, and the
+ * index of the first cell of each column (with one more element, the
+ * number of cells, so that the cells of column `x` are the ones from
+ * `columns[x]` to `columns[x + 1]` excluded). The macro below can't be
+ * used for them, and setting a cell which isn't stored yet takes a time
+ * proportional to the number of stored cells.
+ *
+ * In all cases, the used cells can be iterated on using
+ * `casio_iter_mcscells()`, which gives entries: */
+
+typedef struct casio_mcscell_entry_s {
+	unsigned int    casio_mcscell_entry_x;
+	unsigned int    casio_mcscell_entry_y;
+	casio_mcscell_t casio_mcscell_entry_cell;
+} casio_mcscell_entry_t;
+
+# define casio_mcscell_index(CASIO__F, CASIO__X, CASIO__Y) \
+	((unsigned long)(CASIO__Y) \
+	* (CASIO__F)->casio_mcsfile_head.casio_mcshead_width + (CASIO__X))
+
 /* ---
  * Main Memory file head.
  * --- */
@@ -217,6 +251,9 @@ typedef struct casio_mcshead_s {
 	char casio_mcshead_dirname[9];
 	char casio_mcshead_cas_app[4];
 	char casio_mcshead_datatype[3];
+
+	/* matching key (see `casio_key_mcshead()`) */
+	casio_uint32_t casio_mcshead_key;
 } casio_mcshead_t;
 
 /* ---
@@ -235,7 +272,17 @@ typedef struct casio_mcsfile_s {
 	/* variables */
 	casio_mcscell_t   casio_mcsfile_var;
 	casio_mcscell_t  *casio_mcsfile_vars;
-	casio_mcscell_t **casio_mcsfile_cells;
+
+	/* cells (for lists, matrixes, vectors and spreadsheets), as planes;
+	 * see `casio_mcscell_index()` */
+	unsigned char    *casio_mcsfile_cell_flags;
+	casio_bcd_t      *casio_mcsfile_cell_real;
+	casio_bcd_t      *casio_mcsfile_cell_imgn;
+
+	/* for spreadsheets, the row of each stored cell, and the index of the
+	 * first stored cell of each column (plus the number of cells) */
+	unsigned int     *casio_mcsfile_cell_rows;
+	unsigned long    *casio_mcsfile_cell_columns;
 
 	/* for pictures and captures */
 	casio_pixel_t   **casio_mcsfile_pic; /* 0x0RGB */
@@ -243,6 +290,9 @@ typedef struct casio_mcsfile_s {
 
 	/* for settings */
 	casio_setup_t     casio_mcsfile_setup;
+
+	/* number of files sharing the allocated content (NULL if not shared) */
+	unsigned int     *casio_mcsfile_refs;
 } casio_mcsfile_t;
 
 /* Some macros to manipulate the password. */
@@ -267,12 +317,35 @@ CASIO_EXTERN int  CASIO_EXPORT casio_prepare_mcsfile
 CASIO_EXTERN void CASIO_EXPORT casio_free_mcsfile
 	OF((casio_mcsfile_t  *casio__handle));
 
-/* Copy or duplicate a main memory file. */
+/* Copy or duplicate a main memory file.
+ * The copies share the allocated content (cells, pixels, raw content) with
+ * the original file until it is freed; in order to modify the content of
+ * a file which might be shared, unshare it first, which copies the content
+ * if it is still shared. */
 
 CASIO_EXTERN int  CASIO_EXPORT casio_duplicate_mcsfile
 	OF((casio_mcsfile_t **casio__handle, casio_mcsfile_t *casio__old));
 CASIO_EXTERN int  CASIO_EXPORT casio_copy_mcsfile
 	OF((casio_mcsfile_t  *casio__handle, casio_mcsfile_t *casio__old));
+CASIO_EXTERN int  CASIO_EXPORT casio_unshare_mcsfile
+	OF((casio_mcsfile_t  *casio__handle));
+
+/* Get and set the cells of a list, matrix, vector or spreadsheet. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_get_mcscell
+	OF((const casio_mcsfile_t *casio__handle, unsigned int casio__x,
+		unsigned int casio__y, casio_mcscell_t *casio__cell));
+CASIO_EXTERN int CASIO_EXPORT casio_set_mcscell
+	OF((casio_mcsfile_t *casio__handle, unsigned int casio__x,
+		unsigned int casio__y, const casio_mcscell_t *casio__cell));
+CASIO_EXTERN int CASIO_EXPORT casio_make_mcscells_imgn
+	OF((casio_mcsfile_t *casio__handle));
+
+CASIO_EXTERN int CASIO_EXPORT casio_iter_mcscells
+	OF((casio_iter_t **casio__iterp, casio_mcsfile_t *casio__handle));
+
+# define casio_next_mcscell(ITER, ENTRYP) \
+	(casio_next((ITER), (void **)(casio_mcscell_entry_t **)(ENTRYP)))
 
 /* Decode and encode an MCS file from an MCS archive. */
 
@@ -312,13 +385,28 @@ CASIO_EXTERN int CASIO_EXPORT casio_encode_casfile_part
 CASIO_EXTERN int CASIO_EXPORT casio_correct_mcshead
 	OF((casio_mcshead_t *casio__head, unsigned long casio__mcsfor));
 
-/* Compare MCS files (for ordering). */
-
+/* Compare MCS files (for ordering).
+ *
+ * Matching is done a lot when looking for files, so heads can have a key,
+ * computed from what identifies the file: heads with different keys don't
+ * match, and heads with the same key are compared completely.
+ * The key is computed by `casio_key_mcshead()`, which sets the
+ * `casio_mcsflag_keyed` flag; heads of files made by libcasio and heads
+ * given by its iterators have it. If you modify the type, ID or names of
+ * a keyed head, call this function again (or remove the flag). */
+
+CASIO_EXTERN casio_uint32_t CASIO_EXPORT casio_key_mcshead
+	OF((casio_mcshead_t *casio__head));
 CASIO_EXTERN int CASIO_EXPORT casio_match_mcsfiles
 	OF((casio_mcshead_t *casio__first, casio_mcshead_t *casio__second));
 CASIO_EXTERN int CASIO_EXPORT casio_compare_mcsfiles
 	OF((casio_mcshead_t *casio__first, casio_mcshead_t *casio__second));
 
+/* Make the fingerprint of an MCS file content (for detecting changes). */
+
+CASIO_EXTERN casio_uint32_t CASIO_EXPORT casio_fingerprint_mcsfile
+	OF((const casio_mcsfile_t *casio__file));
+
 CASIO_END_DECLS
 CASIO_END_NAMESPACE
 #endif /* LIBCASIO_MCSFILE_H */
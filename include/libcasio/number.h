@@ -51,8 +51,9 @@ CASIO_BEGIN_NAMESPACE
  * `exp` is the 10-exponent, between -99 and 99.
  * `mant` is the mantissa: unpacked BCD digits (one digit per byte).
  *
- * The first digit of the mantissa is the integer part, the others are
- * the decimal part.
+ * The number is 0.[mantissa] * 10^[exp], i.e. the first digit of the
+ * mantissa is the first one after the decimal point (1 has an exponent
+ * of 1).
  *
  * To interact the flags or the exponent, it is advised to use the
  * `casio_bcd_*` macros, as some of them could change. */
@@ -142,6 +143,39 @@ CASIO_EXTERN void   CASIO_EXPORT casio_bcd_fromdouble
 CASIO_EXTERN double CASIO_EXPORT casio_bcd_todouble
 	OF((const casio_bcd_t *casio__bcd));
 
+/* The same, for arrays of numbers; the MCS and CAS conversions return
+ * whether one of the numbers has the special bit. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_bcd_frommcs_array
+	OF((casio_bcd_t *casio__bcd, const casio_mcsbcd_t *casio__raw,
+		size_t casio__count));
+CASIO_EXTERN int CASIO_EXPORT casio_bcd_tomcs_array
+	OF((casio_mcsbcd_t *casio__raw, const casio_bcd_t *casio__bcd,
+		size_t casio__count));
+
+CASIO_EXTERN int CASIO_EXPORT casio_bcd_fromcas_array
+	OF((casio_bcd_t *casio__bcd, const casio_casbcd_t *casio__raw,
+		size_t casio__count));
+CASIO_EXTERN int CASIO_EXPORT casio_bcd_tocas_array
+	OF((casio_casbcd_t *casio__raw, const casio_bcd_t *casio__bcd,
+		size_t casio__count));
+
+CASIO_EXTERN void CASIO_EXPORT casio_bcd_fromdouble_array
+	OF((casio_bcd_t *casio__bcd, const double *casio__raw,
+		size_t casio__count));
+CASIO_EXTERN void CASIO_EXPORT casio_bcd_todouble_array
+	OF((double *casio__raw, const casio_bcd_t *casio__bcd,
+		size_t casio__count));
+
+/* From and to MCS BCD, for arrays of C-doubles. */
+
+CASIO_EXTERN int  CASIO_EXPORT casio_double_frommcs_array
+	OF((double *casio__dbl, const casio_mcsbcd_t *casio__raw,
+		size_t casio__count));
+CASIO_EXTERN void CASIO_EXPORT casio_double_tomcs_array
+	OF((casio_mcsbcd_t *casio__raw, const double *casio__dbl,
+		size_t casio__count));
+
 /* Make a string out of a BCD */
 
 CASIO_EXTERN size_t CASIO_EXPORT casio_bcdtoa
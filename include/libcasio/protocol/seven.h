@@ -200,6 +200,23 @@ CASIO_BEGIN_DECLS
 CASIO_EXTERN int CASIO_EXPORT casio_seven_receive
 	OF((casio_link_t *casio__handle, unsigned int casio__flags));
 
+/* The function above blocks until the packet is complete. Packets can also
+ * be decoded from bytes received by any other mean (e.g. an event loop
+ * managing several links), in chunks of any size: reset the decoder, then
+ * give it the bytes as they come. `casio_seven_decode_chunk` returns 0 once
+ * a packet is complete (and tells how many bytes it has used; the packet
+ * can then be got using `casio_get_link_response`), and
+ * `casio_error_eof` if it needs more bytes. Checksum errors, resend
+ * requests and timeouts are up to the caller. */
+
+CASIO_EXTERN int    CASIO_EXPORT casio_seven_reset_decoder
+	OF((casio_link_t *casio__handle, unsigned int casio__flags));
+CASIO_EXTERN size_t CASIO_EXPORT casio_seven_decoder_need
+	OF((casio_link_t *casio__handle));
+CASIO_EXTERN int    CASIO_EXPORT casio_seven_decode_chunk
+	OF((casio_link_t *casio__handle, const void *casio__data,
+		size_t casio__size, size_t *casio__consumed));
+
 /* These are the base functions to send a packet.
  * Unless `resp` is zero, it will also get the response to the packet,
  * and store its info in the handle's packet representation.
@@ -215,6 +232,11 @@ CASIO_EXTERN int CASIO_EXPORT casio_seven_send_ext
 		casio_seven_type_t casio__type, unsigned int casio__subtype,
 		const void *casio__data, unsigned int casio__size,
 		int casio__resp));
+CASIO_EXTERN int CASIO_EXPORT casio_seven_send_extv
+	OF((casio_link_t *casio__handle,
+		casio_seven_type_t casio__type, unsigned int casio__subtype,
+		const casio_iovec_t *casio__data, int casio__count,
+		int casio__resp));
 
 /* Send checks.
  * Initial checks are useful to check if there is another device speaking
@@ -356,7 +378,10 @@ typedef struct casio_seven_packet_s {
 	char casio_seven_packet_vram[CASIO_SEVEN_MAX_VRAM_SIZE];
 } casio_seven_packet_t;
 
-/* To extract it from the handle, use the extractors in `libcasio/link.h`. */
+/* To extract the last received packet from the handle, use this: */
+
+CASIO_EXTERN const casio_seven_packet_t* CASIO_EXPORT casio_get_link_response
+	OF((casio_link_t *casio__handle));
 
 /* ---
  * Packet flows.
@@ -125,6 +125,12 @@ CASIO_EXTERN int CASIO_EXPORT casio_seven_send_cmdsys_setlink
 	casio_seven_send_typical_mcs_command(CASIO__HANDLE, 0x26, \
 		(CASIO__HEAD), NULL, 0)
 
+/* Request the transfer of all files */
+
+# define casio_seven_cmdmcs_reqall      0x29
+# define casio_seven_send_cmdmcs_reqall(CASIO__HANDLE) \
+	casio_seven_send_cmd(CASIO__HANDLE, 0x29)
+
 /* Request all file information */
 
 # define casio_seven_cmdmcs_reqallinfo  0x2D
@@ -41,6 +41,8 @@ struct         casio_timeouts_s;
 typedef struct casio_timeouts_s     casio_timeouts_t;
 struct         casio_scsi_s;
 typedef struct casio_scsi_s         casio_scsi_t;
+struct         casio_iovec_s;
+typedef struct casio_iovec_s        casio_iovec_t;
 
 /* ---
  * Stream.
@@ -112,7 +114,21 @@ typedef int casio_stream_seek_t
 typedef int casio_stream_scsi_t
 	OF((void *, casio_scsi_t*));
 
-/* Here is the callbacks structure: */
+/* Scatter-gather writing uses the following element, which describes
+ * one of the buffers to write (the buffers are written in order, as if they
+ * were one contiguous buffer): */
+
+struct casio_iovec_s {
+	const void *casio_iovec_base;
+	size_t      casio_iovec_len;
+};
+
+typedef ssize_t casio_stream_writev_t
+	OF((void *, const casio_iovec_t *, int));
+
+/* Here is the callbacks structure.
+ * Optional callbacks which were added later are at the end, so that
+ * existing initializers keep on working (they will just be NULL). */
 
 struct casio_streamfuncs_s {
 	/* Main callbacks. */
@@ -133,6 +149,11 @@ struct casio_streamfuncs_s {
 	/* SCSI callbacks. */
 
 	casio_stream_scsi_t     *casio_streamfuncs_scsi;
+
+	/* Scatter-gather write callback (optional, `write` is used
+	 * for each buffer if not defined). */
+
+	casio_stream_writev_t   *casio_streamfuncs_writev;
 };
 
 /* And here are some macros, for better API compatibility */
@@ -144,14 +165,14 @@ struct casio_streamfuncs_s {
  (casio_stream_read_t*)(CASIO__READ), \
  (casio_stream_write_t*)(CASIO__WRITE), NULL, \
  (casio_stream_setattrs_t*)(CASIO__SETCOMM), \
- NULL}
+ NULL, NULL}
 
 # define casio_stream_callbacks_for_virtual(CASIO__CLOSE, \
 	CASIO__READ, CASIO__WRITE, CASIO__SEEK) \
 {(casio_stream_close_t*)(CASIO__CLOSE), NULL, \
  (casio_stream_read_t*)(CASIO__READ), \
  (casio_stream_write_t*)(CASIO__WRITE), \
- (casio_stream_seek_t*)(CASIO__SEEK), NULL, NULL}
+ (casio_stream_seek_t*)(CASIO__SEEK), NULL, NULL, NULL}
 
 /* ---
  * Stream serial settings ad flags.
@@ -368,6 +389,10 @@ CASIO_EXTERN ssize_t CASIO_EXPORT casio_write
 	OF((casio_stream_t *casio__stream,
 		const void *casio__data, size_t casio__size));
 
+CASIO_EXTERN ssize_t CASIO_EXPORT casio_writev
+	OF((casio_stream_t *casio__stream,
+		const casio_iovec_t *casio__iov, int casio__iovcnt));
+
 CASIO_EXTERN int CASIO_EXPORT casio_write_char
 	OF((casio_stream_t *casio__stream, int casio__char));
 
@@ -420,7 +445,44 @@ CASIO_EXTERN int CASIO_EXPORT casio_open_memory
 	OF((casio_stream_t **casio__stream,
 		const void *casio__memory, size_t casio__size));
 
-/* Make a stream out of another, with a limit (and empty it). */
+/* Make a readable, writable and seekable stream which stores its contents
+ * in memory, growing as data is written, and get these contents back
+ * (the buffers belong to the stream, and stay valid until the next write
+ * or until the stream is closed). */
+
+CASIO_EXTERN int CASIO_EXPORT casio_open_membuf
+	OF((casio_stream_t **casio__stream));
+
+CASIO_EXTERN int CASIO_EXPORT casio_get_membuf
+	OF((casio_stream_t *casio__stream,
+		const void **casio__data, size_t *casio__size));
+CASIO_EXTERN int CASIO_EXPORT casio_get_membuf_iovec
+	OF((casio_stream_t *casio__stream,
+		const casio_iovec_t **casio__iov, int *casio__iovcnt));
+
+/* Make a stream out of another, on which filters are applied to what
+ * is read, in one pass: a limit on the number of bytes that can be read,
+ * checksums and deobfuscation. Checksums registered before the
+ * deobfuscation are made on the original bytes, those registered after
+ * are made on the deobfuscated bytes. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_open_filter
+	OF((casio_stream_t **casio__stream, casio_stream_t *casio__original));
+
+CASIO_EXTERN int CASIO_EXPORT casio_filter_limit
+	OF((casio_stream_t *casio__stream, size_t casio__size));
+CASIO_EXTERN int CASIO_EXPORT casio_filter_csum32
+	OF((casio_stream_t *casio__stream, casio_uint32_t *casio__csum));
+CASIO_EXTERN int CASIO_EXPORT casio_filter_csumsub
+	OF((casio_stream_t *casio__stream, int *casio__csum));
+CASIO_EXTERN int CASIO_EXPORT casio_filter_deobfuscate
+	OF((casio_stream_t *casio__stream));
+
+CASIO_EXTERN int CASIO_EXPORT casio_empty_filter
+	OF((casio_stream_t *casio__stream));
+
+/* Make a stream out of another, with a limit (and empty it).
+ * These are filter streams with only a limit. */
 
 CASIO_EXTERN int CASIO_EXPORT casio_open_limited
 	OF((casio_stream_t **casio__stream,
@@ -428,12 +490,36 @@ CASIO_EXTERN int CASIO_EXPORT casio_open_limited
 CASIO_EXTERN int CASIO_EXPORT casio_empty_limited
 	OF((casio_stream_t *casio__stream));
 
-/* Make a stream out of another, while calculating a 32-bit checksum. */
+/* Make a stream out of another, while calculating a 32-bit checksum.
+ * This is a filter stream with only a 32-bit checksum. */
 
 CASIO_EXTERN int CASIO_EXPORT casio_open_csum32
 	OF((casio_stream_t **casio__stream, casio_stream_t *casio__original,
 		casio_uint32_t *casio__csum));
 
+/* Make a stream out of another, recording every read and write operation
+ * with its timing into a log stream. The original and log streams are
+ * closed with the recording stream. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_open_record
+	OF((casio_stream_t **casio__stream, casio_stream_t *casio__original,
+		casio_stream_t *casio__log));
+
+/* Make a stream out of such a log, playing back what was read from the
+ * original stream, so that exchanges can be reproduced without the device.
+ * The log stream is closed with the replaying stream.
+ * Available flags are:
+ *
+ * `PACE`: respect the recorded timing (by default, as fast as possible);
+ * `CHECK`: fail if what is written differs from what was recorded. */
+
+# define CASIO_REPLAYFLAG_PACE  0x0001
+# define CASIO_REPLAYFLAG_CHECK 0x0002
+
+CASIO_EXTERN int CASIO_EXPORT casio_open_replay
+	OF((casio_stream_t **casio__stream, casio_stream_t *casio__log,
+		unsigned int casio__flags));
+
 /* ---
  * USB and serial stream utilities.
  * --- */
@@ -104,3 +104,43 @@ int CASIO_EXPORT casio_bcd_tocas(casio_casbcd_t *raw, const casio_bcd_t *bcd)
 	/* end, hugh. */
 	return (casio_bcd_has_special(bcd));
 }
+
+/**
+ *	casio_bcd_fromcas_array:
+ *	Make libcasio BCD numbers out of CAS BCD numbers.
+ *
+ *	@arg	bcd		the not raw BCDs.
+ *	@arg	raw		the raw BCDs.
+ *	@arg	count	the number of numbers.
+ *	@return			whether one of them has the special bit.
+ */
+
+int CASIO_EXPORT casio_bcd_fromcas_array(casio_bcd_t *bcd,
+	const casio_casbcd_t *raw, size_t count)
+{
+	int special = 0;
+
+	for (; count; count--)
+		special |= casio_bcd_fromcas(bcd++, raw++);
+	return (special);
+}
+
+/**
+ *	casio_bcd_tocas_array:
+ *	Make CAS BCD numbers out of libcasio BCD numbers.
+ *
+ *	@arg	raw		the raw BCDs.
+ *	@arg	bcd		the not raw BCDs.
+ *	@arg	count	the number of numbers.
+ *	@return			whether one of them has the special bit.
+ */
+
+int CASIO_EXPORT casio_bcd_tocas_array(casio_casbcd_t *raw,
+	const casio_bcd_t *bcd, size_t count)
+{
+	int special = 0;
+
+	for (; count; count--)
+		special |= casio_bcd_tocas(raw++, bcd++);
+	return (special);
+}
@@ -15,84 +15,246 @@
  *
  * You should have received a copy of the GNU Lesser General Public License
  * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * The mantissa holds 15 digits, and a double about 17, so converting
+ * a double means rounding it to 15 significant digits. This is done with
+ * one floating-point operation by an exact power of ten when it is known
+ * to be enough (the rounding error is then at most a sixteenth of a unit),
+ * and falls back on the standard library conversions otherwise, which
+ * are exact.
  * ************************************************************************* */
 #include "../internals.h"
 #include <math.h>
+#include <float.h>
+
+/* Powers of ten which are exact in a double. */
+
+#define MAXPOW 22
+
+CASIO_LOCAL const double powers[MAXPOW + 1] = {
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ *	set_mantissa:
+ *	Set the mantissa of a BCD number from an integer.
+ *
+ *	The integer is split in two parts which fit in a long, the product
+ *	and the difference being exact in a double.
+ *
+ *	@arg	bcd		the BCD number.
+ *	@arg	num		the integer, between 1e14 and 1e15.
+ */
+
+CASIO_LOCAL void set_mantissa(casio_bcd_t *bcd, double num)
+{
+	unsigned long hi, lo;
+	double rest;
+	int i;
+
+	hi = (unsigned long)(num / 1e8);
+	rest = num - (double)hi * 1e8;
+	if (rest < 0) {
+		hi--;
+		rest += 1e8;
+	} else if (rest >= 1e8) {
+		hi++;
+		rest -= 1e8;
+	}
+	lo = (unsigned long)rest;
+
+	for (i = 14; i >= 7; i--, lo /= 10)
+		bcd->casio_bcd_mant[i] = (char)(lo % 10);
+	for (i = 6; i >= 0; i--, hi /= 10)
+		bcd->casio_bcd_mant[i] = (char)(hi % 10);
+	bcd->casio_bcd_mant[15] = 0;
+}
 
 /**
  *	casio_bcd_fromdouble:
  *	Make a libcasio BCD number out of a C-double.
  *
+ *	The double is rounded to the nearest 15-digit number. Numbers too big
+ *	for the BCD format are set to the biggest one, numbers too small (and
+ *	NaN) are set to zero.
+ *
  *	@arg	bcd		the BCD to make.
  *	@arg	dbl		the source double.
  */
 
 void CASIO_EXPORT casio_bcd_fromdouble(casio_bcd_t *bcd, double dbl)
 {
-	int neg = 0, exp = 1, i;
-
-	/* Check if is negative. */
+	int neg = 0, exp, k, i;
+	double num, frac;
 
 	if (dbl < 0) {
 		neg = 1;
 		dbl = -dbl;
 	}
 
-	/* Check the exponent, normalize the number. */
+	bcd->casio_bcd_flags = casio_make_bcdflags(0, neg, 15);
+	if (!(dbl > 0)) /* zero or NaN */
+		goto zero;
+	if (dbl > DBL_MAX) /* infinity */
+		goto big;
+
+	/* Find the exponent, so that the number is 0.[mantissa] * 10^exp,
+	 * and scale the number so that its integer part is the mantissa.
+	 * The exponent is guessed from the binary one, and can be one off,
+	 * which the scaling corrects. */
 
-	while (dbl >= 10) {
-		exp++;
-		dbl /= 10;
-	}
-	if (dbl > 0) while (dbl < 1) {
-		exp--;
-		dbl *= 10;
+	frexp(dbl, &exp);
+	exp = (int)floor((exp - 1) * 0.30102999566398120) + 1;
+	if (exp > CASIO_BCD_EXPMAX + 1)
+		goto big;
+	if (exp < CASIO_BCD_EXPMIN - 1)
+		goto zero;
+
+	for (i = 0; i < 2; i++) {
+		k = 15 - exp;
+		if (k > MAXPOW || k < -MAXPOW)
+			goto exact;
+
+		num = k >= 0 ? dbl * powers[k] : dbl / powers[-k];
+		if (num < 1e14)
+			exp--;
+		else if (num >= 1e15)
+			exp++;
+		else
+			break;
 	}
+	if (i == 2)
+		goto exact;
+
+	/* Round the scaled number, if it isn't too close to a half. */
 
-	/* Get the mantissa. */
+	frac = num - floor(num);
+	if (frac > 0.375 && frac < 0.625)
+		goto exact;
 
-	for (i = 0; i < 15; i++) {
-		double work = floor(dbl);
-		bcd->casio_bcd_mant[i] = (int)work;
-		dbl = (dbl - work) * 10;
+	num = floor(num) + (frac > 0.5);
+	if (num >= 1e15) {
+		num = 1e14;
+		exp++;
 	}
 
-	/* Set the flags */
+	set_mantissa(bcd, num);
+	goto check;
 
-	bcd->casio_bcd_flags = casio_make_bcdflags(0, neg, 15);
-	bcd->casio_bcd_exp = exp;
+exact: {
+	/* Let the standard library round the number. */
+
+	char buf[32];
+
+	sprintf(buf, "%.14e", dbl);
+	bcd->casio_bcd_mant[0] = buf[0] - '0';
+	for (i = 1; i < 15; i++)
+		bcd->casio_bcd_mant[i] = buf[i + 1] - '0';
+	bcd->casio_bcd_mant[15] = 0;
+	exp = atoi(&buf[17]) + 1;
+}
+
+check:
+	if (exp > CASIO_BCD_EXPMAX)
+		goto big;
+	if (exp < CASIO_BCD_EXPMIN)
+		goto zero;
+
+	bcd->casio_bcd_exp = (char)exp;
+	return ;
+
+big:
+	memset(bcd->casio_bcd_mant, 9, 15);
+	bcd->casio_bcd_mant[15] = 0;
+	bcd->casio_bcd_exp = CASIO_BCD_EXPMAX;
+	return ;
+
+zero:
+	memset(bcd->casio_bcd_mant, 0, CASIO_BCD_MANTISSA_SIZE);
+	bcd->casio_bcd_flags = casio_make_bcdflags(0, 0, 15);
+	bcd->casio_bcd_exp = 1;
 }
 
 /**
  *	casio_bcd_todouble:
  *	Make a C-double out of a libcasio BCD number.
  *
+ *	The result is the double nearest to the BCD number.
+ *
  *	@arg	bcd		the BCD to convert.
  *	@return			the double.
  */
 
 double CASIO_EXPORT casio_bcd_todouble(casio_bcd_t const *bcd)
 {
-	double val = 0.0;
-	double power = 1.0;
-	int i;
+	const char *mant = bcd->casio_bcd_mant;
+	unsigned long hi = 0, lo = 0;
+	double num, val;
+	int i, last, exp;
+
+	/* Get the significant digits as an integer, which is exact in
+	 * a double as it has at most 15 digits. */
+
+	last = min(casio_bcd_precision(bcd), 15);
+	while (last && !mant[last - 1])
+		last--;
+	if (!last)
+		return (0.0);
 
-	/* Use the mantissa. */
+	for (i = 0; i < last && i < 7; i++)
+		hi = hi * 10 + mant[i];
+	for (; i < last; i++)
+		lo = lo * 10 + mant[i];
+	num = last > 7 ? (double)hi * powers[last - 7] + (double)lo : (double)hi;
 
-	for (i = 0; i < casio_bcd_precision(bcd); i++) {
-		val += bcd->casio_bcd_mant[i] * power;
-		power /= 10.0;
+	/* Scale it, which is exact when the power of ten is. */
+
+	exp = casio_bcd_exponent(bcd) - last;
+	if (exp >= 0 && exp <= MAXPOW)
+		val = num * powers[exp];
+	else if (exp < 0 && exp >= -MAXPOW)
+		val = num / powers[-exp];
+	else {
+		char buf[32], *p = buf;
+
+		for (i = 0; i < last; i++)
+			*p++ = '0' + mant[i];
+		sprintf(p, "e%d", exp);
+		val = strtod(buf, NULL);
 	}
 
-	/* Use the exponent. */
+	return (casio_bcd_is_negative(bcd) ? -val : val);
+}
 
-	power = pow(10, (double)bcd->casio_bcd_exp);
-	val *= power;
+/**
+ *	casio_bcd_fromdouble_array:
+ *	Make libcasio BCD numbers out of C-doubles.
+ *
+ *	@arg	bcd		the BCDs to make.
+ *	@arg	dbl		the source doubles.
+ *	@arg	count	the number of numbers.
+ */
 
-	/* Use the flags. */
+void CASIO_EXPORT casio_bcd_fromdouble_array(casio_bcd_t *bcd,
+	const double *dbl, size_t count)
+{
+	for (; count; count--)
+		casio_bcd_fromdouble(bcd++, *dbl++);
+}
 
-	if (casio_bcd_is_negative(bcd))
-		val = -val;
+/**
+ *	casio_bcd_todouble_array:
+ *	Make C-doubles out of libcasio BCD numbers.
+ *
+ *	@arg	dbl		the doubles to set.
+ *	@arg	bcd		the BCDs to convert.
+ *	@arg	count	the number of numbers.
+ */
 
-	return (val);
+void CASIO_EXPORT casio_bcd_todouble_array(double *dbl,
+	const casio_bcd_t *bcd, size_t count)
+{
+	for (; count; count--)
+		*dbl++ = casio_bcd_todouble(bcd++);
 }
@@ -20,6 +20,11 @@
 #define upr(N) (bytes[(N)] >> 4)
 #define lwr(N) (bytes[(N)] & 15)
 
+/* Numbers are converted by blocks of this many numbers when they
+ * go through libcasio BCD numbers. */
+
+#define BLOCK 64
+
 /**
  *	casio_bcd_frommcs:
  *	Make a libcasio BCD out of an MCS BCD number.
@@ -105,3 +110,91 @@ int CASIO_EXPORT casio_bcd_tomcs(casio_mcsbcd_t *raw, const casio_bcd_t *bcd)
 	/* return the special bit, hugh. */
 	return (casio_bcd_has_special(bcd));
 }
+
+/**
+ *	casio_bcd_frommcs_array:
+ *	Make libcasio BCD numbers out of MCS BCD numbers.
+ *
+ *	@arg	bcd		the not raw BCDs.
+ *	@arg	raw		the raw BCDs.
+ *	@arg	count	the number of numbers.
+ *	@return			whether one of them has the special bit.
+ */
+
+int CASIO_EXPORT casio_bcd_frommcs_array(casio_bcd_t *bcd,
+	const casio_mcsbcd_t *raw, size_t count)
+{
+	int special = 0;
+
+	for (; count; count--)
+		special |= casio_bcd_frommcs(bcd++, raw++);
+	return (special);
+}
+
+/**
+ *	casio_bcd_tomcs_array:
+ *	Make MCS BCD numbers out of libcasio BCD numbers.
+ *
+ *	@arg	raw		the raw BCDs.
+ *	@arg	bcd		the not raw BCDs.
+ *	@arg	count	the number of numbers.
+ *	@return			whether one of them has the special bit.
+ */
+
+int CASIO_EXPORT casio_bcd_tomcs_array(casio_mcsbcd_t *raw,
+	const casio_bcd_t *bcd, size_t count)
+{
+	int special = 0;
+
+	for (; count; count--)
+		special |= casio_bcd_tomcs(raw++, bcd++);
+	return (special);
+}
+
+/**
+ *	casio_double_frommcs_array:
+ *	Make C-doubles out of MCS BCD numbers.
+ *
+ *	@arg	dbl		the doubles.
+ *	@arg	raw		the raw BCDs.
+ *	@arg	count	the number of numbers.
+ *	@return			whether one of them has the special bit.
+ */
+
+int CASIO_EXPORT casio_double_frommcs_array(double *dbl,
+	const casio_mcsbcd_t *raw, size_t count)
+{
+	casio_bcd_t bcd[BLOCK];
+	size_t num;
+	int special = 0;
+
+	for (; count; count -= num, raw += num, dbl += num) {
+		num = min(count, BLOCK);
+		special |= casio_bcd_frommcs_array(bcd, raw, num);
+		casio_bcd_todouble_array(dbl, bcd, num);
+	}
+
+	return (special);
+}
+
+/**
+ *	casio_double_tomcs_array:
+ *	Make MCS BCD numbers out of C-doubles.
+ *
+ *	@arg	raw		the raw BCDs.
+ *	@arg	dbl		the doubles.
+ *	@arg	count	the number of numbers.
+ */
+
+void CASIO_EXPORT casio_double_tomcs_array(casio_mcsbcd_t *raw,
+	const double *dbl, size_t count)
+{
+	casio_bcd_t bcd[BLOCK];
+	size_t num;
+
+	for (; count; count -= num, raw += num, dbl += num) {
+		num = min(count, BLOCK);
+		casio_bcd_fromdouble_array(bcd, dbl, num);
+		casio_bcd_tomcs_array(raw, bcd, num);
+	}
+}
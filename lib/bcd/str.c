@@ -89,9 +89,10 @@ size_t CASIO_EXPORT casio_bcdtoa(char *buf, size_t len, const casio_bcd_t *bcd)
 	/* get number of digits, check if zero */
 	for (; leftdigits && !digits[leftdigits - 1]; leftdigits--);
 	if (!leftdigits) {
-		int l = (len >= 2) ? 0 : 2;
-		memcpy(buf, "0", 2 - l);
-		return (len);
+		if (len < 2)
+			return (2);
+		memcpy(buf, "0", 2);
+		return (0);
 	}
 
 	/* try to play with the settings to make a more acceptable output */
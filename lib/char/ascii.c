@@ -0,0 +1,58 @@
+/* ****************************************************************************
+ * char/ascii.c -- find runs of printable ASCII characters.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#include "char.h"
+
+/* Bytes of a word: all set to 0x01, and all set to 0x80. */
+
+#define ONES  ((unsigned long)-1 / 0xFF)
+#define HIGHS (ONES * 0x80)
+
+/**
+ *	casio_fontchar_ascii:
+ *	Get the length of the run of printable ASCII characters at the
+ *	beginning of a buffer.
+ *
+ *	A word only has bytes between 0x20 and 0x7E if none of them has its
+ *	high bit set, and if adding 0x60 to each sets it for all of them while
+ *	adding 1 sets it for none of them; as the bytes are under 0x80,
+ *	the additions don't carry from one byte to the next.
+ *
+ *	@arg	buf		the buffer.
+ *	@arg	size	the buffer size.
+ *	@return			the length of the run.
+ */
+
+size_t CASIO_EXPORT casio_fontchar_ascii(const casio_uint8_t *buf,
+	size_t size)
+{
+	const casio_uint8_t *p = buf, *end = buf + size;
+	unsigned long w;
+
+	while ((size_t)(end - p) >= sizeof(w)) {
+		memcpy(&w, p, sizeof(w));
+		if ((w & HIGHS) || ((w + ONES * 0x60) & HIGHS) != HIGHS
+		 || ((w + ONES) & HIGHS))
+			break;
+		p += sizeof(w);
+	}
+
+	while (p < end && fontchar_isascii(*p))
+		p++;
+	return ((size_t)(p - buf));
+}
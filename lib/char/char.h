@@ -0,0 +1,101 @@
+/* ****************************************************************************
+ * char/char.h -- libcasio internal macros for character conversions.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#ifndef  LOCAL_CHAR_H
+# define LOCAL_CHAR_H 1
+# include "../internals.h"
+
+/* The FONTCHARACTER tables are generated out of a reference
+ * (see `tools/write-fontchar-table`), and compiled in the library.
+ *
+ * A character is looked up in two steps: its first byte gives its leader
+ * index in `casio_fontchar_leads` (0 for a single-byte character), which
+ * is the row of `casio_fontchar_table` in which to look for the last byte.
+ * The entry gives where the Unicode sequence is in each of the pools,
+ * and its length in both. Every character has one, the ones without
+ * an equivalent being in the Private Use Area; only the leaders, which
+ * aren't characters by themselves, have a length of zero. */
+
+typedef struct {
+	casio_uint16_t fontchar_entry_off32;
+	casio_uint16_t fontchar_entry_off8;
+	casio_uint8_t  fontchar_entry_len32;
+	casio_uint8_t  fontchar_entry_len8;
+} fontchar_entry_t;
+
+CASIO_EXTERN const casio_uint8_t    CASIO_EXPORT casio_fontchar_leads[256];
+CASIO_EXTERN const fontchar_entry_t CASIO_EXPORT casio_fontchar_table[][256];
+CASIO_EXTERN const casio_uint32_t   CASIO_EXPORT casio_fontchar_pool32[];
+CASIO_EXTERN const casio_uint8_t    CASIO_EXPORT casio_fontchar_pool8[];
+
+/* The other way around, characters representing a single code point
+ * are sorted by code point, to be found by binary search. */
+
+typedef struct {
+	casio_uint32_t fontchar_rev_uni;
+	casio_uint16_t fontchar_rev_code;
+} fontchar_rev_t;
+
+CASIO_EXTERN const fontchar_rev_t CASIO_EXPORT casio_fontchar_rev[];
+CASIO_EXTERN const size_t         CASIO_EXPORT casio_fontchar_nrev;
+
+/* The characters representing several code points are also in a trie,
+ * on their UTF-8 sequences, to find the longest of them at the beginning
+ * of a text. The root is the node 0, and its children are directly
+ * indexed by their byte; the children of other nodes are contiguous
+ * and sorted by byte. The code of a node is 0 if no character ends
+ * there. */
+
+typedef struct {
+	casio_uint8_t  fontchar_node_byte;
+	casio_uint8_t  fontchar_node_nchildren;
+	casio_uint16_t fontchar_node_child;
+	casio_uint16_t fontchar_node_code;
+} fontchar_node_t;
+
+CASIO_EXTERN const fontchar_node_t CASIO_EXPORT casio_fontchar_trie[];
+CASIO_EXTERN const casio_uint16_t  CASIO_EXPORT casio_fontchar_trie_root[256];
+
+/* Get the entry of a FONTCHARACTER character. */
+
+# define fontchar_entry(CASIO__CODE) \
+	(&casio_fontchar_table[casio_fontchar_leads[(CASIO__CODE) >> 8 & 0xFF]] \
+		[(CASIO__CODE) & 0xFF])
+
+/* Find the character representing a code point (-1 if there is none). */
+
+CASIO_EXTERN int CASIO_EXPORT casio_find_fontchar
+	OF((casio_uint32_t casio__uni));
+
+/* Printable ASCII characters (0x20 to 0x7E) are the same in FONTCHARACTER
+ * and in Unicode, and are most of what is converted; this gets the length
+ * of a run of them in a byte buffer, a word at a time. */
+
+# define fontchar_isascii(CASIO__C) ((CASIO__C) >= 0x20 && (CASIO__C) <= 0x7E)
+
+CASIO_EXTERN size_t CASIO_EXPORT casio_fontchar_ascii
+	OF((const casio_uint8_t *casio__buf, size_t casio__size));
+
+/* Decode an UTF-8 encoded code point; returns the sequence length,
+ * or the opposite of the error code. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_decode_utf8
+	OF((const casio_uint8_t *casio__buf, size_t casio__size,
+		casio_uint32_t *casio__uni));
+
+#endif /* LOCAL_CHAR_H */
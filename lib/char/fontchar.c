@@ -0,0 +1,130 @@
+/* ****************************************************************************
+ * char/fontchar.c -- FONTCHARACTER characters.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#include "char.h"
+
+/**
+ *	casio_is_fontchar_lead:
+ *	Check if a byte is a FONTCHARACTER leader.
+ *
+ *	@arg	code	the byte.
+ *	@return			if it is a leader.
+ */
+
+int CASIO_EXPORT casio_is_fontchar_lead(int code)
+{
+	return (code >= 0 && code <= 0xFF && casio_fontchar_leads[code] != 0);
+}
+
+/**
+ *	casio_find_fontchar:
+ *	Find the character representing a code point.
+ *
+ *	@arg	uni		the code point.
+ *	@return			the character (-1 if there is none).
+ */
+
+int CASIO_EXPORT casio_find_fontchar(casio_uint32_t uni)
+{
+	size_t lo = 0, hi = casio_fontchar_nrev, mid;
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (casio_fontchar_rev[mid].fontchar_rev_uni < uni)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo < casio_fontchar_nrev && casio_fontchar_rev[lo].fontchar_rev_uni
+	  == uni)
+		return (casio_fontchar_rev[lo].fontchar_rev_code);
+	return (-1);
+}
+
+/**
+ *	casio_fontchar_to_uni:
+ *	Get the Unicode sequence represented by a FONTCHARACTER character.
+ *
+ *	@arg	code	the character.
+ *	@arg	uni		the sequence to fill, zero-terminated
+ *					(CASIO_FONTCHAR_MULTI_MAX + 1 code points).
+ *	@return			the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_fontchar_to_uni(casio_uint16_t code,
+	casio_uint32_t *uni)
+{
+	const fontchar_entry_t *e;
+
+	if (code > 0xFF && !casio_fontchar_leads[code >> 8])
+		return (casio_error_seq);
+	e = fontchar_entry(code);
+	if (!e->fontchar_entry_len32)
+		return (casio_error_seq);
+
+	memcpy(uni, &casio_fontchar_pool32[e->fontchar_entry_off32],
+		e->fontchar_entry_len32 * sizeof(casio_uint32_t));
+	uni[e->fontchar_entry_len32] = 0;
+	return (0);
+}
+
+/**
+ *	casio_uni_to_fontchar:
+ *	Get the FONTCHARACTER character representing a Unicode sequence.
+ *
+ *	@arg	uni		the sequence, zero-terminated.
+ *	@arg	code	the character to set.
+ *	@return			the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_uni_to_fontchar(casio_uint32_t const *uni,
+	casio_uint16_t *code)
+{
+	const fontchar_entry_t *e;
+	size_t len;
+	int lead, c;
+
+	for (len = 0; uni[len]; len++);
+	if (!len)
+		return (casio_error_seq);
+	if (len == 1) {
+		if ((c = casio_find_fontchar(uni[0])) < 0)
+			return (casio_error_seq);
+		*code = (casio_uint16_t)c;
+		return (0);
+	}
+
+	/* Sequences are only in the tables, look for them there. */
+
+	for (lead = 0; lead < 256; lead++) {
+		if (lead && !casio_fontchar_leads[lead])
+			continue;
+		for (c = 0; c < 256; c++) {
+			e = &casio_fontchar_table[casio_fontchar_leads[lead]][c];
+			if (e->fontchar_entry_len32 == len
+			 && !memcmp(&casio_fontchar_pool32[e->fontchar_entry_off32], uni,
+			  len * sizeof(casio_uint32_t))) {
+				*code = (casio_uint16_t)(lead << 8 | c);
+				return (0);
+			}
+		}
+	}
+
+	return (casio_error_seq);
+}
@@ -0,0 +1,298 @@
+/* ****************************************************************************
+ * char/program.c -- tokenize and detokenize BASIC programs.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * The tokens of a program are FONTCHARACTER characters, so detokenizing
+ * is converting them to UTF-8; tokenizing is the other way around, except
+ * that the longest token is taken where several characters could be
+ * (e.g. "sin " instead of 's', 'i', 'n' and ' ').
+ *
+ * Outside of strings and comments, some tokens are written like ASCII
+ * characters (e.g. the '+' and '-' operators), and some like the variables
+ * (e.g. the 'M' unit prefix); the program characters below take
+ * precedence there, in both directions.
+ * ************************************************************************* */
+#include "char.h"
+
+/* Program characters; the unit prefixes, and the 'P' and 'C' of nPr and
+ * nCr, are written after a backslash not to be read as the variables. */
+
+struct program_char {
+	unsigned int code;
+	const char  *text;
+	size_t       len;
+};
+
+#define PC(CODE, TEXT) {(CODE), (TEXT), sizeof(TEXT) - 1}
+CASIO_LOCAL const struct program_char program_chars[] = {
+	PC(0x01, "\\f"),   PC(0x02, "\\p"),   PC(0x03, "\\n"),
+	PC(0x05, "\\m"),   PC(0x06, "\\k"),   PC(0x07, "\\M"),
+	PC(0x08, "\\G"),   PC(0x09, "\\T"),   PC(0x0A, "\\P"),
+	PC(0x0B, "\\E"),   PC(0x0D, "\n"),
+	PC(0x88, "\\nPr"), PC(0x98, "\\nCr"),
+	PC(0x89, "+"),     PC(0x99, "-"),     PC(0xA8, "^"),
+	PC(0xAB, "!"),     PC(0xCD, "r"),     PC(0x7F50, "i"),
+	{0, NULL, 0}
+};
+
+/* Contexts: strings end with a double quote or at the end of the line,
+ * comments at the end of the line. */
+
+#define CODE        0
+#define STRING      1
+#define COMMENT     2
+
+/**
+ *	find_program_code:
+ *	Find the program character of a code.
+ *
+ *	@arg	code		the code.
+ *	@return				the program character (NULL if there is none).
+ */
+
+CASIO_LOCAL const struct program_char *find_program_code(unsigned int code)
+{
+	const struct program_char *pc;
+
+	for (pc = program_chars; pc->text; pc++)
+		if (pc->code == code)
+			return (pc);
+	return (NULL);
+}
+
+/**
+ *	find_program_text:
+ *	Find the longest program character at the beginning of a text.
+ *
+ *	@arg	buf			the text.
+ *	@arg	size		the text size.
+ *	@return				the program character (NULL if there is none).
+ */
+
+CASIO_LOCAL const struct program_char *find_program_text(
+	const casio_uint8_t *buf, size_t size)
+{
+	const struct program_char *pc, *found = NULL;
+
+	for (pc = program_chars; pc->text; pc++)
+		if (pc->len <= size && (!found || pc->len > found->len)
+		 && !memcmp(buf, pc->text, pc->len))
+			found = pc;
+	return (found);
+}
+
+/**
+ *	next_context:
+ *	Get the context after a character.
+ *
+ *	@arg	ctx			the current context.
+ *	@arg	code		the character.
+ *	@return				the next context.
+ */
+
+CASIO_LOCAL int next_context(int ctx, unsigned int code)
+{
+	if (code == 0x0D || code == '\n')
+		return (CODE);
+	if (code == '"' && ctx != COMMENT)
+		return (ctx == STRING ? CODE : STRING);
+	if (code == '\'' && ctx == CODE)
+		return (COMMENT);
+	return (ctx);
+}
+
+/**
+ *	casio_detokenize:
+ *	Detokenize a BASIC program into UTF-8 text.
+ *
+ *	Programs end with a zero, which is left in the input buffer.
+ *
+ *	@arg	inbuf		the input buffer reference.
+ *	@arg	inleft		the input buffer size reference.
+ *	@arg	outbuf		the output buffer reference.
+ *	@arg	outleft		the output buffer size reference.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_detokenize(casio_uint8_t **inbuf, size_t *inleft,
+	casio_uint8_t **outbuf, size_t *outleft)
+{
+	const struct program_char *pc;
+	const casio_uint8_t *p;
+	size_t len, left;
+	unsigned int code;
+	int err, ctx = CODE;
+
+	while (1) {
+		/* Find the run of characters to convert as they are, which ends
+		 * with the zero (which can only be a single-byte character, but
+		 * can be the last byte of multi-byte ones) or a program
+		 * character. */
+
+		p = *inbuf;
+		pc = NULL;
+		for (len = 0; len < *inleft && p[len]; len += code > 0xFF ? 2 : 1) {
+			code = p[len];
+			if (casio_fontchar_leads[code] && len + 1 < *inleft)
+				code = code << 8 | p[len + 1];
+			if (ctx == CODE && (pc = find_program_code(code)))
+				break;
+			ctx = next_context(ctx, code);
+		}
+
+		left = min(len, *inleft);
+		err = casio_fontchar8_to_utf8(inbuf, &left, outbuf, outleft);
+		*inleft -= min(len, *inleft) - left;
+		if (err || !pc)
+			return (err);
+
+		/* Write the program character. */
+
+		if (*outleft < pc->len)
+			return (casio_error_write);
+		memcpy(*outbuf, pc->text, pc->len);
+		*outbuf += pc->len;
+		*outleft -= pc->len;
+		*inbuf += pc->code > 0xFF ? 2 : 1;
+		*inleft -= pc->code > 0xFF ? 2 : 1;
+		ctx = next_context(ctx, pc->code);
+	}
+}
+
+/**
+ *	find_token:
+ *	Find the longest token at the beginning of a text.
+ *
+ *	@arg	buf			the text.
+ *	@arg	size		the text size.
+ *	@arg	code		the token to set.
+ *	@return				the token length (0 if there is none).
+ */
+
+CASIO_LOCAL size_t find_token(const casio_uint8_t *buf, size_t size,
+	unsigned int *code)
+{
+	const fontchar_node_t *node, *child, *last;
+	size_t n = 0, len = 0;
+
+	if (!casio_fontchar_trie_root[buf[0]])
+		return (0);
+
+	node = &casio_fontchar_trie[casio_fontchar_trie_root[buf[0]]];
+	while (1) {
+		n++;
+		if (node->fontchar_node_code) {
+			*code = node->fontchar_node_code;
+			len = n;
+		}
+		if (n == size)
+			break;
+
+		/* Find the child with the next byte. */
+
+		child = &casio_fontchar_trie[node->fontchar_node_child];
+		last = child + node->fontchar_node_nchildren;
+		for (; child < last && child->fontchar_node_byte < buf[n]; child++);
+		if (child == last || child->fontchar_node_byte != buf[n])
+			break;
+		node = child;
+	}
+
+	return (len);
+}
+
+/**
+ *	casio_tokenize:
+ *	Tokenize UTF-8 text into a BASIC program.
+ *
+ *	Strings (between double quotes, or a double quote and the end of the
+ *	line) and comments (between a quote and the end of the line) are only
+ *	converted character by character. As tokens can be longer than one
+ *	character, the text should be tokenized whole, or by lines.
+ *
+ *	@arg	inbuf		the input buffer reference.
+ *	@arg	inleft		the input buffer size reference.
+ *	@arg	outbuf		the output buffer reference.
+ *	@arg	outleft		the output buffer size reference.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_tokenize(casio_uint8_t **inbuf, size_t *inleft,
+	casio_uint8_t **outbuf, size_t *outleft)
+{
+	const struct program_char *pc;
+	casio_uint8_t *i = *inbuf, *o = *outbuf;
+	size_t il = *inleft, ol = *outleft, len;
+	unsigned int code = 0;
+	casio_uint32_t uni;
+	int err = 0, ctx = CODE, ret;
+
+	while (il) {
+		len = 0;
+		if (ctx == CODE) {
+			/* Take the longest of the token and the program character,
+			 * the latter on a draw. */
+
+			len = find_token(i, il, &code);
+			if ((pc = find_program_text(i, il)) && pc->len >= len) {
+				code = pc->code;
+				len = pc->len;
+			}
+		}
+
+		if (!len) {
+			/* Convert the character. */
+
+			if (fontchar_isascii(*i)) {
+				code = *i;
+				len = 1;
+			} else {
+				if ((ret = casio_decode_utf8(i, il, &uni)) < 0) {
+					err = -ret;
+					break;
+				}
+				len = (size_t)ret;
+				if ((ret = casio_find_fontchar(uni)) < 0) {
+					err = casio_error_seq;
+					break;
+				}
+				code = (unsigned int)ret;
+			}
+		}
+
+		/* Write the token. */
+
+		if (ol < (code > 0xFF ? 2U : 1U)) {
+			err = casio_error_write;
+			break;
+		}
+
+		if (code > 0xFF) {
+			*o++ = (casio_uint8_t)(code >> 8);
+			ol--;
+		}
+		*o++ = (casio_uint8_t)(code & 0xFF);
+		ol--;
+		i += len;
+		il -= len;
+		ctx = next_context(ctx, code);
+	}
+
+	*inbuf = i; *inleft = il;
+	*outbuf = o; *outleft = ol;
+	return (err);
+}
@@ -0,0 +1,5233 @@
+/* ****************************************************************************
+ * char/table.c -- FONTCHARACTER conversion tables.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * This file is generated by `tools/write-fontchar-table` out of
+ * `tools/fontchar.txt`; edit the reference instead.
+ * ************************************************************************* */
+#include "char.h"
+
+/* Leaders, as indexes in the character table. */
+
+const casio_uint8_t CASIO_EXPORT casio_fontchar_leads[256] = {
+	[0x7F] = 1,
+	[0xE5] = 2,
+	[0xE6] = 3,
+	[0xE7] = 4,
+	[0xF7] = 5,
+	[0xF9] = 6,
+};
+
+/* Characters: the single-byte ones, then the ones of each leader. */
+
+const fontchar_entry_t CASIO_EXPORT casio_fontchar_table[7][256] = {
+	{ /* single-byte characters */
+		[0x00] = {   0,    0,  1,  1},
+		[0x01] = {   1,    1,  1,  1},
+		[0x02] = {   2,    2,  1,  1},
+		[0x03] = {   3,    3,  1,  1},
+		[0x04] = {   4,    4,  1,  2},
+		[0x05] = {   5,    6,  1,  1},
+		[0x06] = {   6,    7,  1,  1},
+		[0x07] = {   7,    8,  1,  1},
+		[0x08] = {   8,    9,  1,  1},
+		[0x09] = {   9,   10,  1,  1},
+		[0x0A] = {  10,   11,  1,  1},
+		[0x0B] = {  11,   12,  1,  1},
+		[0x0C] = {  12,   13,  1,  3},
+		[0x0D] = {  13,   16,  1,  1},
+		[0x0E] = {  14,   17,  1,  3},
+		[0x0F] = {  15,   20,  1,  3},
+		[0x10] = {  16,   23,  1,  3},
+		[0x11] = {  17,   26,  1,  3},
+		[0x12] = {  18,   29,  1,  3},
+		[0x13] = {  19,   32,  1,  3},
+		[0x14] = {  20,   35,  1,  4},
+		[0x15] = {  21,   39,  1,  4},
+		[0x16] = {  22,   43,  1,  4},
+		[0x17] = {  23,   47,  1,  4},
+		[0x18] = {  24,   51,  1,  4},
+		[0x19] = {  25,   55,  1,  4},
+		[0x1A] = {  26,   59,  1,  4},
+		[0x1B] = {  27,   63,  1,  4},
+		[0x1C] = {  28,   67,  1,  4},
+		[0x1D] = {  29,   71,  1,  4},
+		[0x1E] = {  30,   75,  1,  4},
+		[0x1F] = {  31,   79,  1,  4},
+		[0x20] = {  32,   83,  1,  1},
+		[0x21] = {  33,   84,  1,  1},
+		[0x22] = {  34,   85,  1,  1},
+		[0x23] = {  35,   86,  1,  1},
+		[0x24] = {  36,   87,  1,  1},
+		[0x25] = {  37,   88,  1,  1},
+		[0x26] = {  38,   89,  1,  1},
+		[0x27] = {  39,   90,  1,  1},
+		[0x28] = {  40,   91,  1,  1},
+		[0x29] = {  41,   92,  1,  1},
+		[0x2A] = {  42,   93,  1,  1},
+		[0x2B] = {  43,   94,  1,  1},
+		[0x2C] = {  44,   95,  1,  1},
+		[0x2D] = {  45,   96,  1,  1},
+		[0x2E] = {  46,   97,  1,  1},
+		[0x2F] = {  47,   98,  1,  1},
+		[0x30] = {  48,   99,  1,  1},
+		[0x31] = {  49,  100,  1,  1},
+		[0x32] = {  50,  101,  1,  1},
+		[0x33] = {  51,  102,  1,  1},
+		[0x34] = {  52,  103,  1,  1},
+		[0x35] = {  53,  104,  1,  1},
+		[0x36] = {  54,  105,  1,  1},
+		[0x37] = {  55,  106,  1,  1},
+		[0x38] = {  56,  107,  1,  1},
+		[0x39] = {  57,  108,  1,  1},
+		[0x3A] = {  58,  109,  1,  1},
+		[0x3B] = {  59,  110,  1,  1},
+		[0x3C] = {  60,  111,  1,  1},
+		[0x3D] = {  61,  112,  1,  1},
+		[0x3E] = {  62,  113,  1,  1},
+		[0x3F] = {  63,  114,  1,  1},
+		[0x40] = {  64,  115,  1,  1},
+		[0x41] = {  65,  116,  1,  1},
+		[0x42] = {  66,  117,  1,  1},
+		[0x43] = {  67,  118,  1,  1},
+		[0x44] = {  68,  119,  1,  1},
+		[0x45] = {  11,   12,  1,  1},
+		[0x46] = {  69,  120,  1,  1},
+		[0x47] = {   8,    9,  1,  1},
+		[0x48] = {  70,  121,  1,  1},
+		[0x49] = {  71,  122,  1,  1},
+		[0x4A] = {  72,  123,  1,  1},
+		[0x4B] = {  73,  124,  1,  1},
+		[0x4C] = {  74,  125,  1,  1},
+		[0x4D] = {   7,    8,  1,  1},
+		[0x4E] = {  75,  126,  1,  1},
+		[0x4F] = {  76,  127,  1,  1},
+		[0x50] = {  10,   11,  1,  1},
+		[0x51] = {  77,  128,  1,  1},
+		[0x52] = {  78,  129,  1,  1},
+		[0x53] = {  79,  130,  1,  1},
+		[0x54] = {   9,   10,  1,  1},
+		[0x55] = {  80,  131,  1,  1},
+		[0x56] = {  81,  132,  1,  1},
+		[0x57] = {  82,  133,  1,  1},
+		[0x58] = {  83,  134,  1,  1},
+		[0x59] = {  84,  135,  1,  1},
+		[0x5A] = {  85,  136,  1,  1},
+		[0x5B] = {  86,  137,  1,  1},
+		[0x5C] = {  87,  138,  1,  1},
+		[0x5D] = {  88,  139,  1,  1},
+		[0x5E] = {  89,  140,  1,  1},
+		[0x5F] = {  90,  141,  1,  1},
+		[0x60] = {  91,  142,  1,  1},
+		[0x61] = {  92,  143,  1,  1},
+		[0x62] = {  93,  144,  1,  1},
+		[0x63] = {  94,  145,  1,  1},
+		[0x64] = {  95,  146,  1,  1},
+		[0x65] = {  96,  147,  1,  1},
+		[0x66] = {   1,    1,  1,  1},
+		[0x67] = {  97,  148,  1,  1},
+		[0x68] = {  98,  149,  1,  1},
+		[0x69] = {  99,  150,  1,  1},
+		[0x6A] = { 100,  151,  1,  1},
+		[0x6B] = {   6,    7,  1,  1},
+		[0x6C] = { 101,  152,  1,  1},
+		[0x6D] = {   5,    6,  1,  1},
+		[0x6E] = {   3,    3,  1,  1},
+		[0x6F] = { 102,  153,  1,  1},
+		[0x70] = {   2,    2,  1,  1},
+		[0x71] = { 103,  154,  1,  1},
+		[0x72] = { 104,  155,  1,  1},
+		[0x73] = { 105,  156,  1,  1},
+		[0x74] = { 106,  157,  1,  1},
+		[0x75] = { 107,  158,  1,  1},
+		[0x76] = { 108,  159,  1,  1},
+		[0x77] = { 109,  160,  1,  1},
+		[0x78] = { 110,  161,  1,  1},
+		[0x79] = { 111,  162,  1,  1},
+		[0x7A] = { 112,  163,  1,  1},
+		[0x7B] = { 113,  164,  1,  1},
+		[0x7C] = { 114,  165,  1,  1},
+		[0x7D] = { 115,  166,  1,  1},
+		[0x7E] = { 116,  167,  1,  1},
+		[0x80] = { 117,  168,  4,  4},
+		[0x81] = { 121,  172,  4,  4},
+		[0x82] = { 125,  176,  4,  4},
+		[0x83] = { 129,  180,  4,  4},
+		[0x84] = { 133,  184,  1,  4},
+		[0x85] = { 134,  188,  3,  3},
+		[0x86] = { 137,  191,  1,  3},
+		[0x87] = { 138,  194,  1,  3},
+		[0x88] = {  10,   11,  1,  1},
+		[0x89] = {  43,   94,  1,  1},
+		[0x8A] = { 139,  197,  6,  6},
+		[0x8B] = { 145,  203,  1,  2},
+		[0x8C] = { 146,  205,  1,  2},
+		[0x8D] = { 147,  207,  2,  4},
+		[0x8E] = { 149,  211,  2,  2},
+		[0x8F] = { 151,  213,  3,  5},
+		[0x90] = { 154,  218,  4,  4},
+		[0x91] = { 158,  222,  6,  9},
+		[0x92] = { 164,  231,  6,  9},
+		[0x93] = { 170,  240,  6,  9},
+		[0x94] = { 176,  249,  1,  4},
+		[0x95] = { 177,  253,  4,  4},
+		[0x96] = { 181,  257,  2,  5},
+		[0x97] = { 183,  262,  4,  4},
+		[0x98] = {  67,  118,  1,  1},
+		[0x99] = {  45,   96,  1,  1},
+		[0x9A] = { 187,  266,  5,  5},
+		[0x9B] = { 192,  271,  2,  5},
+		[0x9C] = { 194,  276,  1,  2},
+		[0x9D] = { 195,  278,  1,  4},
+		[0x9E] = { 196,  282,  3,  3},
+		[0x9F] = { 199,  285,  2,  3},
+		[0xA0] = { 201,  288,  4,  4},
+		[0xA1] = { 205,  292,  5,  5},
+		[0xA2] = { 210,  297,  5,  5},
+		[0xA3] = { 215,  302,  5,  5},
+		[0xA4] = { 220,  307,  1,  4},
+		[0xA5] = { 221,  311,  2,  2},
+		[0xA6] = { 223,  313,  4,  4},
+		[0xA7] = { 227,  317,  4,  4},
+		[0xA8] = {  89,  140,  1,  1},
+		[0xA9] = { 231,  321,  1,  2},
+		[0xAA] = { 232,  323,  4,  4},
+		[0xAB] = {  33,   84,  1,  1},
+		[0xAC] = { 236,  327,  1,  3},
+		[0xAD] = { 237,  330,  1,  4},
+		[0xAE] = { 238,  334,  1,  4},
+		[0xAF] = { 239,  338,  1,  4},
+		[0xB0] = { 240,  342,  5,  5},
+		[0xB1] = { 245,  347,  7, 10},
+		[0xB2] = { 252,  357,  7, 10},
+		[0xB3] = { 259,  367,  7, 10},
+		[0xB4] = { 266,  377,  1,  4},
+		[0xB5] = { 267,  381,  1,  4},
+		[0xB6] = { 268,  385,  5,  5},
+		[0xB7] = { 273,  390,  4,  4},
+		[0xB8] = { 277,  394,  2,  5},
+		[0xB9] = { 279,  399,  1,  2},
+		[0xBA] = { 280,  401,  5,  5},
+		[0xBB] = { 285,  406,  1,  3},
+		[0xBC] = { 286,  409,  1,  4},
+		[0xBD] = { 287,  413,  1,  4},
+		[0xBE] = { 288,  417,  1,  4},
+		[0xBF] = { 289,  421,  1,  4},
+		[0xC0] = { 290,  425,  3,  3},
+		[0xC1] = { 293,  428,  5,  5},
+		[0xC2] = { 298,  433,  1,  4},
+		[0xC3] = { 299,  437,  1,  4},
+		[0xC4] = { 300,  441,  1,  4},
+		[0xC5] = { 301,  445,  1,  4},
+		[0xC6] = { 302,  449,  1,  4},
+		[0xC7] = { 303,  453,  1,  4},
+		[0xC8] = { 304,  457,  1,  4},
+		[0xC9] = { 305,  461,  1,  4},
+		[0xCA] = { 306,  465,  1,  4},
+		[0xCB] = { 307,  469,  1,  4},
+		[0xCC] = { 308,  473,  1,  4},
+		[0xCD] = { 104,  155,  1,  1},
+		[0xCE] = { 309,  477,  1,  2},
+		[0xCF] = { 310,  479,  1,  4},
+		[0xD0] = { 311,  483,  1,  2},
+		[0xD1] = { 312,  485,  3,  3},
+		[0xD2] = { 315,  488,  1,  4},
+		[0xD3] = { 316,  492,  3,  3},
+		[0xD4] = { 319,  495,  3,  3},
+		[0xD5] = { 322,  498,  3,  3},
+		[0xD6] = { 325,  501,  3,  3},
+		[0xD7] = { 328,  504,  3,  3},
+		[0xD8] = { 331,  507,  1,  4},
+		[0xD9] = { 332,  511,  4,  4},
+		[0xDA] = { 336,  515,  3,  3},
+		[0xDB] = { 339,  518,  3,  3},
+		[0xDC] = { 342,  521,  3,  3},
+		[0xDD] = { 345,  524,  3,  3},
+		[0xDE] = { 348,  527,  5,  5},
+		[0xDF] = { 353,  532,  1,  4},
+		[0xE0] = { 354,  536,  5,  5},
+		[0xE1] = { 359,  541,  4,  4},
+		[0xE2] = { 363,  545,  4,  4},
+		[0xE3] = { 367,  549,  4,  4},
+		[0xE4] = { 371,  553,  4,  4},
+		[0xE8] = { 375,  557,  4,  4},
+		[0xE9] = { 379,  561,  4,  4},
+		[0xEA] = { 383,  565,  7,  7},
+		[0xEB] = { 390,  572, 11, 11},
+		[0xEC] = { 401,  583,  5,  5},
+		[0xED] = { 406,  588,  5,  5},
+		[0xEE] = { 411,  593,  8,  8},
+		[0xEF] = { 419,  601,  7,  9},
+		[0xF0] = { 426,  610,  8,  8},
+		[0xF1] = { 434,  618,  8,  8},
+		[0xF2] = { 442,  626,  8, 10},
+		[0xF3] = { 450,  636,  8, 10},
+		[0xF4] = { 458,  646,  8,  8},
+		[0xF5] = { 466,  654, 12, 12},
+		[0xF6] = { 478,  666,  1,  4},
+		[0xF8] = { 479,  670,  1,  4},
+		[0xFA] = { 480,  674,  1,  4},
+		[0xFB] = { 481,  678,  2,  2},
+		[0xFC] = { 483,  680,  2,  2},
+		[0xFD] = { 485,  682,  2,  2},
+		[0xFE] = { 487,  684,  2,  2},
+		[0xFF] = { 489,  686,  1,  4},
+	},
+	{ /* leader 0x7F */
+		[0x00] = { 490,  690,  4,  4},
+		[0x01] = { 494,  694,  4,  4},
+		[0x02] = { 498,  698,  4,  4},
+		[0x03] = { 502,  702,  1,  4},
+		[0x04] = { 503,  706,  4,  4},
+		[0x05] = { 507,  710,  4,  4},
+		[0x06] = { 511,  714,  4,  4},
+		[0x07] = { 515,  718,  1,  4},
+		[0x08] = { 516,  722,  5,  6},
+		[0x09] = { 521,  728,  5,  6},
+		[0x0A] = { 526,  734,  6,  7},
+		[0x0B] = { 532,  741,  4,  4},
+		[0x0C] = { 536,  745,  4,  4},
+		[0x0D] = { 540,  749,  7,  7},
+		[0x0E] = { 547,  756,  5,  5},
+		[0x0F] = { 552,  761,  7,  7},
+		[0x10] = { 559,  768,  9,  9},
+		[0x11] = { 568,  777,  9,  9},
+		[0x12] = { 577,  786,  9,  9},
+		[0x13] = { 586,  795,  1,  4},
+		[0x14] = { 587,  799,  9,  9},
+		[0x15] = { 596,  808,  9,  9},
+		[0x16] = { 605,  817,  9,  9},
+		[0x17] = { 614,  826,  1,  4},
+		[0x18] = { 615,  830, 10, 11},
+		[0x19] = { 625,  841, 10, 11},
+		[0x1A] = { 635,  852, 11, 12},
+		[0x1B] = { 646,  864,  1,  4},
+		[0x1C] = { 647,  868,  1,  4},
+		[0x1D] = { 648,  872,  1,  4},
+		[0x1E] = { 649,  876,  1,  4},
+		[0x1F] = { 650,  880,  1,  4},
+		[0x20] = { 651,  884,  4,  4},
+		[0x21] = { 655,  888,  4,  4},
+		[0x22] = { 659,  892,  4,  4},
+		[0x23] = { 663,  896,  6,  6},
+		[0x24] = { 669,  902,  4,  4},
+		[0x25] = { 673,  906,  4,  4},
+		[0x26] = { 677,  910,  5,  5},
+		[0x27] = { 682,  915,  7,  9},
+		[0x28] = { 689,  924,  6,  6},
+		[0x29] = { 695,  930,  2,  3},
+		[0x2A] = { 697,  933,  5,  5},
+		[0x2B] = { 702,  938,  5,  5},
+		[0x2C] = { 707,  943,  4,  4},
+		[0x2D] = { 711,  947,  4,  4},
+		[0x2E] = { 715,  951,  5,  5},
+		[0x2F] = { 720,  956,  7,  7},
+		[0x30] = { 727,  963,  1,  4},
+		[0x31] = { 728,  967,  1,  4},
+		[0x32] = { 729,  971,  1,  4},
+		[0x33] = { 730,  975,  1,  4},
+		[0x34] = { 731,  979,  1,  4},
+		[0x35] = { 732,  983,  1,  4},
+		[0x36] = { 733,  987,  1,  4},
+		[0x37] = { 734,  991,  1,  4},
+		[0x38] = { 735,  995,  1,  4},
+		[0x39] = { 736,  999,  1,  4},
+		[0x3A] = { 737, 1003,  4,  4},
+		[0x3B] = { 741, 1007,  8,  8},
+		[0x3C] = { 749, 1015,  4,  4},
+		[0x3D] = { 753, 1019,  4,  4},
+		[0x3E] = { 757, 1023,  1,  4},
+		[0x3F] = { 758, 1027,  1,  4},
+		[0x40] = { 759, 1031,  4,  4},
+		[0x41] = { 763, 1035,  4,  4},
+		[0x42] = { 767, 1039,  5,  5},
+		[0x43] = { 772, 1044,  6,  6},
+		[0x44] = { 778, 1050,  5,  5},
+		[0x45] = { 783, 1055,  5,  5},
+		[0x46] = { 788, 1060,  4,  4},
+		[0x47] = { 792, 1064,  5,  5},
+		[0x48] = { 797, 1069,  9,  9},
+		[0x49] = { 806, 1078,  8,  8},
+		[0x4A] = { 814, 1086,  9, 11},
+		[0x4B] = { 823, 1097,  9, 11},
+		[0x4C] = { 832, 1108,  4,  4},
+		[0x4D] = { 836, 1112,  5,  5},
+		[0x4E] = { 841, 1117,  8,  8},
+		[0x4F] = { 849, 1125,  5,  5},
+		[0x50] = {  99,  150,  1,  1},
+		[0x51] = { 854, 1130,  5,  5},
+		[0x52] = { 859, 1135,  6,  7},
+		[0x53] = { 865, 1142,  1,  4},
+		[0x54] = { 866, 1146,  1,  3},
+		[0x55] = { 867, 1149,  1,  4},
+		[0x56] = { 868, 1153,  1,  4},
+		[0x57] = { 869, 1157,  1,  4},
+		[0x58] = { 870, 1161,  1,  4},
+		[0x59] = { 871, 1165,  1,  4},
+		[0x5A] = { 872, 1169,  1,  4},
+		[0x5B] = { 873, 1173,  1,  4},
+		[0x5C] = { 874, 1177,  1,  4},
+		[0x5D] = { 875, 1181,  1,  4},
+		[0x5E] = { 876, 1185,  1,  4},
+		[0x5F] = { 877, 1189,  1,  4},
+		[0x60] = { 878, 1193,  1,  4},
+		[0x61] = { 879, 1197,  1,  4},
+		[0x62] = { 880, 1201,  1,  4},
+		[0x63] = { 881, 1205,  1,  4},
+		[0x64] = { 882, 1209,  1,  4},
+		[0x65] = { 883, 1213,  1,  4},
+		[0x66] = { 884, 1217,  1,  4},
+		[0x67] = { 885, 1221,  1,  4},
+		[0x68] = { 886, 1225,  1,  4},
+		[0x69] = { 887, 1229,  1,  4},
+		[0x6A] = { 888, 1233,  1,  4},
+		[0x6B] = { 889, 1237,  1,  4},
+		[0x6C] = { 890, 1241,  1,  4},
+		[0x6D] = { 891, 1245,  1,  4},
+		[0x6E] = { 892, 1249,  1,  4},
+		[0x6F] = { 893, 1253,  1,  4},
+		[0x70] = { 894, 1257,  1,  4},
+		[0x71] = { 895, 1261,  1,  4},
+		[0x72] = { 896, 1265,  1,  4},
+		[0x73] = { 897, 1269,  1,  4},
+		[0x74] = { 898, 1273,  1,  4},
+		[0x75] = { 899, 1277,  1,  4},
+		[0x76] = { 900, 1281,  1,  4},
+		[0x77] = { 901, 1285,  1,  4},
+		[0x78] = { 902, 1289,  1,  4},
+		[0x79] = { 903, 1293,  1,  4},
+		[0x7A] = { 904, 1297,  1,  4},
+		[0x7B] = { 905, 1301,  1,  4},
+		[0x7C] = { 906, 1305,  1,  4},
+		[0x7D] = { 907, 1309,  1,  4},
+		[0x7E] = { 908, 1313,  1,  4},
+		[0x7F] = { 909, 1317,  1,  4},
+		[0x80] = { 910, 1321,  1,  4},
+		[0x81] = { 911, 1325,  1,  4},
+		[0x82] = { 912, 1329,  1,  4},
+		[0x83] = { 913, 1333,  1,  4},
+		[0x84] = { 914, 1337,  1,  4},
+		[0x85] = { 915, 1341,  1,  4},
+		[0x86] = { 916, 1345,  7,  7},
+		[0x87] = { 923, 1352,  8,  8},
+		[0x88] = { 931, 1360,  9,  9},
+		[0x89] = { 940, 1369,  8,  8},
+		[0x8A] = { 948, 1377,  9,  9},
+		[0x8B] = { 957, 1386,  1,  4},
+		[0x8C] = { 958, 1390,  1,  4},
+		[0x8D] = { 959, 1394,  1,  4},
+		[0x8E] = { 960, 1398,  1,  4},
+		[0x8F] = { 961, 1402,  6,  6},
+		[0x90] = { 967, 1408,  1,  4},
+		[0x91] = { 968, 1412,  1,  4},
+		[0x92] = { 969, 1416,  1,  4},
+		[0x93] = { 970, 1420,  1,  4},
+		[0x94] = { 971, 1424,  1,  4},
+		[0x95] = { 972, 1428,  1,  4},
+		[0x96] = { 973, 1432,  1,  4},
+		[0x97] = { 974, 1436,  1,  4},
+		[0x98] = { 975, 1440,  1,  4},
+		[0x99] = { 976, 1444,  1,  4},
+		[0x9A] = { 977, 1448,  1,  4},
+		[0x9B] = { 978, 1452,  1,  4},
+		[0x9C] = { 979, 1456,  1,  4},
+		[0x9D] = { 980, 1460,  1,  4},
+		[0x9E] = { 981, 1464,  1,  4},
+		[0x9F] = { 982, 1468,  1,  4},
+		[0xA0] = { 983, 1472,  1,  4},
+		[0xA1] = { 984, 1476,  1,  4},
+		[0xA2] = { 985, 1480,  1,  4},
+		[0xA3] = { 986, 1484,  1,  4},
+		[0xA4] = { 987, 1488,  1,  4},
+		[0xA5] = { 988, 1492,  1,  4},
+		[0xA6] = { 989, 1496,  1,  4},
+		[0xA7] = { 990, 1500,  1,  4},
+		[0xA8] = { 991, 1504,  1,  4},
+		[0xA9] = { 992, 1508,  1,  4},
+		[0xAA] = { 993, 1512,  1,  4},
+		[0xAB] = { 994, 1516,  1,  4},
+		[0xAC] = { 995, 1520,  1,  4},
+		[0xAD] = { 996, 1524,  1,  4},
+		[0xAE] = { 997, 1528,  1,  4},
+		[0xAF] = { 998, 1532,  1,  4},
+		[0xB0] = { 999, 1536,  1,  4},
+		[0xB1] = {1000, 1540,  4,  4},
+		[0xB2] = {1004, 1544,  1,  4},
+		[0xB3] = { 227,  317,  4,  4},
+		[0xB4] = {1005, 1548,  5,  5},
+		[0xB5] = {1010, 1553,  1,  4},
+		[0xB6] = {1011, 1557,  1,  4},
+		[0xB7] = {1012, 1561,  1,  4},
+		[0xB8] = {1013, 1565,  1,  4},
+		[0xB9] = {1014, 1569,  1,  4},
+		[0xBA] = {1015, 1573,  1,  4},
+		[0xBB] = {1016, 1577,  1,  4},
+		[0xBC] = {1017, 1581,  6,  7},
+		[0xBD] = {1023, 1588,  6,  6},
+		[0xBE] = {1029, 1594,  1,  4},
+		[0xBF] = {1030, 1598,  1,  4},
+		[0xC0] = {1031, 1602,  1,  4},
+		[0xC1] = {1032, 1606,  1,  4},
+		[0xC2] = {1033, 1610,  1,  4},
+		[0xC3] = {1034, 1614,  1,  4},
+		[0xC4] = {1035, 1618,  1,  4},
+		[0xC5] = {1036, 1622,  1,  4},
+		[0xC6] = {1037, 1626,  1,  4},
+		[0xC7] = {1038, 1630,  1,  4},
+		[0xC8] = {1039, 1634,  1,  4},
+		[0xC9] = {1040, 1638,  1,  4},
+		[0xCA] = {1041, 1642,  1,  4},
+		[0xCB] = {1042, 1646,  1,  4},
+		[0xCC] = {1043, 1650,  1,  4},
+		[0xCD] = {1044, 1654,  1,  4},
+		[0xCE] = {1045, 1658,  1,  4},
+		[0xCF] = {1046, 1662,  1,  4},
+		[0xD0] = {1047, 1666,  1,  4},
+		[0xD1] = {1048, 1670,  1,  4},
+		[0xD2] = {1049, 1674,  1,  4},
+		[0xD3] = {1050, 1678,  1,  4},
+		[0xD4] = {1051, 1682,  1,  4},
+		[0xD5] = {1052, 1686,  1,  4},
+		[0xD6] = {1053, 1690,  1,  4},
+		[0xD7] = {1054, 1694,  1,  4},
+		[0xD8] = {1055, 1698,  1,  4},
+		[0xD9] = {1056, 1702,  1,  4},
+		[0xDA] = {1057, 1706,  1,  4},
+		[0xDB] = {1058, 1710,  1,  4},
+		[0xDC] = {1059, 1714,  1,  4},
+		[0xDD] = {1060, 1718,  1,  4},
+		[0xDE] = {1061, 1722,  1,  4},
+		[0xDF] = {1062, 1726,  1,  4},
+		[0xE0] = {1063, 1730,  1,  4},
+		[0xE1] = {1064, 1734,  1,  4},
+		[0xE2] = {1065, 1738,  1,  4},
+		[0xE3] = {1066, 1742,  1,  4},
+		[0xE4] = {1067, 1746,  1,  4},
+		[0xE5] = {1068, 1750,  1,  4},
+		[0xE6] = {1069, 1754,  1,  4},
+		[0xE7] = {1070, 1758,  1,  4},
+		[0xE8] = {1071, 1762,  1,  4},
+		[0xE9] = {1072, 1766,  1,  4},
+		[0xEA] = {1073, 1770,  1,  4},
+		[0xEB] = {1074, 1774,  1,  4},
+		[0xEC] = {1075, 1778,  1,  4},
+		[0xED] = {1076, 1782,  1,  4},
+		[0xEE] = {1077, 1786,  1,  4},
+		[0xEF] = {1078, 1790,  1,  4},
+		[0xF0] = {1079, 1794,  1,  4},
+		[0xF1] = {1080, 1798,  1,  4},
+		[0xF2] = {1081, 1802,  1,  4},
+		[0xF3] = {1082, 1806,  1,  4},
+		[0xF4] = {1083, 1810,  1,  4},
+		[0xF5] = {1084, 1814,  1,  4},
+		[0xF6] = {1085, 1818,  1,  4},
+		[0xF7] = {1086, 1822,  1,  4},
+		[0xF8] = {1087, 1826,  1,  4},
+		[0xF9] = {1088, 1830,  1,  4},
+		[0xFA] = {1089, 1834,  1,  4},
+		[0xFB] = {1090, 1838,  1,  4},
+		[0xFC] = {1091, 1842,  1,  4},
+		[0xFD] = {1092, 1846,  1,  4},
+		[0xFE] = {1093, 1850,  1,  4},
+		[0xFF] = {1094, 1854,  1,  4},
+	},
+	{ /* leader 0xE5 */
+		[0x00] = {1095, 1858,  1,  4},
+		[0x01] = {1096, 1862,  1,  4},
+		[0x02] = {1097, 1866,  1,  4},
+		[0x03] = {1098, 1870,  1,  4},
+		[0x04] = {1099, 1874,  1,  4},
+		[0x05] = {1100, 1878,  1,  4},
+		[0x06] = {1101, 1882,  1,  4},
+		[0x07] = {1102, 1886,  1,  4},
+		[0x08] = {1103, 1890,  1,  4},
+		[0x09] = {1104, 1894,  1,  4},
+		[0x0A] = {1105, 1898,  1,  4},
+		[0x0B] = {1106, 1902,  1,  4},
+		[0x0C] = {1107, 1906,  1,  4},
+		[0x0D] = {1108, 1910,  1,  4},
+		[0x0E] = {1109, 1914,  1,  4},
+		[0x0F] = {1110, 1918,  1,  4},
+		[0x10] = {1111, 1922,  1,  4},
+		[0x11] = {1112, 1926,  1,  4},
+		[0x12] = {1113, 1930,  1,  4},
+		[0x13] = {1114, 1934,  1,  4},
+		[0x14] = {1115, 1938,  1,  4},
+		[0x15] = {1116, 1942,  1,  4},
+		[0x16] = {1117, 1946,  1,  4},
+		[0x17] = {1118, 1950,  1,  4},
+		[0x18] = {1119, 1954,  1,  4},
+		[0x19] = {1120, 1958,  1,  4},
+		[0x1A] = {1121, 1962,  1,  4},
+		[0x1B] = {1122, 1966,  1,  4},
+		[0x1C] = {1123, 1970,  1,  4},
+		[0x1D] = {1124, 1974,  1,  4},
+		[0x1E] = {1125, 1978,  1,  4},
+		[0x1F] = {1126, 1982,  1,  4},
+		[0x20] = {1127, 1986,  1,  4},
+		[0x21] = {1128, 1990,  1,  4},
+		[0x22] = {1129, 1994,  1,  4},
+		[0x23] = {1130, 1998,  1,  4},
+		[0x24] = {1131, 2002,  1,  4},
+		[0x25] = {1132, 2006,  1,  4},
+		[0x26] = {1133, 2010,  1,  4},
+		[0x27] = {1134, 2014,  1,  4},
+		[0x28] = {1135, 2018,  1,  4},
+		[0x29] = {1136, 2022,  1,  4},
+		[0x2A] = {1137, 2026,  1,  4},
+		[0x2B] = {1138, 2030,  1,  4},
+		[0x2C] = {1139, 2034,  1,  4},
+		[0x2D] = {1140, 2038,  1,  4},
+		[0x2E] = {1141, 2042,  1,  4},
+		[0x2F] = {1142, 2046,  1,  4},
+		[0x30] = {1143, 2050,  1,  4},
+		[0x31] = {1144, 2054,  1,  4},
+		[0x32] = {1145, 2058,  1,  4},
+		[0x33] = {1146, 2062,  1,  4},
+		[0x34] = {1147, 2066,  1,  4},
+		[0x35] = {1148, 2070,  1,  4},
+		[0x36] = {1149, 2074,  1,  4},
+		[0x37] = {1150, 2078,  1,  4},
+		[0x38] = {1151, 2082,  1,  4},
+		[0x39] = {1152, 2086,  1,  4},
+		[0x3A] = {1153, 2090,  1,  4},
+		[0x3B] = {1154, 2094,  1,  4},
+		[0x3C] = {1155, 2098,  1,  4},
+		[0x3D] = {1156, 2102,  1,  4},
+		[0x3E] = {1157, 2106,  1,  4},
+		[0x3F] = {1158, 2110,  1,  4},
+		[0x40] = {1159, 2114,  1,  4},
+		[0x41] = {1160, 2118,  1,  4},
+		[0x42] = {1161, 2122,  1,  4},
+		[0x43] = {1162, 2126,  1,  4},
+		[0x44] = {1163, 2130,  1,  4},
+		[0x45] = {1164, 2134,  1,  4},
+		[0x46] = {1165, 2138,  1,  4},
+		[0x47] = {1166, 2142,  1,  4},
+		[0x48] = {1167, 2146,  1,  4},
+		[0x49] = {1168, 2150,  1,  4},
+		[0x4A] = {1169, 2154,  1,  4},
+		[0x4B] = {1170, 2158,  1,  4},
+		[0x4C] = {1171, 2162,  1,  4},
+		[0x4D] = {1172, 2166,  1,  4},
+		[0x4E] = {1173, 2170,  1,  4},
+		[0x4F] = {1174, 2174,  1,  4},
+		[0x50] = {1175, 2178,  1,  4},
+		[0x51] = {1176, 2182,  1,  4},
+		[0x52] = {1177, 2186,  1,  4},
+		[0x53] = {1178, 2190,  1,  4},
+		[0x54] = {1179, 2194,  1,  4},
+		[0x55] = {1180, 2198,  1,  4},
+		[0x56] = {1181, 2202,  1,  4},
+		[0x57] = {1182, 2206,  1,  4},
+		[0x58] = {1183, 2210,  1,  4},
+		[0x59] = {1184, 2214,  1,  4},
+		[0x5A] = {1185, 2218,  1,  4},
+		[0x5B] = {1186, 2222,  1,  4},
+		[0x5C] = {1187, 2226,  1,  4},
+		[0x5D] = {1188, 2230,  1,  4},
+		[0x5E] = {1189, 2234,  1,  4},
+		[0x5F] = {1190, 2238,  1,  4},
+		[0x60] = {1191, 2242,  1,  4},
+		[0x61] = {1192, 2246,  1,  4},
+		[0x62] = {1193, 2250,  1,  4},
+		[0x63] = {1194, 2254,  1,  4},
+		[0x64] = {1195, 2258,  1,  4},
+		[0x65] = {1196, 2262,  1,  4},
+		[0x66] = {1197, 2266,  1,  4},
+		[0x67] = {1198, 2270,  1,  4},
+		[0x68] = {1199, 2274,  1,  4},
+		[0x69] = {1200, 2278,  1,  4},
+		[0x6A] = {1201, 2282,  1,  4},
+		[0x6B] = {1202, 2286,  1,  4},
+		[0x6C] = {1203, 2290,  1,  4},
+		[0x6D] = {1204, 2294,  1,  4},
+		[0x6E] = {1205, 2298,  1,  4},
+		[0x6F] = {1206, 2302,  1,  4},
+		[0x70] = {1207, 2306,  1,  4},
+		[0x71] = {1208, 2310,  1,  4},
+		[0x72] = {1209, 2314,  1,  4},
+		[0x73] = {1210, 2318,  1,  4},
+		[0x74] = {1211, 2322,  1,  4},
+		[0x75] = {1212, 2326,  1,  4},
+		[0x76] = {1213, 2330,  1,  4},
+		[0x77] = {1214, 2334,  1,  4},
+		[0x78] = {1215, 2338,  1,  4},
+		[0x79] = {1216, 2342,  1,  4},
+		[0x7A] = {1217, 2346,  1,  4},
+		[0x7B] = {1218, 2350,  1,  4},
+		[0x7C] = {1219, 2354,  1,  4},
+		[0x7D] = {1220, 2358,  1,  4},
+		[0x7E] = {1221, 2362,  1,  4},
+		[0x7F] = {1222, 2366,  1,  4},
+		[0x80] = {1223, 2370,  1,  4},
+		[0x81] = {1224, 2374,  1,  4},
+		[0x82] = {1225, 2378,  1,  4},
+		[0x83] = {1226, 2382,  1,  4},
+		[0x84] = {1227, 2386,  1,  4},
+		[0x85] = {1228, 2390,  1,  4},
+		[0x86] = {1229, 2394,  1,  4},
+		[0x87] = {1230, 2398,  1,  4},
+		[0x88] = {1231, 2402,  1,  4},
+		[0x89] = {1232, 2406,  1,  4},
+		[0x8A] = {1233, 2410,  1,  4},
+		[0x8B] = {1234, 2414,  1,  4},
+		[0x8C] = {1235, 2418,  1,  4},
+		[0x8D] = {1236, 2422,  1,  4},
+		[0x8E] = {1237, 2426,  1,  4},
+		[0x8F] = {1238, 2430,  1,  4},
+		[0x90] = {1239, 2434,  1,  4},
+		[0x91] = {1240, 2438,  1,  4},
+		[0x92] = {1241, 2442,  1,  4},
+		[0x93] = {1242, 2446,  1,  4},
+		[0x94] = {1243, 2450,  1,  4},
+		[0x95] = {1244, 2454,  1,  4},
+		[0x96] = {1245, 2458,  1,  4},
+		[0x97] = {1246, 2462,  1,  4},
+		[0x98] = {1247, 2466,  1,  4},
+		[0x99] = {1248, 2470,  1,  4},
+		[0x9A] = {1249, 2474,  1,  4},
+		[0x9B] = {1250, 2478,  1,  4},
+		[0x9C] = {1251, 2482,  1,  4},
+		[0x9D] = {1252, 2486,  1,  4},
+		[0x9E] = {1253, 2490,  1,  4},
+		[0x9F] = {1254, 2494,  1,  4},
+		[0xA0] = {1255, 2498,  1,  4},
+		[0xA1] = {1256, 2502,  1,  4},
+		[0xA2] = {1257, 2506,  1,  4},
+		[0xA3] = {1258, 2510,  1,  4},
+		[0xA4] = {1259, 2514,  1,  4},
+		[0xA5] = {1260, 2518,  1,  4},
+		[0xA6] = {1261, 2522,  1,  4},
+		[0xA7] = {1262, 2526,  1,  4},
+		[0xA8] = {1263, 2530,  1,  4},
+		[0xA9] = {1264, 2534,  1,  4},
+		[0xAA] = {1265, 2538,  1,  4},
+		[0xAB] = {1266, 2542,  1,  4},
+		[0xAC] = {1267, 2546,  1,  4},
+		[0xAD] = {1268, 2550,  1,  4},
+		[0xAE] = {1269, 2554,  1,  4},
+		[0xAF] = {1270, 2558,  1,  4},
+		[0xB0] = {1271, 2562,  1,  4},
+		[0xB1] = {1272, 2566,  1,  4},
+		[0xB2] = {1273, 2570,  1,  4},
+		[0xB3] = {1274, 2574,  1,  4},
+		[0xB4] = {1275, 2578,  1,  4},
+		[0xB5] = {1276, 2582,  1,  4},
+		[0xB6] = {1277, 2586,  1,  4},
+		[0xB7] = {1278, 2590,  1,  4},
+		[0xB8] = {1279, 2594,  1,  4},
+		[0xB9] = {1280, 2598,  1,  4},
+		[0xBA] = {1281, 2602,  1,  4},
+		[0xBB] = {1282, 2606,  1,  4},
+		[0xBC] = {1283, 2610,  1,  4},
+		[0xBD] = {1284, 2614,  1,  4},
+		[0xBE] = {1285, 2618,  1,  4},
+		[0xBF] = {1286, 2622,  1,  4},
+		[0xC0] = {1287, 2626,  1,  4},
+		[0xC1] = {1288, 2630,  1,  4},
+		[0xC2] = {1289, 2634,  1,  4},
+		[0xC3] = {1290, 2638,  1,  4},
+		[0xC4] = {1291, 2642,  1,  4},
+		[0xC5] = {1292, 2646,  1,  4},
+		[0xC6] = {1293, 2650,  1,  4},
+		[0xC7] = {1294, 2654,  1,  4},
+		[0xC8] = {1295, 2658,  1,  4},
+		[0xC9] = {1296, 2662,  1,  4},
+		[0xCA] = {1297, 2666,  1,  4},
+		[0xCB] = {1298, 2670,  1,  4},
+		[0xCC] = {1299, 2674,  1,  4},
+		[0xCD] = {1300, 2678,  1,  4},
+		[0xCE] = {1301, 2682,  1,  4},
+		[0xCF] = {1302, 2686,  1,  4},
+		[0xD0] = {1303, 2690,  1,  4},
+		[0xD1] = {1304, 2694,  1,  4},
+		[0xD2] = {1305, 2698,  1,  4},
+		[0xD3] = {1306, 2702,  1,  4},
+		[0xD4] = {1307, 2706,  1,  4},
+		[0xD5] = {1308, 2710,  1,  4},
+		[0xD6] = {1309, 2714,  1,  4},
+		[0xD7] = {1310, 2718,  1,  4},
+		[0xD8] = {1311, 2722,  1,  4},
+		[0xD9] = {1312, 2726,  1,  4},
+		[0xDA] = {1313, 2730,  1,  4},
+		[0xDB] = {1314, 2734,  1,  4},
+		[0xDC] = {1315, 2738,  1,  4},
+		[0xDD] = {1316, 2742,  1,  4},
+		[0xDE] = {1317, 2746,  1,  4},
+		[0xDF] = {1318, 2750,  1,  4},
+		[0xE0] = {1319, 2754,  1,  4},
+		[0xE1] = {1320, 2758,  1,  4},
+		[0xE2] = {1321, 2762,  1,  4},
+		[0xE3] = {1322, 2766,  1,  4},
+		[0xE4] = {1323, 2770,  1,  4},
+		[0xE5] = {1324, 2774,  1,  4},
+		[0xE6] = {1325, 2778,  1,  4},
+		[0xE7] = {1326, 2782,  1,  4},
+		[0xE8] = {1327, 2786,  1,  4},
+		[0xE9] = {1328, 2790,  1,  4},
+		[0xEA] = {1329, 2794,  1,  4},
+		[0xEB] = {1330, 2798,  1,  4},
+		[0xEC] = {1331, 2802,  1,  4},
+		[0xED] = {1332, 2806,  1,  4},
+		[0xEE] = {1333, 2810,  1,  4},
+		[0xEF] = {1334, 2814,  1,  4},
+		[0xF0] = {1335, 2818,  1,  4},
+		[0xF1] = {1336, 2822,  1,  4},
+		[0xF2] = {1337, 2826,  1,  4},
+		[0xF3] = {1338, 2830,  1,  4},
+		[0xF4] = {1339, 2834,  1,  4},
+		[0xF5] = {1340, 2838,  1,  4},
+		[0xF6] = {1341, 2842,  1,  4},
+		[0xF7] = {1342, 2846,  1,  4},
+		[0xF8] = {1343, 2850,  1,  4},
+		[0xF9] = {1344, 2854,  1,  4},
+		[0xFA] = {1345, 2858,  1,  4},
+		[0xFB] = {1346, 2862,  1,  4},
+		[0xFC] = {1347, 2866,  1,  4},
+		[0xFD] = {1348, 2870,  1,  4},
+		[0xFE] = {1349, 2874,  1,  4},
+		[0xFF] = {1350, 2878,  1,  4},
+	},
+	{ /* leader 0xE6 */
+		[0x00] = {1351, 2882,  1,  4},
+		[0x01] = {1352, 2886,  1,  4},
+		[0x02] = {1353, 2890,  1,  4},
+		[0x03] = {1354, 2894,  1,  4},
+		[0x04] = {1355, 2898,  1,  4},
+		[0x05] = {1356, 2902,  1,  4},
+		[0x06] = {1357, 2906,  1,  4},
+		[0x07] = {1358, 2910,  1,  4},
+		[0x08] = {1359, 2914,  1,  4},
+		[0x09] = {1360, 2918,  1,  4},
+		[0x0A] = {1361, 2922,  1,  4},
+		[0x0B] = {1362, 2926,  1,  4},
+		[0x0C] = {1363, 2930,  1,  4},
+		[0x0D] = {1364, 2934,  1,  4},
+		[0x0E] = {1365, 2938,  1,  4},
+		[0x0F] = {1366, 2942,  1,  4},
+		[0x10] = {1367, 2946,  1,  4},
+		[0x11] = {1368, 2950,  1,  4},
+		[0x12] = {1369, 2954,  1,  4},
+		[0x13] = {1370, 2958,  1,  4},
+		[0x14] = {1371, 2962,  1,  4},
+		[0x15] = {1372, 2966,  1,  4},
+		[0x16] = {1373, 2970,  1,  4},
+		[0x17] = {1374, 2974,  1,  4},
+		[0x18] = {1375, 2978,  1,  4},
+		[0x19] = {1376, 2982,  1,  4},
+		[0x1A] = {1377, 2986,  1,  4},
+		[0x1B] = {1378, 2990,  1,  4},
+		[0x1C] = {1379, 2994,  1,  4},
+		[0x1D] = {1380, 2998,  1,  4},
+		[0x1E] = {1381, 3002,  1,  4},
+		[0x1F] = {1382, 3006,  1,  4},
+		[0x20] = {1383, 3010,  1,  4},
+		[0x21] = {1384, 3014,  1,  4},
+		[0x22] = {1385, 3018,  1,  4},
+		[0x23] = {1386, 3022,  1,  4},
+		[0x24] = {1387, 3026,  1,  4},
+		[0x25] = {1388, 3030,  1,  4},
+		[0x26] = {1389, 3034,  1,  4},
+		[0x27] = {1390, 3038,  1,  4},
+		[0x28] = {1391, 3042,  1,  4},
+		[0x29] = {1392, 3046,  1,  4},
+		[0x2A] = {1393, 3050,  1,  4},
+		[0x2B] = {1394, 3054,  1,  4},
+		[0x2C] = {1395, 3058,  1,  4},
+		[0x2D] = {1396, 3062,  1,  4},
+		[0x2E] = {1397, 3066,  1,  4},
+		[0x2F] = {1398, 3070,  1,  4},
+		[0x30] = {1399, 3074,  1,  4},
+		[0x31] = {1400, 3078,  1,  4},
+		[0x32] = {1401, 3082,  1,  4},
+		[0x33] = {1402, 3086,  1,  4},
+		[0x34] = {1403, 3090,  1,  4},
+		[0x35] = {1404, 3094,  1,  4},
+		[0x36] = {1405, 3098,  1,  4},
+		[0x37] = {1406, 3102,  1,  4},
+		[0x38] = {1407, 3106,  1,  4},
+		[0x39] = {1408, 3110,  1,  4},
+		[0x3A] = {1409, 3114,  1,  4},
+		[0x3B] = {1410, 3118,  1,  4},
+		[0x3C] = {1411, 3122,  1,  4},
+		[0x3D] = {1412, 3126,  1,  4},
+		[0x3E] = {1413, 3130,  1,  4},
+		[0x3F] = {1414, 3134,  1,  4},
+		[0x40] = {1415, 3138,  1,  4},
+		[0x41] = {1416, 3142,  1,  4},
+		[0x42] = {1417, 3146,  1,  4},
+		[0x43] = {1418, 3150,  1,  4},
+		[0x44] = {1419, 3154,  1,  4},
+		[0x45] = {1420, 3158,  1,  4},
+		[0x46] = {1421, 3162,  1,  4},
+		[0x47] = {1422, 3166,  1,  4},
+		[0x48] = {1423, 3170,  1,  4},
+		[0x49] = {1424, 3174,  1,  4},
+		[0x4A] = {1425, 3178,  1,  4},
+		[0x4B] = {1426, 3182,  1,  4},
+		[0x4C] = {1427, 3186,  1,  4},
+		[0x4D] = {1428, 3190,  1,  4},
+		[0x4E] = {1429, 3194,  1,  4},
+		[0x4F] = {1430, 3198,  1,  4},
+		[0x50] = {1431, 3202,  1,  4},
+		[0x51] = {1432, 3206,  1,  4},
+		[0x52] = {1433, 3210,  1,  4},
+		[0x53] = {1434, 3214,  1,  4},
+		[0x54] = {1435, 3218,  1,  4},
+		[0x55] = {1436, 3222,  1,  4},
+		[0x56] = {1437, 3226,  1,  4},
+		[0x57] = {1438, 3230,  1,  4},
+		[0x58] = {1439, 3234,  1,  4},
+		[0x59] = {1440, 3238,  1,  4},
+		[0x5A] = {1441, 3242,  1,  4},
+		[0x5B] = {1442, 3246,  1,  4},
+		[0x5C] = {1443, 3250,  1,  4},
+		[0x5D] = {1444, 3254,  1,  4},
+		[0x5E] = {1445, 3258,  1,  4},
+		[0x5F] = {1446, 3262,  1,  4},
+		[0x60] = {1447, 3266,  1,  4},
+		[0x61] = {1448, 3270,  1,  4},
+		[0x62] = {1449, 3274,  1,  4},
+		[0x63] = {1450, 3278,  1,  4},
+		[0x64] = {1451, 3282,  1,  4},
+		[0x65] = {1452, 3286,  1,  4},
+		[0x66] = {1453, 3290,  1,  4},
+		[0x67] = {1454, 3294,  1,  4},
+		[0x68] = {1455, 3298,  1,  4},
+		[0x69] = {1456, 3302,  1,  4},
+		[0x6A] = {1457, 3306,  1,  4},
+		[0x6B] = {1458, 3310,  1,  4},
+		[0x6C] = {1459, 3314,  1,  4},
+		[0x6D] = {1460, 3318,  1,  4},
+		[0x6E] = {1461, 3322,  1,  4},
+		[0x6F] = {1462, 3326,  1,  4},
+		[0x70] = {1463, 3330,  1,  4},
+		[0x71] = {1464, 3334,  1,  4},
+		[0x72] = {1465, 3338,  1,  4},
+		[0x73] = {1466, 3342,  1,  4},
+		[0x74] = {1467, 3346,  1,  4},
+		[0x75] = {1468, 3350,  1,  4},
+		[0x76] = {1469, 3354,  1,  4},
+		[0x77] = {1470, 3358,  1,  4},
+		[0x78] = {1471, 3362,  1,  4},
+		[0x79] = {1472, 3366,  1,  4},
+		[0x7A] = {1473, 3370,  1,  4},
+		[0x7B] = {1474, 3374,  1,  4},
+		[0x7C] = {1475, 3378,  1,  4},
+		[0x7D] = {1476, 3382,  1,  4},
+		[0x7E] = {1477, 3386,  1,  4},
+		[0x7F] = {1478, 3390,  1,  4},
+		[0x80] = {1479, 3394,  1,  4},
+		[0x81] = {1480, 3398,  1,  4},
+		[0x82] = {1481, 3402,  1,  4},
+		[0x83] = {1482, 3406,  1,  4},
+		[0x84] = {1483, 3410,  1,  4},
+		[0x85] = {1484, 3414,  1,  4},
+		[0x86] = {1485, 3418,  1,  4},
+		[0x87] = {1486, 3422,  1,  4},
+		[0x88] = {1487, 3426,  1,  4},
+		[0x89] = {1488, 3430,  1,  4},
+		[0x8A] = {1489, 3434,  1,  4},
+		[0x8B] = {1490, 3438,  1,  4},
+		[0x8C] = {1491, 3442,  1,  4},
+		[0x8D] = {1492, 3446,  1,  4},
+		[0x8E] = {1493, 3450,  1,  4},
+		[0x8F] = {1494, 3454,  1,  4},
+		[0x90] = {1495, 3458,  1,  4},
+		[0x91] = {1496, 3462,  1,  4},
+		[0x92] = {1497, 3466,  1,  4},
+		[0x93] = {1498, 3470,  1,  4},
+		[0x94] = {1499, 3474,  1,  4},
+		[0x95] = {1500, 3478,  1,  4},
+		[0x96] = {1501, 3482,  1,  4},
+		[0x97] = {1502, 3486,  1,  4},
+		[0x98] = {1503, 3490,  1,  4},
+		[0x99] = {1504, 3494,  1,  4},
+		[0x9A] = {1505, 3498,  1,  4},
+		[0x9B] = {1506, 3502,  1,  4},
+		[0x9C] = {1507, 3506,  1,  4},
+		[0x9D] = {1508, 3510,  1,  4},
+		[0x9E] = {1509, 3514,  1,  4},
+		[0x9F] = {1510, 3518,  1,  4},
+		[0xA0] = {1511, 3522,  1,  4},
+		[0xA1] = {1512, 3526,  1,  4},
+		[0xA2] = {1513, 3530,  1,  4},
+		[0xA3] = {1514, 3534,  1,  4},
+		[0xA4] = {1515, 3538,  1,  4},
+		[0xA5] = {1516, 3542,  1,  4},
+		[0xA6] = {1517, 3546,  1,  4},
+		[0xA7] = {1518, 3550,  1,  4},
+		[0xA8] = {1519, 3554,  1,  4},
+		[0xA9] = {1520, 3558,  1,  4},
+		[0xAA] = {1521, 3562,  1,  4},
+		[0xAB] = {1522, 3566,  1,  4},
+		[0xAC] = {1523, 3570,  1,  4},
+		[0xAD] = {1524, 3574,  1,  4},
+		[0xAE] = {1525, 3578,  1,  4},
+		[0xAF] = {1526, 3582,  1,  4},
+		[0xB0] = {1527, 3586,  1,  4},
+		[0xB1] = {1528, 3590,  1,  4},
+		[0xB2] = {1529, 3594,  1,  4},
+		[0xB3] = {1530, 3598,  1,  4},
+		[0xB4] = {1531, 3602,  1,  4},
+		[0xB5] = {1532, 3606,  1,  4},
+		[0xB6] = {1533, 3610,  1,  4},
+		[0xB7] = {1534, 3614,  1,  4},
+		[0xB8] = {1535, 3618,  1,  4},
+		[0xB9] = {1536, 3622,  1,  4},
+		[0xBA] = {1537, 3626,  1,  4},
+		[0xBB] = {1538, 3630,  1,  4},
+		[0xBC] = {1539, 3634,  1,  4},
+		[0xBD] = {1540, 3638,  1,  4},
+		[0xBE] = {1541, 3642,  1,  4},
+		[0xBF] = {1542, 3646,  1,  4},
+		[0xC0] = {1543, 3650,  1,  4},
+		[0xC1] = {1544, 3654,  1,  4},
+		[0xC2] = {1545, 3658,  1,  4},
+		[0xC3] = {1546, 3662,  1,  4},
+		[0xC4] = {1547, 3666,  1,  4},
+		[0xC5] = {1548, 3670,  1,  4},
+		[0xC6] = {1549, 3674,  1,  4},
+		[0xC7] = {1550, 3678,  1,  4},
+		[0xC8] = {1551, 3682,  1,  4},
+		[0xC9] = {1552, 3686,  1,  4},
+		[0xCA] = {1553, 3690,  1,  4},
+		[0xCB] = {1554, 3694,  1,  4},
+		[0xCC] = {1555, 3698,  1,  4},
+		[0xCD] = {1556, 3702,  1,  4},
+		[0xCE] = {1557, 3706,  1,  4},
+		[0xCF] = {1558, 3710,  1,  4},
+		[0xD0] = {1559, 3714,  1,  4},
+		[0xD1] = {1560, 3718,  1,  4},
+		[0xD2] = {1561, 3722,  1,  4},
+		[0xD3] = {1562, 3726,  1,  4},
+		[0xD4] = {1563, 3730,  1,  4},
+		[0xD5] = {1564, 3734,  1,  4},
+		[0xD6] = {1565, 3738,  1,  4},
+		[0xD7] = {1566, 3742,  1,  4},
+		[0xD8] = {1567, 3746,  1,  4},
+		[0xD9] = {1568, 3750,  1,  4},
+		[0xDA] = {1569, 3754,  1,  4},
+		[0xDB] = {1570, 3758,  1,  4},
+		[0xDC] = {1571, 3762,  1,  4},
+		[0xDD] = {1572, 3766,  1,  4},
+		[0xDE] = {1573, 3770,  1,  4},
+		[0xDF] = {1574, 3774,  1,  4},
+		[0xE0] = {1575, 3778,  1,  4},
+		[0xE1] = {1576, 3782,  1,  4},
+		[0xE2] = {1577, 3786,  1,  4},
+		[0xE3] = {1578, 3790,  1,  4},
+		[0xE4] = {1579, 3794,  1,  4},
+		[0xE5] = {1580, 3798,  1,  4},
+		[0xE6] = {1581, 3802,  1,  4},
+		[0xE7] = {1582, 3806,  1,  4},
+		[0xE8] = {1583, 3810,  1,  4},
+		[0xE9] = {1584, 3814,  1,  4},
+		[0xEA] = {1585, 3818,  1,  4},
+		[0xEB] = {1586, 3822,  1,  4},
+		[0xEC] = {1587, 3826,  1,  4},
+		[0xED] = {1588, 3830,  1,  4},
+		[0xEE] = {1589, 3834,  1,  4},
+		[0xEF] = {1590, 3838,  1,  4},
+		[0xF0] = {1591, 3842,  1,  4},
+		[0xF1] = {1592, 3846,  1,  4},
+		[0xF2] = {1593, 3850,  1,  4},
+		[0xF3] = {1594, 3854,  1,  4},
+		[0xF4] = {1595, 3858,  1,  4},
+		[0xF5] = {1596, 3862,  1,  4},
+		[0xF6] = {1597, 3866,  1,  4},
+		[0xF7] = {1598, 3870,  1,  4},
+		[0xF8] = {1599, 3874,  1,  4},
+		[0xF9] = {1600, 3878,  1,  4},
+		[0xFA] = {1601, 3882,  1,  4},
+		[0xFB] = {1602, 3886,  1,  4},
+		[0xFC] = {1603, 3890,  1,  4},
+		[0xFD] = {1604, 3894,  1,  4},
+		[0xFE] = {1605, 3898,  1,  4},
+		[0xFF] = {1606, 3902,  1,  4},
+	},
+	{ /* leader 0xE7 */
+		[0x00] = {1607, 3906,  1,  4},
+		[0x01] = {1608, 3910,  1,  4},
+		[0x02] = {1609, 3914,  1,  4},
+		[0x03] = {1610, 3918,  1,  4},
+		[0x04] = {1611, 3922,  1,  4},
+		[0x05] = {1612, 3926,  1,  4},
+		[0x06] = {1613, 3930,  1,  4},
+		[0x07] = {1614, 3934,  1,  4},
+		[0x08] = {1615, 3938,  1,  4},
+		[0x09] = {1616, 3942,  1,  4},
+		[0x0A] = {1617, 3946,  1,  4},
+		[0x0B] = {1618, 3950,  1,  4},
+		[0x0C] = {1619, 3954,  1,  4},
+		[0x0D] = {1620, 3958,  1,  4},
+		[0x0E] = {1621, 3962,  1,  4},
+		[0x0F] = {1622, 3966,  1,  4},
+		[0x10] = {1623, 3970,  1,  4},
+		[0x11] = {1624, 3974,  1,  4},
+		[0x12] = {1625, 3978,  1,  4},
+		[0x13] = {1626, 3982,  1,  4},
+		[0x14] = {1627, 3986,  1,  4},
+		[0x15] = {1628, 3990,  1,  4},
+		[0x16] = {1629, 3994,  1,  4},
+		[0x17] = {1630, 3998,  1,  4},
+		[0x18] = {1631, 4002,  1,  4},
+		[0x19] = {1632, 4006,  1,  4},
+		[0x1A] = {1633, 4010,  1,  4},
+		[0x1B] = {1634, 4014,  1,  4},
+		[0x1C] = {1635, 4018,  1,  4},
+		[0x1D] = {1636, 4022,  1,  4},
+		[0x1E] = {1637, 4026,  1,  4},
+		[0x1F] = {1638, 4030,  1,  4},
+		[0x20] = {1639, 4034,  1,  4},
+		[0x21] = {1640, 4038,  1,  4},
+		[0x22] = {1641, 4042,  1,  4},
+		[0x23] = {1642, 4046,  1,  4},
+		[0x24] = {1643, 4050,  1,  4},
+		[0x25] = {1644, 4054,  1,  4},
+		[0x26] = {1645, 4058,  1,  4},
+		[0x27] = {1646, 4062,  1,  4},
+		[0x28] = {1647, 4066,  1,  4},
+		[0x29] = {1648, 4070,  1,  4},
+		[0x2A] = {1649, 4074,  1,  4},
+		[0x2B] = {1650, 4078,  1,  4},
+		[0x2C] = {1651, 4082,  1,  4},
+		[0x2D] = {1652, 4086,  1,  4},
+		[0x2E] = {1653, 4090,  1,  4},
+		[0x2F] = {1654, 4094,  1,  4},
+		[0x30] = {1655, 4098,  1,  4},
+		[0x31] = {1656, 4102,  1,  4},
+		[0x32] = {1657, 4106,  1,  4},
+		[0x33] = {1658, 4110,  1,  4},
+		[0x34] = {1659, 4114,  1,  4},
+		[0x35] = {1660, 4118,  1,  4},
+		[0x36] = {1661, 4122,  1,  4},
+		[0x37] = {1662, 4126,  1,  4},
+		[0x38] = {1663, 4130,  1,  4},
+		[0x39] = {1664, 4134,  1,  4},
+		[0x3A] = {1665, 4138,  1,  4},
+		[0x3B] = {1666, 4142,  1,  4},
+		[0x3C] = {1667, 4146,  1,  4},
+		[0x3D] = {1668, 4150,  1,  4},
+		[0x3E] = {1669, 4154,  1,  4},
+		[0x3F] = {1670, 4158,  1,  4},
+		[0x40] = {1671, 4162,  1,  4},
+		[0x41] = {1672, 4166,  1,  4},
+		[0x42] = {1673, 4170,  1,  4},
+		[0x43] = {1674, 4174,  1,  4},
+		[0x44] = {1675, 4178,  1,  4},
+		[0x45] = {1676, 4182,  1,  4},
+		[0x46] = {1677, 4186,  1,  4},
+		[0x47] = {1678, 4190,  1,  4},
+		[0x48] = {1679, 4194,  1,  4},
+		[0x49] = {1680, 4198,  1,  4},
+		[0x4A] = {1681, 4202,  1,  4},
+		[0x4B] = {1682, 4206,  1,  4},
+		[0x4C] = {1683, 4210,  1,  4},
+		[0x4D] = {1684, 4214,  1,  4},
+		[0x4E] = {1685, 4218,  1,  4},
+		[0x4F] = {1686, 4222,  1,  4},
+		[0x50] = {1687, 4226,  1,  4},
+		[0x51] = {1688, 4230,  1,  4},
+		[0x52] = {1689, 4234,  1,  4},
+		[0x53] = {1690, 4238,  1,  4},
+		[0x54] = {1691, 4242,  1,  4},
+		[0x55] = {1692, 4246,  1,  4},
+		[0x56] = {1693, 4250,  1,  4},
+		[0x57] = {1694, 4254,  1,  4},
+		[0x58] = {1695, 4258,  1,  4},
+		[0x59] = {1696, 4262,  1,  4},
+		[0x5A] = {1697, 4266,  1,  4},
+		[0x5B] = {1698, 4270,  1,  4},
+		[0x5C] = {1699, 4274,  1,  4},
+		[0x5D] = {1700, 4278,  1,  4},
+		[0x5E] = {1701, 4282,  1,  4},
+		[0x5F] = {1702, 4286,  1,  4},
+		[0x60] = {1703, 4290,  1,  4},
+		[0x61] = {1704, 4294,  1,  4},
+		[0x62] = {1705, 4298,  1,  4},
+		[0x63] = {1706, 4302,  1,  4},
+		[0x64] = {1707, 4306,  1,  4},
+		[0x65] = {1708, 4310,  1,  4},
+		[0x66] = {1709, 4314,  1,  4},
+		[0x67] = {1710, 4318,  1,  4},
+		[0x68] = {1711, 4322,  1,  4},
+		[0x69] = {1712, 4326,  1,  4},
+		[0x6A] = {1713, 4330,  1,  4},
+		[0x6B] = {1714, 4334,  1,  4},
+		[0x6C] = {1715, 4338,  1,  4},
+		[0x6D] = {1716, 4342,  1,  4},
+		[0x6E] = {1717, 4346,  1,  4},
+		[0x6F] = {1718, 4350,  1,  4},
+		[0x70] = {1719, 4354,  1,  4},
+		[0x71] = {1720, 4358,  1,  4},
+		[0x72] = {1721, 4362,  1,  4},
+		[0x73] = {1722, 4366,  1,  4},
+		[0x74] = {1723, 4370,  1,  4},
+		[0x75] = {1724, 4374,  1,  4},
+		[0x76] = {1725, 4378,  1,  4},
+		[0x77] = {1726, 4382,  1,  4},
+		[0x78] = {1727, 4386,  1,  4},
+		[0x79] = {1728, 4390,  1,  4},
+		[0x7A] = {1729, 4394,  1,  4},
+		[0x7B] = {1730, 4398,  1,  4},
+		[0x7C] = {1731, 4402,  1,  4},
+		[0x7D] = {1732, 4406,  1,  4},
+		[0x7E] = {1733, 4410,  1,  4},
+		[0x7F] = {1734, 4414,  1,  4},
+		[0x80] = {1735, 4418,  1,  4},
+		[0x81] = {1736, 4422,  1,  4},
+		[0x82] = {1737, 4426,  1,  4},
+		[0x83] = {1738, 4430,  1,  4},
+		[0x84] = {1739, 4434,  1,  4},
+		[0x85] = {1740, 4438,  1,  4},
+		[0x86] = {1741, 4442,  1,  4},
+		[0x87] = {1742, 4446,  1,  4},
+		[0x88] = {1743, 4450,  1,  4},
+		[0x89] = {1744, 4454,  1,  4},
+		[0x8A] = {1745, 4458,  1,  4},
+		[0x8B] = {1746, 4462,  1,  4},
+		[0x8C] = {1747, 4466,  1,  4},
+		[0x8D] = {1748, 4470,  1,  4},
+		[0x8E] = {1749, 4474,  1,  4},
+		[0x8F] = {1750, 4478,  1,  4},
+		[0x90] = {1751, 4482,  1,  4},
+		[0x91] = {1752, 4486,  1,  4},
+		[0x92] = {1753, 4490,  1,  4},
+		[0x93] = {1754, 4494,  1,  4},
+		[0x94] = {1755, 4498,  1,  4},
+		[0x95] = {1756, 4502,  1,  4},
+		[0x96] = {1757, 4506,  1,  4},
+		[0x97] = {1758, 4510,  1,  4},
+		[0x98] = {1759, 4514,  1,  4},
+		[0x99] = {1760, 4518,  1,  4},
+		[0x9A] = {1761, 4522,  1,  4},
+		[0x9B] = {1762, 4526,  1,  4},
+		[0x9C] = {1763, 4530,  1,  4},
+		[0x9D] = {1764, 4534,  1,  4},
+		[0x9E] = {1765, 4538,  1,  4},
+		[0x9F] = {1766, 4542,  1,  4},
+		[0xA0] = {1767, 4546,  1,  4},
+		[0xA1] = {1768, 4550,  1,  4},
+		[0xA2] = {1769, 4554,  1,  4},
+		[0xA3] = {1770, 4558,  1,  4},
+		[0xA4] = {1771, 4562,  1,  4},
+		[0xA5] = {1772, 4566,  1,  4},
+		[0xA6] = {1773, 4570,  1,  4},
+		[0xA7] = {1774, 4574,  1,  4},
+		[0xA8] = {1775, 4578,  1,  4},
+		[0xA9] = {1776, 4582,  1,  4},
+		[0xAA] = {1777, 4586,  1,  4},
+		[0xAB] = {1778, 4590,  1,  4},
+		[0xAC] = {1779, 4594,  1,  4},
+		[0xAD] = {1780, 4598,  1,  4},
+		[0xAE] = {1781, 4602,  1,  4},
+		[0xAF] = {1782, 4606,  1,  4},
+		[0xB0] = {1783, 4610,  1,  4},
+		[0xB1] = {1784, 4614,  1,  4},
+		[0xB2] = {1785, 4618,  1,  4},
+		[0xB3] = {1786, 4622,  1,  4},
+		[0xB4] = {1787, 4626,  1,  4},
+		[0xB5] = {1788, 4630,  1,  4},
+		[0xB6] = {1789, 4634,  1,  4},
+		[0xB7] = {1790, 4638,  1,  4},
+		[0xB8] = {1791, 4642,  1,  4},
+		[0xB9] = {1792, 4646,  1,  4},
+		[0xBA] = {1793, 4650,  1,  4},
+		[0xBB] = {1794, 4654,  1,  4},
+		[0xBC] = {1795, 4658,  1,  4},
+		[0xBD] = {1796, 4662,  1,  4},
+		[0xBE] = {1797, 4666,  1,  4},
+		[0xBF] = {1798, 4670,  1,  4},
+		[0xC0] = {1799, 4674,  1,  4},
+		[0xC1] = {1800, 4678,  1,  4},
+		[0xC2] = {1801, 4682,  1,  4},
+		[0xC3] = {1802, 4686,  1,  4},
+		[0xC4] = {1803, 4690,  1,  4},
+		[0xC5] = {1804, 4694,  1,  4},
+		[0xC6] = {1805, 4698,  1,  4},
+		[0xC7] = {1806, 4702,  1,  4},
+		[0xC8] = {1807, 4706,  1,  4},
+		[0xC9] = {1808, 4710,  1,  4},
+		[0xCA] = {1809, 4714,  1,  4},
+		[0xCB] = {1810, 4718,  1,  4},
+		[0xCC] = {1811, 4722,  1,  4},
+		[0xCD] = {1812, 4726,  1,  4},
+		[0xCE] = {1813, 4730,  1,  4},
+		[0xCF] = {1814, 4734,  1,  4},
+		[0xD0] = {1815, 4738,  1,  4},
+		[0xD1] = {1816, 4742,  1,  4},
+		[0xD2] = {1817, 4746,  1,  4},
+		[0xD3] = {1818, 4750,  1,  4},
+		[0xD4] = {1819, 4754,  1,  4},
+		[0xD5] = {1820, 4758,  1,  4},
+		[0xD6] = {1821, 4762,  1,  4},
+		[0xD7] = {1822, 4766,  1,  4},
+		[0xD8] = {1823, 4770,  1,  4},
+		[0xD9] = {1824, 4774,  1,  4},
+		[0xDA] = {1825, 4778,  1,  4},
+		[0xDB] = {1826, 4782,  1,  4},
+		[0xDC] = {1827, 4786,  1,  4},
+		[0xDD] = {1828, 4790,  1,  4},
+		[0xDE] = {1829, 4794,  1,  4},
+		[0xDF] = {1830, 4798,  1,  4},
+		[0xE0] = {1831, 4802,  1,  4},
+		[0xE1] = {1832, 4806,  1,  4},
+		[0xE2] = {1833, 4810,  1,  4},
+		[0xE3] = {1834, 4814,  1,  4},
+		[0xE4] = {1835, 4818,  1,  4},
+		[0xE5] = {1836, 4822,  1,  4},
+		[0xE6] = {1837, 4826,  1,  4},
+		[0xE7] = {1838, 4830,  1,  4},
+		[0xE8] = {1839, 4834,  1,  4},
+		[0xE9] = {1840, 4838,  1,  4},
+		[0xEA] = {1841, 4842,  1,  4},
+		[0xEB] = {1842, 4846,  1,  4},
+		[0xEC] = {1843, 4850,  1,  4},
+		[0xED] = {1844, 4854,  1,  4},
+		[0xEE] = {1845, 4858,  1,  4},
+		[0xEF] = {1846, 4862,  1,  4},
+		[0xF0] = {1847, 4866,  1,  4},
+		[0xF1] = {1848, 4870,  1,  4},
+		[0xF2] = {1849, 4874,  1,  4},
+		[0xF3] = {1850, 4878,  1,  4},
+		[0xF4] = {1851, 4882,  1,  4},
+		[0xF5] = {1852, 4886,  1,  4},
+		[0xF6] = {1853, 4890,  1,  4},
+		[0xF7] = {1854, 4894,  1,  4},
+		[0xF8] = {1855, 4898,  1,  4},
+		[0xF9] = {1856, 4902,  1,  4},
+		[0xFA] = {1857, 4906,  1,  4},
+		[0xFB] = {1858, 4910,  1,  4},
+		[0xFC] = {1859, 4914,  1,  4},
+		[0xFD] = {1860, 4918,  1,  4},
+		[0xFE] = {1861, 4922,  1,  4},
+		[0xFF] = {1862, 4926,  1,  4},
+	},
+	{ /* leader 0xF7 */
+		[0x00] = {1863, 4930,  3,  3},
+		[0x01] = {1866, 4933,  5,  5},
+		[0x02] = {1871, 4938,  5,  5},
+		[0x03] = {1876, 4943,  5,  5},
+		[0x04] = {1881, 4948,  4,  4},
+		[0x05] = {1885, 4952,  4,  4},
+		[0x06] = {1889, 4956,  6,  6},
+		[0x07] = {1895, 4962,  4,  4},
+		[0x08] = {1899, 4966,  6,  6},
+		[0x09] = {1905, 4972,  8,  8},
+		[0x0A] = {1913, 4980,  2,  2},
+		[0x0B] = {1915, 4982,  8,  8},
+		[0x0C] = {1923, 4990,  6,  6},
+		[0x0D] = {1929, 4996,  5,  5},
+		[0x0E] = {1934, 5001,  4,  4},
+		[0x0F] = {1938, 5005,  1,  4},
+		[0x10] = {1939, 5009,  7,  7},
+		[0x11] = {1946, 5016,  5,  5},
+		[0x12] = {1951, 5021,  8,  8},
+		[0x13] = {1959, 5029, 14, 14},
+		[0x14] = {1973, 5043, 15, 15},
+		[0x15] = {1988, 5058,  8,  8},
+		[0x16] = {1996, 5066, 11, 11},
+		[0x17] = {2007, 5077,  1,  4},
+		[0x18] = {2008, 5081,  7,  7},
+		[0x19] = {2015, 5088,  8,  8},
+		[0x1A] = {2023, 5096,  7,  7},
+		[0x1B] = {2030, 5103,  1,  4},
+		[0x1C] = {2031, 5107,  1,  4},
+		[0x1D] = {2032, 5111,  1,  4},
+		[0x1E] = {2033, 5115,  1,  4},
+		[0x1F] = {2034, 5119,  1,  4},
+		[0x20] = {2035, 5123,  9,  9},
+		[0x21] = {2044, 5132,  1,  4},
+		[0x22] = {2045, 5136,  1,  4},
+		[0x23] = {2046, 5140,  1,  4},
+		[0x24] = {2047, 5144,  1,  4},
+		[0x25] = {2048, 5148,  1,  4},
+		[0x26] = {2049, 5152,  1,  4},
+		[0x27] = {2050, 5156,  1,  4},
+		[0x28] = {2051, 5160,  1,  4},
+		[0x29] = {2052, 5164,  1,  4},
+		[0x2A] = {2053, 5168,  1,  4},
+		[0x2B] = {2054, 5172,  1,  4},
+		[0x2C] = {2055, 5176,  1,  4},
+		[0x2D] = {2056, 5180,  1,  4},
+		[0x2E] = {2057, 5184,  1,  4},
+		[0x2F] = {2058, 5188,  1,  4},
+		[0x30] = {2059, 5192,  1,  4},
+		[0x31] = {2060, 5196,  1,  4},
+		[0x32] = {2061, 5200,  1,  4},
+		[0x33] = {2062, 5204,  1,  4},
+		[0x34] = {2063, 5208,  1,  4},
+		[0x35] = {2064, 5212,  1,  4},
+		[0x36] = {2065, 5216,  1,  4},
+		[0x37] = {2066, 5220,  1,  4},
+		[0x38] = {2067, 5224,  1,  4},
+		[0x39] = {2068, 5228,  1,  4},
+		[0x3A] = {2069, 5232,  1,  4},
+		[0x3B] = {2070, 5236,  1,  4},
+		[0x3C] = {2071, 5240,  1,  4},
+		[0x3D] = {2072, 5244,  1,  4},
+		[0x3E] = {2073, 5248,  1,  4},
+		[0x3F] = {2074, 5252,  1,  4},
+		[0x40] = {2075, 5256,  1,  4},
+		[0x41] = {2076, 5260,  1,  4},
+		[0x42] = {2077, 5264,  1,  4},
+		[0x43] = {2078, 5268,  1,  4},
+		[0x44] = {2079, 5272,  1,  4},
+		[0x45] = {2080, 5276,  1,  4},
+		[0x46] = {2081, 5280,  1,  4},
+		[0x47] = {2082, 5284,  1,  4},
+		[0x48] = {2083, 5288,  1,  4},
+		[0x49] = {2084, 5292,  1,  4},
+		[0x4A] = {2085, 5296,  1,  4},
+		[0x4B] = {2086, 5300,  1,  4},
+		[0x4C] = {2087, 5304,  1,  4},
+		[0x4D] = {2088, 5308,  1,  4},
+		[0x4E] = {2089, 5312,  1,  4},
+		[0x4F] = {2090, 5316,  1,  4},
+		[0x50] = {2091, 5320,  1,  4},
+		[0x51] = {2092, 5324,  1,  4},
+		[0x52] = {2093, 5328,  1,  4},
+		[0x53] = {2094, 5332,  1,  4},
+		[0x54] = {2095, 5336,  1,  4},
+		[0x55] = {2096, 5340,  1,  4},
+		[0x56] = {2097, 5344,  1,  4},
+		[0x57] = {2098, 5348,  1,  4},
+		[0x58] = {2099, 5352,  1,  4},
+		[0x59] = {2100, 5356,  1,  4},
+		[0x5A] = {2101, 5360,  1,  4},
+		[0x5B] = {2102, 5364,  1,  4},
+		[0x5C] = {2103, 5368,  1,  4},
+		[0x5D] = {2104, 5372,  1,  4},
+		[0x5E] = {2105, 5376,  1,  4},
+		[0x5F] = {2106, 5380,  1,  4},
+		[0x60] = {2107, 5384,  1,  4},
+		[0x61] = {2108, 5388,  1,  4},
+		[0x62] = {2109, 5392,  1,  4},
+		[0x63] = {2110, 5396,  1,  4},
+		[0x64] = {2111, 5400,  1,  4},
+		[0x65] = {2112, 5404,  1,  4},
+		[0x66] = {2113, 5408,  1,  4},
+		[0x67] = {2114, 5412,  1,  4},
+		[0x68] = {2115, 5416,  1,  4},
+		[0x69] = {2116, 5420,  1,  4},
+		[0x6A] = {2117, 5424,  1,  4},
+		[0x6B] = {2118, 5428,  1,  4},
+		[0x6C] = {2119, 5432,  1,  4},
+		[0x6D] = {2120, 5436,  1,  4},
+		[0x6E] = {2121, 5440,  1,  4},
+		[0x6F] = {2122, 5444,  1,  4},
+		[0x70] = {2123, 5448,  1,  4},
+		[0x71] = {2124, 5452,  1,  4},
+		[0x72] = {2125, 5456,  1,  4},
+		[0x73] = {2126, 5460,  1,  4},
+		[0x74] = {2127, 5464,  1,  4},
+		[0x75] = {2128, 5468,  1,  4},
+		[0x76] = {2129, 5472,  1,  4},
+		[0x77] = {2130, 5476,  1,  4},
+		[0x78] = {2131, 5480,  1,  4},
+		[0x79] = {2132, 5484,  1,  4},
+		[0x7A] = {2133, 5488,  1,  4},
+		[0x7B] = {2134, 5492,  1,  4},
+		[0x7C] = {2135, 5496,  1,  4},
+		[0x7D] = {2136, 5500,  1,  4},
+		[0x7E] = {2137, 5504,  1,  4},
+		[0x7F] = {2138, 5508,  1,  4},
+		[0x80] = {2139, 5512,  1,  4},
+		[0x81] = {2140, 5516,  1,  4},
+		[0x82] = {2141, 5520,  1,  4},
+		[0x83] = {2142, 5524,  1,  4},
+		[0x84] = {2143, 5528,  1,  4},
+		[0x85] = {2144, 5532,  1,  4},
+		[0x86] = {2145, 5536,  1,  4},
+		[0x87] = {2146, 5540,  1,  4},
+		[0x88] = {2147, 5544,  1,  4},
+		[0x89] = {2148, 5548,  1,  4},
+		[0x8A] = {2149, 5552,  1,  4},
+		[0x8B] = {2150, 5556,  1,  4},
+		[0x8C] = {2151, 5560,  1,  4},
+		[0x8D] = {2152, 5564,  1,  4},
+		[0x8E] = {2153, 5568,  1,  4},
+		[0x8F] = {2154, 5572,  1,  4},
+		[0x90] = {2155, 5576,  1,  4},
+		[0x91] = {2156, 5580,  1,  4},
+		[0x92] = {2157, 5584,  1,  4},
+		[0x93] = {2158, 5588,  8,  8},
+		[0x94] = {2166, 5596,  8,  8},
+		[0x95] = {2174, 5604,  1,  4},
+		[0x96] = {2175, 5608,  1,  4},
+		[0x97] = {2176, 5612,  9,  9},
+		[0x98] = {2185, 5621,  9,  9},
+		[0x99] = {2194, 5630,  1,  4},
+		[0x9A] = {2195, 5634,  1,  4},
+		[0x9B] = {2196, 5638,  1,  4},
+		[0x9C] = {2197, 5642,  1,  4},
+		[0x9D] = {2198, 5646,  1,  4},
+		[0x9E] = {2199, 5650,  1,  4},
+		[0x9F] = {2200, 5654,  1,  4},
+		[0xA0] = {2201, 5658,  8,  8},
+		[0xA1] = {2209, 5666,  7,  7},
+		[0xA2] = {2216, 5673,  8,  8},
+		[0xA3] = {2224, 5681,  9,  9},
+		[0xA4] = {2233, 5690, 11, 11},
+		[0xA5] = {2244, 5701,  5,  5},
+		[0xA6] = {2249, 5706,  7,  7},
+		[0xA7] = {2256, 5713,  7,  7},
+		[0xA8] = {2263, 5720,  7,  7},
+		[0xA9] = {2270, 5727,  8,  8},
+		[0xAA] = {2278, 5735,  8,  8},
+		[0xAB] = {2286, 5743,  6,  6},
+		[0xAC] = {2292, 5749,  7,  7},
+		[0xAD] = {2299, 5756,  7,  7},
+		[0xAE] = {2306, 5763,  1,  4},
+		[0xAF] = {2307, 5767,  8,  8},
+		[0xB0] = {2315, 5775,  1,  4},
+		[0xB1] = {2316, 5779,  1,  4},
+		[0xB2] = {2317, 5783,  1,  4},
+		[0xB3] = {2318, 5787,  1,  4},
+		[0xB4] = {2319, 5791,  1,  4},
+		[0xB5] = {2320, 5795,  1,  4},
+		[0xB6] = {2321, 5799,  1,  4},
+		[0xB7] = {2322, 5803,  1,  4},
+		[0xB8] = {2323, 5807,  1,  4},
+		[0xB9] = {2324, 5811,  1,  4},
+		[0xBA] = {2325, 5815,  1,  4},
+		[0xBB] = {2326, 5819,  1,  4},
+		[0xBC] = {2327, 5823,  1,  4},
+		[0xBD] = {2328, 5827,  1,  4},
+		[0xBE] = {2329, 5831,  1,  4},
+		[0xBF] = {2330, 5835,  1,  4},
+		[0xC0] = {2331, 5839,  1,  4},
+		[0xC1] = {2332, 5843,  1,  4},
+		[0xC2] = {2333, 5847,  1,  4},
+		[0xC3] = {2334, 5851,  1,  4},
+		[0xC4] = {2335, 5855,  1,  4},
+		[0xC5] = {2336, 5859,  1,  4},
+		[0xC6] = {2337, 5863,  1,  4},
+		[0xC7] = {2338, 5867,  1,  4},
+		[0xC8] = {2339, 5871,  1,  4},
+		[0xC9] = {2340, 5875,  1,  4},
+		[0xCA] = {2341, 5879,  1,  4},
+		[0xCB] = {2342, 5883,  1,  4},
+		[0xCC] = {2343, 5887,  1,  4},
+		[0xCD] = {2344, 5891,  1,  4},
+		[0xCE] = {2345, 5895,  1,  4},
+		[0xCF] = {2346, 5899,  1,  4},
+		[0xD0] = {2347, 5903,  1,  4},
+		[0xD1] = {2348, 5907,  1,  4},
+		[0xD2] = {2349, 5911,  1,  4},
+		[0xD3] = {2350, 5915,  1,  4},
+		[0xD4] = {2351, 5919,  1,  4},
+		[0xD5] = {2352, 5923,  1,  4},
+		[0xD6] = {2353, 5927,  1,  4},
+		[0xD7] = {2354, 5931,  1,  4},
+		[0xD8] = {2355, 5935,  1,  4},
+		[0xD9] = {2356, 5939,  1,  4},
+		[0xDA] = {2357, 5943,  1,  4},
+		[0xDB] = {2358, 5947,  1,  4},
+		[0xDC] = {2359, 5951,  1,  4},
+		[0xDD] = {2360, 5955,  1,  4},
+		[0xDE] = {2361, 5959,  1,  4},
+		[0xDF] = {2362, 5963,  1,  4},
+		[0xE0] = {2363, 5967,  1,  4},
+		[0xE1] = {2364, 5971,  1,  4},
+		[0xE2] = {2365, 5975,  1,  4},
+		[0xE3] = {2366, 5979,  1,  4},
+		[0xE4] = {2367, 5983,  1,  4},
+		[0xE5] = {2368, 5987,  1,  4},
+		[0xE6] = {2369, 5991,  1,  4},
+		[0xE7] = {2370, 5995,  1,  4},
+		[0xE8] = {2371, 5999,  1,  4},
+		[0xE9] = {2372, 6003,  1,  4},
+		[0xEA] = {2373, 6007,  1,  4},
+		[0xEB] = {2374, 6011,  1,  4},
+		[0xEC] = {2375, 6015,  1,  4},
+		[0xED] = {2376, 6019,  1,  4},
+		[0xEE] = {2377, 6023,  1,  4},
+		[0xEF] = {2378, 6027,  1,  4},
+		[0xF0] = {2379, 6031,  1,  4},
+		[0xF1] = {2380, 6035,  1,  4},
+		[0xF2] = {2381, 6039,  1,  4},
+		[0xF3] = {2382, 6043,  1,  4},
+		[0xF4] = {2383, 6047,  1,  4},
+		[0xF5] = {2384, 6051,  1,  4},
+		[0xF6] = {2385, 6055,  1,  4},
+		[0xF7] = {2386, 6059,  1,  4},
+		[0xF8] = {2387, 6063,  1,  4},
+		[0xF9] = {2388, 6067,  1,  4},
+		[0xFA] = {2389, 6071,  1,  4},
+		[0xFB] = {2390, 6075,  1,  4},
+		[0xFC] = {2391, 6079,  1,  4},
+		[0xFD] = {2392, 6083,  1,  4},
+		[0xFE] = {2393, 6087,  1,  4},
+		[0xFF] = {2394, 6091,  1,  4},
+	},
+	{ /* leader 0xF9 */
+		[0x00] = {2395, 6095,  1,  4},
+		[0x01] = {2396, 6099,  1,  4},
+		[0x02] = {2397, 6103,  1,  4},
+		[0x03] = {2398, 6107,  1,  4},
+		[0x04] = {2399, 6111,  1,  4},
+		[0x05] = {2400, 6115,  1,  4},
+		[0x06] = {2401, 6119,  1,  4},
+		[0x07] = {2402, 6123,  1,  4},
+		[0x08] = {2403, 6127,  1,  4},
+		[0x09] = {2404, 6131,  1,  4},
+		[0x0A] = {2405, 6135,  1,  4},
+		[0x0B] = {2406, 6139,  1,  4},
+		[0x0C] = {2407, 6143,  1,  4},
+		[0x0D] = {2408, 6147,  1,  4},
+		[0x0E] = {2409, 6151,  1,  4},
+		[0x0F] = {2410, 6155,  1,  4},
+		[0x10] = {2411, 6159,  1,  4},
+		[0x11] = {2412, 6163,  1,  4},
+		[0x12] = {2413, 6167,  1,  4},
+		[0x13] = {2414, 6171,  1,  4},
+		[0x14] = {2415, 6175,  1,  4},
+		[0x15] = {2416, 6179,  1,  4},
+		[0x16] = {2417, 6183,  1,  4},
+		[0x17] = {2418, 6187,  1,  4},
+		[0x18] = {2419, 6191,  1,  4},
+		[0x19] = {2420, 6195,  1,  4},
+		[0x1A] = {2421, 6199,  1,  4},
+		[0x1B] = {2422, 6203,  1,  4},
+		[0x1C] = {2423, 6207,  1,  4},
+		[0x1D] = {2424, 6211,  1,  4},
+		[0x1E] = {2425, 6215,  7,  7},
+		[0x1F] = {2432, 6222,  1,  4},
+		[0x20] = {2433, 6226,  1,  4},
+		[0x21] = {2434, 6230,  1,  4},
+		[0x22] = {2435, 6234,  1,  4},
+		[0x23] = {2436, 6238,  1,  4},
+		[0x24] = {2437, 6242,  1,  4},
+		[0x25] = {2438, 6246,  1,  4},
+		[0x26] = {2439, 6250,  1,  4},
+		[0x27] = {2440, 6254,  1,  4},
+		[0x28] = {2441, 6258,  1,  4},
+		[0x29] = {2442, 6262,  1,  4},
+		[0x2A] = {2443, 6266,  1,  4},
+		[0x2B] = {2444, 6270,  1,  4},
+		[0x2C] = {2445, 6274,  1,  4},
+		[0x2D] = {2446, 6278,  1,  4},
+		[0x2E] = {2447, 6282,  1,  4},
+		[0x2F] = {2448, 6286,  1,  4},
+		[0x30] = {2449, 6290,  8,  8},
+		[0x31] = {2457, 6298,  7,  7},
+		[0x32] = {2464, 6305,  7,  7},
+		[0x33] = {2471, 6312,  7,  7},
+		[0x34] = {2478, 6319,  8,  8},
+		[0x35] = {2486, 6327,  9,  9},
+		[0x36] = {2495, 6336,  7,  7},
+		[0x37] = {2502, 6343,  8, 10},
+		[0x38] = {2510, 6353,  4,  4},
+		[0x39] = {2514, 6357,  7,  7},
+		[0x3A] = {2521, 6364,  7,  7},
+		[0x3B] = {2528, 6371,  7,  7},
+		[0x3C] = {2535, 6378,  9,  9},
+		[0x3D] = {2544, 6387, 10, 10},
+		[0x3E] = {2554, 6397,  1,  4},
+		[0x3F] = {2555, 6401,  4,  4},
+		[0x40] = {2559, 6405,  1,  4},
+		[0x41] = {2560, 6409,  1,  4},
+		[0x42] = {2561, 6413,  1,  4},
+		[0x43] = {2562, 6417,  1,  4},
+		[0x44] = {2563, 6421,  1,  4},
+		[0x45] = {2564, 6425,  1,  4},
+		[0x46] = {2565, 6429,  1,  4},
+		[0x47] = {2566, 6433,  1,  4},
+		[0x48] = {2567, 6437,  1,  4},
+		[0x49] = {2568, 6441,  1,  4},
+		[0x4A] = {2569, 6445,  1,  4},
+		[0x4B] = {2570, 6449,  1,  4},
+		[0x4C] = {2571, 6453,  1,  4},
+		[0x4D] = {2572, 6457,  1,  4},
+		[0x4E] = {2573, 6461,  1,  4},
+		[0x4F] = {2574, 6465,  1,  4},
+		[0x50] = {2575, 6469,  1,  4},
+		[0x51] = {2576, 6473,  1,  4},
+		[0x52] = {2577, 6477,  1,  4},
+		[0x53] = {2578, 6481,  1,  4},
+		[0x54] = {2579, 6485,  1,  4},
+		[0x55] = {2580, 6489,  1,  4},
+		[0x56] = {2581, 6493,  1,  4},
+		[0x57] = {2582, 6497,  1,  4},
+		[0x58] = {2583, 6501,  1,  4},
+		[0x59] = {2584, 6505,  1,  4},
+		[0x5A] = {2585, 6509,  1,  4},
+		[0x5B] = {2586, 6513,  1,  4},
+		[0x5C] = {2587, 6517,  1,  4},
+		[0x5D] = {2588, 6521,  1,  4},
+		[0x5E] = {2589, 6525,  1,  4},
+		[0x5F] = {2590, 6529,  1,  4},
+		[0x60] = {2591, 6533,  1,  4},
+		[0x61] = {2592, 6537,  1,  4},
+		[0x62] = {2593, 6541,  1,  4},
+		[0x63] = {2594, 6545,  1,  4},
+		[0x64] = {2595, 6549,  1,  4},
+		[0x65] = {2596, 6553,  1,  4},
+		[0x66] = {2597, 6557,  1,  4},
+		[0x67] = {2598, 6561,  1,  4},
+		[0x68] = {2599, 6565,  1,  4},
+		[0x69] = {2600, 6569,  1,  4},
+		[0x6A] = {2601, 6573,  1,  4},
+		[0x6B] = {2602, 6577,  1,  4},
+		[0x6C] = {2603, 6581,  1,  4},
+		[0x6D] = {2604, 6585,  1,  4},
+		[0x6E] = {2605, 6589,  1,  4},
+		[0x6F] = {2606, 6593,  1,  4},
+		[0x70] = {2607, 6597,  1,  4},
+		[0x71] = {2608, 6601,  1,  4},
+		[0x72] = {2609, 6605,  1,  4},
+		[0x73] = {2610, 6609,  1,  4},
+		[0x74] = {2611, 6613,  1,  4},
+		[0x75] = {2612, 6617,  1,  4},
+		[0x76] = {2613, 6621,  1,  4},
+		[0x77] = {2614, 6625,  1,  4},
+		[0x78] = {2615, 6629,  1,  4},
+		[0x79] = {2616, 6633,  1,  4},
+		[0x7A] = {2617, 6637,  1,  4},
+		[0x7B] = {2618, 6641,  1,  4},
+		[0x7C] = {2619, 6645,  1,  4},
+		[0x7D] = {2620, 6649,  1,  4},
+		[0x7E] = {2621, 6653,  1,  4},
+		[0x7F] = {2622, 6657,  1,  4},
+		[0x80] = {2623, 6661,  1,  4},
+		[0x81] = {2624, 6665,  1,  4},
+		[0x82] = {2625, 6669,  1,  4},
+		[0x83] = {2626, 6673,  1,  4},
+		[0x84] = {2627, 6677,  1,  4},
+		[0x85] = {2628, 6681,  1,  4},
+		[0x86] = {2629, 6685,  1,  4},
+		[0x87] = {2630, 6689,  1,  4},
+		[0x88] = {2631, 6693,  1,  4},
+		[0x89] = {2632, 6697,  1,  4},
+		[0x8A] = {2633, 6701,  1,  4},
+		[0x8B] = {2634, 6705,  1,  4},
+		[0x8C] = {2635, 6709,  1,  4},
+		[0x8D] = {2636, 6713,  1,  4},
+		[0x8E] = {2637, 6717,  1,  4},
+		[0x8F] = {2638, 6721,  1,  4},
+		[0x90] = {2639, 6725,  1,  4},
+		[0x91] = {2640, 6729,  1,  4},
+		[0x92] = {2641, 6733,  1,  4},
+		[0x93] = {2642, 6737,  1,  4},
+		[0x94] = {2643, 6741,  1,  4},
+		[0x95] = {2644, 6745,  1,  4},
+		[0x96] = {2645, 6749,  1,  4},
+		[0x97] = {2646, 6753,  1,  4},
+		[0x98] = {2647, 6757,  1,  4},
+		[0x99] = {2648, 6761,  1,  4},
+		[0x9A] = {2649, 6765,  1,  4},
+		[0x9B] = {2650, 6769,  1,  4},
+		[0x9C] = {2651, 6773,  1,  4},
+		[0x9D] = {2652, 6777,  1,  4},
+		[0x9E] = {2653, 6781,  1,  4},
+		[0x9F] = {2654, 6785,  1,  4},
+		[0xA0] = {2655, 6789,  1,  4},
+		[0xA1] = {2656, 6793,  1,  4},
+		[0xA2] = {2657, 6797,  1,  4},
+		[0xA3] = {2658, 6801,  1,  4},
+		[0xA4] = {2659, 6805,  1,  4},
+		[0xA5] = {2660, 6809,  1,  4},
+		[0xA6] = {2661, 6813,  1,  4},
+		[0xA7] = {2662, 6817,  1,  4},
+		[0xA8] = {2663, 6821,  1,  4},
+		[0xA9] = {2664, 6825,  1,  4},
+		[0xAA] = {2665, 6829,  1,  4},
+		[0xAB] = {2666, 6833,  1,  4},
+		[0xAC] = {2667, 6837,  1,  4},
+		[0xAD] = {2668, 6841,  1,  4},
+		[0xAE] = {2669, 6845,  1,  4},
+		[0xAF] = {2670, 6849,  1,  4},
+		[0xB0] = {2671, 6853,  1,  4},
+		[0xB1] = {2672, 6857,  1,  4},
+		[0xB2] = {2673, 6861,  1,  4},
+		[0xB3] = {2674, 6865,  1,  4},
+		[0xB4] = {2675, 6869,  1,  4},
+		[0xB5] = {2676, 6873,  1,  4},
+		[0xB6] = {2677, 6877,  1,  4},
+		[0xB7] = {2678, 6881,  1,  4},
+		[0xB8] = {2679, 6885,  1,  4},
+		[0xB9] = {2680, 6889,  1,  4},
+		[0xBA] = {2681, 6893,  1,  4},
+		[0xBB] = {2682, 6897,  1,  4},
+		[0xBC] = {2683, 6901,  1,  4},
+		[0xBD] = {2684, 6905,  1,  4},
+		[0xBE] = {2685, 6909,  1,  4},
+		[0xBF] = {2686, 6913,  1,  4},
+		[0xC0] = {2687, 6917,  1,  4},
+		[0xC1] = {2688, 6921,  1,  4},
+		[0xC2] = {2689, 6925,  1,  4},
+		[0xC3] = {2690, 6929,  1,  4},
+		[0xC4] = {2691, 6933,  1,  4},
+		[0xC5] = {2692, 6937,  1,  4},
+		[0xC6] = {2693, 6941,  1,  4},
+		[0xC7] = {2694, 6945,  1,  4},
+		[0xC8] = {2695, 6949,  1,  4},
+		[0xC9] = {2696, 6953,  1,  4},
+		[0xCA] = {2697, 6957,  1,  4},
+		[0xCB] = {2698, 6961,  1,  4},
+		[0xCC] = {2699, 6965,  1,  4},
+		[0xCD] = {2700, 6969,  1,  4},
+		[0xCE] = {2701, 6973,  1,  4},
+		[0xCF] = {2702, 6977,  1,  4},
+		[0xD0] = {2703, 6981,  1,  4},
+		[0xD1] = {2704, 6985,  1,  4},
+		[0xD2] = {2705, 6989,  1,  4},
+		[0xD3] = {2706, 6993,  1,  4},
+		[0xD4] = {2707, 6997,  1,  4},
+		[0xD5] = {2708, 7001,  1,  4},
+		[0xD6] = {2709, 7005,  1,  4},
+		[0xD7] = {2710, 7009,  1,  4},
+		[0xD8] = {2711, 7013,  1,  4},
+		[0xD9] = {2712, 7017,  1,  4},
+		[0xDA] = {2713, 7021,  1,  4},
+		[0xDB] = {2714, 7025,  1,  4},
+		[0xDC] = {2715, 7029,  1,  4},
+		[0xDD] = {2716, 7033,  1,  4},
+		[0xDE] = {2717, 7037,  1,  4},
+		[0xDF] = {2718, 7041,  1,  4},
+		[0xE0] = {2719, 7045,  1,  4},
+		[0xE1] = {2720, 7049,  1,  4},
+		[0xE2] = {2721, 7053,  1,  4},
+		[0xE3] = {2722, 7057,  1,  4},
+		[0xE4] = {2723, 7061,  1,  4},
+		[0xE5] = {2724, 7065,  1,  4},
+		[0xE6] = {2725, 7069,  1,  4},
+		[0xE7] = {2726, 7073,  1,  4},
+		[0xE8] = {2727, 7077,  1,  4},
+		[0xE9] = {2728, 7081,  1,  4},
+		[0xEA] = {2729, 7085,  1,  4},
+		[0xEB] = {2730, 7089,  1,  4},
+		[0xEC] = {2731, 7093,  1,  4},
+		[0xED] = {2732, 7097,  1,  4},
+		[0xEE] = {2733, 7101,  1,  4},
+		[0xEF] = {2734, 7105,  1,  4},
+		[0xF0] = {2735, 7109,  1,  4},
+		[0xF1] = {2736, 7113,  1,  4},
+		[0xF2] = {2737, 7117,  1,  4},
+		[0xF3] = {2738, 7121,  1,  4},
+		[0xF4] = {2739, 7125,  1,  4},
+		[0xF5] = {2740, 7129,  1,  4},
+		[0xF6] = {2741, 7133,  1,  4},
+		[0xF7] = {2742, 7137,  1,  4},
+		[0xF8] = {2743, 7141,  1,  4},
+		[0xF9] = {2744, 7145,  1,  4},
+		[0xFA] = {2745, 7149,  1,  4},
+		[0xFB] = {2746, 7153,  1,  4},
+		[0xFC] = {2747, 7157,  1,  4},
+		[0xFD] = {2748, 7161,  1,  4},
+		[0xFE] = {2749, 7165,  1,  4},
+		[0xFF] = {2750, 7169,  1,  4},
+	},
+};
+
+/* Sequences, in UTF-32 then in UTF-8. */
+
+const casio_uint32_t CASIO_EXPORT casio_fontchar_pool32[2751] = {
+	0x0000, 0x0066, 0x0070, 0x006E, 0x00B5, 0x006D, 0x006B, 0x004D,
+	0x0047, 0x0054, 0x0050, 0x0045, 0x25E2, 0x000A, 0x2192, 0x1D07,
+	0x2264, 0x2260, 0x2265, 0x21D2, 0xF0014, 0xF0015, 0xF0016, 0xF0017,
+	0xF0018, 0xF0019, 0xF001A, 0xF001B, 0xF001C, 0xF001D, 0xF001E, 0xF001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0046, 0x0048, 0x0049,
+	0x004A, 0x004B, 0x004C, 0x004E, 0x004F, 0x0051, 0x0052, 0x0053,
+	0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C,
+	0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064,
+	0x0065, 0x0067, 0x0068, 0x0069, 0x006A, 0x006C, 0x006F, 0x0071,
+	0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+	0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x0050, 0x006F, 0x006C,
+	0x0028, 0x0073, 0x0069, 0x006E, 0x0020, 0x0063, 0x006F, 0x0073,
+	0x0020, 0x0074, 0x0061, 0x006E, 0x0020, 0xF0084, 0x006C, 0x006E,
+	0x0020, 0x221A, 0x2212, 0x0020, 0x0078, 0x006E, 0x006F, 0x0072,
+	0x0020, 0x00B2, 0x00B0, 0x222B, 0x0028, 0x004D, 0x006F, 0x03A3,
+	0x0078, 0x00B2, 0x0052, 0x0065, 0x0066, 0x0020, 0x0073, 0x0069,
+	0x006E, 0x207B, 0x00B9, 0x0020, 0x0063, 0x006F, 0x0073, 0x207B,
+	0x00B9, 0x0020, 0x0074, 0x0061, 0x006E, 0x207B, 0x00B9, 0x0020,
+	0xF0094, 0x006C, 0x006F, 0x0067, 0x0020, 0x00B3, 0x221A, 0x0041,
+	0x0062, 0x0073, 0x0020, 0x0020, 0x0078, 0x006F, 0x0072, 0x0020,
+	0x207B, 0x00B9, 0x02B3, 0xF009D, 0x004D, 0x0065, 0x0064, 0x03A3,
+	0x0078, 0x0052, 0x0065, 0x0063, 0x0028, 0x0073, 0x0069, 0x006E,
+	0x0068, 0x0020, 0x0063, 0x006F, 0x0073, 0x0068, 0x0020, 0x0074,
+	0x0061, 0x006E, 0x0068, 0x0020, 0xF00A4, 0x0065, 0x005E, 0x0049,
+	0x006E, 0x0074, 0x0020, 0x004E, 0x006F, 0x0074, 0x0020, 0x00D7,
+	0x0020, 0x006F, 0x0072, 0x0020, 0x1D4D, 0xF00AD, 0xF00AE, 0xF00AF,
+	0x0020, 0x0041, 0x006E, 0x0064, 0x0020, 0x0073, 0x0069, 0x006E,
+	0x0068, 0x207B, 0x00B9, 0x0020, 0x0063, 0x006F, 0x0073, 0x0068,
+	0x207B, 0x00B9, 0x0020, 0x0074, 0x0061, 0x006E, 0x0068, 0x207B,
+	0x00B9, 0x0020, 0xF00B4, 0xF00B5, 0x0046, 0x0072, 0x0061, 0x0063,
+	0x0020, 0x004E, 0x0065, 0x0067, 0x0020, 0x02E3, 0x221A, 0x00F7,
+	0x0020, 0x0061, 0x006E, 0x0064, 0x0020, 0x231F, 0xF00BC, 0xF00BD,
+	0xF00BE, 0xF00BF, 0x0041, 0x006E, 0x0073, 0x0052, 0x0061, 0x006E,
+	0x0023, 0x0020, 0xF00C2, 0xF00C3, 0xF00C4, 0xF00C5, 0xF00C6, 0xF00C7,
+	0xF00C8, 0xF00C9, 0xF00CA, 0xF00CB, 0xF00CC, 0x03B8, 0xF00CF, 0x03C0,
+	0x0043, 0x006C, 0x0073, 0xF00D2, 0x0052, 0x006E, 0x0064, 0x0044,
+	0x0065, 0x0063, 0x0048, 0x0065, 0x0078, 0x0042, 0x0069, 0x006E,
+	0x004F, 0x0063, 0x0074, 0xF00D8, 0x004E, 0x006F, 0x0072, 0x006D,
+	0x0044, 0x0065, 0x0067, 0x0052, 0x0061, 0x0064, 0x0047, 0x0072,
+	0x0061, 0x0045, 0x006E, 0x0067, 0x0049, 0x006E, 0x0074, 0x0067,
+	0x0020, 0xF00DF, 0x0050, 0x006C, 0x006F, 0x0074, 0x0020, 0x004C,
+	0x0069, 0x006E, 0x0065, 0x004C, 0x0062, 0x006C, 0x0020, 0x0046,
+	0x0069, 0x0078, 0x0020, 0x0053, 0x0063, 0x0069, 0x0020, 0x0044,
+	0x0073, 0x007A, 0x0020, 0x0049, 0x0073, 0x007A, 0x0020, 0x0046,
+	0x0061, 0x0063, 0x0074, 0x006F, 0x0072, 0x0020, 0x0056, 0x0069,
+	0x0065, 0x0077, 0x0057, 0x0069, 0x006E, 0x0064, 0x006F, 0x0077,
+	0x0020, 0x0047, 0x006F, 0x0074, 0x006F, 0x0020, 0x0050, 0x0072,
+	0x006F, 0x0067, 0x0020, 0x0047, 0x0072, 0x0061, 0x0070, 0x0068,
+	0x0020, 0x0059, 0x003D, 0x0047, 0x0072, 0x0061, 0x0070, 0x0068,
+	0x0020, 0x222B, 0x0047, 0x0072, 0x0061, 0x0070, 0x0068, 0x0020,
+	0x0059, 0x003E, 0x0047, 0x0072, 0x0061, 0x0070, 0x0068, 0x0020,
+	0x0059, 0x003C, 0x0047, 0x0072, 0x0061, 0x0070, 0x0068, 0x0020,
+	0x0059, 0x2265, 0x0047, 0x0072, 0x0061, 0x0070, 0x0068, 0x0020,
+	0x0059, 0x2264, 0x0047, 0x0072, 0x0061, 0x0070, 0x0068, 0x0020,
+	0x0072, 0x003D, 0x0047, 0x0072, 0x0061, 0x0070, 0x0068, 0x0028,
+	0x0058, 0x002C, 0x0059, 0x0029, 0x003D, 0x0028, 0xF00F6, 0xF00F8,
+	0xF00FA, 0x0050, 0x0028, 0x0051, 0x0028, 0x0052, 0x0028, 0x0074,
+	0x0028, 0xF00FF, 0x0058, 0x006D, 0x0069, 0x006E, 0x0058, 0x006D,
+	0x0061, 0x0078, 0x0058, 0x0073, 0x0063, 0x006C, 0xF7F03, 0x0059,
+	0x006D, 0x0069, 0x006E, 0x0059, 0x006D, 0x0061, 0x0078, 0x0059,
+	0x0073, 0x0063, 0x006C, 0xF7F07, 0x0054, 0x03B8, 0x006D, 0x0069,
+	0x006E, 0x0054, 0x03B8, 0x006D, 0x0061, 0x0078, 0x0054, 0x03B8,
+	0x0070, 0x0074, 0x0063, 0x0068, 0x0058, 0x0066, 0x0063, 0x0074,
+	0x0059, 0x0066, 0x0063, 0x0074, 0x0044, 0x0020, 0x0053, 0x0074,
+	0x0061, 0x0072, 0x0074, 0x0044, 0x0020, 0x0045, 0x006E, 0x0064,
+	0x0044, 0x0020, 0x0070, 0x0069, 0x0074, 0x0063, 0x0068, 0x0052,
+	0x0069, 0x0067, 0x0068, 0x0074, 0x0058, 0x006D, 0x0069, 0x006E,
+	0x0052, 0x0069, 0x0067, 0x0068, 0x0074, 0x0058, 0x006D, 0x0061,
+	0x0078, 0x0052, 0x0069, 0x0067, 0x0068, 0x0074, 0x0058, 0x0073,
+	0x0063, 0x006C, 0xF7F13, 0x0052, 0x0069, 0x0067, 0x0068, 0x0074,
+	0x0059, 0x006D, 0x0069, 0x006E, 0x0052, 0x0069, 0x0067, 0x0068,
+	0x0074, 0x0059, 0x006D, 0x0061, 0x0078, 0x0052, 0x0069, 0x0067,
+	0x0068, 0x0074, 0x0059, 0x0073, 0x0063, 0x006C, 0xF7F17, 0x0052,
+	0x0069, 0x0067, 0x0068, 0x0074, 0x0054, 0x03B8, 0x006D, 0x0069,
+	0x006E, 0x0052, 0x0069, 0x0067, 0x0068, 0x0074, 0x0054, 0x03B8,
+	0x006D, 0x0061, 0x0078, 0x0052, 0x0069, 0x0067, 0x0068, 0x0074,
+	0x0054, 0x03B8, 0x0070, 0x0074, 0x0063, 0x0068, 0xF7F1B, 0xF7F1C,
+	0xF7F1D, 0xF7F1E, 0xF7F1F, 0x004D, 0x0061, 0x0078, 0x0028, 0x0044,
+	0x0065, 0x0074, 0x0020, 0x0041, 0x0072, 0x0067, 0x0020, 0x0043,
+	0x006F, 0x006E, 0x006A, 0x0067, 0x0020, 0x0052, 0x0065, 0x0050,
+	0x0020, 0x0049, 0x006D, 0x0050, 0x0020, 0x0064, 0x002F, 0x0064,
+	0x0078, 0x0028, 0x0064, 0x00B2, 0x002F, 0x0064, 0x0078, 0x00B2,
+	0x0028, 0x0053, 0x006F, 0x006C, 0x0076, 0x0065, 0x0028, 0x03A3,
+	0x0028, 0x0046, 0x004D, 0x0069, 0x006E, 0x0028, 0x0046, 0x004D,
+	0x0061, 0x0078, 0x0028, 0x0053, 0x0065, 0x0071, 0x0028, 0x004D,
+	0x0069, 0x006E, 0x0028, 0x004D, 0x0065, 0x0061, 0x006E, 0x0028,
+	0x004D, 0x0065, 0x0064, 0x0069, 0x0061, 0x006E, 0x0028, 0xF7F30,
+	0xF7F31, 0xF7F32, 0xF7F33, 0xF7F34, 0xF7F35, 0xF7F36, 0xF7F37, 0xF7F38,
+	0xF7F39, 0x004D, 0x004F, 0x0044, 0x0028, 0x004D, 0x004F, 0x0044,
+	0x005F, 0x0045, 0x0078, 0x0070, 0x0028, 0x0047, 0x0043, 0x0044,
+	0x0028, 0x004C, 0x0043, 0x004D, 0x0028, 0xF7F3E, 0xF7F3F, 0x004D,
+	0x0061, 0x0074, 0x0020, 0x0054, 0x0072, 0x006E, 0x0020, 0x002A,
+	0x0052, 0x006F, 0x0077, 0x0020, 0x002A, 0x0052, 0x006F, 0x0077,
+	0x002B, 0x0020, 0x0052, 0x006F, 0x0077, 0x002B, 0x0020, 0x0053,
+	0x0077, 0x0061, 0x0070, 0x0020, 0x0044, 0x0069, 0x006D, 0x0020,
+	0x0046, 0x0069, 0x006C, 0x006C, 0x0028, 0x0049, 0x0064, 0x0065,
+	0x006E, 0x0074, 0x0069, 0x0074, 0x0079, 0x0020, 0x0041, 0x0075,
+	0x0067, 0x006D, 0x0065, 0x006E, 0x0074, 0x0028, 0x004C, 0x0069,
+	0x0073, 0x0074, 0x2192, 0x004D, 0x0061, 0x0074, 0x0028, 0x004D,
+	0x0061, 0x0074, 0x2192, 0x004C, 0x0069, 0x0073, 0x0074, 0x0028,
+	0x0053, 0x0075, 0x006D, 0x0020, 0x0050, 0x0072, 0x006F, 0x0064,
+	0x0020, 0x0050, 0x0065, 0x0072, 0x0063, 0x0065, 0x006E, 0x0074,
+	0x0020, 0x0043, 0x0075, 0x006D, 0x006C, 0x0020, 0x004C, 0x0069,
+	0x0073, 0x0074, 0x0020, 0x0394, 0x004C, 0x0069, 0x0073, 0x0074,
+	0x0020, 0xF7F53, 0x2220, 0xF7F55, 0xF7F56, 0xF7F57, 0xF7F58, 0xF7F59,
+	0xF7F5A, 0xF7F5B, 0xF7F5C, 0xF7F5D, 0xF7F5E, 0xF7F5F, 0xF7F60, 0xF7F61,
+	0xF7F62, 0xF7F63, 0xF7F64, 0xF7F65, 0xF7F66, 0xF7F67, 0xF7F68, 0xF7F69,
+	0xF7F6A, 0xF7F6B, 0xF7F6C, 0xF7F6D, 0xF7F6E, 0xF7F6F, 0xF7F70, 0xF7F71,
+	0xF7F72, 0xF7F73, 0xF7F74, 0xF7F75, 0xF7F76, 0xF7F77, 0xF7F78, 0xF7F79,
+	0xF7F7A, 0xF7F7B, 0xF7F7C, 0xF7F7D, 0xF7F7E, 0xF7F7F, 0xF7F80, 0xF7F81,
+	0xF7F82, 0xF7F83, 0xF7F84, 0xF7F85, 0x0052, 0x006E, 0x0064, 0x0046,
+	0x0069, 0x0078, 0x0028, 0x0052, 0x0061, 0x006E, 0x0049, 0x006E,
+	0x0074, 0x0023, 0x0028, 0x0052, 0x0061, 0x006E, 0x004C, 0x0069,
+	0x0073, 0x0074, 0x0023, 0x0028, 0x0052, 0x0061, 0x006E, 0x0042,
+	0x0069, 0x006E, 0x0023, 0x0028, 0x0052, 0x0061, 0x006E, 0x004E,
+	0x006F, 0x0072, 0x006D, 0x0023, 0x0028, 0xF7F8B, 0xF7F8C, 0xF7F8D,
+	0xF7F8E, 0x0047, 0x0065, 0x0074, 0x006B, 0x0065, 0x0079, 0xF7F90,
+	0xF7F91, 0xF7F92, 0xF7F93, 0xF7F94, 0xF7F95, 0xF7F96, 0xF7F97, 0xF7F98,
+	0xF7F99, 0xF7F9A, 0xF7F9B, 0xF7F9C, 0xF7F9D, 0xF7F9E, 0xF7F9F, 0xF7FA0,
+	0xF7FA1, 0xF7FA2, 0xF7FA3, 0xF7FA4, 0xF7FA5, 0xF7FA6, 0xF7FA7, 0xF7FA8,
+	0xF7FA9, 0xF7FAA, 0xF7FAB, 0xF7FAC, 0xF7FAD, 0xF7FAE, 0xF7FAF, 0xF7FB0,
+	0x0020, 0x004F, 0x0072, 0x0020, 0xF7FB2, 0x0020, 0x0058, 0x006F,
+	0x0072, 0x0020, 0xF7FB5, 0xF7FB6, 0xF7FB7, 0xF7FB8, 0xF7FB9, 0xF7FBA,
+	0xF7FBB, 0x0020, 0x0049, 0x006E, 0x0074, 0x00F7, 0x0020, 0x0020,
+	0x0052, 0x006D, 0x0064, 0x0072, 0x0020, 0xF7FBE, 0xF7FBF, 0xF7FC0,
+	0xF7FC1, 0xF7FC2, 0xF7FC3, 0xF7FC4, 0xF7FC5, 0xF7FC6, 0xF7FC7, 0xF7FC8,
+	0xF7FC9, 0xF7FCA, 0xF7FCB, 0xF7FCC, 0xF7FCD, 0xF7FCE, 0xF7FCF, 0xF7FD0,
+	0xF7FD1, 0xF7FD2, 0xF7FD3, 0xF7FD4, 0xF7FD5, 0xF7FD6, 0xF7FD7, 0xF7FD8,
+	0xF7FD9, 0xF7FDA, 0xF7FDB, 0xF7FDC, 0xF7FDD, 0xF7FDE, 0xF7FDF, 0xF7FE0,
+	0xF7FE1, 0xF7FE2, 0xF7FE3, 0xF7FE4, 0xF7FE5, 0xF7FE6, 0xF7FE7, 0xF7FE8,
+	0xF7FE9, 0xF7FEA, 0xF7FEB, 0xF7FEC, 0xF7FED, 0xF7FEE, 0xF7FEF, 0xF7FF0,
+	0xF7FF1, 0xF7FF2, 0xF7FF3, 0xF7FF4, 0xF7FF5, 0xF7FF6, 0xF7FF7, 0xF7FF8,
+	0xF7FF9, 0xF7FFA, 0xF7FFB, 0xF7FFC, 0xF7FFD, 0xF7FFE, 0xF7FFF, 0xFE500,
+	0xFE501, 0xFE502, 0xFE503, 0xFE504, 0xFE505, 0xFE506, 0xFE507, 0xFE508,
+	0xFE509, 0xFE50A, 0xFE50B, 0xFE50C, 0xFE50D, 0xFE50E, 0xFE50F, 0xFE510,
+	0xFE511, 0xFE512, 0xFE513, 0xFE514, 0xFE515, 0xFE516, 0xFE517, 0xFE518,
+	0xFE519, 0xFE51A, 0xFE51B, 0xFE51C, 0xFE51D, 0xFE51E, 0xFE51F, 0xFE520,
+	0xFE521, 0xFE522, 0xFE523, 0xFE524, 0xFE525, 0xFE526, 0xFE527, 0xFE528,
+	0xFE529, 0xFE52A, 0xFE52B, 0xFE52C, 0xFE52D, 0xFE52E, 0xFE52F, 0xFE530,
+	0xFE531, 0xFE532, 0xFE533, 0xFE534, 0xFE535, 0xFE536, 0xFE537, 0xFE538,
+	0xFE539, 0xFE53A, 0xFE53B, 0xFE53C, 0xFE53D, 0xFE53E, 0xFE53F, 0xFE540,
+	0xFE541, 0xFE542, 0xFE543, 0xFE544, 0xFE545, 0xFE546, 0xFE547, 0xFE548,
+	0xFE549, 0xFE54A, 0xFE54B, 0xFE54C, 0xFE54D, 0xFE54E, 0xFE54F, 0xFE550,
+	0xFE551, 0xFE552, 0xFE553, 0xFE554, 0xFE555, 0xFE556, 0xFE557, 0xFE558,
+	0xFE559, 0xFE55A, 0xFE55B, 0xFE55C, 0xFE55D, 0xFE55E, 0xFE55F, 0xFE560,
+	0xFE561, 0xFE562, 0xFE563, 0xFE564, 0xFE565, 0xFE566, 0xFE567, 0xFE568,
+	0xFE569, 0xFE56A, 0xFE56B, 0xFE56C, 0xFE56D, 0xFE56E, 0xFE56F, 0xFE570,
+	0xFE571, 0xFE572, 0xFE573, 0xFE574, 0xFE575, 0xFE576, 0xFE577, 0xFE578,
+	0xFE579, 0xFE57A, 0xFE57B, 0xFE57C, 0xFE57D, 0xFE57E, 0xFE57F, 0xFE580,
+	0xFE581, 0xFE582, 0xFE583, 0xFE584, 0xFE585, 0xFE586, 0xFE587, 0xFE588,
+	0xFE589, 0xFE58A, 0xFE58B, 0xFE58C, 0xFE58D, 0xFE58E, 0xFE58F, 0xFE590,
+	0xFE591, 0xFE592, 0xFE593, 0xFE594, 0xFE595, 0xFE596, 0xFE597, 0xFE598,
+	0xFE599, 0xFE59A, 0xFE59B, 0xFE59C, 0xFE59D, 0xFE59E, 0xFE59F, 0xFE5A0,
+	0xFE5A1, 0xFE5A2, 0xFE5A3, 0xFE5A4, 0xFE5A5, 0xFE5A6, 0xFE5A7, 0xFE5A8,
+	0xFE5A9, 0xFE5AA, 0xFE5AB, 0xFE5AC, 0xFE5AD, 0xFE5AE, 0xFE5AF, 0xFE5B0,
+	0xFE5B1, 0xFE5B2, 0xFE5B3, 0xFE5B4, 0xFE5B5, 0xFE5B6, 0xFE5B7, 0xFE5B8,
+	0xFE5B9, 0xFE5BA, 0xFE5BB, 0xFE5BC, 0xFE5BD, 0xFE5BE, 0xFE5BF, 0xFE5C0,
+	0xFE5C1, 0xFE5C2, 0xFE5C3, 0xFE5C4, 0xFE5C5, 0xFE5C6, 0xFE5C7, 0xFE5C8,
+	0xFE5C9, 0xFE5CA, 0xFE5CB, 0xFE5CC, 0xFE5CD, 0xFE5CE, 0xFE5CF, 0xFE5D0,
+	0xFE5D1, 0xFE5D2, 0xFE5D3, 0xFE5D4, 0xFE5D5, 0xFE5D6, 0xFE5D7, 0xFE5D8,
+	0xFE5D9, 0xFE5DA, 0xFE5DB, 0xFE5DC, 0xFE5DD, 0xFE5DE, 0xFE5DF, 0xFE5E0,
+	0xFE5E1, 0xFE5E2, 0xFE5E3, 0xFE5E4, 0xFE5E5, 0xFE5E6, 0xFE5E7, 0xFE5E8,
+	0xFE5E9, 0xFE5EA, 0xFE5EB, 0xFE5EC, 0xFE5ED, 0xFE5EE, 0xFE5EF, 0xFE5F0,
+	0xFE5F1, 0xFE5F2, 0xFE5F3, 0xFE5F4, 0xFE5F5, 0xFE5F6, 0xFE5F7, 0xFE5F8,
+	0xFE5F9, 0xFE5FA, 0xFE5FB, 0xFE5FC, 0xFE5FD, 0xFE5FE, 0xFE5FF, 0xFE600,
+	0xFE601, 0xFE602, 0xFE603, 0xFE604, 0xFE605, 0xFE606, 0xFE607, 0xFE608,
+	0xFE609, 0xFE60A, 0xFE60B, 0xFE60C, 0xFE60D, 0xFE60E, 0xFE60F, 0xFE610,
+	0xFE611, 0xFE612, 0xFE613, 0xFE614, 0xFE615, 0xFE616, 0xFE617, 0xFE618,
+	0xFE619, 0xFE61A, 0xFE61B, 0xFE61C, 0xFE61D, 0xFE61E, 0xFE61F, 0xFE620,
+	0xFE621, 0xFE622, 0xFE623, 0xFE624, 0xFE625, 0xFE626, 0xFE627, 0xFE628,
+	0xFE629, 0xFE62A, 0xFE62B, 0xFE62C, 0xFE62D, 0xFE62E, 0xFE62F, 0xFE630,
+	0xFE631, 0xFE632, 0xFE633, 0xFE634, 0xFE635, 0xFE636, 0xFE637, 0xFE638,
+	0xFE639, 0xFE63A, 0xFE63B, 0xFE63C, 0xFE63D, 0xFE63E, 0xFE63F, 0xFE640,
+	0xFE641, 0xFE642, 0xFE643, 0xFE644, 0xFE645, 0xFE646, 0xFE647, 0xFE648,
+	0xFE649, 0xFE64A, 0xFE64B, 0xFE64C, 0xFE64D, 0xFE64E, 0xFE64F, 0xFE650,
+	0xFE651, 0xFE652, 0xFE653, 0xFE654, 0xFE655, 0xFE656, 0xFE657, 0xFE658,
+	0xFE659, 0xFE65A, 0xFE65B, 0xFE65C, 0xFE65D, 0xFE65E, 0xFE65F, 0xFE660,
+	0xFE661, 0xFE662, 0xFE663, 0xFE664, 0xFE665, 0xFE666, 0xFE667, 0xFE668,
+	0xFE669, 0xFE66A, 0xFE66B, 0xFE66C, 0xFE66D, 0xFE66E, 0xFE66F, 0xFE670,
+	0xFE671, 0xFE672, 0xFE673, 0xFE674, 0xFE675, 0xFE676, 0xFE677, 0xFE678,
+	0xFE679, 0xFE67A, 0xFE67B, 0xFE67C, 0xFE67D, 0xFE67E, 0xFE67F, 0xFE680,
+	0xFE681, 0xFE682, 0xFE683, 0xFE684, 0xFE685, 0xFE686, 0xFE687, 0xFE688,
+	0xFE689, 0xFE68A, 0xFE68B, 0xFE68C, 0xFE68D, 0xFE68E, 0xFE68F, 0xFE690,
+	0xFE691, 0xFE692, 0xFE693, 0xFE694, 0xFE695, 0xFE696, 0xFE697, 0xFE698,
+	0xFE699, 0xFE69A, 0xFE69B, 0xFE69C, 0xFE69D, 0xFE69E, 0xFE69F, 0xFE6A0,
+	0xFE6A1, 0xFE6A2, 0xFE6A3, 0xFE6A4, 0xFE6A5, 0xFE6A6, 0xFE6A7, 0xFE6A8,
+	0xFE6A9, 0xFE6AA, 0xFE6AB, 0xFE6AC, 0xFE6AD, 0xFE6AE, 0xFE6AF, 0xFE6B0,
+	0xFE6B1, 0xFE6B2, 0xFE6B3, 0xFE6B4, 0xFE6B5, 0xFE6B6, 0xFE6B7, 0xFE6B8,
+	0xFE6B9, 0xFE6BA, 0xFE6BB, 0xFE6BC, 0xFE6BD, 0xFE6BE, 0xFE6BF, 0xFE6C0,
+	0xFE6C1, 0xFE6C2, 0xFE6C3, 0xFE6C4, 0xFE6C5, 0xFE6C6, 0xFE6C7, 0xFE6C8,
+	0xFE6C9, 0xFE6CA, 0xFE6CB, 0xFE6CC, 0xFE6CD, 0xFE6CE, 0xFE6CF, 0xFE6D0,
+	0xFE6D1, 0xFE6D2, 0xFE6D3, 0xFE6D4, 0xFE6D5, 0xFE6D6, 0xFE6D7, 0xFE6D8,
+	0xFE6D9, 0xFE6DA, 0xFE6DB, 0xFE6DC, 0xFE6DD, 0xFE6DE, 0xFE6DF, 0xFE6E0,
+	0xFE6E1, 0xFE6E2, 0xFE6E3, 0xFE6E4, 0xFE6E5, 0xFE6E6, 0xFE6E7, 0xFE6E8,
+	0xFE6E9, 0xFE6EA, 0xFE6EB, 0xFE6EC, 0xFE6ED, 0xFE6EE, 0xFE6EF, 0xFE6F0,
+	0xFE6F1, 0xFE6F2, 0xFE6F3, 0xFE6F4, 0xFE6F5, 0xFE6F6, 0xFE6F7, 0xFE6F8,
+	0xFE6F9, 0xFE6FA, 0xFE6FB, 0xFE6FC, 0xFE6FD, 0xFE6FE, 0xFE6FF, 0xFE700,
+	0xFE701, 0xFE702, 0xFE703, 0xFE704, 0xFE705, 0xFE706, 0xFE707, 0xFE708,
+	0xFE709, 0xFE70A, 0xFE70B, 0xFE70C, 0xFE70D, 0xFE70E, 0xFE70F, 0xFE710,
+	0xFE711, 0xFE712, 0xFE713, 0xFE714, 0xFE715, 0xFE716, 0xFE717, 0xFE718,
+	0xFE719, 0xFE71A, 0xFE71B, 0xFE71C, 0xFE71D, 0xFE71E, 0xFE71F, 0xFE720,
+	0xFE721, 0xFE722, 0xFE723, 0xFE724, 0xFE725, 0xFE726, 0xFE727, 0xFE728,
+	0xFE729, 0xFE72A, 0xFE72B, 0xFE72C, 0xFE72D, 0xFE72E, 0xFE72F, 0xFE730,
+	0xFE731, 0xFE732, 0xFE733, 0xFE734, 0xFE735, 0xFE736, 0xFE737, 0xFE738,
+	0xFE739, 0xFE73A, 0xFE73B, 0xFE73C, 0xFE73D, 0xFE73E, 0xFE73F, 0xFE740,
+	0xFE741, 0xFE742, 0xFE743, 0xFE744, 0xFE745, 0xFE746, 0xFE747, 0xFE748,
+	0xFE749, 0xFE74A, 0xFE74B, 0xFE74C, 0xFE74D, 0xFE74E, 0xFE74F, 0xFE750,
+	0xFE751, 0xFE752, 0xFE753, 0xFE754, 0xFE755, 0xFE756, 0xFE757, 0xFE758,
+	0xFE759, 0xFE75A, 0xFE75B, 0xFE75C, 0xFE75D, 0xFE75E, 0xFE75F, 0xFE760,
+	0xFE761, 0xFE762, 0xFE763, 0xFE764, 0xFE765, 0xFE766, 0xFE767, 0xFE768,
+	0xFE769, 0xFE76A, 0xFE76B, 0xFE76C, 0xFE76D, 0xFE76E, 0xFE76F, 0xFE770,
+	0xFE771, 0xFE772, 0xFE773, 0xFE774, 0xFE775, 0xFE776, 0xFE777, 0xFE778,
+	0xFE779, 0xFE77A, 0xFE77B, 0xFE77C, 0xFE77D, 0xFE77E, 0xFE77F, 0xFE780,
+	0xFE781, 0xFE782, 0xFE783, 0xFE784, 0xFE785, 0xFE786, 0xFE787, 0xFE788,
+	0xFE789, 0xFE78A, 0xFE78B, 0xFE78C, 0xFE78D, 0xFE78E, 0xFE78F, 0xFE790,
+	0xFE791, 0xFE792, 0xFE793, 0xFE794, 0xFE795, 0xFE796, 0xFE797, 0xFE798,
+	0xFE799, 0xFE79A, 0xFE79B, 0xFE79C, 0xFE79D, 0xFE79E, 0xFE79F, 0xFE7A0,
+	0xFE7A1, 0xFE7A2, 0xFE7A3, 0xFE7A4, 0xFE7A5, 0xFE7A6, 0xFE7A7, 0xFE7A8,
+	0xFE7A9, 0xFE7AA, 0xFE7AB, 0xFE7AC, 0xFE7AD, 0xFE7AE, 0xFE7AF, 0xFE7B0,
+	0xFE7B1, 0xFE7B2, 0xFE7B3, 0xFE7B4, 0xFE7B5, 0xFE7B6, 0xFE7B7, 0xFE7B8,
+	0xFE7B9, 0xFE7BA, 0xFE7BB, 0xFE7BC, 0xFE7BD, 0xFE7BE, 0xFE7BF, 0xFE7C0,
+	0xFE7C1, 0xFE7C2, 0xFE7C3, 0xFE7C4, 0xFE7C5, 0xFE7C6, 0xFE7C7, 0xFE7C8,
+	0xFE7C9, 0xFE7CA, 0xFE7CB, 0xFE7CC, 0xFE7CD, 0xFE7CE, 0xFE7CF, 0xFE7D0,
+	0xFE7D1, 0xFE7D2, 0xFE7D3, 0xFE7D4, 0xFE7D5, 0xFE7D6, 0xFE7D7, 0xFE7D8,
+	0xFE7D9, 0xFE7DA, 0xFE7DB, 0xFE7DC, 0xFE7DD, 0xFE7DE, 0xFE7DF, 0xFE7E0,
+	0xFE7E1, 0xFE7E2, 0xFE7E3, 0xFE7E4, 0xFE7E5, 0xFE7E6, 0xFE7E7, 0xFE7E8,
+	0xFE7E9, 0xFE7EA, 0xFE7EB, 0xFE7EC, 0xFE7ED, 0xFE7EE, 0xFE7EF, 0xFE7F0,
+	0xFE7F1, 0xFE7F2, 0xFE7F3, 0xFE7F4, 0xFE7F5, 0xFE7F6, 0xFE7F7, 0xFE7F8,
+	0xFE7F9, 0xFE7FA, 0xFE7FB, 0xFE7FC, 0xFE7FD, 0xFE7FE, 0xFE7FF, 0x0049,
+	0x0066, 0x0020, 0x0054, 0x0068, 0x0065, 0x006E, 0x0020, 0x0045,
+	0x006C, 0x0073, 0x0065, 0x0020, 0x0049, 0x0066, 0x0045, 0x006E,
+	0x0064, 0x0046, 0x006F, 0x0072, 0x0020, 0x0020, 0x0054, 0x006F,
+	0x0020, 0x0020, 0x0053, 0x0074, 0x0065, 0x0070, 0x0020, 0x004E,
+	0x0065, 0x0078, 0x0074, 0x0057, 0x0068, 0x0069, 0x006C, 0x0065,
+	0x0020, 0x0057, 0x0068, 0x0069, 0x006C, 0x0065, 0x0045, 0x006E,
+	0x0064, 0x0044, 0x006F, 0x004C, 0x0070, 0x0057, 0x0068, 0x0069,
+	0x006C, 0x0065, 0x0020, 0x0052, 0x0065, 0x0074, 0x0075, 0x0072,
+	0x006E, 0x0042, 0x0072, 0x0065, 0x0061, 0x006B, 0x0053, 0x0074,
+	0x006F, 0x0070, 0xFF70F, 0x004C, 0x006F, 0x0063, 0x0061, 0x0074,
+	0x0065, 0x0020, 0x0053, 0x0065, 0x006E, 0x0064, 0x0028, 0x0052,
+	0x0065, 0x0063, 0x0065, 0x0069, 0x0076, 0x0065, 0x0028, 0x004F,
+	0x0070, 0x0065, 0x006E, 0x0043, 0x006F, 0x006D, 0x0070, 0x006F,
+	0x0072, 0x0074, 0x0033, 0x0038, 0x006B, 0x0043, 0x006C, 0x006F,
+	0x0073, 0x0065, 0x0043, 0x006F, 0x006D, 0x0070, 0x006F, 0x0072,
+	0x0074, 0x0033, 0x0038, 0x006B, 0x0053, 0x0065, 0x006E, 0x0064,
+	0x0033, 0x0038, 0x006B, 0x0020, 0x0052, 0x0065, 0x0063, 0x0065,
+	0x0069, 0x0076, 0x0065, 0x0033, 0x0038, 0x006B, 0x0020, 0xFF717,
+	0x0043, 0x006C, 0x0072, 0x0054, 0x0065, 0x0078, 0x0074, 0x0043,
+	0x006C, 0x0072, 0x0047, 0x0072, 0x0061, 0x0070, 0x0068, 0x0043,
+	0x006C, 0x0072, 0x004C, 0x0069, 0x0073, 0x0074, 0xFF71B, 0xFF71C,
+	0xFF71D, 0xFF71E, 0xFF71F, 0x0044, 0x0072, 0x0061, 0x0077, 0x0047,
+	0x0072, 0x0061, 0x0070, 0x0068, 0xFF721, 0xFF722, 0xFF723, 0xFF724,
+	0xFF725, 0xFF726, 0xFF727, 0xFF728, 0xFF729, 0xFF72A, 0xFF72B, 0xFF72C,
+	0xFF72D, 0xFF72E, 0xFF72F, 0xFF730, 0xFF731, 0xFF732, 0xFF733, 0xFF734,
+	0xFF735, 0xFF736, 0xFF737, 0xFF738, 0xFF739, 0xFF73A, 0xFF73B, 0xFF73C,
+	0xFF73D, 0xFF73E, 0xFF73F, 0xFF740, 0xFF741, 0xFF742, 0xFF743, 0xFF744,
+	0xFF745, 0xFF746, 0xFF747, 0xFF748, 0xFF749, 0xFF74A, 0xFF74B, 0xFF74C,
+	0xFF74D, 0xFF74E, 0xFF74F, 0xFF750, 0xFF751, 0xFF752, 0xFF753, 0xFF754,
+	0xFF755, 0xFF756, 0xFF757, 0xFF758, 0xFF759, 0xFF75A, 0xFF75B, 0xFF75C,
+	0xFF75D, 0xFF75E, 0xFF75F, 0xFF760, 0xFF761, 0xFF762, 0xFF763, 0xFF764,
+	0xFF765, 0xFF766, 0xFF767, 0xFF768, 0xFF769, 0xFF76A, 0xFF76B, 0xFF76C,
+	0xFF76D, 0xFF76E, 0xFF76F, 0xFF770, 0xFF771, 0xFF772, 0xFF773, 0xFF774,
+	0xFF775, 0xFF776, 0xFF777, 0xFF778, 0xFF779, 0xFF77A, 0xFF77B, 0xFF77C,
+	0xFF77D, 0xFF77E, 0xFF77F, 0xFF780, 0xFF781, 0xFF782, 0xFF783, 0xFF784,
+	0xFF785, 0xFF786, 0xFF787, 0xFF788, 0xFF789, 0xFF78A, 0xFF78B, 0xFF78C,
+	0xFF78D, 0xFF78E, 0xFF78F, 0xFF790, 0xFF791, 0xFF792, 0x0053, 0x0074,
+	0x006F, 0x0050, 0x0069, 0x0063, 0x0074, 0x0020, 0x0052, 0x0063,
+	0x006C, 0x0050, 0x0069, 0x0063, 0x0074, 0x0020, 0xFF795, 0xFF796,
+	0x0053, 0x0074, 0x006F, 0x0056, 0x002D, 0x0057, 0x0069, 0x006E,
+	0x0020, 0x0052, 0x0063, 0x006C, 0x0056, 0x002D, 0x0057, 0x0069,
+	0x006E, 0x0020, 0xFF799, 0xFF79A, 0xFF79B, 0xFF79C, 0xFF79D, 0xFF79E,
+	0xFF79F, 0x0054, 0x0061, 0x006E, 0x0067, 0x0065, 0x006E, 0x0074,
+	0x0020, 0x004E, 0x006F, 0x0072, 0x006D, 0x0061, 0x006C, 0x0020,
+	0x0049, 0x006E, 0x0076, 0x0065, 0x0072, 0x0073, 0x0065, 0x0020,
+	0x0056, 0x0065, 0x0072, 0x0074, 0x0069, 0x0063, 0x0061, 0x006C,
+	0x0020, 0x0048, 0x006F, 0x0072, 0x0069, 0x007A, 0x006F, 0x006E,
+	0x0074, 0x0061, 0x006C, 0x0020, 0x0054, 0x0065, 0x0078, 0x0074,
+	0x0020, 0x0043, 0x0069, 0x0072, 0x0063, 0x006C, 0x0065, 0x0020,
+	0x0046, 0x002D, 0x004C, 0x0069, 0x006E, 0x0065, 0x0020, 0x0050,
+	0x006C, 0x006F, 0x0074, 0x004F, 0x006E, 0x0020, 0x0050, 0x006C,
+	0x006F, 0x0074, 0x004F, 0x0066, 0x0066, 0x0020, 0x0050, 0x006C,
+	0x006F, 0x0074, 0x0043, 0x0068, 0x0067, 0x0020, 0x0050, 0x0078,
+	0x006C, 0x004F, 0x006E, 0x0020, 0x0050, 0x0078, 0x006C, 0x004F,
+	0x0066, 0x0066, 0x0020, 0x0050, 0x0078, 0x006C, 0x0043, 0x0068,
+	0x0067, 0x0020, 0xFF7AE, 0x0050, 0x0078, 0x006C, 0x0054, 0x0065,
+	0x0073, 0x0074, 0x0028, 0xFF7B0, 0xFF7B1, 0xFF7B2, 0xFF7B3, 0xFF7B4,
+	0xFF7B5, 0xFF7B6, 0xFF7B7, 0xFF7B8, 0xFF7B9, 0xFF7BA, 0xFF7BB, 0xFF7BC,
+	0xFF7BD, 0xFF7BE, 0xFF7BF, 0xFF7C0, 0xFF7C1, 0xFF7C2, 0xFF7C3, 0xFF7C4,
+	0xFF7C5, 0xFF7C6, 0xFF7C7, 0xFF7C8, 0xFF7C9, 0xFF7CA, 0xFF7CB, 0xFF7CC,
+	0xFF7CD, 0xFF7CE, 0xFF7CF, 0xFF7D0, 0xFF7D1, 0xFF7D2, 0xFF7D3, 0xFF7D4,
+	0xFF7D5, 0xFF7D6, 0xFF7D7, 0xFF7D8, 0xFF7D9, 0xFF7DA, 0xFF7DB, 0xFF7DC,
+	0xFF7DD, 0xFF7DE, 0xFF7DF, 0xFF7E0, 0xFF7E1, 0xFF7E2, 0xFF7E3, 0xFF7E4,
+	0xFF7E5, 0xFF7E6, 0xFF7E7, 0xFF7E8, 0xFF7E9, 0xFF7EA, 0xFF7EB, 0xFF7EC,
+	0xFF7ED, 0xFF7EE, 0xFF7EF, 0xFF7F0, 0xFF7F1, 0xFF7F2, 0xFF7F3, 0xFF7F4,
+	0xFF7F5, 0xFF7F6, 0xFF7F7, 0xFF7F8, 0xFF7F9, 0xFF7FA, 0xFF7FB, 0xFF7FC,
+	0xFF7FD, 0xFF7FE, 0xFF7FF, 0xFF900, 0xFF901, 0xFF902, 0xFF903, 0xFF904,
+	0xFF905, 0xFF906, 0xFF907, 0xFF908, 0xFF909, 0xFF90A, 0xFF90B, 0xFF90C,
+	0xFF90D, 0xFF90E, 0xFF90F, 0xFF910, 0xFF911, 0xFF912, 0xFF913, 0xFF914,
+	0xFF915, 0xFF916, 0xFF917, 0xFF918, 0xFF919, 0xFF91A, 0xFF91B, 0xFF91C,
+	0xFF91D, 0x0043, 0x006C, 0x0072, 0x004D, 0x0061, 0x0074, 0x0020,
+	0xFF91F, 0xFF920, 0xFF921, 0xFF922, 0xFF923, 0xFF924, 0xFF925, 0xFF926,
+	0xFF927, 0xFF928, 0xFF929, 0xFF92A, 0xFF92B, 0xFF92C, 0xFF92D, 0xFF92E,
+	0xFF92F, 0x0053, 0x0074, 0x0072, 0x004A, 0x006F, 0x0069, 0x006E,
+	0x0028, 0x0053, 0x0074, 0x0072, 0x004C, 0x0065, 0x006E, 0x0028,
+	0x0053, 0x0074, 0x0072, 0x0043, 0x006D, 0x0070, 0x0028, 0x0053,
+	0x0074, 0x0072, 0x0053, 0x0072, 0x0063, 0x0028, 0x0053, 0x0074,
+	0x0072, 0x004C, 0x0065, 0x0066, 0x0074, 0x0028, 0x0053, 0x0074,
+	0x0072, 0x0052, 0x0069, 0x0067, 0x0068, 0x0074, 0x0028, 0x0053,
+	0x0074, 0x0072, 0x004D, 0x0069, 0x0064, 0x0028, 0x0045, 0x0078,
+	0x0070, 0x2192, 0x0053, 0x0074, 0x0072, 0x0028, 0x0045, 0x0078,
+	0x0070, 0x0028, 0x0053, 0x0074, 0x0072, 0x0055, 0x0070, 0x0072,
+	0x0028, 0x0053, 0x0074, 0x0072, 0x004C, 0x0077, 0x0072, 0x0028,
+	0x0053, 0x0074, 0x0072, 0x0049, 0x006E, 0x0076, 0x0028, 0x0053,
+	0x0074, 0x0072, 0x0053, 0x0068, 0x0069, 0x0066, 0x0074, 0x0028,
+	0x0053, 0x0074, 0x0072, 0x0052, 0x006F, 0x0074, 0x0061, 0x0074,
+	0x0065, 0x0028, 0xFF93E, 0x0053, 0x0074, 0x0072, 0x0020, 0xFF940,
+	0xFF941, 0xFF942, 0xFF943, 0xFF944, 0xFF945, 0xFF946, 0xFF947, 0xFF948,
+	0xFF949, 0xFF94A, 0xFF94B, 0xFF94C, 0xFF94D, 0xFF94E, 0xFF94F, 0xFF950,
+	0xFF951, 0xFF952, 0xFF953, 0xFF954, 0xFF955, 0xFF956, 0xFF957, 0xFF958,
+	0xFF959, 0xFF95A, 0xFF95B, 0xFF95C, 0xFF95D, 0xFF95E, 0xFF95F, 0xFF960,
+	0xFF961, 0xFF962, 0xFF963, 0xFF964, 0xFF965, 0xFF966, 0xFF967, 0xFF968,
+	0xFF969, 0xFF96A, 0xFF96B, 0xFF96C, 0xFF96D, 0xFF96E, 0xFF96F, 0xFF970,
+	0xFF971, 0xFF972, 0xFF973, 0xFF974, 0xFF975, 0xFF976, 0xFF977, 0xFF978,
+	0xFF979, 0xFF97A, 0xFF97B, 0xFF97C, 0xFF97D, 0xFF97E, 0xFF97F, 0xFF980,
+	0xFF981, 0xFF982, 0xFF983, 0xFF984, 0xFF985, 0xFF986, 0xFF987, 0xFF988,
+	0xFF989, 0xFF98A, 0xFF98B, 0xFF98C, 0xFF98D, 0xFF98E, 0xFF98F, 0xFF990,
+	0xFF991, 0xFF992, 0xFF993, 0xFF994, 0xFF995, 0xFF996, 0xFF997, 0xFF998,
+	0xFF999, 0xFF99A, 0xFF99B, 0xFF99C, 0xFF99D, 0xFF99E, 0xFF99F, 0xFF9A0,
+	0xFF9A1, 0xFF9A2, 0xFF9A3, 0xFF9A4, 0xFF9A5, 0xFF9A6, 0xFF9A7, 0xFF9A8,
+	0xFF9A9, 0xFF9AA, 0xFF9AB, 0xFF9AC, 0xFF9AD, 0xFF9AE, 0xFF9AF, 0xFF9B0,
+	0xFF9B1, 0xFF9B2, 0xFF9B3, 0xFF9B4, 0xFF9B5, 0xFF9B6, 0xFF9B7, 0xFF9B8,
+	0xFF9B9, 0xFF9BA, 0xFF9BB, 0xFF9BC, 0xFF9BD, 0xFF9BE, 0xFF9BF, 0xFF9C0,
+	0xFF9C1, 0xFF9C2, 0xFF9C3, 0xFF9C4, 0xFF9C5, 0xFF9C6, 0xFF9C7, 0xFF9C8,
+	0xFF9C9, 0xFF9CA, 0xFF9CB, 0xFF9CC, 0xFF9CD, 0xFF9CE, 0xFF9CF, 0xFF9D0,
+	0xFF9D1, 0xFF9D2, 0xFF9D3, 0xFF9D4, 0xFF9D5, 0xFF9D6, 0xFF9D7, 0xFF9D8,
+	0xFF9D9, 0xFF9DA, 0xFF9DB, 0xFF9DC, 0xFF9DD, 0xFF9DE, 0xFF9DF, 0xFF9E0,
+	0xFF9E1, 0xFF9E2, 0xFF9E3, 0xFF9E4, 0xFF9E5, 0xFF9E6, 0xFF9E7, 0xFF9E8,
+	0xFF9E9, 0xFF9EA, 0xFF9EB, 0xFF9EC, 0xFF9ED, 0xFF9EE, 0xFF9EF, 0xFF9F0,
+	0xFF9F1, 0xFF9F2, 0xFF9F3, 0xFF9F4, 0xFF9F5, 0xFF9F6, 0xFF9F7, 0xFF9F8,
+	0xFF9F9, 0xFF9FA, 0xFF9FB, 0xFF9FC, 0xFF9FD, 0xFF9FE, 0xFF9FF,
+};
+
+const casio_uint8_t CASIO_EXPORT casio_fontchar_pool8[7173] = {
+	0x00, 0x66, 0x70, 0x6E, 0xC2, 0xB5, 0x6D, 0x6B, 0x4D, 0x47, 0x54, 0x50,
+	0x45, 0xE2, 0x97, 0xA2, 0x0A, 0xE2, 0x86, 0x92, 0xE1, 0xB4, 0x87, 0xE2,
+	0x89, 0xA4, 0xE2, 0x89, 0xA0, 0xE2, 0x89, 0xA5, 0xE2, 0x87, 0x92, 0xF3,
+	0xB0, 0x80, 0x94, 0xF3, 0xB0, 0x80, 0x95, 0xF3, 0xB0, 0x80, 0x96, 0xF3,
+	0xB0, 0x80, 0x97, 0xF3, 0xB0, 0x80, 0x98, 0xF3, 0xB0, 0x80, 0x99, 0xF3,
+	0xB0, 0x80, 0x9A, 0xF3, 0xB0, 0x80, 0x9B, 0xF3, 0xB0, 0x80, 0x9C, 0xF3,
+	0xB0, 0x80, 0x9D, 0xF3, 0xB0, 0x80, 0x9E, 0xF3, 0xB0, 0x80, 0x9F, 0x20,
+	0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C,
+	0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+	0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44,
+	0x46, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4E, 0x4F, 0x51, 0x52, 0x53, 0x55,
+	0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61,
+	0x62, 0x63, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6A, 0x6C, 0x6F, 0x71, 0x72,
+	0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E,
+	0x50, 0x6F, 0x6C, 0x28, 0x73, 0x69, 0x6E, 0x20, 0x63, 0x6F, 0x73, 0x20,
+	0x74, 0x61, 0x6E, 0x20, 0xF3, 0xB0, 0x82, 0x84, 0x6C, 0x6E, 0x20, 0xE2,
+	0x88, 0x9A, 0xE2, 0x88, 0x92, 0x20, 0x78, 0x6E, 0x6F, 0x72, 0x20, 0xC2,
+	0xB2, 0xC2, 0xB0, 0xE2, 0x88, 0xAB, 0x28, 0x4D, 0x6F, 0xCE, 0xA3, 0x78,
+	0xC2, 0xB2, 0x52, 0x65, 0x66, 0x20, 0x73, 0x69, 0x6E, 0xE2, 0x81, 0xBB,
+	0xC2, 0xB9, 0x20, 0x63, 0x6F, 0x73, 0xE2, 0x81, 0xBB, 0xC2, 0xB9, 0x20,
+	0x74, 0x61, 0x6E, 0xE2, 0x81, 0xBB, 0xC2, 0xB9, 0x20, 0xF3, 0xB0, 0x82,
+	0x94, 0x6C, 0x6F, 0x67, 0x20, 0xC2, 0xB3, 0xE2, 0x88, 0x9A, 0x41, 0x62,
+	0x73, 0x20, 0x20, 0x78, 0x6F, 0x72, 0x20, 0xE2, 0x81, 0xBB, 0xC2, 0xB9,
+	0xCA, 0xB3, 0xF3, 0xB0, 0x82, 0x9D, 0x4D, 0x65, 0x64, 0xCE, 0xA3, 0x78,
+	0x52, 0x65, 0x63, 0x28, 0x73, 0x69, 0x6E, 0x68, 0x20, 0x63, 0x6F, 0x73,
+	0x68, 0x20, 0x74, 0x61, 0x6E, 0x68, 0x20, 0xF3, 0xB0, 0x82, 0xA4, 0x65,
+	0x5E, 0x49, 0x6E, 0x74, 0x20, 0x4E, 0x6F, 0x74, 0x20, 0xC3, 0x97, 0x20,
+	0x6F, 0x72, 0x20, 0xE1, 0xB5, 0x8D, 0xF3, 0xB0, 0x82, 0xAD, 0xF3, 0xB0,
+	0x82, 0xAE, 0xF3, 0xB0, 0x82, 0xAF, 0x20, 0x41, 0x6E, 0x64, 0x20, 0x73,
+	0x69, 0x6E, 0x68, 0xE2, 0x81, 0xBB, 0xC2, 0xB9, 0x20, 0x63, 0x6F, 0x73,
+	0x68, 0xE2, 0x81, 0xBB, 0xC2, 0xB9, 0x20, 0x74, 0x61, 0x6E, 0x68, 0xE2,
+	0x81, 0xBB, 0xC2, 0xB9, 0x20, 0xF3, 0xB0, 0x82, 0xB4, 0xF3, 0xB0, 0x82,
+	0xB5, 0x46, 0x72, 0x61, 0x63, 0x20, 0x4E, 0x65, 0x67, 0x20, 0xCB, 0xA3,
+	0xE2, 0x88, 0x9A, 0xC3, 0xB7, 0x20, 0x61, 0x6E, 0x64, 0x20, 0xE2, 0x8C,
+	0x9F, 0xF3, 0xB0, 0x82, 0xBC, 0xF3, 0xB0, 0x82, 0xBD, 0xF3, 0xB0, 0x82,
+	0xBE, 0xF3, 0xB0, 0x82, 0xBF, 0x41, 0x6E, 0x73, 0x52, 0x61, 0x6E, 0x23,
+	0x20, 0xF3, 0xB0, 0x83, 0x82, 0xF3, 0xB0, 0x83, 0x83, 0xF3, 0xB0, 0x83,
+	0x84, 0xF3, 0xB0, 0x83, 0x85, 0xF3, 0xB0, 0x83, 0x86, 0xF3, 0xB0, 0x83,
+	0x87, 0xF3, 0xB0, 0x83, 0x88, 0xF3, 0xB0, 0x83, 0x89, 0xF3, 0xB0, 0x83,
+	0x8A, 0xF3, 0xB0, 0x83, 0x8B, 0xF3, 0xB0, 0x83, 0x8C, 0xCE, 0xB8, 0xF3,
+	0xB0, 0x83, 0x8F, 0xCF, 0x80, 0x43, 0x6C, 0x73, 0xF3, 0xB0, 0x83, 0x92,
+	0x52, 0x6E, 0x64, 0x44, 0x65, 0x63, 0x48, 0x65, 0x78, 0x42, 0x69, 0x6E,
+	0x4F, 0x63, 0x74, 0xF3, 0xB0, 0x83, 0x98, 0x4E, 0x6F, 0x72, 0x6D, 0x44,
+	0x65, 0x67, 0x52, 0x61, 0x64, 0x47, 0x72, 0x61, 0x45, 0x6E, 0x67, 0x49,
+	0x6E, 0x74, 0x67, 0x20, 0xF3, 0xB0, 0x83, 0x9F, 0x50, 0x6C, 0x6F, 0x74,
+	0x20, 0x4C, 0x69, 0x6E, 0x65, 0x4C, 0x62, 0x6C, 0x20, 0x46, 0x69, 0x78,
+	0x20, 0x53, 0x63, 0x69, 0x20, 0x44, 0x73, 0x7A, 0x20, 0x49, 0x73, 0x7A,
+	0x20, 0x46, 0x61, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x56, 0x69, 0x65, 0x77,
+	0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x47, 0x6F, 0x74, 0x6F, 0x20,
+	0x50, 0x72, 0x6F, 0x67, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x59,
+	0x3D, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0xE2, 0x88, 0xAB, 0x47, 0x72,
+	0x61, 0x70, 0x68, 0x20, 0x59, 0x3E, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20,
+	0x59, 0x3C, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x59, 0xE2, 0x89, 0xA5,
+	0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x59, 0xE2, 0x89, 0xA4, 0x47, 0x72,
+	0x61, 0x70, 0x68, 0x20, 0x72, 0x3D, 0x47, 0x72, 0x61, 0x70, 0x68, 0x28,
+	0x58, 0x2C, 0x59, 0x29, 0x3D, 0x28, 0xF3, 0xB0, 0x83, 0xB6, 0xF3, 0xB0,
+	0x83, 0xB8, 0xF3, 0xB0, 0x83, 0xBA, 0x50, 0x28, 0x51, 0x28, 0x52, 0x28,
+	0x74, 0x28, 0xF3, 0xB0, 0x83, 0xBF, 0x58, 0x6D, 0x69, 0x6E, 0x58, 0x6D,
+	0x61, 0x78, 0x58, 0x73, 0x63, 0x6C, 0xF3, 0xB7, 0xBC, 0x83, 0x59, 0x6D,
+	0x69, 0x6E, 0x59, 0x6D, 0x61, 0x78, 0x59, 0x73, 0x63, 0x6C, 0xF3, 0xB7,
+	0xBC, 0x87, 0x54, 0xCE, 0xB8, 0x6D, 0x69, 0x6E, 0x54, 0xCE, 0xB8, 0x6D,
+	0x61, 0x78, 0x54, 0xCE, 0xB8, 0x70, 0x74, 0x63, 0x68, 0x58, 0x66, 0x63,
+	0x74, 0x59, 0x66, 0x63, 0x74, 0x44, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74,
+	0x44, 0x20, 0x45, 0x6E, 0x64, 0x44, 0x20, 0x70, 0x69, 0x74, 0x63, 0x68,
+	0x52, 0x69, 0x67, 0x68, 0x74, 0x58, 0x6D, 0x69, 0x6E, 0x52, 0x69, 0x67,
+	0x68, 0x74, 0x58, 0x6D, 0x61, 0x78, 0x52, 0x69, 0x67, 0x68, 0x74, 0x58,
+	0x73, 0x63, 0x6C, 0xF3, 0xB7, 0xBC, 0x93, 0x52, 0x69, 0x67, 0x68, 0x74,
+	0x59, 0x6D, 0x69, 0x6E, 0x52, 0x69, 0x67, 0x68, 0x74, 0x59, 0x6D, 0x61,
+	0x78, 0x52, 0x69, 0x67, 0x68, 0x74, 0x59, 0x73, 0x63, 0x6C, 0xF3, 0xB7,
+	0xBC, 0x97, 0x52, 0x69, 0x67, 0x68, 0x74, 0x54, 0xCE, 0xB8, 0x6D, 0x69,
+	0x6E, 0x52, 0x69, 0x67, 0x68, 0x74, 0x54, 0xCE, 0xB8, 0x6D, 0x61, 0x78,
+	0x52, 0x69, 0x67, 0x68, 0x74, 0x54, 0xCE, 0xB8, 0x70, 0x74, 0x63, 0x68,
+	0xF3, 0xB7, 0xBC, 0x9B, 0xF3, 0xB7, 0xBC, 0x9C, 0xF3, 0xB7, 0xBC, 0x9D,
+	0xF3, 0xB7, 0xBC, 0x9E, 0xF3, 0xB7, 0xBC, 0x9F, 0x4D, 0x61, 0x78, 0x28,
+	0x44, 0x65, 0x74, 0x20, 0x41, 0x72, 0x67, 0x20, 0x43, 0x6F, 0x6E, 0x6A,
+	0x67, 0x20, 0x52, 0x65, 0x50, 0x20, 0x49, 0x6D, 0x50, 0x20, 0x64, 0x2F,
+	0x64, 0x78, 0x28, 0x64, 0xC2, 0xB2, 0x2F, 0x64, 0x78, 0xC2, 0xB2, 0x28,
+	0x53, 0x6F, 0x6C, 0x76, 0x65, 0x28, 0xCE, 0xA3, 0x28, 0x46, 0x4D, 0x69,
+	0x6E, 0x28, 0x46, 0x4D, 0x61, 0x78, 0x28, 0x53, 0x65, 0x71, 0x28, 0x4D,
+	0x69, 0x6E, 0x28, 0x4D, 0x65, 0x61, 0x6E, 0x28, 0x4D, 0x65, 0x64, 0x69,
+	0x61, 0x6E, 0x28, 0xF3, 0xB7, 0xBC, 0xB0, 0xF3, 0xB7, 0xBC, 0xB1, 0xF3,
+	0xB7, 0xBC, 0xB2, 0xF3, 0xB7, 0xBC, 0xB3, 0xF3, 0xB7, 0xBC, 0xB4, 0xF3,
+	0xB7, 0xBC, 0xB5, 0xF3, 0xB7, 0xBC, 0xB6, 0xF3, 0xB7, 0xBC, 0xB7, 0xF3,
+	0xB7, 0xBC, 0xB8, 0xF3, 0xB7, 0xBC, 0xB9, 0x4D, 0x4F, 0x44, 0x28, 0x4D,
+	0x4F, 0x44, 0x5F, 0x45, 0x78, 0x70, 0x28, 0x47, 0x43, 0x44, 0x28, 0x4C,
+	0x43, 0x4D, 0x28, 0xF3, 0xB7, 0xBC, 0xBE, 0xF3, 0xB7, 0xBC, 0xBF, 0x4D,
+	0x61, 0x74, 0x20, 0x54, 0x72, 0x6E, 0x20, 0x2A, 0x52, 0x6F, 0x77, 0x20,
+	0x2A, 0x52, 0x6F, 0x77, 0x2B, 0x20, 0x52, 0x6F, 0x77, 0x2B, 0x20, 0x53,
+	0x77, 0x61, 0x70, 0x20, 0x44, 0x69, 0x6D, 0x20, 0x46, 0x69, 0x6C, 0x6C,
+	0x28, 0x49, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x41, 0x75,
+	0x67, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x4C, 0x69, 0x73, 0x74, 0xE2, 0x86,
+	0x92, 0x4D, 0x61, 0x74, 0x28, 0x4D, 0x61, 0x74, 0xE2, 0x86, 0x92, 0x4C,
+	0x69, 0x73, 0x74, 0x28, 0x53, 0x75, 0x6D, 0x20, 0x50, 0x72, 0x6F, 0x64,
+	0x20, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x20, 0x43, 0x75, 0x6D,
+	0x6C, 0x20, 0x4C, 0x69, 0x73, 0x74, 0x20, 0xCE, 0x94, 0x4C, 0x69, 0x73,
+	0x74, 0x20, 0xF3, 0xB7, 0xBD, 0x93, 0xE2, 0x88, 0xA0, 0xF3, 0xB7, 0xBD,
+	0x95, 0xF3, 0xB7, 0xBD, 0x96, 0xF3, 0xB7, 0xBD, 0x97, 0xF3, 0xB7, 0xBD,
+	0x98, 0xF3, 0xB7, 0xBD, 0x99, 0xF3, 0xB7, 0xBD, 0x9A, 0xF3, 0xB7, 0xBD,
+	0x9B, 0xF3, 0xB7, 0xBD, 0x9C, 0xF3, 0xB7, 0xBD, 0x9D, 0xF3, 0xB7, 0xBD,
+	0x9E, 0xF3, 0xB7, 0xBD, 0x9F, 0xF3, 0xB7, 0xBD, 0xA0, 0xF3, 0xB7, 0xBD,
+	0xA1, 0xF3, 0xB7, 0xBD, 0xA2, 0xF3, 0xB7, 0xBD, 0xA3, 0xF3, 0xB7, 0xBD,
+	0xA4, 0xF3, 0xB7, 0xBD, 0xA5, 0xF3, 0xB7, 0xBD, 0xA6, 0xF3, 0xB7, 0xBD,
+	0xA7, 0xF3, 0xB7, 0xBD, 0xA8, 0xF3, 0xB7, 0xBD, 0xA9, 0xF3, 0xB7, 0xBD,
+	0xAA, 0xF3, 0xB7, 0xBD, 0xAB, 0xF3, 0xB7, 0xBD, 0xAC, 0xF3, 0xB7, 0xBD,
+	0xAD, 0xF3, 0xB7, 0xBD, 0xAE, 0xF3, 0xB7, 0xBD, 0xAF, 0xF3, 0xB7, 0xBD,
+	0xB0, 0xF3, 0xB7, 0xBD, 0xB1, 0xF3, 0xB7, 0xBD, 0xB2, 0xF3, 0xB7, 0xBD,
+	0xB3, 0xF3, 0xB7, 0xBD, 0xB4, 0xF3, 0xB7, 0xBD, 0xB5, 0xF3, 0xB7, 0xBD,
+	0xB6, 0xF3, 0xB7, 0xBD, 0xB7, 0xF3, 0xB7, 0xBD, 0xB8, 0xF3, 0xB7, 0xBD,
+	0xB9, 0xF3, 0xB7, 0xBD, 0xBA, 0xF3, 0xB7, 0xBD, 0xBB, 0xF3, 0xB7, 0xBD,
+	0xBC, 0xF3, 0xB7, 0xBD, 0xBD, 0xF3, 0xB7, 0xBD, 0xBE, 0xF3, 0xB7, 0xBD,
+	0xBF, 0xF3, 0xB7, 0xBE, 0x80, 0xF3, 0xB7, 0xBE, 0x81, 0xF3, 0xB7, 0xBE,
+	0x82, 0xF3, 0xB7, 0xBE, 0x83, 0xF3, 0xB7, 0xBE, 0x84, 0xF3, 0xB7, 0xBE,
+	0x85, 0x52, 0x6E, 0x64, 0x46, 0x69, 0x78, 0x28, 0x52, 0x61, 0x6E, 0x49,
+	0x6E, 0x74, 0x23, 0x28, 0x52, 0x61, 0x6E, 0x4C, 0x69, 0x73, 0x74, 0x23,
+	0x28, 0x52, 0x61, 0x6E, 0x42, 0x69, 0x6E, 0x23, 0x28, 0x52, 0x61, 0x6E,
+	0x4E, 0x6F, 0x72, 0x6D, 0x23, 0x28, 0xF3, 0xB7, 0xBE, 0x8B, 0xF3, 0xB7,
+	0xBE, 0x8C, 0xF3, 0xB7, 0xBE, 0x8D, 0xF3, 0xB7, 0xBE, 0x8E, 0x47, 0x65,
+	0x74, 0x6B, 0x65, 0x79, 0xF3, 0xB7, 0xBE, 0x90, 0xF3, 0xB7, 0xBE, 0x91,
+	0xF3, 0xB7, 0xBE, 0x92, 0xF3, 0xB7, 0xBE, 0x93, 0xF3, 0xB7, 0xBE, 0x94,
+	0xF3, 0xB7, 0xBE, 0x95, 0xF3, 0xB7, 0xBE, 0x96, 0xF3, 0xB7, 0xBE, 0x97,
+	0xF3, 0xB7, 0xBE, 0x98, 0xF3, 0xB7, 0xBE, 0x99, 0xF3, 0xB7, 0xBE, 0x9A,
+	0xF3, 0xB7, 0xBE, 0x9B, 0xF3, 0xB7, 0xBE, 0x9C, 0xF3, 0xB7, 0xBE, 0x9D,
+	0xF3, 0xB7, 0xBE, 0x9E, 0xF3, 0xB7, 0xBE, 0x9F, 0xF3, 0xB7, 0xBE, 0xA0,
+	0xF3, 0xB7, 0xBE, 0xA1, 0xF3, 0xB7, 0xBE, 0xA2, 0xF3, 0xB7, 0xBE, 0xA3,
+	0xF3, 0xB7, 0xBE, 0xA4, 0xF3, 0xB7, 0xBE, 0xA5, 0xF3, 0xB7, 0xBE, 0xA6,
+	0xF3, 0xB7, 0xBE, 0xA7, 0xF3, 0xB7, 0xBE, 0xA8, 0xF3, 0xB7, 0xBE, 0xA9,
+	0xF3, 0xB7, 0xBE, 0xAA, 0xF3, 0xB7, 0xBE, 0xAB, 0xF3, 0xB7, 0xBE, 0xAC,
+	0xF3, 0xB7, 0xBE, 0xAD, 0xF3, 0xB7, 0xBE, 0xAE, 0xF3, 0xB7, 0xBE, 0xAF,
+	0xF3, 0xB7, 0xBE, 0xB0, 0x20, 0x4F, 0x72, 0x20, 0xF3, 0xB7, 0xBE, 0xB2,
+	0x20, 0x58, 0x6F, 0x72, 0x20, 0xF3, 0xB7, 0xBE, 0xB5, 0xF3, 0xB7, 0xBE,
+	0xB6, 0xF3, 0xB7, 0xBE, 0xB7, 0xF3, 0xB7, 0xBE, 0xB8, 0xF3, 0xB7, 0xBE,
+	0xB9, 0xF3, 0xB7, 0xBE, 0xBA, 0xF3, 0xB7, 0xBE, 0xBB, 0x20, 0x49, 0x6E,
+	0x74, 0xC3, 0xB7, 0x20, 0x20, 0x52, 0x6D, 0x64, 0x72, 0x20, 0xF3, 0xB7,
+	0xBE, 0xBE, 0xF3, 0xB7, 0xBE, 0xBF, 0xF3, 0xB7, 0xBF, 0x80, 0xF3, 0xB7,
+	0xBF, 0x81, 0xF3, 0xB7, 0xBF, 0x82, 0xF3, 0xB7, 0xBF, 0x83, 0xF3, 0xB7,
+	0xBF, 0x84, 0xF3, 0xB7, 0xBF, 0x85, 0xF3, 0xB7, 0xBF, 0x86, 0xF3, 0xB7,
+	0xBF, 0x87, 0xF3, 0xB7, 0xBF, 0x88, 0xF3, 0xB7, 0xBF, 0x89, 0xF3, 0xB7,
+	0xBF, 0x8A, 0xF3, 0xB7, 0xBF, 0x8B, 0xF3, 0xB7, 0xBF, 0x8C, 0xF3, 0xB7,
+	0xBF, 0x8D, 0xF3, 0xB7, 0xBF, 0x8E, 0xF3, 0xB7, 0xBF, 0x8F, 0xF3, 0xB7,
+	0xBF, 0x90, 0xF3, 0xB7, 0xBF, 0x91, 0xF3, 0xB7, 0xBF, 0x92, 0xF3, 0xB7,
+	0xBF, 0x93, 0xF3, 0xB7, 0xBF, 0x94, 0xF3, 0xB7, 0xBF, 0x95, 0xF3, 0xB7,
+	0xBF, 0x96, 0xF3, 0xB7, 0xBF, 0x97, 0xF3, 0xB7, 0xBF, 0x98, 0xF3, 0xB7,
+	0xBF, 0x99, 0xF3, 0xB7, 0xBF, 0x9A, 0xF3, 0xB7, 0xBF, 0x9B, 0xF3, 0xB7,
+	0xBF, 0x9C, 0xF3, 0xB7, 0xBF, 0x9D, 0xF3, 0xB7, 0xBF, 0x9E, 0xF3, 0xB7,
+	0xBF, 0x9F, 0xF3, 0xB7, 0xBF, 0xA0, 0xF3, 0xB7, 0xBF, 0xA1, 0xF3, 0xB7,
+	0xBF, 0xA2, 0xF3, 0xB7, 0xBF, 0xA3, 0xF3, 0xB7, 0xBF, 0xA4, 0xF3, 0xB7,
+	0xBF, 0xA5, 0xF3, 0xB7, 0xBF, 0xA6, 0xF3, 0xB7, 0xBF, 0xA7, 0xF3, 0xB7,
+	0xBF, 0xA8, 0xF3, 0xB7, 0xBF, 0xA9, 0xF3, 0xB7, 0xBF, 0xAA, 0xF3, 0xB7,
+	0xBF, 0xAB, 0xF3, 0xB7, 0xBF, 0xAC, 0xF3, 0xB7, 0xBF, 0xAD, 0xF3, 0xB7,
+	0xBF, 0xAE, 0xF3, 0xB7, 0xBF, 0xAF, 0xF3, 0xB7, 0xBF, 0xB0, 0xF3, 0xB7,
+	0xBF, 0xB1, 0xF3, 0xB7, 0xBF, 0xB2, 0xF3, 0xB7, 0xBF, 0xB3, 0xF3, 0xB7,
+	0xBF, 0xB4, 0xF3, 0xB7, 0xBF, 0xB5, 0xF3, 0xB7, 0xBF, 0xB6, 0xF3, 0xB7,
+	0xBF, 0xB7, 0xF3, 0xB7, 0xBF, 0xB8, 0xF3, 0xB7, 0xBF, 0xB9, 0xF3, 0xB7,
+	0xBF, 0xBA, 0xF3, 0xB7, 0xBF, 0xBB, 0xF3, 0xB7, 0xBF, 0xBC, 0xF3, 0xB7,
+	0xBF, 0xBD, 0xF3, 0xB7, 0xBF, 0xBE, 0xF3, 0xB7, 0xBF, 0xBF, 0xF3, 0xBE,
+	0x94, 0x80, 0xF3, 0xBE, 0x94, 0x81, 0xF3, 0xBE, 0x94, 0x82, 0xF3, 0xBE,
+	0x94, 0x83, 0xF3, 0xBE, 0x94, 0x84, 0xF3, 0xBE, 0x94, 0x85, 0xF3, 0xBE,
+	0x94, 0x86, 0xF3, 0xBE, 0x94, 0x87, 0xF3, 0xBE, 0x94, 0x88, 0xF3, 0xBE,
+	0x94, 0x89, 0xF3, 0xBE, 0x94, 0x8A, 0xF3, 0xBE, 0x94, 0x8B, 0xF3, 0xBE,
+	0x94, 0x8C, 0xF3, 0xBE, 0x94, 0x8D, 0xF3, 0xBE, 0x94, 0x8E, 0xF3, 0xBE,
+	0x94, 0x8F, 0xF3, 0xBE, 0x94, 0x90, 0xF3, 0xBE, 0x94, 0x91, 0xF3, 0xBE,
+	0x94, 0x92, 0xF3, 0xBE, 0x94, 0x93, 0xF3, 0xBE, 0x94, 0x94, 0xF3, 0xBE,
+	0x94, 0x95, 0xF3, 0xBE, 0x94, 0x96, 0xF3, 0xBE, 0x94, 0x97, 0xF3, 0xBE,
+	0x94, 0x98, 0xF3, 0xBE, 0x94, 0x99, 0xF3, 0xBE, 0x94, 0x9A, 0xF3, 0xBE,
+	0x94, 0x9B, 0xF3, 0xBE, 0x94, 0x9C, 0xF3, 0xBE, 0x94, 0x9D, 0xF3, 0xBE,
+	0x94, 0x9E, 0xF3, 0xBE, 0x94, 0x9F, 0xF3, 0xBE, 0x94, 0xA0, 0xF3, 0xBE,
+	0x94, 0xA1, 0xF3, 0xBE, 0x94, 0xA2, 0xF3, 0xBE, 0x94, 0xA3, 0xF3, 0xBE,
+	0x94, 0xA4, 0xF3, 0xBE, 0x94, 0xA5, 0xF3, 0xBE, 0x94, 0xA6, 0xF3, 0xBE,
+	0x94, 0xA7, 0xF3, 0xBE, 0x94, 0xA8, 0xF3, 0xBE, 0x94, 0xA9, 0xF3, 0xBE,
+	0x94, 0xAA, 0xF3, 0xBE, 0x94, 0xAB, 0xF3, 0xBE, 0x94, 0xAC, 0xF3, 0xBE,
+	0x94, 0xAD, 0xF3, 0xBE, 0x94, 0xAE, 0xF3, 0xBE, 0x94, 0xAF, 0xF3, 0xBE,
+	0x94, 0xB0, 0xF3, 0xBE, 0x94, 0xB1, 0xF3, 0xBE, 0x94, 0xB2, 0xF3, 0xBE,
+	0x94, 0xB3, 0xF3, 0xBE, 0x94, 0xB4, 0xF3, 0xBE, 0x94, 0xB5, 0xF3, 0xBE,
+	0x94, 0xB6, 0xF3, 0xBE, 0x94, 0xB7, 0xF3, 0xBE, 0x94, 0xB8, 0xF3, 0xBE,
+	0x94, 0xB9, 0xF3, 0xBE, 0x94, 0xBA, 0xF3, 0xBE, 0x94, 0xBB, 0xF3, 0xBE,
+	0x94, 0xBC, 0xF3, 0xBE, 0x94, 0xBD, 0xF3, 0xBE, 0x94, 0xBE, 0xF3, 0xBE,
+	0x94, 0xBF, 0xF3, 0xBE, 0x95, 0x80, 0xF3, 0xBE, 0x95, 0x81, 0xF3, 0xBE,
+	0x95, 0x82, 0xF3, 0xBE, 0x95, 0x83, 0xF3, 0xBE, 0x95, 0x84, 0xF3, 0xBE,
+	0x95, 0x85, 0xF3, 0xBE, 0x95, 0x86, 0xF3, 0xBE, 0x95, 0x87, 0xF3, 0xBE,
+	0x95, 0x88, 0xF3, 0xBE, 0x95, 0x89, 0xF3, 0xBE, 0x95, 0x8A, 0xF3, 0xBE,
+	0x95, 0x8B, 0xF3, 0xBE, 0x95, 0x8C, 0xF3, 0xBE, 0x95, 0x8D, 0xF3, 0xBE,
+	0x95, 0x8E, 0xF3, 0xBE, 0x95, 0x8F, 0xF3, 0xBE, 0x95, 0x90, 0xF3, 0xBE,
+	0x95, 0x91, 0xF3, 0xBE, 0x95, 0x92, 0xF3, 0xBE, 0x95, 0x93, 0xF3, 0xBE,
+	0x95, 0x94, 0xF3, 0xBE, 0x95, 0x95, 0xF3, 0xBE, 0x95, 0x96, 0xF3, 0xBE,
+	0x95, 0x97, 0xF3, 0xBE, 0x95, 0x98, 0xF3, 0xBE, 0x95, 0x99, 0xF3, 0xBE,
+	0x95, 0x9A, 0xF3, 0xBE, 0x95, 0x9B, 0xF3, 0xBE, 0x95, 0x9C, 0xF3, 0xBE,
+	0x95, 0x9D, 0xF3, 0xBE, 0x95, 0x9E, 0xF3, 0xBE, 0x95, 0x9F, 0xF3, 0xBE,
+	0x95, 0xA0, 0xF3, 0xBE, 0x95, 0xA1, 0xF3, 0xBE, 0x95, 0xA2, 0xF3, 0xBE,
+	0x95, 0xA3, 0xF3, 0xBE, 0x95, 0xA4, 0xF3, 0xBE, 0x95, 0xA5, 0xF3, 0xBE,
+	0x95, 0xA6, 0xF3, 0xBE, 0x95, 0xA7, 0xF3, 0xBE, 0x95, 0xA8, 0xF3, 0xBE,
+	0x95, 0xA9, 0xF3, 0xBE, 0x95, 0xAA, 0xF3, 0xBE, 0x95, 0xAB, 0xF3, 0xBE,
+	0x95, 0xAC, 0xF3, 0xBE, 0x95, 0xAD, 0xF3, 0xBE, 0x95, 0xAE, 0xF3, 0xBE,
+	0x95, 0xAF, 0xF3, 0xBE, 0x95, 0xB0, 0xF3, 0xBE, 0x95, 0xB1, 0xF3, 0xBE,
+	0x95, 0xB2, 0xF3, 0xBE, 0x95, 0xB3, 0xF3, 0xBE, 0x95, 0xB4, 0xF3, 0xBE,
+	0x95, 0xB5, 0xF3, 0xBE, 0x95, 0xB6, 0xF3, 0xBE, 0x95, 0xB7, 0xF3, 0xBE,
+	0x95, 0xB8, 0xF3, 0xBE, 0x95, 0xB9, 0xF3, 0xBE, 0x95, 0xBA, 0xF3, 0xBE,
+	0x95, 0xBB, 0xF3, 0xBE, 0x95, 0xBC, 0xF3, 0xBE, 0x95, 0xBD, 0xF3, 0xBE,
+	0x95, 0xBE, 0xF3, 0xBE, 0x95, 0xBF, 0xF3, 0xBE, 0x96, 0x80, 0xF3, 0xBE,
+	0x96, 0x81, 0xF3, 0xBE, 0x96, 0x82, 0xF3, 0xBE, 0x96, 0x83, 0xF3, 0xBE,
+	0x96, 0x84, 0xF3, 0xBE, 0x96, 0x85, 0xF3, 0xBE, 0x96, 0x86, 0xF3, 0xBE,
+	0x96, 0x87, 0xF3, 0xBE, 0x96, 0x88, 0xF3, 0xBE, 0x96, 0x89, 0xF3, 0xBE,
+	0x96, 0x8A, 0xF3, 0xBE, 0x96, 0x8B, 0xF3, 0xBE, 0x96, 0x8C, 0xF3, 0xBE,
+	0x96, 0x8D, 0xF3, 0xBE, 0x96, 0x8E, 0xF3, 0xBE, 0x96, 0x8F, 0xF3, 0xBE,
+	0x96, 0x90, 0xF3, 0xBE, 0x96, 0x91, 0xF3, 0xBE, 0x96, 0x92, 0xF3, 0xBE,
+	0x96, 0x93, 0xF3, 0xBE, 0x96, 0x94, 0xF3, 0xBE, 0x96, 0x95, 0xF3, 0xBE,
+	0x96, 0x96, 0xF3, 0xBE, 0x96, 0x97, 0xF3, 0xBE, 0x96, 0x98, 0xF3, 0xBE,
+	0x96, 0x99, 0xF3, 0xBE, 0x96, 0x9A, 0xF3, 0xBE, 0x96, 0x9B, 0xF3, 0xBE,
+	0x96, 0x9C, 0xF3, 0xBE, 0x96, 0x9D, 0xF3, 0xBE, 0x96, 0x9E, 0xF3, 0xBE,
+	0x96, 0x9F, 0xF3, 0xBE, 0x96, 0xA0, 0xF3, 0xBE, 0x96, 0xA1, 0xF3, 0xBE,
+	0x96, 0xA2, 0xF3, 0xBE, 0x96, 0xA3, 0xF3, 0xBE, 0x96, 0xA4, 0xF3, 0xBE,
+	0x96, 0xA5, 0xF3, 0xBE, 0x96, 0xA6, 0xF3, 0xBE, 0x96, 0xA7, 0xF3, 0xBE,
+	0x96, 0xA8, 0xF3, 0xBE, 0x96, 0xA9, 0xF3, 0xBE, 0x96, 0xAA, 0xF3, 0xBE,
+	0x96, 0xAB, 0xF3, 0xBE, 0x96, 0xAC, 0xF3, 0xBE, 0x96, 0xAD, 0xF3, 0xBE,
+	0x96, 0xAE, 0xF3, 0xBE, 0x96, 0xAF, 0xF3, 0xBE, 0x96, 0xB0, 0xF3, 0xBE,
+	0x96, 0xB1, 0xF3, 0xBE, 0x96, 0xB2, 0xF3, 0xBE, 0x96, 0xB3, 0xF3, 0xBE,
+	0x96, 0xB4, 0xF3, 0xBE, 0x96, 0xB5, 0xF3, 0xBE, 0x96, 0xB6, 0xF3, 0xBE,
+	0x96, 0xB7, 0xF3, 0xBE, 0x96, 0xB8, 0xF3, 0xBE, 0x96, 0xB9, 0xF3, 0xBE,
+	0x96, 0xBA, 0xF3, 0xBE, 0x96, 0xBB, 0xF3, 0xBE, 0x96, 0xBC, 0xF3, 0xBE,
+	0x96, 0xBD, 0xF3, 0xBE, 0x96, 0xBE, 0xF3, 0xBE, 0x96, 0xBF, 0xF3, 0xBE,
+	0x97, 0x80, 0xF3, 0xBE, 0x97, 0x81, 0xF3, 0xBE, 0x97, 0x82, 0xF3, 0xBE,
+	0x97, 0x83, 0xF3, 0xBE, 0x97, 0x84, 0xF3, 0xBE, 0x97, 0x85, 0xF3, 0xBE,
+	0x97, 0x86, 0xF3, 0xBE, 0x97, 0x87, 0xF3, 0xBE, 0x97, 0x88, 0xF3, 0xBE,
+	0x97, 0x89, 0xF3, 0xBE, 0x97, 0x8A, 0xF3, 0xBE, 0x97, 0x8B, 0xF3, 0xBE,
+	0x97, 0x8C, 0xF3, 0xBE, 0x97, 0x8D, 0xF3, 0xBE, 0x97, 0x8E, 0xF3, 0xBE,
+	0x97, 0x8F, 0xF3, 0xBE, 0x97, 0x90, 0xF3, 0xBE, 0x97, 0x91, 0xF3, 0xBE,
+	0x97, 0x92, 0xF3, 0xBE, 0x97, 0x93, 0xF3, 0xBE, 0x97, 0x94, 0xF3, 0xBE,
+	0x97, 0x95, 0xF3, 0xBE, 0x97, 0x96, 0xF3, 0xBE, 0x97, 0x97, 0xF3, 0xBE,
+	0x97, 0x98, 0xF3, 0xBE, 0x97, 0x99, 0xF3, 0xBE, 0x97, 0x9A, 0xF3, 0xBE,
+	0x97, 0x9B, 0xF3, 0xBE, 0x97, 0x9C, 0xF3, 0xBE, 0x97, 0x9D, 0xF3, 0xBE,
+	0x97, 0x9E, 0xF3, 0xBE, 0x97, 0x9F, 0xF3, 0xBE, 0x97, 0xA0, 0xF3, 0xBE,
+	0x97, 0xA1, 0xF3, 0xBE, 0x97, 0xA2, 0xF3, 0xBE, 0x97, 0xA3, 0xF3, 0xBE,
+	0x97, 0xA4, 0xF3, 0xBE, 0x97, 0xA5, 0xF3, 0xBE, 0x97, 0xA6, 0xF3, 0xBE,
+	0x97, 0xA7, 0xF3, 0xBE, 0x97, 0xA8, 0xF3, 0xBE, 0x97, 0xA9, 0xF3, 0xBE,
+	0x97, 0xAA, 0xF3, 0xBE, 0x97, 0xAB, 0xF3, 0xBE, 0x97, 0xAC, 0xF3, 0xBE,
+	0x97, 0xAD, 0xF3, 0xBE, 0x97, 0xAE, 0xF3, 0xBE, 0x97, 0xAF, 0xF3, 0xBE,
+	0x97, 0xB0, 0xF3, 0xBE, 0x97, 0xB1, 0xF3, 0xBE, 0x97, 0xB2, 0xF3, 0xBE,
+	0x97, 0xB3, 0xF3, 0xBE, 0x97, 0xB4, 0xF3, 0xBE, 0x97, 0xB5, 0xF3, 0xBE,
+	0x97, 0xB6, 0xF3, 0xBE, 0x97, 0xB7, 0xF3, 0xBE, 0x97, 0xB8, 0xF3, 0xBE,
+	0x97, 0xB9, 0xF3, 0xBE, 0x97, 0xBA, 0xF3, 0xBE, 0x97, 0xBB, 0xF3, 0xBE,
+	0x97, 0xBC, 0xF3, 0xBE, 0x97, 0xBD, 0xF3, 0xBE, 0x97, 0xBE, 0xF3, 0xBE,
+	0x97, 0xBF, 0xF3, 0xBE, 0x98, 0x80, 0xF3, 0xBE, 0x98, 0x81, 0xF3, 0xBE,
+	0x98, 0x82, 0xF3, 0xBE, 0x98, 0x83, 0xF3, 0xBE, 0x98, 0x84, 0xF3, 0xBE,
+	0x98, 0x85, 0xF3, 0xBE, 0x98, 0x86, 0xF3, 0xBE, 0x98, 0x87, 0xF3, 0xBE,
+	0x98, 0x88, 0xF3, 0xBE, 0x98, 0x89, 0xF3, 0xBE, 0x98, 0x8A, 0xF3, 0xBE,
+	0x98, 0x8B, 0xF3, 0xBE, 0x98, 0x8C, 0xF3, 0xBE, 0x98, 0x8D, 0xF3, 0xBE,
+	0x98, 0x8E, 0xF3, 0xBE, 0x98, 0x8F, 0xF3, 0xBE, 0x98, 0x90, 0xF3, 0xBE,
+	0x98, 0x91, 0xF3, 0xBE, 0x98, 0x92, 0xF3, 0xBE, 0x98, 0x93, 0xF3, 0xBE,
+	0x98, 0x94, 0xF3, 0xBE, 0x98, 0x95, 0xF3, 0xBE, 0x98, 0x96, 0xF3, 0xBE,
+	0x98, 0x97, 0xF3, 0xBE, 0x98, 0x98, 0xF3, 0xBE, 0x98, 0x99, 0xF3, 0xBE,
+	0x98, 0x9A, 0xF3, 0xBE, 0x98, 0x9B, 0xF3, 0xBE, 0x98, 0x9C, 0xF3, 0xBE,
+	0x98, 0x9D, 0xF3, 0xBE, 0x98, 0x9E, 0xF3, 0xBE, 0x98, 0x9F, 0xF3, 0xBE,
+	0x98, 0xA0, 0xF3, 0xBE, 0x98, 0xA1, 0xF3, 0xBE, 0x98, 0xA2, 0xF3, 0xBE,
+	0x98, 0xA3, 0xF3, 0xBE, 0x98, 0xA4, 0xF3, 0xBE, 0x98, 0xA5, 0xF3, 0xBE,
+	0x98, 0xA6, 0xF3, 0xBE, 0x98, 0xA7, 0xF3, 0xBE, 0x98, 0xA8, 0xF3, 0xBE,
+	0x98, 0xA9, 0xF3, 0xBE, 0x98, 0xAA, 0xF3, 0xBE, 0x98, 0xAB, 0xF3, 0xBE,
+	0x98, 0xAC, 0xF3, 0xBE, 0x98, 0xAD, 0xF3, 0xBE, 0x98, 0xAE, 0xF3, 0xBE,
+	0x98, 0xAF, 0xF3, 0xBE, 0x98, 0xB0, 0xF3, 0xBE, 0x98, 0xB1, 0xF3, 0xBE,
+	0x98, 0xB2, 0xF3, 0xBE, 0x98, 0xB3, 0xF3, 0xBE, 0x98, 0xB4, 0xF3, 0xBE,
+	0x98, 0xB5, 0xF3, 0xBE, 0x98, 0xB6, 0xF3, 0xBE, 0x98, 0xB7, 0xF3, 0xBE,
+	0x98, 0xB8, 0xF3, 0xBE, 0x98, 0xB9, 0xF3, 0xBE, 0x98, 0xBA, 0xF3, 0xBE,
+	0x98, 0xBB, 0xF3, 0xBE, 0x98, 0xBC, 0xF3, 0xBE, 0x98, 0xBD, 0xF3, 0xBE,
+	0x98, 0xBE, 0xF3, 0xBE, 0x98, 0xBF, 0xF3, 0xBE, 0x99, 0x80, 0xF3, 0xBE,
+	0x99, 0x81, 0xF3, 0xBE, 0x99, 0x82, 0xF3, 0xBE, 0x99, 0x83, 0xF3, 0xBE,
+	0x99, 0x84, 0xF3, 0xBE, 0x99, 0x85, 0xF3, 0xBE, 0x99, 0x86, 0xF3, 0xBE,
+	0x99, 0x87, 0xF3, 0xBE, 0x99, 0x88, 0xF3, 0xBE, 0x99, 0x89, 0xF3, 0xBE,
+	0x99, 0x8A, 0xF3, 0xBE, 0x99, 0x8B, 0xF3, 0xBE, 0x99, 0x8C, 0xF3, 0xBE,
+	0x99, 0x8D, 0xF3, 0xBE, 0x99, 0x8E, 0xF3, 0xBE, 0x99, 0x8F, 0xF3, 0xBE,
+	0x99, 0x90, 0xF3, 0xBE, 0x99, 0x91, 0xF3, 0xBE, 0x99, 0x92, 0xF3, 0xBE,
+	0x99, 0x93, 0xF3, 0xBE, 0x99, 0x94, 0xF3, 0xBE, 0x99, 0x95, 0xF3, 0xBE,
+	0x99, 0x96, 0xF3, 0xBE, 0x99, 0x97, 0xF3, 0xBE, 0x99, 0x98, 0xF3, 0xBE,
+	0x99, 0x99, 0xF3, 0xBE, 0x99, 0x9A, 0xF3, 0xBE, 0x99, 0x9B, 0xF3, 0xBE,
+	0x99, 0x9C, 0xF3, 0xBE, 0x99, 0x9D, 0xF3, 0xBE, 0x99, 0x9E, 0xF3, 0xBE,
+	0x99, 0x9F, 0xF3, 0xBE, 0x99, 0xA0, 0xF3, 0xBE, 0x99, 0xA1, 0xF3, 0xBE,
+	0x99, 0xA2, 0xF3, 0xBE, 0x99, 0xA3, 0xF3, 0xBE, 0x99, 0xA4, 0xF3, 0xBE,
+	0x99, 0xA5, 0xF3, 0xBE, 0x99, 0xA6, 0xF3, 0xBE, 0x99, 0xA7, 0xF3, 0xBE,
+	0x99, 0xA8, 0xF3, 0xBE, 0x99, 0xA9, 0xF3, 0xBE, 0x99, 0xAA, 0xF3, 0xBE,
+	0x99, 0xAB, 0xF3, 0xBE, 0x99, 0xAC, 0xF3, 0xBE, 0x99, 0xAD, 0xF3, 0xBE,
+	0x99, 0xAE, 0xF3, 0xBE, 0x99, 0xAF, 0xF3, 0xBE, 0x99, 0xB0, 0xF3, 0xBE,
+	0x99, 0xB1, 0xF3, 0xBE, 0x99, 0xB2, 0xF3, 0xBE, 0x99, 0xB3, 0xF3, 0xBE,
+	0x99, 0xB4, 0xF3, 0xBE, 0x99, 0xB5, 0xF3, 0xBE, 0x99, 0xB6, 0xF3, 0xBE,
+	0x99, 0xB7, 0xF3, 0xBE, 0x99, 0xB8, 0xF3, 0xBE, 0x99, 0xB9, 0xF3, 0xBE,
+	0x99, 0xBA, 0xF3, 0xBE, 0x99, 0xBB, 0xF3, 0xBE, 0x99, 0xBC, 0xF3, 0xBE,
+	0x99, 0xBD, 0xF3, 0xBE, 0x99, 0xBE, 0xF3, 0xBE, 0x99, 0xBF, 0xF3, 0xBE,
+	0x9A, 0x80, 0xF3, 0xBE, 0x9A, 0x81, 0xF3, 0xBE, 0x9A, 0x82, 0xF3, 0xBE,
+	0x9A, 0x83, 0xF3, 0xBE, 0x9A, 0x84, 0xF3, 0xBE, 0x9A, 0x85, 0xF3, 0xBE,
+	0x9A, 0x86, 0xF3, 0xBE, 0x9A, 0x87, 0xF3, 0xBE, 0x9A, 0x88, 0xF3, 0xBE,
+	0x9A, 0x89, 0xF3, 0xBE, 0x9A, 0x8A, 0xF3, 0xBE, 0x9A, 0x8B, 0xF3, 0xBE,
+	0x9A, 0x8C, 0xF3, 0xBE, 0x9A, 0x8D, 0xF3, 0xBE, 0x9A, 0x8E, 0xF3, 0xBE,
+	0x9A, 0x8F, 0xF3, 0xBE, 0x9A, 0x90, 0xF3, 0xBE, 0x9A, 0x91, 0xF3, 0xBE,
+	0x9A, 0x92, 0xF3, 0xBE, 0x9A, 0x93, 0xF3, 0xBE, 0x9A, 0x94, 0xF3, 0xBE,
+	0x9A, 0x95, 0xF3, 0xBE, 0x9A, 0x96, 0xF3, 0xBE, 0x9A, 0x97, 0xF3, 0xBE,
+	0x9A, 0x98, 0xF3, 0xBE, 0x9A, 0x99, 0xF3, 0xBE, 0x9A, 0x9A, 0xF3, 0xBE,
+	0x9A, 0x9B, 0xF3, 0xBE, 0x9A, 0x9C, 0xF3, 0xBE, 0x9A, 0x9D, 0xF3, 0xBE,
+	0x9A, 0x9E, 0xF3, 0xBE, 0x9A, 0x9F, 0xF3, 0xBE, 0x9A, 0xA0, 0xF3, 0xBE,
+	0x9A, 0xA1, 0xF3, 0xBE, 0x9A, 0xA2, 0xF3, 0xBE, 0x9A, 0xA3, 0xF3, 0xBE,
+	0x9A, 0xA4, 0xF3, 0xBE, 0x9A, 0xA5, 0xF3, 0xBE, 0x9A, 0xA6, 0xF3, 0xBE,
+	0x9A, 0xA7, 0xF3, 0xBE, 0x9A, 0xA8, 0xF3, 0xBE, 0x9A, 0xA9, 0xF3, 0xBE,
+	0x9A, 0xAA, 0xF3, 0xBE, 0x9A, 0xAB, 0xF3, 0xBE, 0x9A, 0xAC, 0xF3, 0xBE,
+	0x9A, 0xAD, 0xF3, 0xBE, 0x9A, 0xAE, 0xF3, 0xBE, 0x9A, 0xAF, 0xF3, 0xBE,
+	0x9A, 0xB0, 0xF3, 0xBE, 0x9A, 0xB1, 0xF3, 0xBE, 0x9A, 0xB2, 0xF3, 0xBE,
+	0x9A, 0xB3, 0xF3, 0xBE, 0x9A, 0xB4, 0xF3, 0xBE, 0x9A, 0xB5, 0xF3, 0xBE,
+	0x9A, 0xB6, 0xF3, 0xBE, 0x9A, 0xB7, 0xF3, 0xBE, 0x9A, 0xB8, 0xF3, 0xBE,
+	0x9A, 0xB9, 0xF3, 0xBE, 0x9A, 0xBA, 0xF3, 0xBE, 0x9A, 0xBB, 0xF3, 0xBE,
+	0x9A, 0xBC, 0xF3, 0xBE, 0x9A, 0xBD, 0xF3, 0xBE, 0x9A, 0xBE, 0xF3, 0xBE,
+	0x9A, 0xBF, 0xF3, 0xBE, 0x9B, 0x80, 0xF3, 0xBE, 0x9B, 0x81, 0xF3, 0xBE,
+	0x9B, 0x82, 0xF3, 0xBE, 0x9B, 0x83, 0xF3, 0xBE, 0x9B, 0x84, 0xF3, 0xBE,
+	0x9B, 0x85, 0xF3, 0xBE, 0x9B, 0x86, 0xF3, 0xBE, 0x9B, 0x87, 0xF3, 0xBE,
+	0x9B, 0x88, 0xF3, 0xBE, 0x9B, 0x89, 0xF3, 0xBE, 0x9B, 0x8A, 0xF3, 0xBE,
+	0x9B, 0x8B, 0xF3, 0xBE, 0x9B, 0x8C, 0xF3, 0xBE, 0x9B, 0x8D, 0xF3, 0xBE,
+	0x9B, 0x8E, 0xF3, 0xBE, 0x9B, 0x8F, 0xF3, 0xBE, 0x9B, 0x90, 0xF3, 0xBE,
+	0x9B, 0x91, 0xF3, 0xBE, 0x9B, 0x92, 0xF3, 0xBE, 0x9B, 0x93, 0xF3, 0xBE,
+	0x9B, 0x94, 0xF3, 0xBE, 0x9B, 0x95, 0xF3, 0xBE, 0x9B, 0x96, 0xF3, 0xBE,
+	0x9B, 0x97, 0xF3, 0xBE, 0x9B, 0x98, 0xF3, 0xBE, 0x9B, 0x99, 0xF3, 0xBE,
+	0x9B, 0x9A, 0xF3, 0xBE, 0x9B, 0x9B, 0xF3, 0xBE, 0x9B, 0x9C, 0xF3, 0xBE,
+	0x9B, 0x9D, 0xF3, 0xBE, 0x9B, 0x9E, 0xF3, 0xBE, 0x9B, 0x9F, 0xF3, 0xBE,
+	0x9B, 0xA0, 0xF3, 0xBE, 0x9B, 0xA1, 0xF3, 0xBE, 0x9B, 0xA2, 0xF3, 0xBE,
+	0x9B, 0xA3, 0xF3, 0xBE, 0x9B, 0xA4, 0xF3, 0xBE, 0x9B, 0xA5, 0xF3, 0xBE,
+	0x9B, 0xA6, 0xF3, 0xBE, 0x9B, 0xA7, 0xF3, 0xBE, 0x9B, 0xA8, 0xF3, 0xBE,
+	0x9B, 0xA9, 0xF3, 0xBE, 0x9B, 0xAA, 0xF3, 0xBE, 0x9B, 0xAB, 0xF3, 0xBE,
+	0x9B, 0xAC, 0xF3, 0xBE, 0x9B, 0xAD, 0xF3, 0xBE, 0x9B, 0xAE, 0xF3, 0xBE,
+	0x9B, 0xAF, 0xF3, 0xBE, 0x9B, 0xB0, 0xF3, 0xBE, 0x9B, 0xB1, 0xF3, 0xBE,
+	0x9B, 0xB2, 0xF3, 0xBE, 0x9B, 0xB3, 0xF3, 0xBE, 0x9B, 0xB4, 0xF3, 0xBE,
+	0x9B, 0xB5, 0xF3, 0xBE, 0x9B, 0xB6, 0xF3, 0xBE, 0x9B, 0xB7, 0xF3, 0xBE,
+	0x9B, 0xB8, 0xF3, 0xBE, 0x9B, 0xB9, 0xF3, 0xBE, 0x9B, 0xBA, 0xF3, 0xBE,
+	0x9B, 0xBB, 0xF3, 0xBE, 0x9B, 0xBC, 0xF3, 0xBE, 0x9B, 0xBD, 0xF3, 0xBE,
+	0x9B, 0xBE, 0xF3, 0xBE, 0x9B, 0xBF, 0xF3, 0xBE, 0x9C, 0x80, 0xF3, 0xBE,
+	0x9C, 0x81, 0xF3, 0xBE, 0x9C, 0x82, 0xF3, 0xBE, 0x9C, 0x83, 0xF3, 0xBE,
+	0x9C, 0x84, 0xF3, 0xBE, 0x9C, 0x85, 0xF3, 0xBE, 0x9C, 0x86, 0xF3, 0xBE,
+	0x9C, 0x87, 0xF3, 0xBE, 0x9C, 0x88, 0xF3, 0xBE, 0x9C, 0x89, 0xF3, 0xBE,
+	0x9C, 0x8A, 0xF3, 0xBE, 0x9C, 0x8B, 0xF3, 0xBE, 0x9C, 0x8C, 0xF3, 0xBE,
+	0x9C, 0x8D, 0xF3, 0xBE, 0x9C, 0x8E, 0xF3, 0xBE, 0x9C, 0x8F, 0xF3, 0xBE,
+	0x9C, 0x90, 0xF3, 0xBE, 0x9C, 0x91, 0xF3, 0xBE, 0x9C, 0x92, 0xF3, 0xBE,
+	0x9C, 0x93, 0xF3, 0xBE, 0x9C, 0x94, 0xF3, 0xBE, 0x9C, 0x95, 0xF3, 0xBE,
+	0x9C, 0x96, 0xF3, 0xBE, 0x9C, 0x97, 0xF3, 0xBE, 0x9C, 0x98, 0xF3, 0xBE,
+	0x9C, 0x99, 0xF3, 0xBE, 0x9C, 0x9A, 0xF3, 0xBE, 0x9C, 0x9B, 0xF3, 0xBE,
+	0x9C, 0x9C, 0xF3, 0xBE, 0x9C, 0x9D, 0xF3, 0xBE, 0x9C, 0x9E, 0xF3, 0xBE,
+	0x9C, 0x9F, 0xF3, 0xBE, 0x9C, 0xA0, 0xF3, 0xBE, 0x9C, 0xA1, 0xF3, 0xBE,
+	0x9C, 0xA2, 0xF3, 0xBE, 0x9C, 0xA3, 0xF3, 0xBE, 0x9C, 0xA4, 0xF3, 0xBE,
+	0x9C, 0xA5, 0xF3, 0xBE, 0x9C, 0xA6, 0xF3, 0xBE, 0x9C, 0xA7, 0xF3, 0xBE,
+	0x9C, 0xA8, 0xF3, 0xBE, 0x9C, 0xA9, 0xF3, 0xBE, 0x9C, 0xAA, 0xF3, 0xBE,
+	0x9C, 0xAB, 0xF3, 0xBE, 0x9C, 0xAC, 0xF3, 0xBE, 0x9C, 0xAD, 0xF3, 0xBE,
+	0x9C, 0xAE, 0xF3, 0xBE, 0x9C, 0xAF, 0xF3, 0xBE, 0x9C, 0xB0, 0xF3, 0xBE,
+	0x9C, 0xB1, 0xF3, 0xBE, 0x9C, 0xB2, 0xF3, 0xBE, 0x9C, 0xB3, 0xF3, 0xBE,
+	0x9C, 0xB4, 0xF3, 0xBE, 0x9C, 0xB5, 0xF3, 0xBE, 0x9C, 0xB6, 0xF3, 0xBE,
+	0x9C, 0xB7, 0xF3, 0xBE, 0x9C, 0xB8, 0xF3, 0xBE, 0x9C, 0xB9, 0xF3, 0xBE,
+	0x9C, 0xBA, 0xF3, 0xBE, 0x9C, 0xBB, 0xF3, 0xBE, 0x9C, 0xBC, 0xF3, 0xBE,
+	0x9C, 0xBD, 0xF3, 0xBE, 0x9C, 0xBE, 0xF3, 0xBE, 0x9C, 0xBF, 0xF3, 0xBE,
+	0x9D, 0x80, 0xF3, 0xBE, 0x9D, 0x81, 0xF3, 0xBE, 0x9D, 0x82, 0xF3, 0xBE,
+	0x9D, 0x83, 0xF3, 0xBE, 0x9D, 0x84, 0xF3, 0xBE, 0x9D, 0x85, 0xF3, 0xBE,
+	0x9D, 0x86, 0xF3, 0xBE, 0x9D, 0x87, 0xF3, 0xBE, 0x9D, 0x88, 0xF3, 0xBE,
+	0x9D, 0x89, 0xF3, 0xBE, 0x9D, 0x8A, 0xF3, 0xBE, 0x9D, 0x8B, 0xF3, 0xBE,
+	0x9D, 0x8C, 0xF3, 0xBE, 0x9D, 0x8D, 0xF3, 0xBE, 0x9D, 0x8E, 0xF3, 0xBE,
+	0x9D, 0x8F, 0xF3, 0xBE, 0x9D, 0x90, 0xF3, 0xBE, 0x9D, 0x91, 0xF3, 0xBE,
+	0x9D, 0x92, 0xF3, 0xBE, 0x9D, 0x93, 0xF3, 0xBE, 0x9D, 0x94, 0xF3, 0xBE,
+	0x9D, 0x95, 0xF3, 0xBE, 0x9D, 0x96, 0xF3, 0xBE, 0x9D, 0x97, 0xF3, 0xBE,
+	0x9D, 0x98, 0xF3, 0xBE, 0x9D, 0x99, 0xF3, 0xBE, 0x9D, 0x9A, 0xF3, 0xBE,
+	0x9D, 0x9B, 0xF3, 0xBE, 0x9D, 0x9C, 0xF3, 0xBE, 0x9D, 0x9D, 0xF3, 0xBE,
+	0x9D, 0x9E, 0xF3, 0xBE, 0x9D, 0x9F, 0xF3, 0xBE, 0x9D, 0xA0, 0xF3, 0xBE,
+	0x9D, 0xA1, 0xF3, 0xBE, 0x9D, 0xA2, 0xF3, 0xBE, 0x9D, 0xA3, 0xF3, 0xBE,
+	0x9D, 0xA4, 0xF3, 0xBE, 0x9D, 0xA5, 0xF3, 0xBE, 0x9D, 0xA6, 0xF3, 0xBE,
+	0x9D, 0xA7, 0xF3, 0xBE, 0x9D, 0xA8, 0xF3, 0xBE, 0x9D, 0xA9, 0xF3, 0xBE,
+	0x9D, 0xAA, 0xF3, 0xBE, 0x9D, 0xAB, 0xF3, 0xBE, 0x9D, 0xAC, 0xF3, 0xBE,
+	0x9D, 0xAD, 0xF3, 0xBE, 0x9D, 0xAE, 0xF3, 0xBE, 0x9D, 0xAF, 0xF3, 0xBE,
+	0x9D, 0xB0, 0xF3, 0xBE, 0x9D, 0xB1, 0xF3, 0xBE, 0x9D, 0xB2, 0xF3, 0xBE,
+	0x9D, 0xB3, 0xF3, 0xBE, 0x9D, 0xB4, 0xF3, 0xBE, 0x9D, 0xB5, 0xF3, 0xBE,
+	0x9D, 0xB6, 0xF3, 0xBE, 0x9D, 0xB7, 0xF3, 0xBE, 0x9D, 0xB8, 0xF3, 0xBE,
+	0x9D, 0xB9, 0xF3, 0xBE, 0x9D, 0xBA, 0xF3, 0xBE, 0x9D, 0xBB, 0xF3, 0xBE,
+	0x9D, 0xBC, 0xF3, 0xBE, 0x9D, 0xBD, 0xF3, 0xBE, 0x9D, 0xBE, 0xF3, 0xBE,
+	0x9D, 0xBF, 0xF3, 0xBE, 0x9E, 0x80, 0xF3, 0xBE, 0x9E, 0x81, 0xF3, 0xBE,
+	0x9E, 0x82, 0xF3, 0xBE, 0x9E, 0x83, 0xF3, 0xBE, 0x9E, 0x84, 0xF3, 0xBE,
+	0x9E, 0x85, 0xF3, 0xBE, 0x9E, 0x86, 0xF3, 0xBE, 0x9E, 0x87, 0xF3, 0xBE,
+	0x9E, 0x88, 0xF3, 0xBE, 0x9E, 0x89, 0xF3, 0xBE, 0x9E, 0x8A, 0xF3, 0xBE,
+	0x9E, 0x8B, 0xF3, 0xBE, 0x9E, 0x8C, 0xF3, 0xBE, 0x9E, 0x8D, 0xF3, 0xBE,
+	0x9E, 0x8E, 0xF3, 0xBE, 0x9E, 0x8F, 0xF3, 0xBE, 0x9E, 0x90, 0xF3, 0xBE,
+	0x9E, 0x91, 0xF3, 0xBE, 0x9E, 0x92, 0xF3, 0xBE, 0x9E, 0x93, 0xF3, 0xBE,
+	0x9E, 0x94, 0xF3, 0xBE, 0x9E, 0x95, 0xF3, 0xBE, 0x9E, 0x96, 0xF3, 0xBE,
+	0x9E, 0x97, 0xF3, 0xBE, 0x9E, 0x98, 0xF3, 0xBE, 0x9E, 0x99, 0xF3, 0xBE,
+	0x9E, 0x9A, 0xF3, 0xBE, 0x9E, 0x9B, 0xF3, 0xBE, 0x9E, 0x9C, 0xF3, 0xBE,
+	0x9E, 0x9D, 0xF3, 0xBE, 0x9E, 0x9E, 0xF3, 0xBE, 0x9E, 0x9F, 0xF3, 0xBE,
+	0x9E, 0xA0, 0xF3, 0xBE, 0x9E, 0xA1, 0xF3, 0xBE, 0x9E, 0xA2, 0xF3, 0xBE,
+	0x9E, 0xA3, 0xF3, 0xBE, 0x9E, 0xA4, 0xF3, 0xBE, 0x9E, 0xA5, 0xF3, 0xBE,
+	0x9E, 0xA6, 0xF3, 0xBE, 0x9E, 0xA7, 0xF3, 0xBE, 0x9E, 0xA8, 0xF3, 0xBE,
+	0x9E, 0xA9, 0xF3, 0xBE, 0x9E, 0xAA, 0xF3, 0xBE, 0x9E, 0xAB, 0xF3, 0xBE,
+	0x9E, 0xAC, 0xF3, 0xBE, 0x9E, 0xAD, 0xF3, 0xBE, 0x9E, 0xAE, 0xF3, 0xBE,
+	0x9E, 0xAF, 0xF3, 0xBE, 0x9E, 0xB0, 0xF3, 0xBE, 0x9E, 0xB1, 0xF3, 0xBE,
+	0x9E, 0xB2, 0xF3, 0xBE, 0x9E, 0xB3, 0xF3, 0xBE, 0x9E, 0xB4, 0xF3, 0xBE,
+	0x9E, 0xB5, 0xF3, 0xBE, 0x9E, 0xB6, 0xF3, 0xBE, 0x9E, 0xB7, 0xF3, 0xBE,
+	0x9E, 0xB8, 0xF3, 0xBE, 0x9E, 0xB9, 0xF3, 0xBE, 0x9E, 0xBA, 0xF3, 0xBE,
+	0x9E, 0xBB, 0xF3, 0xBE, 0x9E, 0xBC, 0xF3, 0xBE, 0x9E, 0xBD, 0xF3, 0xBE,
+	0x9E, 0xBE, 0xF3, 0xBE, 0x9E, 0xBF, 0xF3, 0xBE, 0x9F, 0x80, 0xF3, 0xBE,
+	0x9F, 0x81, 0xF3, 0xBE, 0x9F, 0x82, 0xF3, 0xBE, 0x9F, 0x83, 0xF3, 0xBE,
+	0x9F, 0x84, 0xF3, 0xBE, 0x9F, 0x85, 0xF3, 0xBE, 0x9F, 0x86, 0xF3, 0xBE,
+	0x9F, 0x87, 0xF3, 0xBE, 0x9F, 0x88, 0xF3, 0xBE, 0x9F, 0x89, 0xF3, 0xBE,
+	0x9F, 0x8A, 0xF3, 0xBE, 0x9F, 0x8B, 0xF3, 0xBE, 0x9F, 0x8C, 0xF3, 0xBE,
+	0x9F, 0x8D, 0xF3, 0xBE, 0x9F, 0x8E, 0xF3, 0xBE, 0x9F, 0x8F, 0xF3, 0xBE,
+	0x9F, 0x90, 0xF3, 0xBE, 0x9F, 0x91, 0xF3, 0xBE, 0x9F, 0x92, 0xF3, 0xBE,
+	0x9F, 0x93, 0xF3, 0xBE, 0x9F, 0x94, 0xF3, 0xBE, 0x9F, 0x95, 0xF3, 0xBE,
+	0x9F, 0x96, 0xF3, 0xBE, 0x9F, 0x97, 0xF3, 0xBE, 0x9F, 0x98, 0xF3, 0xBE,
+	0x9F, 0x99, 0xF3, 0xBE, 0x9F, 0x9A, 0xF3, 0xBE, 0x9F, 0x9B, 0xF3, 0xBE,
+	0x9F, 0x9C, 0xF3, 0xBE, 0x9F, 0x9D, 0xF3, 0xBE, 0x9F, 0x9E, 0xF3, 0xBE,
+	0x9F, 0x9F, 0xF3, 0xBE, 0x9F, 0xA0, 0xF3, 0xBE, 0x9F, 0xA1, 0xF3, 0xBE,
+	0x9F, 0xA2, 0xF3, 0xBE, 0x9F, 0xA3, 0xF3, 0xBE, 0x9F, 0xA4, 0xF3, 0xBE,
+	0x9F, 0xA5, 0xF3, 0xBE, 0x9F, 0xA6, 0xF3, 0xBE, 0x9F, 0xA7, 0xF3, 0xBE,
+	0x9F, 0xA8, 0xF3, 0xBE, 0x9F, 0xA9, 0xF3, 0xBE, 0x9F, 0xAA, 0xF3, 0xBE,
+	0x9F, 0xAB, 0xF3, 0xBE, 0x9F, 0xAC, 0xF3, 0xBE, 0x9F, 0xAD, 0xF3, 0xBE,
+	0x9F, 0xAE, 0xF3, 0xBE, 0x9F, 0xAF, 0xF3, 0xBE, 0x9F, 0xB0, 0xF3, 0xBE,
+	0x9F, 0xB1, 0xF3, 0xBE, 0x9F, 0xB2, 0xF3, 0xBE, 0x9F, 0xB3, 0xF3, 0xBE,
+	0x9F, 0xB4, 0xF3, 0xBE, 0x9F, 0xB5, 0xF3, 0xBE, 0x9F, 0xB6, 0xF3, 0xBE,
+	0x9F, 0xB7, 0xF3, 0xBE, 0x9F, 0xB8, 0xF3, 0xBE, 0x9F, 0xB9, 0xF3, 0xBE,
+	0x9F, 0xBA, 0xF3, 0xBE, 0x9F, 0xBB, 0xF3, 0xBE, 0x9F, 0xBC, 0xF3, 0xBE,
+	0x9F, 0xBD, 0xF3, 0xBE, 0x9F, 0xBE, 0xF3, 0xBE, 0x9F, 0xBF, 0x49, 0x66,
+	0x20, 0x54, 0x68, 0x65, 0x6E, 0x20, 0x45, 0x6C, 0x73, 0x65, 0x20, 0x49,
+	0x66, 0x45, 0x6E, 0x64, 0x46, 0x6F, 0x72, 0x20, 0x20, 0x54, 0x6F, 0x20,
+	0x20, 0x53, 0x74, 0x65, 0x70, 0x20, 0x4E, 0x65, 0x78, 0x74, 0x57, 0x68,
+	0x69, 0x6C, 0x65, 0x20, 0x57, 0x68, 0x69, 0x6C, 0x65, 0x45, 0x6E, 0x64,
+	0x44, 0x6F, 0x4C, 0x70, 0x57, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x52, 0x65,
+	0x74, 0x75, 0x72, 0x6E, 0x42, 0x72, 0x65, 0x61, 0x6B, 0x53, 0x74, 0x6F,
+	0x70, 0xF3, 0xBF, 0x9C, 0x8F, 0x4C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20,
+	0x53, 0x65, 0x6E, 0x64, 0x28, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65,
+	0x28, 0x4F, 0x70, 0x65, 0x6E, 0x43, 0x6F, 0x6D, 0x70, 0x6F, 0x72, 0x74,
+	0x33, 0x38, 0x6B, 0x43, 0x6C, 0x6F, 0x73, 0x65, 0x43, 0x6F, 0x6D, 0x70,
+	0x6F, 0x72, 0x74, 0x33, 0x38, 0x6B, 0x53, 0x65, 0x6E, 0x64, 0x33, 0x38,
+	0x6B, 0x20, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x33, 0x38, 0x6B,
+	0x20, 0xF3, 0xBF, 0x9C, 0x97, 0x43, 0x6C, 0x72, 0x54, 0x65, 0x78, 0x74,
+	0x43, 0x6C, 0x72, 0x47, 0x72, 0x61, 0x70, 0x68, 0x43, 0x6C, 0x72, 0x4C,
+	0x69, 0x73, 0x74, 0xF3, 0xBF, 0x9C, 0x9B, 0xF3, 0xBF, 0x9C, 0x9C, 0xF3,
+	0xBF, 0x9C, 0x9D, 0xF3, 0xBF, 0x9C, 0x9E, 0xF3, 0xBF, 0x9C, 0x9F, 0x44,
+	0x72, 0x61, 0x77, 0x47, 0x72, 0x61, 0x70, 0x68, 0xF3, 0xBF, 0x9C, 0xA1,
+	0xF3, 0xBF, 0x9C, 0xA2, 0xF3, 0xBF, 0x9C, 0xA3, 0xF3, 0xBF, 0x9C, 0xA4,
+	0xF3, 0xBF, 0x9C, 0xA5, 0xF3, 0xBF, 0x9C, 0xA6, 0xF3, 0xBF, 0x9C, 0xA7,
+	0xF3, 0xBF, 0x9C, 0xA8, 0xF3, 0xBF, 0x9C, 0xA9, 0xF3, 0xBF, 0x9C, 0xAA,
+	0xF3, 0xBF, 0x9C, 0xAB, 0xF3, 0xBF, 0x9C, 0xAC, 0xF3, 0xBF, 0x9C, 0xAD,
+	0xF3, 0xBF, 0x9C, 0xAE, 0xF3, 0xBF, 0x9C, 0xAF, 0xF3, 0xBF, 0x9C, 0xB0,
+	0xF3, 0xBF, 0x9C, 0xB1, 0xF3, 0xBF, 0x9C, 0xB2, 0xF3, 0xBF, 0x9C, 0xB3,
+	0xF3, 0xBF, 0x9C, 0xB4, 0xF3, 0xBF, 0x9C, 0xB5, 0xF3, 0xBF, 0x9C, 0xB6,
+	0xF3, 0xBF, 0x9C, 0xB7, 0xF3, 0xBF, 0x9C, 0xB8, 0xF3, 0xBF, 0x9C, 0xB9,
+	0xF3, 0xBF, 0x9C, 0xBA, 0xF3, 0xBF, 0x9C, 0xBB, 0xF3, 0xBF, 0x9C, 0xBC,
+	0xF3, 0xBF, 0x9C, 0xBD, 0xF3, 0xBF, 0x9C, 0xBE, 0xF3, 0xBF, 0x9C, 0xBF,
+	0xF3, 0xBF, 0x9D, 0x80, 0xF3, 0xBF, 0x9D, 0x81, 0xF3, 0xBF, 0x9D, 0x82,
+	0xF3, 0xBF, 0x9D, 0x83, 0xF3, 0xBF, 0x9D, 0x84, 0xF3, 0xBF, 0x9D, 0x85,
+	0xF3, 0xBF, 0x9D, 0x86, 0xF3, 0xBF, 0x9D, 0x87, 0xF3, 0xBF, 0x9D, 0x88,
+	0xF3, 0xBF, 0x9D, 0x89, 0xF3, 0xBF, 0x9D, 0x8A, 0xF3, 0xBF, 0x9D, 0x8B,
+	0xF3, 0xBF, 0x9D, 0x8C, 0xF3, 0xBF, 0x9D, 0x8D, 0xF3, 0xBF, 0x9D, 0x8E,
+	0xF3, 0xBF, 0x9D, 0x8F, 0xF3, 0xBF, 0x9D, 0x90, 0xF3, 0xBF, 0x9D, 0x91,
+	0xF3, 0xBF, 0x9D, 0x92, 0xF3, 0xBF, 0x9D, 0x93, 0xF3, 0xBF, 0x9D, 0x94,
+	0xF3, 0xBF, 0x9D, 0x95, 0xF3, 0xBF, 0x9D, 0x96, 0xF3, 0xBF, 0x9D, 0x97,
+	0xF3, 0xBF, 0x9D, 0x98, 0xF3, 0xBF, 0x9D, 0x99, 0xF3, 0xBF, 0x9D, 0x9A,
+	0xF3, 0xBF, 0x9D, 0x9B, 0xF3, 0xBF, 0x9D, 0x9C, 0xF3, 0xBF, 0x9D, 0x9D,
+	0xF3, 0xBF, 0x9D, 0x9E, 0xF3, 0xBF, 0x9D, 0x9F, 0xF3, 0xBF, 0x9D, 0xA0,
+	0xF3, 0xBF, 0x9D, 0xA1, 0xF3, 0xBF, 0x9D, 0xA2, 0xF3, 0xBF, 0x9D, 0xA3,
+	0xF3, 0xBF, 0x9D, 0xA4, 0xF3, 0xBF, 0x9D, 0xA5, 0xF3, 0xBF, 0x9D, 0xA6,
+	0xF3, 0xBF, 0x9D, 0xA7, 0xF3, 0xBF, 0x9D, 0xA8, 0xF3, 0xBF, 0x9D, 0xA9,
+	0xF3, 0xBF, 0x9D, 0xAA, 0xF3, 0xBF, 0x9D, 0xAB, 0xF3, 0xBF, 0x9D, 0xAC,
+	0xF3, 0xBF, 0x9D, 0xAD, 0xF3, 0xBF, 0x9D, 0xAE, 0xF3, 0xBF, 0x9D, 0xAF,
+	0xF3, 0xBF, 0x9D, 0xB0, 0xF3, 0xBF, 0x9D, 0xB1, 0xF3, 0xBF, 0x9D, 0xB2,
+	0xF3, 0xBF, 0x9D, 0xB3, 0xF3, 0xBF, 0x9D, 0xB4, 0xF3, 0xBF, 0x9D, 0xB5,
+	0xF3, 0xBF, 0x9D, 0xB6, 0xF3, 0xBF, 0x9D, 0xB7, 0xF3, 0xBF, 0x9D, 0xB8,
+	0xF3, 0xBF, 0x9D, 0xB9, 0xF3, 0xBF, 0x9D, 0xBA, 0xF3, 0xBF, 0x9D, 0xBB,
+	0xF3, 0xBF, 0x9D, 0xBC, 0xF3, 0xBF, 0x9D, 0xBD, 0xF3, 0xBF, 0x9D, 0xBE,
+	0xF3, 0xBF, 0x9D, 0xBF, 0xF3, 0xBF, 0x9E, 0x80, 0xF3, 0xBF, 0x9E, 0x81,
+	0xF3, 0xBF, 0x9E, 0x82, 0xF3, 0xBF, 0x9E, 0x83, 0xF3, 0xBF, 0x9E, 0x84,
+	0xF3, 0xBF, 0x9E, 0x85, 0xF3, 0xBF, 0x9E, 0x86, 0xF3, 0xBF, 0x9E, 0x87,
+	0xF3, 0xBF, 0x9E, 0x88, 0xF3, 0xBF, 0x9E, 0x89, 0xF3, 0xBF, 0x9E, 0x8A,
+	0xF3, 0xBF, 0x9E, 0x8B, 0xF3, 0xBF, 0x9E, 0x8C, 0xF3, 0xBF, 0x9E, 0x8D,
+	0xF3, 0xBF, 0x9E, 0x8E, 0xF3, 0xBF, 0x9E, 0x8F, 0xF3, 0xBF, 0x9E, 0x90,
+	0xF3, 0xBF, 0x9E, 0x91, 0xF3, 0xBF, 0x9E, 0x92, 0x53, 0x74, 0x6F, 0x50,
+	0x69, 0x63, 0x74, 0x20, 0x52, 0x63, 0x6C, 0x50, 0x69, 0x63, 0x74, 0x20,
+	0xF3, 0xBF, 0x9E, 0x95, 0xF3, 0xBF, 0x9E, 0x96, 0x53, 0x74, 0x6F, 0x56,
+	0x2D, 0x57, 0x69, 0x6E, 0x20, 0x52, 0x63, 0x6C, 0x56, 0x2D, 0x57, 0x69,
+	0x6E, 0x20, 0xF3, 0xBF, 0x9E, 0x99, 0xF3, 0xBF, 0x9E, 0x9A, 0xF3, 0xBF,
+	0x9E, 0x9B, 0xF3, 0xBF, 0x9E, 0x9C, 0xF3, 0xBF, 0x9E, 0x9D, 0xF3, 0xBF,
+	0x9E, 0x9E, 0xF3, 0xBF, 0x9E, 0x9F, 0x54, 0x61, 0x6E, 0x67, 0x65, 0x6E,
+	0x74, 0x20, 0x4E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x20, 0x49, 0x6E, 0x76,
+	0x65, 0x72, 0x73, 0x65, 0x20, 0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61,
+	0x6C, 0x20, 0x48, 0x6F, 0x72, 0x69, 0x7A, 0x6F, 0x6E, 0x74, 0x61, 0x6C,
+	0x20, 0x54, 0x65, 0x78, 0x74, 0x20, 0x43, 0x69, 0x72, 0x63, 0x6C, 0x65,
+	0x20, 0x46, 0x2D, 0x4C, 0x69, 0x6E, 0x65, 0x20, 0x50, 0x6C, 0x6F, 0x74,
+	0x4F, 0x6E, 0x20, 0x50, 0x6C, 0x6F, 0x74, 0x4F, 0x66, 0x66, 0x20, 0x50,
+	0x6C, 0x6F, 0x74, 0x43, 0x68, 0x67, 0x20, 0x50, 0x78, 0x6C, 0x4F, 0x6E,
+	0x20, 0x50, 0x78, 0x6C, 0x4F, 0x66, 0x66, 0x20, 0x50, 0x78, 0x6C, 0x43,
+	0x68, 0x67, 0x20, 0xF3, 0xBF, 0x9E, 0xAE, 0x50, 0x78, 0x6C, 0x54, 0x65,
+	0x73, 0x74, 0x28, 0xF3, 0xBF, 0x9E, 0xB0, 0xF3, 0xBF, 0x9E, 0xB1, 0xF3,
+	0xBF, 0x9E, 0xB2, 0xF3, 0xBF, 0x9E, 0xB3, 0xF3, 0xBF, 0x9E, 0xB4, 0xF3,
+	0xBF, 0x9E, 0xB5, 0xF3, 0xBF, 0x9E, 0xB6, 0xF3, 0xBF, 0x9E, 0xB7, 0xF3,
+	0xBF, 0x9E, 0xB8, 0xF3, 0xBF, 0x9E, 0xB9, 0xF3, 0xBF, 0x9E, 0xBA, 0xF3,
+	0xBF, 0x9E, 0xBB, 0xF3, 0xBF, 0x9E, 0xBC, 0xF3, 0xBF, 0x9E, 0xBD, 0xF3,
+	0xBF, 0x9E, 0xBE, 0xF3, 0xBF, 0x9E, 0xBF, 0xF3, 0xBF, 0x9F, 0x80, 0xF3,
+	0xBF, 0x9F, 0x81, 0xF3, 0xBF, 0x9F, 0x82, 0xF3, 0xBF, 0x9F, 0x83, 0xF3,
+	0xBF, 0x9F, 0x84, 0xF3, 0xBF, 0x9F, 0x85, 0xF3, 0xBF, 0x9F, 0x86, 0xF3,
+	0xBF, 0x9F, 0x87, 0xF3, 0xBF, 0x9F, 0x88, 0xF3, 0xBF, 0x9F, 0x89, 0xF3,
+	0xBF, 0x9F, 0x8A, 0xF3, 0xBF, 0x9F, 0x8B, 0xF3, 0xBF, 0x9F, 0x8C, 0xF3,
+	0xBF, 0x9F, 0x8D, 0xF3, 0xBF, 0x9F, 0x8E, 0xF3, 0xBF, 0x9F, 0x8F, 0xF3,
+	0xBF, 0x9F, 0x90, 0xF3, 0xBF, 0x9F, 0x91, 0xF3, 0xBF, 0x9F, 0x92, 0xF3,
+	0xBF, 0x9F, 0x93, 0xF3, 0xBF, 0x9F, 0x94, 0xF3, 0xBF, 0x9F, 0x95, 0xF3,
+	0xBF, 0x9F, 0x96, 0xF3, 0xBF, 0x9F, 0x97, 0xF3, 0xBF, 0x9F, 0x98, 0xF3,
+	0xBF, 0x9F, 0x99, 0xF3, 0xBF, 0x9F, 0x9A, 0xF3, 0xBF, 0x9F, 0x9B, 0xF3,
+	0xBF, 0x9F, 0x9C, 0xF3, 0xBF, 0x9F, 0x9D, 0xF3, 0xBF, 0x9F, 0x9E, 0xF3,
+	0xBF, 0x9F, 0x9F, 0xF3, 0xBF, 0x9F, 0xA0, 0xF3, 0xBF, 0x9F, 0xA1, 0xF3,
+	0xBF, 0x9F, 0xA2, 0xF3, 0xBF, 0x9F, 0xA3, 0xF3, 0xBF, 0x9F, 0xA4, 0xF3,
+	0xBF, 0x9F, 0xA5, 0xF3, 0xBF, 0x9F, 0xA6, 0xF3, 0xBF, 0x9F, 0xA7, 0xF3,
+	0xBF, 0x9F, 0xA8, 0xF3, 0xBF, 0x9F, 0xA9, 0xF3, 0xBF, 0x9F, 0xAA, 0xF3,
+	0xBF, 0x9F, 0xAB, 0xF3, 0xBF, 0x9F, 0xAC, 0xF3, 0xBF, 0x9F, 0xAD, 0xF3,
+	0xBF, 0x9F, 0xAE, 0xF3, 0xBF, 0x9F, 0xAF, 0xF3, 0xBF, 0x9F, 0xB0, 0xF3,
+	0xBF, 0x9F, 0xB1, 0xF3, 0xBF, 0x9F, 0xB2, 0xF3, 0xBF, 0x9F, 0xB3, 0xF3,
+	0xBF, 0x9F, 0xB4, 0xF3, 0xBF, 0x9F, 0xB5, 0xF3, 0xBF, 0x9F, 0xB6, 0xF3,
+	0xBF, 0x9F, 0xB7, 0xF3, 0xBF, 0x9F, 0xB8, 0xF3, 0xBF, 0x9F, 0xB9, 0xF3,
+	0xBF, 0x9F, 0xBA, 0xF3, 0xBF, 0x9F, 0xBB, 0xF3, 0xBF, 0x9F, 0xBC, 0xF3,
+	0xBF, 0x9F, 0xBD, 0xF3, 0xBF, 0x9F, 0xBE, 0xF3, 0xBF, 0x9F, 0xBF, 0xF3,
+	0xBF, 0xA4, 0x80, 0xF3, 0xBF, 0xA4, 0x81, 0xF3, 0xBF, 0xA4, 0x82, 0xF3,
+	0xBF, 0xA4, 0x83, 0xF3, 0xBF, 0xA4, 0x84, 0xF3, 0xBF, 0xA4, 0x85, 0xF3,
+	0xBF, 0xA4, 0x86, 0xF3, 0xBF, 0xA4, 0x87, 0xF3, 0xBF, 0xA4, 0x88, 0xF3,
+	0xBF, 0xA4, 0x89, 0xF3, 0xBF, 0xA4, 0x8A, 0xF3, 0xBF, 0xA4, 0x8B, 0xF3,
+	0xBF, 0xA4, 0x8C, 0xF3, 0xBF, 0xA4, 0x8D, 0xF3, 0xBF, 0xA4, 0x8E, 0xF3,
+	0xBF, 0xA4, 0x8F, 0xF3, 0xBF, 0xA4, 0x90, 0xF3, 0xBF, 0xA4, 0x91, 0xF3,
+	0xBF, 0xA4, 0x92, 0xF3, 0xBF, 0xA4, 0x93, 0xF3, 0xBF, 0xA4, 0x94, 0xF3,
+	0xBF, 0xA4, 0x95, 0xF3, 0xBF, 0xA4, 0x96, 0xF3, 0xBF, 0xA4, 0x97, 0xF3,
+	0xBF, 0xA4, 0x98, 0xF3, 0xBF, 0xA4, 0x99, 0xF3, 0xBF, 0xA4, 0x9A, 0xF3,
+	0xBF, 0xA4, 0x9B, 0xF3, 0xBF, 0xA4, 0x9C, 0xF3, 0xBF, 0xA4, 0x9D, 0x43,
+	0x6C, 0x72, 0x4D, 0x61, 0x74, 0x20, 0xF3, 0xBF, 0xA4, 0x9F, 0xF3, 0xBF,
+	0xA4, 0xA0, 0xF3, 0xBF, 0xA4, 0xA1, 0xF3, 0xBF, 0xA4, 0xA2, 0xF3, 0xBF,
+	0xA4, 0xA3, 0xF3, 0xBF, 0xA4, 0xA4, 0xF3, 0xBF, 0xA4, 0xA5, 0xF3, 0xBF,
+	0xA4, 0xA6, 0xF3, 0xBF, 0xA4, 0xA7, 0xF3, 0xBF, 0xA4, 0xA8, 0xF3, 0xBF,
+	0xA4, 0xA9, 0xF3, 0xBF, 0xA4, 0xAA, 0xF3, 0xBF, 0xA4, 0xAB, 0xF3, 0xBF,
+	0xA4, 0xAC, 0xF3, 0xBF, 0xA4, 0xAD, 0xF3, 0xBF, 0xA4, 0xAE, 0xF3, 0xBF,
+	0xA4, 0xAF, 0x53, 0x74, 0x72, 0x4A, 0x6F, 0x69, 0x6E, 0x28, 0x53, 0x74,
+	0x72, 0x4C, 0x65, 0x6E, 0x28, 0x53, 0x74, 0x72, 0x43, 0x6D, 0x70, 0x28,
+	0x53, 0x74, 0x72, 0x53, 0x72, 0x63, 0x28, 0x53, 0x74, 0x72, 0x4C, 0x65,
+	0x66, 0x74, 0x28, 0x53, 0x74, 0x72, 0x52, 0x69, 0x67, 0x68, 0x74, 0x28,
+	0x53, 0x74, 0x72, 0x4D, 0x69, 0x64, 0x28, 0x45, 0x78, 0x70, 0xE2, 0x86,
+	0x92, 0x53, 0x74, 0x72, 0x28, 0x45, 0x78, 0x70, 0x28, 0x53, 0x74, 0x72,
+	0x55, 0x70, 0x72, 0x28, 0x53, 0x74, 0x72, 0x4C, 0x77, 0x72, 0x28, 0x53,
+	0x74, 0x72, 0x49, 0x6E, 0x76, 0x28, 0x53, 0x74, 0x72, 0x53, 0x68, 0x69,
+	0x66, 0x74, 0x28, 0x53, 0x74, 0x72, 0x52, 0x6F, 0x74, 0x61, 0x74, 0x65,
+	0x28, 0xF3, 0xBF, 0xA4, 0xBE, 0x53, 0x74, 0x72, 0x20, 0xF3, 0xBF, 0xA5,
+	0x80, 0xF3, 0xBF, 0xA5, 0x81, 0xF3, 0xBF, 0xA5, 0x82, 0xF3, 0xBF, 0xA5,
+	0x83, 0xF3, 0xBF, 0xA5, 0x84, 0xF3, 0xBF, 0xA5, 0x85, 0xF3, 0xBF, 0xA5,
+	0x86, 0xF3, 0xBF, 0xA5, 0x87, 0xF3, 0xBF, 0xA5, 0x88, 0xF3, 0xBF, 0xA5,
+	0x89, 0xF3, 0xBF, 0xA5, 0x8A, 0xF3, 0xBF, 0xA5, 0x8B, 0xF3, 0xBF, 0xA5,
+	0x8C, 0xF3, 0xBF, 0xA5, 0x8D, 0xF3, 0xBF, 0xA5, 0x8E, 0xF3, 0xBF, 0xA5,
+	0x8F, 0xF3, 0xBF, 0xA5, 0x90, 0xF3, 0xBF, 0xA5, 0x91, 0xF3, 0xBF, 0xA5,
+	0x92, 0xF3, 0xBF, 0xA5, 0x93, 0xF3, 0xBF, 0xA5, 0x94, 0xF3, 0xBF, 0xA5,
+	0x95, 0xF3, 0xBF, 0xA5, 0x96, 0xF3, 0xBF, 0xA5, 0x97, 0xF3, 0xBF, 0xA5,
+	0x98, 0xF3, 0xBF, 0xA5, 0x99, 0xF3, 0xBF, 0xA5, 0x9A, 0xF3, 0xBF, 0xA5,
+	0x9B, 0xF3, 0xBF, 0xA5, 0x9C, 0xF3, 0xBF, 0xA5, 0x9D, 0xF3, 0xBF, 0xA5,
+	0x9E, 0xF3, 0xBF, 0xA5, 0x9F, 0xF3, 0xBF, 0xA5, 0xA0, 0xF3, 0xBF, 0xA5,
+	0xA1, 0xF3, 0xBF, 0xA5, 0xA2, 0xF3, 0xBF, 0xA5, 0xA3, 0xF3, 0xBF, 0xA5,
+	0xA4, 0xF3, 0xBF, 0xA5, 0xA5, 0xF3, 0xBF, 0xA5, 0xA6, 0xF3, 0xBF, 0xA5,
+	0xA7, 0xF3, 0xBF, 0xA5, 0xA8, 0xF3, 0xBF, 0xA5, 0xA9, 0xF3, 0xBF, 0xA5,
+	0xAA, 0xF3, 0xBF, 0xA5, 0xAB, 0xF3, 0xBF, 0xA5, 0xAC, 0xF3, 0xBF, 0xA5,
+	0xAD, 0xF3, 0xBF, 0xA5, 0xAE, 0xF3, 0xBF, 0xA5, 0xAF, 0xF3, 0xBF, 0xA5,
+	0xB0, 0xF3, 0xBF, 0xA5, 0xB1, 0xF3, 0xBF, 0xA5, 0xB2, 0xF3, 0xBF, 0xA5,
+	0xB3, 0xF3, 0xBF, 0xA5, 0xB4, 0xF3, 0xBF, 0xA5, 0xB5, 0xF3, 0xBF, 0xA5,
+	0xB6, 0xF3, 0xBF, 0xA5, 0xB7, 0xF3, 0xBF, 0xA5, 0xB8, 0xF3, 0xBF, 0xA5,
+	0xB9, 0xF3, 0xBF, 0xA5, 0xBA, 0xF3, 0xBF, 0xA5, 0xBB, 0xF3, 0xBF, 0xA5,
+	0xBC, 0xF3, 0xBF, 0xA5, 0xBD, 0xF3, 0xBF, 0xA5, 0xBE, 0xF3, 0xBF, 0xA5,
+	0xBF, 0xF3, 0xBF, 0xA6, 0x80, 0xF3, 0xBF, 0xA6, 0x81, 0xF3, 0xBF, 0xA6,
+	0x82, 0xF3, 0xBF, 0xA6, 0x83, 0xF3, 0xBF, 0xA6, 0x84, 0xF3, 0xBF, 0xA6,
+	0x85, 0xF3, 0xBF, 0xA6, 0x86, 0xF3, 0xBF, 0xA6, 0x87, 0xF3, 0xBF, 0xA6,
+	0x88, 0xF3, 0xBF, 0xA6, 0x89, 0xF3, 0xBF, 0xA6, 0x8A, 0xF3, 0xBF, 0xA6,
+	0x8B, 0xF3, 0xBF, 0xA6, 0x8C, 0xF3, 0xBF, 0xA6, 0x8D, 0xF3, 0xBF, 0xA6,
+	0x8E, 0xF3, 0xBF, 0xA6, 0x8F, 0xF3, 0xBF, 0xA6, 0x90, 0xF3, 0xBF, 0xA6,
+	0x91, 0xF3, 0xBF, 0xA6, 0x92, 0xF3, 0xBF, 0xA6, 0x93, 0xF3, 0xBF, 0xA6,
+	0x94, 0xF3, 0xBF, 0xA6, 0x95, 0xF3, 0xBF, 0xA6, 0x96, 0xF3, 0xBF, 0xA6,
+	0x97, 0xF3, 0xBF, 0xA6, 0x98, 0xF3, 0xBF, 0xA6, 0x99, 0xF3, 0xBF, 0xA6,
+	0x9A, 0xF3, 0xBF, 0xA6, 0x9B, 0xF3, 0xBF, 0xA6, 0x9C, 0xF3, 0xBF, 0xA6,
+	0x9D, 0xF3, 0xBF, 0xA6, 0x9E, 0xF3, 0xBF, 0xA6, 0x9F, 0xF3, 0xBF, 0xA6,
+	0xA0, 0xF3, 0xBF, 0xA6, 0xA1, 0xF3, 0xBF, 0xA6, 0xA2, 0xF3, 0xBF, 0xA6,
+	0xA3, 0xF3, 0xBF, 0xA6, 0xA4, 0xF3, 0xBF, 0xA6, 0xA5, 0xF3, 0xBF, 0xA6,
+	0xA6, 0xF3, 0xBF, 0xA6, 0xA7, 0xF3, 0xBF, 0xA6, 0xA8, 0xF3, 0xBF, 0xA6,
+	0xA9, 0xF3, 0xBF, 0xA6, 0xAA, 0xF3, 0xBF, 0xA6, 0xAB, 0xF3, 0xBF, 0xA6,
+	0xAC, 0xF3, 0xBF, 0xA6, 0xAD, 0xF3, 0xBF, 0xA6, 0xAE, 0xF3, 0xBF, 0xA6,
+	0xAF, 0xF3, 0xBF, 0xA6, 0xB0, 0xF3, 0xBF, 0xA6, 0xB1, 0xF3, 0xBF, 0xA6,
+	0xB2, 0xF3, 0xBF, 0xA6, 0xB3, 0xF3, 0xBF, 0xA6, 0xB4, 0xF3, 0xBF, 0xA6,
+	0xB5, 0xF3, 0xBF, 0xA6, 0xB6, 0xF3, 0xBF, 0xA6, 0xB7, 0xF3, 0xBF, 0xA6,
+	0xB8, 0xF3, 0xBF, 0xA6, 0xB9, 0xF3, 0xBF, 0xA6, 0xBA, 0xF3, 0xBF, 0xA6,
+	0xBB, 0xF3, 0xBF, 0xA6, 0xBC, 0xF3, 0xBF, 0xA6, 0xBD, 0xF3, 0xBF, 0xA6,
+	0xBE, 0xF3, 0xBF, 0xA6, 0xBF, 0xF3, 0xBF, 0xA7, 0x80, 0xF3, 0xBF, 0xA7,
+	0x81, 0xF3, 0xBF, 0xA7, 0x82, 0xF3, 0xBF, 0xA7, 0x83, 0xF3, 0xBF, 0xA7,
+	0x84, 0xF3, 0xBF, 0xA7, 0x85, 0xF3, 0xBF, 0xA7, 0x86, 0xF3, 0xBF, 0xA7,
+	0x87, 0xF3, 0xBF, 0xA7, 0x88, 0xF3, 0xBF, 0xA7, 0x89, 0xF3, 0xBF, 0xA7,
+	0x8A, 0xF3, 0xBF, 0xA7, 0x8B, 0xF3, 0xBF, 0xA7, 0x8C, 0xF3, 0xBF, 0xA7,
+	0x8D, 0xF3, 0xBF, 0xA7, 0x8E, 0xF3, 0xBF, 0xA7, 0x8F, 0xF3, 0xBF, 0xA7,
+	0x90, 0xF3, 0xBF, 0xA7, 0x91, 0xF3, 0xBF, 0xA7, 0x92, 0xF3, 0xBF, 0xA7,
+	0x93, 0xF3, 0xBF, 0xA7, 0x94, 0xF3, 0xBF, 0xA7, 0x95, 0xF3, 0xBF, 0xA7,
+	0x96, 0xF3, 0xBF, 0xA7, 0x97, 0xF3, 0xBF, 0xA7, 0x98, 0xF3, 0xBF, 0xA7,
+	0x99, 0xF3, 0xBF, 0xA7, 0x9A, 0xF3, 0xBF, 0xA7, 0x9B, 0xF3, 0xBF, 0xA7,
+	0x9C, 0xF3, 0xBF, 0xA7, 0x9D, 0xF3, 0xBF, 0xA7, 0x9E, 0xF3, 0xBF, 0xA7,
+	0x9F, 0xF3, 0xBF, 0xA7, 0xA0, 0xF3, 0xBF, 0xA7, 0xA1, 0xF3, 0xBF, 0xA7,
+	0xA2, 0xF3, 0xBF, 0xA7, 0xA3, 0xF3, 0xBF, 0xA7, 0xA4, 0xF3, 0xBF, 0xA7,
+	0xA5, 0xF3, 0xBF, 0xA7, 0xA6, 0xF3, 0xBF, 0xA7, 0xA7, 0xF3, 0xBF, 0xA7,
+	0xA8, 0xF3, 0xBF, 0xA7, 0xA9, 0xF3, 0xBF, 0xA7, 0xAA, 0xF3, 0xBF, 0xA7,
+	0xAB, 0xF3, 0xBF, 0xA7, 0xAC, 0xF3, 0xBF, 0xA7, 0xAD, 0xF3, 0xBF, 0xA7,
+	0xAE, 0xF3, 0xBF, 0xA7, 0xAF, 0xF3, 0xBF, 0xA7, 0xB0, 0xF3, 0xBF, 0xA7,
+	0xB1, 0xF3, 0xBF, 0xA7, 0xB2, 0xF3, 0xBF, 0xA7, 0xB3, 0xF3, 0xBF, 0xA7,
+	0xB4, 0xF3, 0xBF, 0xA7, 0xB5, 0xF3, 0xBF, 0xA7, 0xB6, 0xF3, 0xBF, 0xA7,
+	0xB7, 0xF3, 0xBF, 0xA7, 0xB8, 0xF3, 0xBF, 0xA7, 0xB9, 0xF3, 0xBF, 0xA7,
+	0xBA, 0xF3, 0xBF, 0xA7, 0xBB, 0xF3, 0xBF, 0xA7, 0xBC, 0xF3, 0xBF, 0xA7,
+	0xBD, 0xF3, 0xBF, 0xA7, 0xBE, 0xF3, 0xBF, 0xA7, 0xBF,
+};
+
+/* Single code points to characters, sorted by code point. */
+
+const fontchar_rev_t CASIO_EXPORT casio_fontchar_rev[1562] = {
+	{0x0000, 0x0000},
+	{0x000A, 0x000D},
+	{0x0020, 0x0020},
+	{0x0021, 0x0021},
+	{0x0022, 0x0022},
+	{0x0023, 0x0023},
+	{0x0024, 0x0024},
+	{0x0025, 0x0025},
+	{0x0026, 0x0026},
+	{0x0027, 0x0027},
+	{0x0028, 0x0028},
+	{0x0029, 0x0029},
+	{0x002A, 0x002A},
+	{0x002B, 0x002B},
+	{0x002C, 0x002C},
+	{0x002D, 0x002D},
+	{0x002E, 0x002E},
+	{0x002F, 0x002F},
+	{0x0030, 0x0030},
+	{0x0031, 0x0031},
+	{0x0032, 0x0032},
+	{0x0033, 0x0033},
+	{0x0034, 0x0034},
+	{0x0035, 0x0035},
+	{0x0036, 0x0036},
+	{0x0037, 0x0037},
+	{0x0038, 0x0038},
+	{0x0039, 0x0039},
+	{0x003A, 0x003A},
+	{0x003B, 0x003B},
+	{0x003C, 0x003C},
+	{0x003D, 0x003D},
+	{0x003E, 0x003E},
+	{0x003F, 0x003F},
+	{0x0040, 0x0040},
+	{0x0041, 0x0041},
+	{0x0042, 0x0042},
+	{0x0043, 0x0043},
+	{0x0044, 0x0044},
+	{0x0045, 0x0045},
+	{0x0046, 0x0046},
+	{0x0047, 0x0047},
+	{0x0048, 0x0048},
+	{0x0049, 0x0049},
+	{0x004A, 0x004A},
+	{0x004B, 0x004B},
+	{0x004C, 0x004C},
+	{0x004D, 0x004D},
+	{0x004E, 0x004E},
+	{0x004F, 0x004F},
+	{0x0050, 0x0050},
+	{0x0051, 0x0051},
+	{0x0052, 0x0052},
+	{0x0053, 0x0053},
+	{0x0054, 0x0054},
+	{0x0055, 0x0055},
+	{0x0056, 0x0056},
+	{0x0057, 0x0057},
+	{0x0058, 0x0058},
+	{0x0059, 0x0059},
+	{0x005A, 0x005A},
+	{0x005B, 0x005B},
+	{0x005C, 0x005C},
+	{0x005D, 0x005D},
+	{0x005E, 0x005E},
+	{0x005F, 0x005F},
+	{0x0060, 0x0060},
+	{0x0061, 0x0061},
+	{0x0062, 0x0062},
+	{0x0063, 0x0063},
+	{0x0064, 0x0064},
+	{0x0065, 0x0065},
+	{0x0066, 0x0066},
+	{0x0067, 0x0067},
+	{0x0068, 0x0068},
+	{0x0069, 0x0069},
+	{0x006A, 0x006A},
+	{0x006B, 0x006B},
+	{0x006C, 0x006C},
+	{0x006D, 0x006D},
+	{0x006E, 0x006E},
+	{0x006F, 0x006F},
+	{0x0070, 0x0070},
+	{0x0071, 0x0071},
+	{0x0072, 0x0072},
+	{0x0073, 0x0073},
+	{0x0074, 0x0074},
+	{0x0075, 0x0075},
+	{0x0076, 0x0076},
+	{0x0077, 0x0077},
+	{0x0078, 0x0078},
+	{0x0079, 0x0079},
+	{0x007A, 0x007A},
+	{0x007B, 0x007B},
+	{0x007C, 0x007C},
+	{0x007D, 0x007D},
+	{0x007E, 0x007E},
+	{0x00B0, 0x008C},
+	{0x00B2, 0x008B},
+	{0x00B5, 0x0004},
+	{0x00D7, 0x00A9},
+	{0x00F7, 0x00B9},
+	{0x02B3, 0x009C},
+	{0x03B8, 0x00CE},
+	{0x03C0, 0x00D0},
+	{0x1D07, 0x000F},
+	{0x1D4D, 0x00AC},
+	{0x2192, 0x000E},
+	{0x21D2, 0x0013},
+	{0x2212, 0x0087},
+	{0x221A, 0x0086},
+	{0x2220, 0x7F54},
+	{0x2260, 0x0011},
+	{0x2264, 0x0010},
+	{0x2265, 0x0012},
+	{0x231F, 0x00BB},
+	{0x25E2, 0x000C},
+	{0xF0014, 0x0014},
+	{0xF0015, 0x0015},
+	{0xF0016, 0x0016},
+	{0xF0017, 0x0017},
+	{0xF0018, 0x0018},
+	{0xF0019, 0x0019},
+	{0xF001A, 0x001A},
+	{0xF001B, 0x001B},
+	{0xF001C, 0x001C},
+	{0xF001D, 0x001D},
+	{0xF001E, 0x001E},
+	{0xF001F, 0x001F},
+	{0xF0084, 0x0084},
+	{0xF0094, 0x0094},
+	{0xF009D, 0x009D},
+	{0xF00A4, 0x00A4},
+	{0xF00AD, 0x00AD},
+	{0xF00AE, 0x00AE},
+	{0xF00AF, 0x00AF},
+	{0xF00B4, 0x00B4},
+	{0xF00B5, 0x00B5},
+	{0xF00BC, 0x00BC},
+	{0xF00BD, 0x00BD},
+	{0xF00BE, 0x00BE},
+	{0xF00BF, 0x00BF},
+	{0xF00C2, 0x00C2},
+	{0xF00C3, 0x00C3},
+	{0xF00C4, 0x00C4},
+	{0xF00C5, 0x00C5},
+	{0xF00C6, 0x00C6},
+	{0xF00C7, 0x00C7},
+	{0xF00C8, 0x00C8},
+	{0xF00C9, 0x00C9},
+	{0xF00CA, 0x00CA},
+	{0xF00CB, 0x00CB},
+	{0xF00CC, 0x00CC},
+	{0xF00CF, 0x00CF},
+	{0xF00D2, 0x00D2},
+	{0xF00D8, 0x00D8},
+	{0xF00DF, 0x00DF},
+	{0xF00F6, 0x00F6},
+	{0xF00F8, 0x00F8},
+	{0xF00FA, 0x00FA},
+	{0xF00FF, 0x00FF},
+	{0xF7F03, 0x7F03},
+	{0xF7F07, 0x7F07},
+	{0xF7F13, 0x7F13},
+	{0xF7F17, 0x7F17},
+	{0xF7F1B, 0x7F1B},
+	{0xF7F1C, 0x7F1C},
+	{0xF7F1D, 0x7F1D},
+	{0xF7F1E, 0x7F1E},
+	{0xF7F1F, 0x7F1F},
+	{0xF7F30, 0x7F30},
+	{0xF7F31, 0x7F31},
+	{0xF7F32, 0x7F32},
+	{0xF7F33, 0x7F33},
+	{0xF7F34, 0x7F34},
+	{0xF7F35, 0x7F35},
+	{0xF7F36, 0x7F36},
+	{0xF7F37, 0x7F37},
+	{0xF7F38, 0x7F38},
+	{0xF7F39, 0x7F39},
+	{0xF7F3E, 0x7F3E},
+	{0xF7F3F, 0x7F3F},
+	{0xF7F53, 0x7F53},
+	{0xF7F55, 0x7F55},
+	{0xF7F56, 0x7F56},
+	{0xF7F57, 0x7F57},
+	{0xF7F58, 0x7F58},
+	{0xF7F59, 0x7F59},
+	{0xF7F5A, 0x7F5A},
+	{0xF7F5B, 0x7F5B},
+	{0xF7F5C, 0x7F5C},
+	{0xF7F5D, 0x7F5D},
+	{0xF7F5E, 0x7F5E},
+	{0xF7F5F, 0x7F5F},
+	{0xF7F60, 0x7F60},
+	{0xF7F61, 0x7F61},
+	{0xF7F62, 0x7F62},
+	{0xF7F63, 0x7F63},
+	{0xF7F64, 0x7F64},
+	{0xF7F65, 0x7F65},
+	{0xF7F66, 0x7F66},
+	{0xF7F67, 0x7F67},
+	{0xF7F68, 0x7F68},
+	{0xF7F69, 0x7F69},
+	{0xF7F6A, 0x7F6A},
+	{0xF7F6B, 0x7F6B},
+	{0xF7F6C, 0x7F6C},
+	{0xF7F6D, 0x7F6D},
+	{0xF7F6E, 0x7F6E},
+	{0xF7F6F, 0x7F6F},
+	{0xF7F70, 0x7F70},
+	{0xF7F71, 0x7F71},
+	{0xF7F72, 0x7F72},
+	{0xF7F73, 0x7F73},
+	{0xF7F74, 0x7F74},
+	{0xF7F75, 0x7F75},
+	{0xF7F76, 0x7F76},
+	{0xF7F77, 0x7F77},
+	{0xF7F78, 0x7F78},
+	{0xF7F79, 0x7F79},
+	{0xF7F7A, 0x7F7A},
+	{0xF7F7B, 0x7F7B},
+	{0xF7F7C, 0x7F7C},
+	{0xF7F7D, 0x7F7D},
+	{0xF7F7E, 0x7F7E},
+	{0xF7F7F, 0x7F7F},
+	{0xF7F80, 0x7F80},
+	{0xF7F81, 0x7F81},
+	{0xF7F82, 0x7F82},
+	{0xF7F83, 0x7F83},
+	{0xF7F84, 0x7F84},
+	{0xF7F85, 0x7F85},
+	{0xF7F8B, 0x7F8B},
+	{0xF7F8C, 0x7F8C},
+	{0xF7F8D, 0x7F8D},
+	{0xF7F8E, 0x7F8E},
+	{0xF7F90, 0x7F90},
+	{0xF7F91, 0x7F91},
+	{0xF7F92, 0x7F92},
+	{0xF7F93, 0x7F93},
+	{0xF7F94, 0x7F94},
+	{0xF7F95, 0x7F95},
+	{0xF7F96, 0x7F96},
+	{0xF7F97, 0x7F97},
+	{0xF7F98, 0x7F98},
+	{0xF7F99, 0x7F99},
+	{0xF7F9A, 0x7F9A},
+	{0xF7F9B, 0x7F9B},
+	{0xF7F9C, 0x7F9C},
+	{0xF7F9D, 0x7F9D},
+	{0xF7F9E, 0x7F9E},
+	{0xF7F9F, 0x7F9F},
+	{0xF7FA0, 0x7FA0},
+	{0xF7FA1, 0x7FA1},
+	{0xF7FA2, 0x7FA2},
+	{0xF7FA3, 0x7FA3},
+	{0xF7FA4, 0x7FA4},
+	{0xF7FA5, 0x7FA5},
+	{0xF7FA6, 0x7FA6},
+	{0xF7FA7, 0x7FA7},
+	{0xF7FA8, 0x7FA8},
+	{0xF7FA9, 0x7FA9},
+	{0xF7FAA, 0x7FAA},
+	{0xF7FAB, 0x7FAB},
+	{0xF7FAC, 0x7FAC},
+	{0xF7FAD, 0x7FAD},
+	{0xF7FAE, 0x7FAE},
+	{0xF7FAF, 0x7FAF},
+	{0xF7FB0, 0x7FB0},
+	{0xF7FB2, 0x7FB2},
+	{0xF7FB5, 0x7FB5},
+	{0xF7FB6, 0x7FB6},
+	{0xF7FB7, 0x7FB7},
+	{0xF7FB8, 0x7FB8},
+	{0xF7FB9, 0x7FB9},
+	{0xF7FBA, 0x7FBA},
+	{0xF7FBB, 0x7FBB},
+	{0xF7FBE, 0x7FBE},
+	{0xF7FBF, 0x7FBF},
+	{0xF7FC0, 0x7FC0},
+	{0xF7FC1, 0x7FC1},
+	{0xF7FC2, 0x7FC2},
+	{0xF7FC3, 0x7FC3},
+	{0xF7FC4, 0x7FC4},
+	{0xF7FC5, 0x7FC5},
+	{0xF7FC6, 0x7FC6},
+	{0xF7FC7, 0x7FC7},
+	{0xF7FC8, 0x7FC8},
+	{0xF7FC9, 0x7FC9},
+	{0xF7FCA, 0x7FCA},
+	{0xF7FCB, 0x7FCB},
+	{0xF7FCC, 0x7FCC},
+	{0xF7FCD, 0x7FCD},
+	{0xF7FCE, 0x7FCE},
+	{0xF7FCF, 0x7FCF},
+	{0xF7FD0, 0x7FD0},
+	{0xF7FD1, 0x7FD1},
+	{0xF7FD2, 0x7FD2},
+	{0xF7FD3, 0x7FD3},
+	{0xF7FD4, 0x7FD4},
+	{0xF7FD5, 0x7FD5},
+	{0xF7FD6, 0x7FD6},
+	{0xF7FD7, 0x7FD7},
+	{0xF7FD8, 0x7FD8},
+	{0xF7FD9, 0x7FD9},
+	{0xF7FDA, 0x7FDA},
+	{0xF7FDB, 0x7FDB},
+	{0xF7FDC, 0x7FDC},
+	{0xF7FDD, 0x7FDD},
+	{0xF7FDE, 0x7FDE},
+	{0xF7FDF, 0x7FDF},
+	{0xF7FE0, 0x7FE0},
+	{0xF7FE1, 0x7FE1},
+	{0xF7FE2, 0x7FE2},
+	{0xF7FE3, 0x7FE3},
+	{0xF7FE4, 0x7FE4},
+	{0xF7FE5, 0x7FE5},
+	{0xF7FE6, 0x7FE6},
+	{0xF7FE7, 0x7FE7},
+	{0xF7FE8, 0x7FE8},
+	{0xF7FE9, 0x7FE9},
+	{0xF7FEA, 0x7FEA},
+	{0xF7FEB, 0x7FEB},
+	{0xF7FEC, 0x7FEC},
+	{0xF7FED, 0x7FED},
+	{0xF7FEE, 0x7FEE},
+	{0xF7FEF, 0x7FEF},
+	{0xF7FF0, 0x7FF0},
+	{0xF7FF1, 0x7FF1},
+	{0xF7FF2, 0x7FF2},
+	{0xF7FF3, 0x7FF3},
+	{0xF7FF4, 0x7FF4},
+	{0xF7FF5, 0x7FF5},
+	{0xF7FF6, 0x7FF6},
+	{0xF7FF7, 0x7FF7},
+	{0xF7FF8, 0x7FF8},
+	{0xF7FF9, 0x7FF9},
+	{0xF7FFA, 0x7FFA},
+	{0xF7FFB, 0x7FFB},
+	{0xF7FFC, 0x7FFC},
+	{0xF7FFD, 0x7FFD},
+	{0xF7FFE, 0x7FFE},
+	{0xF7FFF, 0x7FFF},
+	{0xFE500, 0xE500},
+	{0xFE501, 0xE501},
+	{0xFE502, 0xE502},
+	{0xFE503, 0xE503},
+	{0xFE504, 0xE504},
+	{0xFE505, 0xE505},
+	{0xFE506, 0xE506},
+	{0xFE507, 0xE507},
+	{0xFE508, 0xE508},
+	{0xFE509, 0xE509},
+	{0xFE50A, 0xE50A},
+	{0xFE50B, 0xE50B},
+	{0xFE50C, 0xE50C},
+	{0xFE50D, 0xE50D},
+	{0xFE50E, 0xE50E},
+	{0xFE50F, 0xE50F},
+	{0xFE510, 0xE510},
+	{0xFE511, 0xE511},
+	{0xFE512, 0xE512},
+	{0xFE513, 0xE513},
+	{0xFE514, 0xE514},
+	{0xFE515, 0xE515},
+	{0xFE516, 0xE516},
+	{0xFE517, 0xE517},
+	{0xFE518, 0xE518},
+	{0xFE519, 0xE519},
+	{0xFE51A, 0xE51A},
+	{0xFE51B, 0xE51B},
+	{0xFE51C, 0xE51C},
+	{0xFE51D, 0xE51D},
+	{0xFE51E, 0xE51E},
+	{0xFE51F, 0xE51F},
+	{0xFE520, 0xE520},
+	{0xFE521, 0xE521},
+	{0xFE522, 0xE522},
+	{0xFE523, 0xE523},
+	{0xFE524, 0xE524},
+	{0xFE525, 0xE525},
+	{0xFE526, 0xE526},
+	{0xFE527, 0xE527},
+	{0xFE528, 0xE528},
+	{0xFE529, 0xE529},
+	{0xFE52A, 0xE52A},
+	{0xFE52B, 0xE52B},
+	{0xFE52C, 0xE52C},
+	{0xFE52D, 0xE52D},
+	{0xFE52E, 0xE52E},
+	{0xFE52F, 0xE52F},
+	{0xFE530, 0xE530},
+	{0xFE531, 0xE531},
+	{0xFE532, 0xE532},
+	{0xFE533, 0xE533},
+	{0xFE534, 0xE534},
+	{0xFE535, 0xE535},
+	{0xFE536, 0xE536},
+	{0xFE537, 0xE537},
+	{0xFE538, 0xE538},
+	{0xFE539, 0xE539},
+	{0xFE53A, 0xE53A},
+	{0xFE53B, 0xE53B},
+	{0xFE53C, 0xE53C},
+	{0xFE53D, 0xE53D},
+	{0xFE53E, 0xE53E},
+	{0xFE53F, 0xE53F},
+	{0xFE540, 0xE540},
+	{0xFE541, 0xE541},
+	{0xFE542, 0xE542},
+	{0xFE543, 0xE543},
+	{0xFE544, 0xE544},
+	{0xFE545, 0xE545},
+	{0xFE546, 0xE546},
+	{0xFE547, 0xE547},
+	{0xFE548, 0xE548},
+	{0xFE549, 0xE549},
+	{0xFE54A, 0xE54A},
+	{0xFE54B, 0xE54B},
+	{0xFE54C, 0xE54C},
+	{0xFE54D, 0xE54D},
+	{0xFE54E, 0xE54E},
+	{0xFE54F, 0xE54F},
+	{0xFE550, 0xE550},
+	{0xFE551, 0xE551},
+	{0xFE552, 0xE552},
+	{0xFE553, 0xE553},
+	{0xFE554, 0xE554},
+	{0xFE555, 0xE555},
+	{0xFE556, 0xE556},
+	{0xFE557, 0xE557},
+	{0xFE558, 0xE558},
+	{0xFE559, 0xE559},
+	{0xFE55A, 0xE55A},
+	{0xFE55B, 0xE55B},
+	{0xFE55C, 0xE55C},
+	{0xFE55D, 0xE55D},
+	{0xFE55E, 0xE55E},
+	{0xFE55F, 0xE55F},
+	{0xFE560, 0xE560},
+	{0xFE561, 0xE561},
+	{0xFE562, 0xE562},
+	{0xFE563, 0xE563},
+	{0xFE564, 0xE564},
+	{0xFE565, 0xE565},
+	{0xFE566, 0xE566},
+	{0xFE567, 0xE567},
+	{0xFE568, 0xE568},
+	{0xFE569, 0xE569},
+	{0xFE56A, 0xE56A},
+	{0xFE56B, 0xE56B},
+	{0xFE56C, 0xE56C},
+	{0xFE56D, 0xE56D},
+	{0xFE56E, 0xE56E},
+	{0xFE56F, 0xE56F},
+	{0xFE570, 0xE570},
+	{0xFE571, 0xE571},
+	{0xFE572, 0xE572},
+	{0xFE573, 0xE573},
+	{0xFE574, 0xE574},
+	{0xFE575, 0xE575},
+	{0xFE576, 0xE576},
+	{0xFE577, 0xE577},
+	{0xFE578, 0xE578},
+	{0xFE579, 0xE579},
+	{0xFE57A, 0xE57A},
+	{0xFE57B, 0xE57B},
+	{0xFE57C, 0xE57C},
+	{0xFE57D, 0xE57D},
+	{0xFE57E, 0xE57E},
+	{0xFE57F, 0xE57F},
+	{0xFE580, 0xE580},
+	{0xFE581, 0xE581},
+	{0xFE582, 0xE582},
+	{0xFE583, 0xE583},
+	{0xFE584, 0xE584},
+	{0xFE585, 0xE585},
+	{0xFE586, 0xE586},
+	{0xFE587, 0xE587},
+	{0xFE588, 0xE588},
+	{0xFE589, 0xE589},
+	{0xFE58A, 0xE58A},
+	{0xFE58B, 0xE58B},
+	{0xFE58C, 0xE58C},
+	{0xFE58D, 0xE58D},
+	{0xFE58E, 0xE58E},
+	{0xFE58F, 0xE58F},
+	{0xFE590, 0xE590},
+	{0xFE591, 0xE591},
+	{0xFE592, 0xE592},
+	{0xFE593, 0xE593},
+	{0xFE594, 0xE594},
+	{0xFE595, 0xE595},
+	{0xFE596, 0xE596},
+	{0xFE597, 0xE597},
+	{0xFE598, 0xE598},
+	{0xFE599, 0xE599},
+	{0xFE59A, 0xE59A},
+	{0xFE59B, 0xE59B},
+	{0xFE59C, 0xE59C},
+	{0xFE59D, 0xE59D},
+	{0xFE59E, 0xE59E},
+	{0xFE59F, 0xE59F},
+	{0xFE5A0, 0xE5A0},
+	{0xFE5A1, 0xE5A1},
+	{0xFE5A2, 0xE5A2},
+	{0xFE5A3, 0xE5A3},
+	{0xFE5A4, 0xE5A4},
+	{0xFE5A5, 0xE5A5},
+	{0xFE5A6, 0xE5A6},
+	{0xFE5A7, 0xE5A7},
+	{0xFE5A8, 0xE5A8},
+	{0xFE5A9, 0xE5A9},
+	{0xFE5AA, 0xE5AA},
+	{0xFE5AB, 0xE5AB},
+	{0xFE5AC, 0xE5AC},
+	{0xFE5AD, 0xE5AD},
+	{0xFE5AE, 0xE5AE},
+	{0xFE5AF, 0xE5AF},
+	{0xFE5B0, 0xE5B0},
+	{0xFE5B1, 0xE5B1},
+	{0xFE5B2, 0xE5B2},
+	{0xFE5B3, 0xE5B3},
+	{0xFE5B4, 0xE5B4},
+	{0xFE5B5, 0xE5B5},
+	{0xFE5B6, 0xE5B6},
+	{0xFE5B7, 0xE5B7},
+	{0xFE5B8, 0xE5B8},
+	{0xFE5B9, 0xE5B9},
+	{0xFE5BA, 0xE5BA},
+	{0xFE5BB, 0xE5BB},
+	{0xFE5BC, 0xE5BC},
+	{0xFE5BD, 0xE5BD},
+	{0xFE5BE, 0xE5BE},
+	{0xFE5BF, 0xE5BF},
+	{0xFE5C0, 0xE5C0},
+	{0xFE5C1, 0xE5C1},
+	{0xFE5C2, 0xE5C2},
+	{0xFE5C3, 0xE5C3},
+	{0xFE5C4, 0xE5C4},
+	{0xFE5C5, 0xE5C5},
+	{0xFE5C6, 0xE5C6},
+	{0xFE5C7, 0xE5C7},
+	{0xFE5C8, 0xE5C8},
+	{0xFE5C9, 0xE5C9},
+	{0xFE5CA, 0xE5CA},
+	{0xFE5CB, 0xE5CB},
+	{0xFE5CC, 0xE5CC},
+	{0xFE5CD, 0xE5CD},
+	{0xFE5CE, 0xE5CE},
+	{0xFE5CF, 0xE5CF},
+	{0xFE5D0, 0xE5D0},
+	{0xFE5D1, 0xE5D1},
+	{0xFE5D2, 0xE5D2},
+	{0xFE5D3, 0xE5D3},
+	{0xFE5D4, 0xE5D4},
+	{0xFE5D5, 0xE5D5},
+	{0xFE5D6, 0xE5D6},
+	{0xFE5D7, 0xE5D7},
+	{0xFE5D8, 0xE5D8},
+	{0xFE5D9, 0xE5D9},
+	{0xFE5DA, 0xE5DA},
+	{0xFE5DB, 0xE5DB},
+	{0xFE5DC, 0xE5DC},
+	{0xFE5DD, 0xE5DD},
+	{0xFE5DE, 0xE5DE},
+	{0xFE5DF, 0xE5DF},
+	{0xFE5E0, 0xE5E0},
+	{0xFE5E1, 0xE5E1},
+	{0xFE5E2, 0xE5E2},
+	{0xFE5E3, 0xE5E3},
+	{0xFE5E4, 0xE5E4},
+	{0xFE5E5, 0xE5E5},
+	{0xFE5E6, 0xE5E6},
+	{0xFE5E7, 0xE5E7},
+	{0xFE5E8, 0xE5E8},
+	{0xFE5E9, 0xE5E9},
+	{0xFE5EA, 0xE5EA},
+	{0xFE5EB, 0xE5EB},
+	{0xFE5EC, 0xE5EC},
+	{0xFE5ED, 0xE5ED},
+	{0xFE5EE, 0xE5EE},
+	{0xFE5EF, 0xE5EF},
+	{0xFE5F0, 0xE5F0},
+	{0xFE5F1, 0xE5F1},
+	{0xFE5F2, 0xE5F2},
+	{0xFE5F3, 0xE5F3},
+	{0xFE5F4, 0xE5F4},
+	{0xFE5F5, 0xE5F5},
+	{0xFE5F6, 0xE5F6},
+	{0xFE5F7, 0xE5F7},
+	{0xFE5F8, 0xE5F8},
+	{0xFE5F9, 0xE5F9},
+	{0xFE5FA, 0xE5FA},
+	{0xFE5FB, 0xE5FB},
+	{0xFE5FC, 0xE5FC},
+	{0xFE5FD, 0xE5FD},
+	{0xFE5FE, 0xE5FE},
+	{0xFE5FF, 0xE5FF},
+	{0xFE600, 0xE600},
+	{0xFE601, 0xE601},
+	{0xFE602, 0xE602},
+	{0xFE603, 0xE603},
+	{0xFE604, 0xE604},
+	{0xFE605, 0xE605},
+	{0xFE606, 0xE606},
+	{0xFE607, 0xE607},
+	{0xFE608, 0xE608},
+	{0xFE609, 0xE609},
+	{0xFE60A, 0xE60A},
+	{0xFE60B, 0xE60B},
+	{0xFE60C, 0xE60C},
+	{0xFE60D, 0xE60D},
+	{0xFE60E, 0xE60E},
+	{0xFE60F, 0xE60F},
+	{0xFE610, 0xE610},
+	{0xFE611, 0xE611},
+	{0xFE612, 0xE612},
+	{0xFE613, 0xE613},
+	{0xFE614, 0xE614},
+	{0xFE615, 0xE615},
+	{0xFE616, 0xE616},
+	{0xFE617, 0xE617},
+	{0xFE618, 0xE618},
+	{0xFE619, 0xE619},
+	{0xFE61A, 0xE61A},
+	{0xFE61B, 0xE61B},
+	{0xFE61C, 0xE61C},
+	{0xFE61D, 0xE61D},
+	{0xFE61E, 0xE61E},
+	{0xFE61F, 0xE61F},
+	{0xFE620, 0xE620},
+	{0xFE621, 0xE621},
+	{0xFE622, 0xE622},
+	{0xFE623, 0xE623},
+	{0xFE624, 0xE624},
+	{0xFE625, 0xE625},
+	{0xFE626, 0xE626},
+	{0xFE627, 0xE627},
+	{0xFE628, 0xE628},
+	{0xFE629, 0xE629},
+	{0xFE62A, 0xE62A},
+	{0xFE62B, 0xE62B},
+	{0xFE62C, 0xE62C},
+	{0xFE62D, 0xE62D},
+	{0xFE62E, 0xE62E},
+	{0xFE62F, 0xE62F},
+	{0xFE630, 0xE630},
+	{0xFE631, 0xE631},
+	{0xFE632, 0xE632},
+	{0xFE633, 0xE633},
+	{0xFE634, 0xE634},
+	{0xFE635, 0xE635},
+	{0xFE636, 0xE636},
+	{0xFE637, 0xE637},
+	{0xFE638, 0xE638},
+	{0xFE639, 0xE639},
+	{0xFE63A, 0xE63A},
+	{0xFE63B, 0xE63B},
+	{0xFE63C, 0xE63C},
+	{0xFE63D, 0xE63D},
+	{0xFE63E, 0xE63E},
+	{0xFE63F, 0xE63F},
+	{0xFE640, 0xE640},
+	{0xFE641, 0xE641},
+	{0xFE642, 0xE642},
+	{0xFE643, 0xE643},
+	{0xFE644, 0xE644},
+	{0xFE645, 0xE645},
+	{0xFE646, 0xE646},
+	{0xFE647, 0xE647},
+	{0xFE648, 0xE648},
+	{0xFE649, 0xE649},
+	{0xFE64A, 0xE64A},
+	{0xFE64B, 0xE64B},
+	{0xFE64C, 0xE64C},
+	{0xFE64D, 0xE64D},
+	{0xFE64E, 0xE64E},
+	{0xFE64F, 0xE64F},
+	{0xFE650, 0xE650},
+	{0xFE651, 0xE651},
+	{0xFE652, 0xE652},
+	{0xFE653, 0xE653},
+	{0xFE654, 0xE654},
+	{0xFE655, 0xE655},
+	{0xFE656, 0xE656},
+	{0xFE657, 0xE657},
+	{0xFE658, 0xE658},
+	{0xFE659, 0xE659},
+	{0xFE65A, 0xE65A},
+	{0xFE65B, 0xE65B},
+	{0xFE65C, 0xE65C},
+	{0xFE65D, 0xE65D},
+	{0xFE65E, 0xE65E},
+	{0xFE65F, 0xE65F},
+	{0xFE660, 0xE660},
+	{0xFE661, 0xE661},
+	{0xFE662, 0xE662},
+	{0xFE663, 0xE663},
+	{0xFE664, 0xE664},
+	{0xFE665, 0xE665},
+	{0xFE666, 0xE666},
+	{0xFE667, 0xE667},
+	{0xFE668, 0xE668},
+	{0xFE669, 0xE669},
+	{0xFE66A, 0xE66A},
+	{0xFE66B, 0xE66B},
+	{0xFE66C, 0xE66C},
+	{0xFE66D, 0xE66D},
+	{0xFE66E, 0xE66E},
+	{0xFE66F, 0xE66F},
+	{0xFE670, 0xE670},
+	{0xFE671, 0xE671},
+	{0xFE672, 0xE672},
+	{0xFE673, 0xE673},
+	{0xFE674, 0xE674},
+	{0xFE675, 0xE675},
+	{0xFE676, 0xE676},
+	{0xFE677, 0xE677},
+	{0xFE678, 0xE678},
+	{0xFE679, 0xE679},
+	{0xFE67A, 0xE67A},
+	{0xFE67B, 0xE67B},
+	{0xFE67C, 0xE67C},
+	{0xFE67D, 0xE67D},
+	{0xFE67E, 0xE67E},
+	{0xFE67F, 0xE67F},
+	{0xFE680, 0xE680},
+	{0xFE681, 0xE681},
+	{0xFE682, 0xE682},
+	{0xFE683, 0xE683},
+	{0xFE684, 0xE684},
+	{0xFE685, 0xE685},
+	{0xFE686, 0xE686},
+	{0xFE687, 0xE687},
+	{0xFE688, 0xE688},
+	{0xFE689, 0xE689},
+	{0xFE68A, 0xE68A},
+	{0xFE68B, 0xE68B},
+	{0xFE68C, 0xE68C},
+	{0xFE68D, 0xE68D},
+	{0xFE68E, 0xE68E},
+	{0xFE68F, 0xE68F},
+	{0xFE690, 0xE690},
+	{0xFE691, 0xE691},
+	{0xFE692, 0xE692},
+	{0xFE693, 0xE693},
+	{0xFE694, 0xE694},
+	{0xFE695, 0xE695},
+	{0xFE696, 0xE696},
+	{0xFE697, 0xE697},
+	{0xFE698, 0xE698},
+	{0xFE699, 0xE699},
+	{0xFE69A, 0xE69A},
+	{0xFE69B, 0xE69B},
+	{0xFE69C, 0xE69C},
+	{0xFE69D, 0xE69D},
+	{0xFE69E, 0xE69E},
+	{0xFE69F, 0xE69F},
+	{0xFE6A0, 0xE6A0},
+	{0xFE6A1, 0xE6A1},
+	{0xFE6A2, 0xE6A2},
+	{0xFE6A3, 0xE6A3},
+	{0xFE6A4, 0xE6A4},
+	{0xFE6A5, 0xE6A5},
+	{0xFE6A6, 0xE6A6},
+	{0xFE6A7, 0xE6A7},
+	{0xFE6A8, 0xE6A8},
+	{0xFE6A9, 0xE6A9},
+	{0xFE6AA, 0xE6AA},
+	{0xFE6AB, 0xE6AB},
+	{0xFE6AC, 0xE6AC},
+	{0xFE6AD, 0xE6AD},
+	{0xFE6AE, 0xE6AE},
+	{0xFE6AF, 0xE6AF},
+	{0xFE6B0, 0xE6B0},
+	{0xFE6B1, 0xE6B1},
+	{0xFE6B2, 0xE6B2},
+	{0xFE6B3, 0xE6B3},
+	{0xFE6B4, 0xE6B4},
+	{0xFE6B5, 0xE6B5},
+	{0xFE6B6, 0xE6B6},
+	{0xFE6B7, 0xE6B7},
+	{0xFE6B8, 0xE6B8},
+	{0xFE6B9, 0xE6B9},
+	{0xFE6BA, 0xE6BA},
+	{0xFE6BB, 0xE6BB},
+	{0xFE6BC, 0xE6BC},
+	{0xFE6BD, 0xE6BD},
+	{0xFE6BE, 0xE6BE},
+	{0xFE6BF, 0xE6BF},
+	{0xFE6C0, 0xE6C0},
+	{0xFE6C1, 0xE6C1},
+	{0xFE6C2, 0xE6C2},
+	{0xFE6C3, 0xE6C3},
+	{0xFE6C4, 0xE6C4},
+	{0xFE6C5, 0xE6C5},
+	{0xFE6C6, 0xE6C6},
+	{0xFE6C7, 0xE6C7},
+	{0xFE6C8, 0xE6C8},
+	{0xFE6C9, 0xE6C9},
+	{0xFE6CA, 0xE6CA},
+	{0xFE6CB, 0xE6CB},
+	{0xFE6CC, 0xE6CC},
+	{0xFE6CD, 0xE6CD},
+	{0xFE6CE, 0xE6CE},
+	{0xFE6CF, 0xE6CF},
+	{0xFE6D0, 0xE6D0},
+	{0xFE6D1, 0xE6D1},
+	{0xFE6D2, 0xE6D2},
+	{0xFE6D3, 0xE6D3},
+	{0xFE6D4, 0xE6D4},
+	{0xFE6D5, 0xE6D5},
+	{0xFE6D6, 0xE6D6},
+	{0xFE6D7, 0xE6D7},
+	{0xFE6D8, 0xE6D8},
+	{0xFE6D9, 0xE6D9},
+	{0xFE6DA, 0xE6DA},
+	{0xFE6DB, 0xE6DB},
+	{0xFE6DC, 0xE6DC},
+	{0xFE6DD, 0xE6DD},
+	{0xFE6DE, 0xE6DE},
+	{0xFE6DF, 0xE6DF},
+	{0xFE6E0, 0xE6E0},
+	{0xFE6E1, 0xE6E1},
+	{0xFE6E2, 0xE6E2},
+	{0xFE6E3, 0xE6E3},
+	{0xFE6E4, 0xE6E4},
+	{0xFE6E5, 0xE6E5},
+	{0xFE6E6, 0xE6E6},
+	{0xFE6E7, 0xE6E7},
+	{0xFE6E8, 0xE6E8},
+	{0xFE6E9, 0xE6E9},
+	{0xFE6EA, 0xE6EA},
+	{0xFE6EB, 0xE6EB},
+	{0xFE6EC, 0xE6EC},
+	{0xFE6ED, 0xE6ED},
+	{0xFE6EE, 0xE6EE},
+	{0xFE6EF, 0xE6EF},
+	{0xFE6F0, 0xE6F0},
+	{0xFE6F1, 0xE6F1},
+	{0xFE6F2, 0xE6F2},
+	{0xFE6F3, 0xE6F3},
+	{0xFE6F4, 0xE6F4},
+	{0xFE6F5, 0xE6F5},
+	{0xFE6F6, 0xE6F6},
+	{0xFE6F7, 0xE6F7},
+	{0xFE6F8, 0xE6F8},
+	{0xFE6F9, 0xE6F9},
+	{0xFE6FA, 0xE6FA},
+	{0xFE6FB, 0xE6FB},
+	{0xFE6FC, 0xE6FC},
+	{0xFE6FD, 0xE6FD},
+	{0xFE6FE, 0xE6FE},
+	{0xFE6FF, 0xE6FF},
+	{0xFE700, 0xE700},
+	{0xFE701, 0xE701},
+	{0xFE702, 0xE702},
+	{0xFE703, 0xE703},
+	{0xFE704, 0xE704},
+	{0xFE705, 0xE705},
+	{0xFE706, 0xE706},
+	{0xFE707, 0xE707},
+	{0xFE708, 0xE708},
+	{0xFE709, 0xE709},
+	{0xFE70A, 0xE70A},
+	{0xFE70B, 0xE70B},
+	{0xFE70C, 0xE70C},
+	{0xFE70D, 0xE70D},
+	{0xFE70E, 0xE70E},
+	{0xFE70F, 0xE70F},
+	{0xFE710, 0xE710},
+	{0xFE711, 0xE711},
+	{0xFE712, 0xE712},
+	{0xFE713, 0xE713},
+	{0xFE714, 0xE714},
+	{0xFE715, 0xE715},
+	{0xFE716, 0xE716},
+	{0xFE717, 0xE717},
+	{0xFE718, 0xE718},
+	{0xFE719, 0xE719},
+	{0xFE71A, 0xE71A},
+	{0xFE71B, 0xE71B},
+	{0xFE71C, 0xE71C},
+	{0xFE71D, 0xE71D},
+	{0xFE71E, 0xE71E},
+	{0xFE71F, 0xE71F},
+	{0xFE720, 0xE720},
+	{0xFE721, 0xE721},
+	{0xFE722, 0xE722},
+	{0xFE723, 0xE723},
+	{0xFE724, 0xE724},
+	{0xFE725, 0xE725},
+	{0xFE726, 0xE726},
+	{0xFE727, 0xE727},
+	{0xFE728, 0xE728},
+	{0xFE729, 0xE729},
+	{0xFE72A, 0xE72A},
+	{0xFE72B, 0xE72B},
+	{0xFE72C, 0xE72C},
+	{0xFE72D, 0xE72D},
+	{0xFE72E, 0xE72E},
+	{0xFE72F, 0xE72F},
+	{0xFE730, 0xE730},
+	{0xFE731, 0xE731},
+	{0xFE732, 0xE732},
+	{0xFE733, 0xE733},
+	{0xFE734, 0xE734},
+	{0xFE735, 0xE735},
+	{0xFE736, 0xE736},
+	{0xFE737, 0xE737},
+	{0xFE738, 0xE738},
+	{0xFE739, 0xE739},
+	{0xFE73A, 0xE73A},
+	{0xFE73B, 0xE73B},
+	{0xFE73C, 0xE73C},
+	{0xFE73D, 0xE73D},
+	{0xFE73E, 0xE73E},
+	{0xFE73F, 0xE73F},
+	{0xFE740, 0xE740},
+	{0xFE741, 0xE741},
+	{0xFE742, 0xE742},
+	{0xFE743, 0xE743},
+	{0xFE744, 0xE744},
+	{0xFE745, 0xE745},
+	{0xFE746, 0xE746},
+	{0xFE747, 0xE747},
+	{0xFE748, 0xE748},
+	{0xFE749, 0xE749},
+	{0xFE74A, 0xE74A},
+	{0xFE74B, 0xE74B},
+	{0xFE74C, 0xE74C},
+	{0xFE74D, 0xE74D},
+	{0xFE74E, 0xE74E},
+	{0xFE74F, 0xE74F},
+	{0xFE750, 0xE750},
+	{0xFE751, 0xE751},
+	{0xFE752, 0xE752},
+	{0xFE753, 0xE753},
+	{0xFE754, 0xE754},
+	{0xFE755, 0xE755},
+	{0xFE756, 0xE756},
+	{0xFE757, 0xE757},
+	{0xFE758, 0xE758},
+	{0xFE759, 0xE759},
+	{0xFE75A, 0xE75A},
+	{0xFE75B, 0xE75B},
+	{0xFE75C, 0xE75C},
+	{0xFE75D, 0xE75D},
+	{0xFE75E, 0xE75E},
+	{0xFE75F, 0xE75F},
+	{0xFE760, 0xE760},
+	{0xFE761, 0xE761},
+	{0xFE762, 0xE762},
+	{0xFE763, 0xE763},
+	{0xFE764, 0xE764},
+	{0xFE765, 0xE765},
+	{0xFE766, 0xE766},
+	{0xFE767, 0xE767},
+	{0xFE768, 0xE768},
+	{0xFE769, 0xE769},
+	{0xFE76A, 0xE76A},
+	{0xFE76B, 0xE76B},
+	{0xFE76C, 0xE76C},
+	{0xFE76D, 0xE76D},
+	{0xFE76E, 0xE76E},
+	{0xFE76F, 0xE76F},
+	{0xFE770, 0xE770},
+	{0xFE771, 0xE771},
+	{0xFE772, 0xE772},
+	{0xFE773, 0xE773},
+	{0xFE774, 0xE774},
+	{0xFE775, 0xE775},
+	{0xFE776, 0xE776},
+	{0xFE777, 0xE777},
+	{0xFE778, 0xE778},
+	{0xFE779, 0xE779},
+	{0xFE77A, 0xE77A},
+	{0xFE77B, 0xE77B},
+	{0xFE77C, 0xE77C},
+	{0xFE77D, 0xE77D},
+	{0xFE77E, 0xE77E},
+	{0xFE77F, 0xE77F},
+	{0xFE780, 0xE780},
+	{0xFE781, 0xE781},
+	{0xFE782, 0xE782},
+	{0xFE783, 0xE783},
+	{0xFE784, 0xE784},
+	{0xFE785, 0xE785},
+	{0xFE786, 0xE786},
+	{0xFE787, 0xE787},
+	{0xFE788, 0xE788},
+	{0xFE789, 0xE789},
+	{0xFE78A, 0xE78A},
+	{0xFE78B, 0xE78B},
+	{0xFE78C, 0xE78C},
+	{0xFE78D, 0xE78D},
+	{0xFE78E, 0xE78E},
+	{0xFE78F, 0xE78F},
+	{0xFE790, 0xE790},
+	{0xFE791, 0xE791},
+	{0xFE792, 0xE792},
+	{0xFE793, 0xE793},
+	{0xFE794, 0xE794},
+	{0xFE795, 0xE795},
+	{0xFE796, 0xE796},
+	{0xFE797, 0xE797},
+	{0xFE798, 0xE798},
+	{0xFE799, 0xE799},
+	{0xFE79A, 0xE79A},
+	{0xFE79B, 0xE79B},
+	{0xFE79C, 0xE79C},
+	{0xFE79D, 0xE79D},
+	{0xFE79E, 0xE79E},
+	{0xFE79F, 0xE79F},
+	{0xFE7A0, 0xE7A0},
+	{0xFE7A1, 0xE7A1},
+	{0xFE7A2, 0xE7A2},
+	{0xFE7A3, 0xE7A3},
+	{0xFE7A4, 0xE7A4},
+	{0xFE7A5, 0xE7A5},
+	{0xFE7A6, 0xE7A6},
+	{0xFE7A7, 0xE7A7},
+	{0xFE7A8, 0xE7A8},
+	{0xFE7A9, 0xE7A9},
+	{0xFE7AA, 0xE7AA},
+	{0xFE7AB, 0xE7AB},
+	{0xFE7AC, 0xE7AC},
+	{0xFE7AD, 0xE7AD},
+	{0xFE7AE, 0xE7AE},
+	{0xFE7AF, 0xE7AF},
+	{0xFE7B0, 0xE7B0},
+	{0xFE7B1, 0xE7B1},
+	{0xFE7B2, 0xE7B2},
+	{0xFE7B3, 0xE7B3},
+	{0xFE7B4, 0xE7B4},
+	{0xFE7B5, 0xE7B5},
+	{0xFE7B6, 0xE7B6},
+	{0xFE7B7, 0xE7B7},
+	{0xFE7B8, 0xE7B8},
+	{0xFE7B9, 0xE7B9},
+	{0xFE7BA, 0xE7BA},
+	{0xFE7BB, 0xE7BB},
+	{0xFE7BC, 0xE7BC},
+	{0xFE7BD, 0xE7BD},
+	{0xFE7BE, 0xE7BE},
+	{0xFE7BF, 0xE7BF},
+	{0xFE7C0, 0xE7C0},
+	{0xFE7C1, 0xE7C1},
+	{0xFE7C2, 0xE7C2},
+	{0xFE7C3, 0xE7C3},
+	{0xFE7C4, 0xE7C4},
+	{0xFE7C5, 0xE7C5},
+	{0xFE7C6, 0xE7C6},
+	{0xFE7C7, 0xE7C7},
+	{0xFE7C8, 0xE7C8},
+	{0xFE7C9, 0xE7C9},
+	{0xFE7CA, 0xE7CA},
+	{0xFE7CB, 0xE7CB},
+	{0xFE7CC, 0xE7CC},
+	{0xFE7CD, 0xE7CD},
+	{0xFE7CE, 0xE7CE},
+	{0xFE7CF, 0xE7CF},
+	{0xFE7D0, 0xE7D0},
+	{0xFE7D1, 0xE7D1},
+	{0xFE7D2, 0xE7D2},
+	{0xFE7D3, 0xE7D3},
+	{0xFE7D4, 0xE7D4},
+	{0xFE7D5, 0xE7D5},
+	{0xFE7D6, 0xE7D6},
+	{0xFE7D7, 0xE7D7},
+	{0xFE7D8, 0xE7D8},
+	{0xFE7D9, 0xE7D9},
+	{0xFE7DA, 0xE7DA},
+	{0xFE7DB, 0xE7DB},
+	{0xFE7DC, 0xE7DC},
+	{0xFE7DD, 0xE7DD},
+	{0xFE7DE, 0xE7DE},
+	{0xFE7DF, 0xE7DF},
+	{0xFE7E0, 0xE7E0},
+	{0xFE7E1, 0xE7E1},
+	{0xFE7E2, 0xE7E2},
+	{0xFE7E3, 0xE7E3},
+	{0xFE7E4, 0xE7E4},
+	{0xFE7E5, 0xE7E5},
+	{0xFE7E6, 0xE7E6},
+	{0xFE7E7, 0xE7E7},
+	{0xFE7E8, 0xE7E8},
+	{0xFE7E9, 0xE7E9},
+	{0xFE7EA, 0xE7EA},
+	{0xFE7EB, 0xE7EB},
+	{0xFE7EC, 0xE7EC},
+	{0xFE7ED, 0xE7ED},
+	{0xFE7EE, 0xE7EE},
+	{0xFE7EF, 0xE7EF},
+	{0xFE7F0, 0xE7F0},
+	{0xFE7F1, 0xE7F1},
+	{0xFE7F2, 0xE7F2},
+	{0xFE7F3, 0xE7F3},
+	{0xFE7F4, 0xE7F4},
+	{0xFE7F5, 0xE7F5},
+	{0xFE7F6, 0xE7F6},
+	{0xFE7F7, 0xE7F7},
+	{0xFE7F8, 0xE7F8},
+	{0xFE7F9, 0xE7F9},
+	{0xFE7FA, 0xE7FA},
+	{0xFE7FB, 0xE7FB},
+	{0xFE7FC, 0xE7FC},
+	{0xFE7FD, 0xE7FD},
+	{0xFE7FE, 0xE7FE},
+	{0xFE7FF, 0xE7FF},
+	{0xFF70F, 0xF70F},
+	{0xFF717, 0xF717},
+	{0xFF71B, 0xF71B},
+	{0xFF71C, 0xF71C},
+	{0xFF71D, 0xF71D},
+	{0xFF71E, 0xF71E},
+	{0xFF71F, 0xF71F},
+	{0xFF721, 0xF721},
+	{0xFF722, 0xF722},
+	{0xFF723, 0xF723},
+	{0xFF724, 0xF724},
+	{0xFF725, 0xF725},
+	{0xFF726, 0xF726},
+	{0xFF727, 0xF727},
+	{0xFF728, 0xF728},
+	{0xFF729, 0xF729},
+	{0xFF72A, 0xF72A},
+	{0xFF72B, 0xF72B},
+	{0xFF72C, 0xF72C},
+	{0xFF72D, 0xF72D},
+	{0xFF72E, 0xF72E},
+	{0xFF72F, 0xF72F},
+	{0xFF730, 0xF730},
+	{0xFF731, 0xF731},
+	{0xFF732, 0xF732},
+	{0xFF733, 0xF733},
+	{0xFF734, 0xF734},
+	{0xFF735, 0xF735},
+	{0xFF736, 0xF736},
+	{0xFF737, 0xF737},
+	{0xFF738, 0xF738},
+	{0xFF739, 0xF739},
+	{0xFF73A, 0xF73A},
+	{0xFF73B, 0xF73B},
+	{0xFF73C, 0xF73C},
+	{0xFF73D, 0xF73D},
+	{0xFF73E, 0xF73E},
+	{0xFF73F, 0xF73F},
+	{0xFF740, 0xF740},
+	{0xFF741, 0xF741},
+	{0xFF742, 0xF742},
+	{0xFF743, 0xF743},
+	{0xFF744, 0xF744},
+	{0xFF745, 0xF745},
+	{0xFF746, 0xF746},
+	{0xFF747, 0xF747},
+	{0xFF748, 0xF748},
+	{0xFF749, 0xF749},
+	{0xFF74A, 0xF74A},
+	{0xFF74B, 0xF74B},
+	{0xFF74C, 0xF74C},
+	{0xFF74D, 0xF74D},
+	{0xFF74E, 0xF74E},
+	{0xFF74F, 0xF74F},
+	{0xFF750, 0xF750},
+	{0xFF751, 0xF751},
+	{0xFF752, 0xF752},
+	{0xFF753, 0xF753},
+	{0xFF754, 0xF754},
+	{0xFF755, 0xF755},
+	{0xFF756, 0xF756},
+	{0xFF757, 0xF757},
+	{0xFF758, 0xF758},
+	{0xFF759, 0xF759},
+	{0xFF75A, 0xF75A},
+	{0xFF75B, 0xF75B},
+	{0xFF75C, 0xF75C},
+	{0xFF75D, 0xF75D},
+	{0xFF75E, 0xF75E},
+	{0xFF75F, 0xF75F},
+	{0xFF760, 0xF760},
+	{0xFF761, 0xF761},
+	{0xFF762, 0xF762},
+	{0xFF763, 0xF763},
+	{0xFF764, 0xF764},
+	{0xFF765, 0xF765},
+	{0xFF766, 0xF766},
+	{0xFF767, 0xF767},
+	{0xFF768, 0xF768},
+	{0xFF769, 0xF769},
+	{0xFF76A, 0xF76A},
+	{0xFF76B, 0xF76B},
+	{0xFF76C, 0xF76C},
+	{0xFF76D, 0xF76D},
+	{0xFF76E, 0xF76E},
+	{0xFF76F, 0xF76F},
+	{0xFF770, 0xF770},
+	{0xFF771, 0xF771},
+	{0xFF772, 0xF772},
+	{0xFF773, 0xF773},
+	{0xFF774, 0xF774},
+	{0xFF775, 0xF775},
+	{0xFF776, 0xF776},
+	{0xFF777, 0xF777},
+	{0xFF778, 0xF778},
+	{0xFF779, 0xF779},
+	{0xFF77A, 0xF77A},
+	{0xFF77B, 0xF77B},
+	{0xFF77C, 0xF77C},
+	{0xFF77D, 0xF77D},
+	{0xFF77E, 0xF77E},
+	{0xFF77F, 0xF77F},
+	{0xFF780, 0xF780},
+	{0xFF781, 0xF781},
+	{0xFF782, 0xF782},
+	{0xFF783, 0xF783},
+	{0xFF784, 0xF784},
+	{0xFF785, 0xF785},
+	{0xFF786, 0xF786},
+	{0xFF787, 0xF787},
+	{0xFF788, 0xF788},
+	{0xFF789, 0xF789},
+	{0xFF78A, 0xF78A},
+	{0xFF78B, 0xF78B},
+	{0xFF78C, 0xF78C},
+	{0xFF78D, 0xF78D},
+	{0xFF78E, 0xF78E},
+	{0xFF78F, 0xF78F},
+	{0xFF790, 0xF790},
+	{0xFF791, 0xF791},
+	{0xFF792, 0xF792},
+	{0xFF795, 0xF795},
+	{0xFF796, 0xF796},
+	{0xFF799, 0xF799},
+	{0xFF79A, 0xF79A},
+	{0xFF79B, 0xF79B},
+	{0xFF79C, 0xF79C},
+	{0xFF79D, 0xF79D},
+	{0xFF79E, 0xF79E},
+	{0xFF79F, 0xF79F},
+	{0xFF7AE, 0xF7AE},
+	{0xFF7B0, 0xF7B0},
+	{0xFF7B1, 0xF7B1},
+	{0xFF7B2, 0xF7B2},
+	{0xFF7B3, 0xF7B3},
+	{0xFF7B4, 0xF7B4},
+	{0xFF7B5, 0xF7B5},
+	{0xFF7B6, 0xF7B6},
+	{0xFF7B7, 0xF7B7},
+	{0xFF7B8, 0xF7B8},
+	{0xFF7B9, 0xF7B9},
+	{0xFF7BA, 0xF7BA},
+	{0xFF7BB, 0xF7BB},
+	{0xFF7BC, 0xF7BC},
+	{0xFF7BD, 0xF7BD},
+	{0xFF7BE, 0xF7BE},
+	{0xFF7BF, 0xF7BF},
+	{0xFF7C0, 0xF7C0},
+	{0xFF7C1, 0xF7C1},
+	{0xFF7C2, 0xF7C2},
+	{0xFF7C3, 0xF7C3},
+	{0xFF7C4, 0xF7C4},
+	{0xFF7C5, 0xF7C5},
+	{0xFF7C6, 0xF7C6},
+	{0xFF7C7, 0xF7C7},
+	{0xFF7C8, 0xF7C8},
+	{0xFF7C9, 0xF7C9},
+	{0xFF7CA, 0xF7CA},
+	{0xFF7CB, 0xF7CB},
+	{0xFF7CC, 0xF7CC},
+	{0xFF7CD, 0xF7CD},
+	{0xFF7CE, 0xF7CE},
+	{0xFF7CF, 0xF7CF},
+	{0xFF7D0, 0xF7D0},
+	{0xFF7D1, 0xF7D1},
+	{0xFF7D2, 0xF7D2},
+	{0xFF7D3, 0xF7D3},
+	{0xFF7D4, 0xF7D4},
+	{0xFF7D5, 0xF7D5},
+	{0xFF7D6, 0xF7D6},
+	{0xFF7D7, 0xF7D7},
+	{0xFF7D8, 0xF7D8},
+	{0xFF7D9, 0xF7D9},
+	{0xFF7DA, 0xF7DA},
+	{0xFF7DB, 0xF7DB},
+	{0xFF7DC, 0xF7DC},
+	{0xFF7DD, 0xF7DD},
+	{0xFF7DE, 0xF7DE},
+	{0xFF7DF, 0xF7DF},
+	{0xFF7E0, 0xF7E0},
+	{0xFF7E1, 0xF7E1},
+	{0xFF7E2, 0xF7E2},
+	{0xFF7E3, 0xF7E3},
+	{0xFF7E4, 0xF7E4},
+	{0xFF7E5, 0xF7E5},
+	{0xFF7E6, 0xF7E6},
+	{0xFF7E7, 0xF7E7},
+	{0xFF7E8, 0xF7E8},
+	{0xFF7E9, 0xF7E9},
+	{0xFF7EA, 0xF7EA},
+	{0xFF7EB, 0xF7EB},
+	{0xFF7EC, 0xF7EC},
+	{0xFF7ED, 0xF7ED},
+	{0xFF7EE, 0xF7EE},
+	{0xFF7EF, 0xF7EF},
+	{0xFF7F0, 0xF7F0},
+	{0xFF7F1, 0xF7F1},
+	{0xFF7F2, 0xF7F2},
+	{0xFF7F3, 0xF7F3},
+	{0xFF7F4, 0xF7F4},
+	{0xFF7F5, 0xF7F5},
+	{0xFF7F6, 0xF7F6},
+	{0xFF7F7, 0xF7F7},
+	{0xFF7F8, 0xF7F8},
+	{0xFF7F9, 0xF7F9},
+	{0xFF7FA, 0xF7FA},
+	{0xFF7FB, 0xF7FB},
+	{0xFF7FC, 0xF7FC},
+	{0xFF7FD, 0xF7FD},
+	{0xFF7FE, 0xF7FE},
+	{0xFF7FF, 0xF7FF},
+	{0xFF900, 0xF900},
+	{0xFF901, 0xF901},
+	{0xFF902, 0xF902},
+	{0xFF903, 0xF903},
+	{0xFF904, 0xF904},
+	{0xFF905, 0xF905},
+	{0xFF906, 0xF906},
+	{0xFF907, 0xF907},
+	{0xFF908, 0xF908},
+	{0xFF909, 0xF909},
+	{0xFF90A, 0xF90A},
+	{0xFF90B, 0xF90B},
+	{0xFF90C, 0xF90C},
+	{0xFF90D, 0xF90D},
+	{0xFF90E, 0xF90E},
+	{0xFF90F, 0xF90F},
+	{0xFF910, 0xF910},
+	{0xFF911, 0xF911},
+	{0xFF912, 0xF912},
+	{0xFF913, 0xF913},
+	{0xFF914, 0xF914},
+	{0xFF915, 0xF915},
+	{0xFF916, 0xF916},
+	{0xFF917, 0xF917},
+	{0xFF918, 0xF918},
+	{0xFF919, 0xF919},
+	{0xFF91A, 0xF91A},
+	{0xFF91B, 0xF91B},
+	{0xFF91C, 0xF91C},
+	{0xFF91D, 0xF91D},
+	{0xFF91F, 0xF91F},
+	{0xFF920, 0xF920},
+	{0xFF921, 0xF921},
+	{0xFF922, 0xF922},
+	{0xFF923, 0xF923},
+	{0xFF924, 0xF924},
+	{0xFF925, 0xF925},
+	{0xFF926, 0xF926},
+	{0xFF927, 0xF927},
+	{0xFF928, 0xF928},
+	{0xFF929, 0xF929},
+	{0xFF92A, 0xF92A},
+	{0xFF92B, 0xF92B},
+	{0xFF92C, 0xF92C},
+	{0xFF92D, 0xF92D},
+	{0xFF92E, 0xF92E},
+	{0xFF92F, 0xF92F},
+	{0xFF93E, 0xF93E},
+	{0xFF940, 0xF940},
+	{0xFF941, 0xF941},
+	{0xFF942, 0xF942},
+	{0xFF943, 0xF943},
+	{0xFF944, 0xF944},
+	{0xFF945, 0xF945},
+	{0xFF946, 0xF946},
+	{0xFF947, 0xF947},
+	{0xFF948, 0xF948},
+	{0xFF949, 0xF949},
+	{0xFF94A, 0xF94A},
+	{0xFF94B, 0xF94B},
+	{0xFF94C, 0xF94C},
+	{0xFF94D, 0xF94D},
+	{0xFF94E, 0xF94E},
+	{0xFF94F, 0xF94F},
+	{0xFF950, 0xF950},
+	{0xFF951, 0xF951},
+	{0xFF952, 0xF952},
+	{0xFF953, 0xF953},
+	{0xFF954, 0xF954},
+	{0xFF955, 0xF955},
+	{0xFF956, 0xF956},
+	{0xFF957, 0xF957},
+	{0xFF958, 0xF958},
+	{0xFF959, 0xF959},
+	{0xFF95A, 0xF95A},
+	{0xFF95B, 0xF95B},
+	{0xFF95C, 0xF95C},
+	{0xFF95D, 0xF95D},
+	{0xFF95E, 0xF95E},
+	{0xFF95F, 0xF95F},
+	{0xFF960, 0xF960},
+	{0xFF961, 0xF961},
+	{0xFF962, 0xF962},
+	{0xFF963, 0xF963},
+	{0xFF964, 0xF964},
+	{0xFF965, 0xF965},
+	{0xFF966, 0xF966},
+	{0xFF967, 0xF967},
+	{0xFF968, 0xF968},
+	{0xFF969, 0xF969},
+	{0xFF96A, 0xF96A},
+	{0xFF96B, 0xF96B},
+	{0xFF96C, 0xF96C},
+	{0xFF96D, 0xF96D},
+	{0xFF96E, 0xF96E},
+	{0xFF96F, 0xF96F},
+	{0xFF970, 0xF970},
+	{0xFF971, 0xF971},
+	{0xFF972, 0xF972},
+	{0xFF973, 0xF973},
+	{0xFF974, 0xF974},
+	{0xFF975, 0xF975},
+	{0xFF976, 0xF976},
+	{0xFF977, 0xF977},
+	{0xFF978, 0xF978},
+	{0xFF979, 0xF979},
+	{0xFF97A, 0xF97A},
+	{0xFF97B, 0xF97B},
+	{0xFF97C, 0xF97C},
+	{0xFF97D, 0xF97D},
+	{0xFF97E, 0xF97E},
+	{0xFF97F, 0xF97F},
+	{0xFF980, 0xF980},
+	{0xFF981, 0xF981},
+	{0xFF982, 0xF982},
+	{0xFF983, 0xF983},
+	{0xFF984, 0xF984},
+	{0xFF985, 0xF985},
+	{0xFF986, 0xF986},
+	{0xFF987, 0xF987},
+	{0xFF988, 0xF988},
+	{0xFF989, 0xF989},
+	{0xFF98A, 0xF98A},
+	{0xFF98B, 0xF98B},
+	{0xFF98C, 0xF98C},
+	{0xFF98D, 0xF98D},
+	{0xFF98E, 0xF98E},
+	{0xFF98F, 0xF98F},
+	{0xFF990, 0xF990},
+	{0xFF991, 0xF991},
+	{0xFF992, 0xF992},
+	{0xFF993, 0xF993},
+	{0xFF994, 0xF994},
+	{0xFF995, 0xF995},
+	{0xFF996, 0xF996},
+	{0xFF997, 0xF997},
+	{0xFF998, 0xF998},
+	{0xFF999, 0xF999},
+	{0xFF99A, 0xF99A},
+	{0xFF99B, 0xF99B},
+	{0xFF99C, 0xF99C},
+	{0xFF99D, 0xF99D},
+	{0xFF99E, 0xF99E},
+	{0xFF99F, 0xF99F},
+	{0xFF9A0, 0xF9A0},
+	{0xFF9A1, 0xF9A1},
+	{0xFF9A2, 0xF9A2},
+	{0xFF9A3, 0xF9A3},
+	{0xFF9A4, 0xF9A4},
+	{0xFF9A5, 0xF9A5},
+	{0xFF9A6, 0xF9A6},
+	{0xFF9A7, 0xF9A7},
+	{0xFF9A8, 0xF9A8},
+	{0xFF9A9, 0xF9A9},
+	{0xFF9AA, 0xF9AA},
+	{0xFF9AB, 0xF9AB},
+	{0xFF9AC, 0xF9AC},
+	{0xFF9AD, 0xF9AD},
+	{0xFF9AE, 0xF9AE},
+	{0xFF9AF, 0xF9AF},
+	{0xFF9B0, 0xF9B0},
+	{0xFF9B1, 0xF9B1},
+	{0xFF9B2, 0xF9B2},
+	{0xFF9B3, 0xF9B3},
+	{0xFF9B4, 0xF9B4},
+	{0xFF9B5, 0xF9B5},
+	{0xFF9B6, 0xF9B6},
+	{0xFF9B7, 0xF9B7},
+	{0xFF9B8, 0xF9B8},
+	{0xFF9B9, 0xF9B9},
+	{0xFF9BA, 0xF9BA},
+	{0xFF9BB, 0xF9BB},
+	{0xFF9BC, 0xF9BC},
+	{0xFF9BD, 0xF9BD},
+	{0xFF9BE, 0xF9BE},
+	{0xFF9BF, 0xF9BF},
+	{0xFF9C0, 0xF9C0},
+	{0xFF9C1, 0xF9C1},
+	{0xFF9C2, 0xF9C2},
+	{0xFF9C3, 0xF9C3},
+	{0xFF9C4, 0xF9C4},
+	{0xFF9C5, 0xF9C5},
+	{0xFF9C6, 0xF9C6},
+	{0xFF9C7, 0xF9C7},
+	{0xFF9C8, 0xF9C8},
+	{0xFF9C9, 0xF9C9},
+	{0xFF9CA, 0xF9CA},
+	{0xFF9CB, 0xF9CB},
+	{0xFF9CC, 0xF9CC},
+	{0xFF9CD, 0xF9CD},
+	{0xFF9CE, 0xF9CE},
+	{0xFF9CF, 0xF9CF},
+	{0xFF9D0, 0xF9D0},
+	{0xFF9D1, 0xF9D1},
+	{0xFF9D2, 0xF9D2},
+	{0xFF9D3, 0xF9D3},
+	{0xFF9D4, 0xF9D4},
+	{0xFF9D5, 0xF9D5},
+	{0xFF9D6, 0xF9D6},
+	{0xFF9D7, 0xF9D7},
+	{0xFF9D8, 0xF9D8},
+	{0xFF9D9, 0xF9D9},
+	{0xFF9DA, 0xF9DA},
+	{0xFF9DB, 0xF9DB},
+	{0xFF9DC, 0xF9DC},
+	{0xFF9DD, 0xF9DD},
+	{0xFF9DE, 0xF9DE},
+	{0xFF9DF, 0xF9DF},
+	{0xFF9E0, 0xF9E0},
+	{0xFF9E1, 0xF9E1},
+	{0xFF9E2, 0xF9E2},
+	{0xFF9E3, 0xF9E3},
+	{0xFF9E4, 0xF9E4},
+	{0xFF9E5, 0xF9E5},
+	{0xFF9E6, 0xF9E6},
+	{0xFF9E7, 0xF9E7},
+	{0xFF9E8, 0xF9E8},
+	{0xFF9E9, 0xF9E9},
+	{0xFF9EA, 0xF9EA},
+	{0xFF9EB, 0xF9EB},
+	{0xFF9EC, 0xF9EC},
+	{0xFF9ED, 0xF9ED},
+	{0xFF9EE, 0xF9EE},
+	{0xFF9EF, 0xF9EF},
+	{0xFF9F0, 0xF9F0},
+	{0xFF9F1, 0xF9F1},
+	{0xFF9F2, 0xF9F2},
+	{0xFF9F3, 0xF9F3},
+	{0xFF9F4, 0xF9F4},
+	{0xFF9F5, 0xF9F5},
+	{0xFF9F6, 0xF9F6},
+	{0xFF9F7, 0xF9F7},
+	{0xFF9F8, 0xF9F8},
+	{0xFF9F9, 0xF9F9},
+	{0xFF9FA, 0xF9FA},
+	{0xFF9FB, 0xF9FB},
+	{0xFF9FC, 0xF9FC},
+	{0xFF9FD, 0xF9FD},
+	{0xFF9FE, 0xF9FE},
+	{0xFF9FF, 0xF9FF},
+};
+
+const size_t CASIO_EXPORT casio_fontchar_nrev = 1562;
+
+/* Token trie, on the UTF-8 sequences; the children of a node are
+ * contiguous and sorted, and a node has a code if a character ends
+ * there. */
+
+const fontchar_node_t CASIO_EXPORT casio_fontchar_trie[830] = {
+	{0x00, 34,    1, 0x0000},
+	{0x20, 10,   35, 0x0000},
+	{0x2A,  1,   45, 0x0000},
+	{0x41,  4,   46, 0x0000},
+	{0x42,  2,   50, 0x0000},
+	{0x43,  4,   52, 0x0000},
+	{0x44,  6,   56, 0x0000},
+	{0x45,  3,   62, 0x0000},
+	{0x46,  6,   65, 0x0000},
+	{0x47,  4,   71, 0x0000},
+	{0x48,  2,   75, 0x0000},
+	{0x49,  5,   77, 0x0000},
+	{0x4C,  5,   82, 0x0000},
+	{0x4D,  5,   87, 0x0000},
+	{0x4E,  2,   92, 0x0000},
+	{0x4F,  2,   94, 0x0000},
+	{0x50,  6,   96, 0x0000},
+	{0x51,  1,  102, 0x0000},
+	{0x52,  7,  103, 0x0000},
+	{0x53,  6,  110, 0x0000},
+	{0x54,  5,  116, 0x0000},
+	{0x56,  2,  121, 0x0000},
+	{0x57,  1,  123, 0x0000},
+	{0x58,  3,  124, 0x0000},
+	{0x59,  3,  127, 0x0000},
+	{0x63,  1,  130, 0x0000},
+	{0x64,  2,  131, 0x0000},
+	{0x65,  1,  133, 0x0000},
+	{0x6C,  2,  134, 0x0000},
+	{0x73,  1,  136, 0x0000},
+	{0x74,  2,  137, 0x0000},
+	{0xC2,  1,  139, 0x0000},
+	{0xCB,  1,  140, 0x0000},
+	{0xCE,  2,  141, 0x0000},
+	{0xE2,  2,  143, 0x0000},
+	{0x41,  1,  145, 0x0000},
+	{0x49,  1,  146, 0x0000},
+	{0x4F,  1,  147, 0x0000},
+	{0x52,  1,  148, 0x0000},
+	{0x53,  1,  149, 0x0000},
+	{0x54,  1,  150, 0x0000},
+	{0x58,  1,  151, 0x0000},
+	{0x61,  1,  152, 0x0000},
+	{0x6F,  1,  153, 0x0000},
+	{0x78,  2,  154, 0x0000},
+	{0x52,  1,  156, 0x0000},
+	{0x62,  1,  157, 0x0000},
+	{0x6E,  1,  158, 0x0000},
+	{0x72,  1,  159, 0x0000},
+	{0x75,  1,  160, 0x0000},
+	{0x69,  1,  161, 0x0000},
+	{0x72,  1,  162, 0x0000},
+	{0x69,  1,  163, 0x0000},
+	{0x6C,  3,  164, 0x0000},
+	{0x6F,  1,  167, 0x0000},
+	{0x75,  1,  168, 0x0000},
+	{0x20,  3,  169, 0x0000},
+	{0x65,  3,  172, 0x0000},
+	{0x69,  1,  175, 0x0000},
+	{0x6F,  0,    0, 0xF70A},
+	{0x72,  1,  176, 0x0000},
+	{0x73,  1,  177, 0x0000},
+	{0x6C,  1,  178, 0x0000},
+	{0x6E,  1,  179, 0x0000},
+	{0x78,  1,  180, 0x0000},
+	{0x2D,  1,  181, 0x0000},
+	{0x4D,  2,  182, 0x0000},
+	{0x61,  1,  184, 0x0000},
+	{0x69,  2,  185, 0x0000},
+	{0x6F,  1,  187, 0x0000},
+	{0x72,  1,  188, 0x0000},
+	{0x43,  1,  189, 0x0000},
+	{0x65,  1,  190, 0x0000},
+	{0x6F,  1,  191, 0x0000},
+	{0x72,  1,  192, 0x0000},
+	{0x65,  1,  193, 0x0000},
+	{0x6F,  1,  194, 0x0000},
+	{0x64,  1,  195, 0x0000},
+	{0x66,  2,  196, 0x0000},
+	{0x6D,  1,  198, 0x0000},
+	{0x6E,  2,  199, 0x0000},
+	{0x73,  1,  201, 0x0000},
+	{0x43,  1,  202, 0x0000},
+	{0x62,  1,  203, 0x0000},
+	{0x69,  2,  204, 0x0000},
+	{0x6F,  1,  206, 0x0000},
+	{0x70,  1,  207, 0x0000},
+	{0x4F,  1,  208, 0x0000},
+	{0x61,  2,  209, 0x0000},
+	{0x65,  2,  211, 0x0000},
+	{0x69,  1,  213, 0x0000},
+	{0x6F,  0,    0, 0x008E},
+	{0x65,  2,  214, 0x0000},
+	{0x6F,  2,  216, 0x0000},
+	{0x63,  1,  218, 0x0000},
+	{0x70,  1,  219, 0x0000},
+	{0x28,  0,    0, 0x00FB},
+	{0x65,  1,  220, 0x0000},
+	{0x6C,  1,  221, 0x0000},
+	{0x6F,  1,  222, 0x0000},
+	{0x72,  1,  223, 0x0000},
+	{0x78,  1,  224, 0x0000},
+	{0x28,  0,    0, 0x00FC},
+	{0x28,  0,    0, 0x00FD},
+	{0x61,  2,  225, 0x0000},
+	{0x63,  1,  227, 0x0000},
+	{0x65,  4,  228, 0x0000},
+	{0x69,  1,  232, 0x0000},
+	{0x6E,  1,  233, 0x0000},
+	{0x6F,  1,  234, 0x0000},
+	{0x63,  1,  235, 0x0000},
+	{0x65,  2,  236, 0x0000},
+	{0x6F,  1,  238, 0x0000},
+	{0x74,  2,  239, 0x0000},
+	{0x75,  1,  241, 0x0000},
+	{0x77,  1,  242, 0x0000},
+	{0x61,  1,  243, 0x0000},
+	{0x65,  1,  244, 0x0000},
+	{0x68,  1,  245, 0x0000},
+	{0x72,  1,  246, 0x0000},
+	{0xCE,  1,  247, 0x0000},
+	{0x65,  1,  248, 0x0000},
+	{0x69,  1,  249, 0x0000},
+	{0x68,  1,  250, 0x0000},
+	{0x66,  1,  251, 0x0000},
+	{0x6D,  2,  252, 0x0000},
+	{0x73,  1,  254, 0x0000},
+	{0x66,  1,  255, 0x0000},
+	{0x6D,  2,  256, 0x0000},
+	{0x73,  1,  258, 0x0000},
+	{0x6F,  1,  259, 0x0000},
+	{0x2F,  1,  260, 0x0000},
+	{0xC2,  1,  261, 0x0000},
+	{0x5E,  0,    0, 0x00A5},
+	{0x6E,  1,  262, 0x0000},
+	{0x6F,  1,  263, 0x0000},
+	{0x69,  1,  264, 0x0000},
+	{0x28,  0,    0, 0x00FE},
+	{0x61,  1,  265, 0x0000},
+	{0xB3,  1,  266, 0x0000},
+	{0xA3,  1,  267, 0x0000},
+	{0x94,  1,  268, 0x0000},
+	{0xA3,  2,  269, 0x0000},
+	{0x81,  1,  271, 0x0000},
+	{0x88,  1,  272, 0x0000},
+	{0x6E,  1,  273, 0x0000},
+	{0x6E,  1,  274, 0x0000},
+	{0x72,  1,  275, 0x0000},
+	{0x6D,  1,  276, 0x0000},
+	{0x74,  1,  277, 0x0000},
+	{0x6F,  1,  278, 0x0000},
+	{0x6F,  1,  279, 0x0000},
+	{0x6E,  1,  280, 0x0000},
+	{0x72,  1,  281, 0x0000},
+	{0x6E,  1,  282, 0x0000},
+	{0x6F,  1,  283, 0x0000},
+	{0x6F,  1,  284, 0x0000},
+	{0x73,  1,  285, 0x0000},
+	{0x73,  0,    0, 0x00C0},
+	{0x67,  1,  286, 0x0000},
+	{0x67,  1,  287, 0x0000},
+	{0x6E,  0,    0, 0x00D6},
+	{0x65,  1,  288, 0x0000},
+	{0x72,  1,  289, 0x0000},
+	{0x6F,  1,  290, 0x0000},
+	{0x72,  4,  291, 0x0000},
+	{0x73,  0,    0, 0x00D1},
+	{0x6E,  1,  295, 0x0000},
+	{0x6D,  1,  296, 0x0000},
+	{0x45,  1,  297, 0x0000},
+	{0x53,  1,  298, 0x0000},
+	{0x70,  1,  299, 0x0000},
+	{0x63,  0,    0, 0x00D4},
+	{0x67,  0,    0, 0x00DA},
+	{0x74,  1,  300, 0x0000},
+	{0x6D,  1,  301, 0x0000},
+	{0x61,  1,  302, 0x0000},
+	{0x7A,  1,  303, 0x0000},
+	{0x73,  1,  304, 0x0000},
+	{0x67,  0,    0, 0x00DD},
+	{0x70,  2,  305, 0x0000},
+	{0x4C,  1,  307, 0x0000},
+	{0x61,  1,  308, 0x0000},
+	{0x69,  1,  309, 0x0000},
+	{0x63,  1,  310, 0x0000},
+	{0x6C,  1,  311, 0x0000},
+	{0x78,  1,  312, 0x0000},
+	{0x72,  1,  313, 0x0000},
+	{0x61,  1,  314, 0x0000},
+	{0x44,  1,  315, 0x0000},
+	{0x74,  1,  316, 0x0000},
+	{0x74,  1,  317, 0x0000},
+	{0x61,  1,  318, 0x00DC},
+	{0x78,  0,    0, 0x00D5},
+	{0x72,  1,  319, 0x0000},
+	{0x65,  1,  320, 0x0000},
+	{0x20,  0,    0, 0xF700},
+	{0x45,  1,  321, 0x0000},
+	{0x50,  1,  322, 0x0000},
+	{0x74,  2,  323, 0x0000},
+	{0x76,  1,  325, 0x0000},
+	{0x7A,  1,  326, 0x0000},
+	{0x4D,  1,  327, 0x0000},
+	{0x6C,  1,  328, 0x0000},
+	{0x6E,  1,  329, 0x0000},
+	{0x73,  1,  330, 0x0000},
+	{0x63,  1,  331, 0x0000},
+	{0x57,  1,  332, 0x0000},
+	{0x44,  2,  333, 0x0000},
+	{0x74,  2,  335, 0x0000},
+	{0x78,  1,  337, 0x0000},
+	{0x61,  1,  338, 0x0000},
+	{0x64,  1,  339, 0x009E},
+	{0x6E,  1,  340, 0x0000},
+	{0x67,  1,  341, 0x0000},
+	{0x78,  1,  342, 0x0000},
+	{0x72,  1,  343, 0x0000},
+	{0x74,  1,  344, 0x0000},
+	{0x74,  0,    0, 0x00D7},
+	{0x65,  1,  345, 0x0000},
+	{0x72,  1,  346, 0x0000},
+	{0x6F,  1,  347, 0x0000},
+	{0x6C,  1,  348, 0x0000},
+	{0x6F,  2,  349, 0x0000},
+	{0x6C,  3,  351, 0x0000},
+	{0x64,  0,    0, 0x00DB},
+	{0x6E,  5,  354, 0x0000},
+	{0x6C,  2,  359, 0x0000},
+	{0x50,  1,  361, 0x0000},
+	{0x63,  2,  362, 0x0000},
+	{0x66,  1,  364, 0x0000},
+	{0x74,  1,  365, 0x0000},
+	{0x67,  1,  366, 0x0000},
+	{0x64,  1,  367, 0x00D3},
+	{0x77,  1,  368, 0x0000},
+	{0x69,  1,  369, 0x0000},
+	{0x6E,  1,  370, 0x0000},
+	{0x71,  1,  371, 0x0000},
+	{0x6C,  1,  372, 0x0000},
+	{0x6F,  3,  373, 0x0000},
+	{0x72,  9,  376, 0x0000},
+	{0x6D,  1,  385, 0x0000},
+	{0x61,  1,  386, 0x0000},
+	{0x6E,  1,  387, 0x0000},
+	{0x78,  1,  388, 0x0000},
+	{0x65,  1,  389, 0x0000},
+	{0x6E,  1,  390, 0x0000},
+	{0xB8,  2,  391, 0x0000},
+	{0x72,  1,  393, 0x0000},
+	{0x65,  1,  394, 0x0000},
+	{0x69,  1,  395, 0x0000},
+	{0x63,  1,  396, 0x0000},
+	{0x61,  1,  397, 0x0000},
+	{0x69,  1,  398, 0x0000},
+	{0x63,  1,  399, 0x0000},
+	{0x63,  1,  400, 0x0000},
+	{0x61,  1,  401, 0x0000},
+	{0x69,  1,  402, 0x0000},
+	{0x63,  1,  403, 0x0000},
+	{0x73,  3,  404, 0x0000},
+	{0x64,  1,  407, 0x0000},
+	{0xB2,  1,  408, 0x0000},
+	{0x20,  0,    0, 0x0085},
+	{0x67,  1,  409, 0x0000},
+	{0x6E,  3,  410, 0x0000},
+	{0x6E,  3,  413, 0x0000},
+	{0xE2,  1,  416, 0x0000},
+	{0xE2,  1,  417, 0x0000},
+	{0x4C,  1,  418, 0x0000},
+	{0x28,  0,    0, 0x7F29},
+	{0x78,  1,  419, 0x009F},
+	{0xBB,  1,  420, 0x0000},
+	{0xAB,  1,  421, 0x0000},
+	{0x64,  1,  422, 0x0000},
+	{0x74,  1,  423, 0x0000},
+	{0x20,  0,    0, 0x7FB1},
+	{0x64,  1,  424, 0x0000},
+	{0x65,  1,  425, 0x0000},
+	{0x20,  0,    0, 0xF705},
+	{0x72,  1,  426, 0x0000},
+	{0x64,  1,  427, 0x0000},
+	{0x20,  0,    0, 0x00AA},
+	{0x6F,  1,  428, 0x0000},
+	{0x72,  1,  429, 0x0000},
+	{0x77,  2,  430, 0x0000},
+	{0x20,  0,    0, 0x0097},
+	{0x20,  0,    0, 0x7F22},
+	{0x6D,  1,  432, 0x0000},
+	{0x61,  1,  433, 0x0000},
+	{0x63,  1,  434, 0x0000},
+	{0x73,  1,  435, 0x0000},
+	{0x47,  1,  436, 0x0000},
+	{0x4C,  1,  437, 0x0000},
+	{0x4D,  1,  438, 0x0000},
+	{0x54,  1,  439, 0x0000},
+	{0x6A,  1,  440, 0x0000},
+	{0x6C,  1,  441, 0x0000},
+	{0x6E,  1,  442, 0x0000},
+	{0x74,  1,  443, 0x0000},
+	{0x69,  1,  444, 0x0000},
+	{0x20,  0,    0, 0x7F21},
+	{0x20,  0,    0, 0x7F46},
+	{0x77,  1,  445, 0x0000},
+	{0x20,  0,    0, 0x00E8},
+	{0x65,  1,  446, 0x0000},
+	{0x28,  0,    0, 0xF938},
+	{0xE2,  1,  447, 0x0000},
+	{0x69,  1,  448, 0x0000},
+	{0x78,  1,  449, 0x0000},
+	{0x6E,  1,  450, 0x0000},
+	{0x74,  1,  451, 0x0000},
+	{0x6C,  1,  452, 0x0000},
+	{0x20,  0,    0, 0x00E3},
+	{0x20,  0,    0, 0xF704},
+	{0x63,  1,  453, 0x0000},
+	{0x28,  0,    0, 0x7F3C},
+	{0x6B,  1,  454, 0x0000},
+	{0x6F,  1,  455, 0x0000},
+	{0x70,  1,  456, 0x0000},
+	{0x69,  1,  457, 0x0000},
+	{0x6E,  1,  458, 0x0000},
+	{0x6E,  1,  459, 0x0000},
+	{0x20,  0,    0, 0x7F25},
+	{0x20,  0,    0, 0x00A6},
+	{0x67,  1,  460, 0x0000},
+	{0x65,  1,  461, 0x0000},
+	{0x20,  0,    0, 0x00E9},
+	{0x28,  0,    0, 0x7F3D},
+	{0x20,  0,    0, 0x00E2},
+	{0x65,  0,    0, 0x00E1},
+	{0x74,  2,  462, 0x0000},
+	{0x61,  1,  464, 0x0000},
+	{0x68,  1,  465, 0x0000},
+	{0x28,  0,    0, 0x7F3A},
+	{0x5F,  1,  466, 0x0000},
+	{0x20,  0,    0, 0x7F40},
+	{0xE2,  1,  467, 0x0000},
+	{0x28,  0,    0, 0x7F20},
+	{0x6E,  1,  468, 0x0000},
+	{0x69,  1,  469, 0x0000},
+	{0x28,  0,    0, 0x7F2D},
+	{0x20,  0,    0, 0x00B7},
+	{0x74,  0,    0, 0xF707},
+	{0x6D,  1,  470, 0x00D9},
+	{0x20,  0,    0, 0x00A7},
+	{0x6E,  1,  471, 0x0000},
+	{0x63,  1,  472, 0x0000},
+	{0x74,  3,  473, 0x0000},
+	{0x28,  0,    0, 0x0080},
+	{0x64,  1,  476, 0x0000},
+	{0x67,  1,  477, 0x0000},
+	{0x43,  1,  478, 0x0000},
+	{0x4F,  2,  479, 0x0000},
+	{0x54,  1,  481, 0x0000},
+	{0x23,  1,  482, 0x0000},
+	{0x42,  1,  483, 0x0000},
+	{0x49,  1,  484, 0x0000},
+	{0x4C,  1,  485, 0x0000},
+	{0x4E,  1,  486, 0x0000},
+	{0x50,  1,  487, 0x0000},
+	{0x56,  1,  488, 0x0000},
+	{0x20,  0,    0, 0x7F24},
+	{0x28,  0,    0, 0x00A0},
+	{0x65,  1,  489, 0x0000},
+	{0x20,  0,    0, 0x0090},
+	{0x75,  1,  490, 0x0000},
+	{0x68,  1,  491, 0x0000},
+	{0x46,  1,  492, 0x0000},
+	{0x2B,  1,  493, 0x0000},
+	{0x20,  0,    0, 0x00E4},
+	{0x64,  2,  494, 0x0000},
+	{0x28,  0,    0, 0x7F2C},
+	{0x76,  1,  496, 0x0000},
+	{0x50,  1,  497, 0x0000},
+	{0x56,  1,  498, 0x0000},
+	{0x70,  0,    0, 0xF70E},
+	{0x20,  0,    0, 0xF93F},
+	{0x43,  1,  499, 0x0000},
+	{0x49,  1,  500, 0x0000},
+	{0x4A,  1,  501, 0x0000},
+	{0x4C,  2,  502, 0x0000},
+	{0x4D,  1,  504, 0x0000},
+	{0x52,  2,  505, 0x0000},
+	{0x53,  2,  507, 0x0000},
+	{0x55,  1,  509, 0x0000},
+	{0x20,  0,    0, 0x7F4C},
+	{0x70,  1,  510, 0x0000},
+	{0x67,  1,  511, 0x0000},
+	{0x74,  1,  512, 0x0000},
+	{0x6E,  1,  513, 0x0000},
+	{0x20,  0,    0, 0x7F41},
+	{0x6D,  2,  514, 0x0000},
+	{0x70,  1,  516, 0x0000},
+	{0x74,  1,  517, 0x0000},
+	{0x77,  1,  518, 0x0000},
+	{0x6C,  1,  519, 0x0000},
+	{0x74,  0,    0, 0x7F0B},
+	{0x78,  0,    0, 0x7F01},
+	{0x6E,  0,    0, 0x7F00},
+	{0x6C,  0,    0, 0x7F02},
+	{0x74,  0,    0, 0x7F0C},
+	{0x78,  0,    0, 0x7F05},
+	{0x6E,  0,    0, 0x7F04},
+	{0x6C,  0,    0, 0x7F06},
+	{0x20,  0,    0, 0x0082},
+	{0x68,  2,  520, 0x0000},
+	{0xE2,  1,  522, 0x0000},
+	{0x78,  1,  523, 0x0000},
+	{0x2F,  1,  524, 0x0000},
+	{0x20,  0,    0, 0x0095},
+	{0x20,  0,    0, 0x0081},
+	{0x68,  2,  525, 0x0000},
+	{0xE2,  1,  527, 0x0000},
+	{0x20,  0,    0, 0x0083},
+	{0x68,  2,  528, 0x0000},
+	{0xE2,  1,  530, 0x0000},
+	{0x88,  1,  531, 0x0000},
+	{0x88,  1,  532, 0x0000},
+	{0x69,  1,  533, 0x0000},
+	{0xC2,  1,  534, 0x0000},
+	{0xC2,  1,  535, 0x0000},
+	{0x28,  0,    0, 0x008D},
+	{0x20,  0,    0, 0x00B0},
+	{0xC3,  1,  536, 0x0000},
+	{0x72,  1,  537, 0x0000},
+	{0x70,  1,  538, 0x0000},
+	{0x20,  0,    0, 0x7FB4},
+	{0x20,  0,    0, 0x00BA},
+	{0x72,  1,  539, 0x0000},
+	{0x20,  0,    0, 0x009A},
+	{0x20,  0,    0, 0x7F42},
+	{0x2B,  1,  540, 0x0000},
+	{0x65,  1,  541, 0x0000},
+	{0x6B,  0,    0, 0xF70D},
+	{0x6C,  1,  542, 0x0000},
+	{0x65,  1,  543, 0x0000},
+	{0x72,  1,  544, 0x0000},
+	{0x69,  1,  545, 0x0000},
+	{0x61,  1,  546, 0x0000},
+	{0x65,  1,  547, 0x0000},
+	{0x67,  1,  548, 0x0000},
+	{0x20,  0,    0, 0x7F4F},
+	{0x64,  0,    0, 0x7F0E},
+	{0x61,  1,  549, 0x0000},
+	{0x74,  1,  550, 0x0000},
+	{0x47,  1,  551, 0x0000},
+	{0x20,  0,    0, 0xF702},
+	{0x86,  1,  552, 0x0000},
+	{0x6E,  1,  553, 0x0000},
+	{0x28,  0,    0, 0x7F2B},
+	{0x28,  0,    0, 0x7F2A},
+	{0x6F,  1,  554, 0x0000},
+	{0x28,  0,    0, 0x7F47},
+	{0x20,  0,    0, 0x00B6},
+	{0x65,  1,  555, 0x0000},
+	{0x20,  0,    0, 0x00EC},
+	{0x68,  2,  556, 0x0000},
+	{0x7A,  1,  558, 0x0000},
+	{0x74,  1,  559, 0x0000},
+	{0x64,  0,    0, 0xF703},
+	{0x20,  0,    0, 0x00DE},
+	{0x72,  1,  560, 0x0000},
+	{0x20,  0,    0, 0x7F51},
+	{0xE2,  1,  561, 0x0000},
+	{0x74,  1,  562, 0x0000},
+	{0x69,  1,  563, 0x0000},
+	{0x45,  1,  564, 0x0000},
+	{0x86,  1,  565, 0x0000},
+	{0x28,  0,    0, 0x7F2E},
+	{0x61,  1,  566, 0x0000},
+	{0x61,  1,  567, 0x0000},
+	{0x43,  1,  568, 0x0000},
+	{0x65,  1,  569, 0x0000},
+	{0x20,  0,    0, 0x00E0},
+	{0x43,  1,  570, 0x0000},
+	{0x4F,  2,  571, 0x0000},
+	{0x20,  0,    0, 0x7F4D},
+	{0x20,  0,    0, 0x00ED},
+	{0x68,  1,  573, 0x0000},
+	{0x66,  1,  574, 0x0000},
+	{0x6E,  1,  575, 0x0000},
+	{0x65,  1,  576, 0x0000},
+	{0x20,  0,    0, 0x00C1},
+	{0x69,  1,  577, 0x0000},
+	{0x6E,  1,  578, 0x0000},
+	{0x69,  1,  579, 0x0000},
+	{0x6F,  1,  580, 0x0000},
+	{0x69,  1,  581, 0x0000},
+	{0x2D,  1,  582, 0x0000},
+	{0x69,  1,  583, 0x0000},
+	{0x72,  1,  584, 0x0000},
+	{0x74,  3,  585, 0x0000},
+	{0x69,  1,  588, 0x0000},
+	{0x20,  0,    0, 0x7F44},
+	{0x28,  0,    0, 0xF711},
+	{0x33,  1,  589, 0x0000},
+	{0x65,  1,  590, 0x0000},
+	{0x69,  1,  591, 0x0000},
+	{0x2D,  1,  592, 0x0000},
+	{0x6D,  1,  593, 0x0000},
+	{0x6E,  1,  594, 0x0000},
+	{0x6F,  1,  595, 0x0000},
+	{0x65,  2,  596, 0x0000},
+	{0x77,  1,  598, 0x0000},
+	{0x69,  1,  599, 0x0000},
+	{0x69,  1,  600, 0x0000},
+	{0x6F,  1,  601, 0x0000},
+	{0x68,  1,  602, 0x0000},
+	{0x72,  1,  603, 0x0000},
+	{0x70,  1,  604, 0x0000},
+	{0x20,  0,    0, 0x7F45},
+	{0x65,  1,  605, 0x0000},
+	{0x20,  0,    0, 0xF7A5},
+	{0x20,  0,    0, 0xF701},
+	{0x61,  1,  606, 0x0000},
+	{0x69,  1,  607, 0x0000},
+	{0x74,  1,  608, 0x0000},
+	{0x69,  1,  609, 0x0000},
+	{0x57,  1,  610, 0x0000},
+	{0x65,  2,  611, 0x0000},
+	{0x20,  0,    0, 0x00A2},
+	{0xE2,  1,  613, 0x0000},
+	{0x81,  1,  614, 0x0000},
+	{0x28,  0,    0, 0x7F26},
+	{0x64,  1,  615, 0x0000},
+	{0x20,  0,    0, 0x00A1},
+	{0xE2,  1,  616, 0x0000},
+	{0x81,  1,  617, 0x0000},
+	{0x20,  0,    0, 0x00A3},
+	{0xE2,  1,  618, 0x0000},
+	{0x81,  1,  619, 0x0000},
+	{0x9A,  0,    0, 0x0096},
+	{0x9A,  0,    0, 0x00B8},
+	{0x73,  1,  620, 0x0000},
+	{0xB2,  0,    0, 0x008F},
+	{0xB9,  0,    0, 0x009B},
+	{0xB7,  1,  621, 0x0000},
+	{0x20,  0,    0, 0x7FBD},
+	{0x20,  0,    0, 0xF706},
+	{0x20,  0,    0, 0x008A},
+	{0x20,  0,    0, 0x7F43},
+	{0x6E,  1,  622, 0x0000},
+	{0x65,  1,  623, 0x0000},
+	{0x43,  1,  624, 0x0000},
+	{0x61,  1,  625, 0x0000},
+	{0x73,  1,  626, 0x0000},
+	{0x74,  1,  627, 0x0000},
+	{0x78,  1,  628, 0x0000},
+	{0x20,  0,    0, 0x7F23},
+	{0x72,  1,  629, 0x0000},
+	{0x63,  1,  630, 0x0000},
+	{0x72,  1,  631, 0x0000},
+	{0x92,  1,  632, 0x0000},
+	{0x65,  1,  633, 0x0000},
+	{0x72,  1,  634, 0x0000},
+	{0x79,  0,    0, 0x7F8F},
+	{0x20,  3,  635, 0x0000},
+	{0x28,  1,  638, 0x0000},
+	{0x6F,  1,  639, 0x0000},
+	{0x69,  1,  640, 0x0000},
+	{0x73,  1,  641, 0x0000},
+	{0x86,  1,  642, 0x0000},
+	{0x65,  1,  643, 0x0000},
+	{0x6C,  1,  644, 0x0000},
+	{0x78,  1,  645, 0x0000},
+	{0x92,  1,  646, 0x0000},
+	{0x6E,  1,  647, 0x0000},
+	{0x6C,  1,  648, 0x0000},
+	{0x6F,  1,  649, 0x0000},
+	{0x6E,  1,  650, 0x0000},
+	{0x68,  1,  651, 0x0000},
+	{0x66,  1,  652, 0x0000},
+	{0x6E,  1,  653, 0x0000},
+	{0x67,  1,  654, 0x0000},
+	{0x66,  1,  655, 0x0000},
+	{0x20,  0,    0, 0xF7AB},
+	{0x73,  1,  656, 0x0000},
+	{0x6E,  1,  657, 0x0000},
+	{0x74,  1,  658, 0x0000},
+	{0x73,  1,  659, 0x0000},
+	{0x72,  1,  660, 0x0000},
+	{0x63,  1,  661, 0x0000},
+	{0x57,  1,  662, 0x0000},
+	{0x76,  1,  663, 0x0000},
+	{0x6E,  0,    0, 0xF70C},
+	{0x54,  1,  664, 0x0000},
+	{0x58,  2,  665, 0x0000},
+	{0x59,  2,  667, 0x0000},
+	{0x78,  1,  669, 0x0000},
+	{0x38,  1,  670, 0x0000},
+	{0x28,  0,    0, 0x7F28},
+	{0x63,  1,  671, 0x0000},
+	{0x57,  1,  672, 0x0000},
+	{0x70,  1,  673, 0x0000},
+	{0x76,  1,  674, 0x0000},
+	{0x69,  1,  675, 0x0000},
+	{0x66,  1,  676, 0x0000},
+	{0x6E,  1,  677, 0x0000},
+	{0x72,  1,  678, 0x0000},
+	{0x64,  1,  679, 0x0000},
+	{0x67,  1,  680, 0x0000},
+	{0x74,  1,  681, 0x0000},
+	{0x69,  1,  682, 0x0000},
+	{0x63,  1,  683, 0x0000},
+	{0x72,  1,  684, 0x0000},
+	{0x6E,  1,  685, 0x0000},
+	{0x78,  0,    0, 0x7F09},
+	{0x6E,  0,    0, 0x7F08},
+	{0x63,  1,  686, 0x0000},
+	{0x63,  1,  687, 0x0000},
+	{0x69,  1,  688, 0x0000},
+	{0x20,  0,    0, 0xF708},
+	{0x45,  1,  689, 0x0000},
+	{0x81,  1,  690, 0x0000},
+	{0xBB,  1,  691, 0x0000},
+	{0x78,  1,  692, 0x0000},
+	{0x81,  1,  693, 0x0000},
+	{0xBB,  1,  694, 0x0000},
+	{0x81,  1,  695, 0x0000},
+	{0xBB,  1,  696, 0x0000},
+	{0x74,  1,  697, 0x0000},
+	{0x20,  0,    0, 0x7FBC},
+	{0x74,  1,  698, 0x0000},
+	{0x20,  0,    0, 0xF7A6},
+	{0x6F,  1,  699, 0x0000},
+	{0x70,  1,  700, 0x0000},
+	{0x74,  0,    0, 0xF71A},
+	{0x20,  0,    0, 0xF91E},
+	{0x74,  0,    0, 0xF718},
+	{0x74,  0,    0, 0x7F0D},
+	{0x68,  0,    0, 0x7F0F},
+	{0x61,  1,  701, 0x0000},
+	{0x53,  1,  702, 0x0000},
+	{0x20,  0,    0, 0xF7A7},
+	{0x20,  0,    0, 0x00EA},
+	{0x59,  4,  703, 0x0000},
+	{0x72,  1,  707, 0x0000},
+	{0xE2,  1,  708, 0x0000},
+	{0x58,  1,  709, 0x0000},
+	{0x6E,  1,  710, 0x0000},
+	{0x74,  1,  711, 0x0000},
+	{0x65,  1,  712, 0x0000},
+	{0x92,  1,  713, 0x0000},
+	{0x20,  0,    0, 0xF710},
+	{0x65,  1,  714, 0x0000},
+	{0x70,  1,  715, 0x0000},
+	{0x4C,  1,  716, 0x0000},
+	{0x28,  0,    0, 0x7F2F},
+	{0x20,  0,    0, 0xF7A1},
+	{0x6D,  1,  717, 0x0000},
+	{0x74,  1,  718, 0x0000},
+	{0x67,  1,  719, 0x0000},
+	{0x66,  1,  720, 0x0000},
+	{0x20,  0,    0, 0xF7A8},
+	{0x20,  0,    0, 0xF7AD},
+	{0x20,  0,    0, 0xF7AC},
+	{0x74,  1,  721, 0x0000},
+	{0x23,  1,  722, 0x0000},
+	{0x23,  1,  723, 0x0000},
+	{0x74,  1,  724, 0x0000},
+	{0x6D,  1,  725, 0x0000},
+	{0x74,  1,  726, 0x0000},
+	{0x69,  1,  727, 0x0000},
+	{0x65,  2,  728, 0x0000},
+	{0xCE,  1,  730, 0x0000},
+	{0x6D,  2,  731, 0x0000},
+	{0x73,  1,  733, 0x0000},
+	{0x6D,  2,  734, 0x0000},
+	{0x73,  1,  736, 0x0000},
+	{0x28,  0,    0, 0x7F86},
+	{0x6B,  1,  737, 0x0000},
+	{0x74,  1,  738, 0x0000},
+	{0x69,  1,  739, 0x0000},
+	{0x28,  0,    0, 0xF932},
+	{0x28,  0,    0, 0xF93B},
+	{0x6E,  1,  740, 0x0000},
+	{0x74,  1,  741, 0x0000},
+	{0x28,  0,    0, 0xF931},
+	{0x28,  0,    0, 0xF93A},
+	{0x28,  0,    0, 0xF936},
+	{0x68,  1,  742, 0x0000},
+	{0x61,  1,  743, 0x0000},
+	{0x66,  1,  744, 0x0000},
+	{0x28,  0,    0, 0xF933},
+	{0x28,  0,    0, 0xF939},
+	{0x74,  1,  745, 0x0000},
+	{0x68,  0,    0, 0x7F0A},
+	{0x61,  1,  746, 0x0000},
+	{0x6E,  1,  747, 0x0000},
+	{0x6E,  1,  748, 0x0000},
+	{0xBB,  1,  749, 0x0000},
+	{0xC2,  1,  750, 0x0000},
+	{0xC2,  1,  751, 0x0000},
+	{0xBB,  1,  752, 0x0000},
+	{0xC2,  1,  753, 0x0000},
+	{0xBB,  1,  754, 0x0000},
+	{0xC2,  1,  755, 0x0000},
+	{0x20,  0,    0, 0x7F52},
+	{0x28,  0,    0, 0x7F49},
+	{0x6D,  1,  756, 0x0000},
+	{0x68,  0,    0, 0xF719},
+	{0x70,  1,  757, 0x0000},
+	{0x74,  1,  758, 0x0000},
+	{0x3C,  0,    0, 0x00F1},
+	{0x3D,  0,    0, 0x00EE},
+	{0x3E,  0,    0, 0x00F0},
+	{0xE2,  1,  759, 0x0000},
+	{0x3D,  0,    0, 0x00F4},
+	{0x88,  1,  760, 0x0000},
+	{0x2C,  1,  761, 0x0000},
+	{0x74,  1,  762, 0x0000},
+	{0x79,  1,  763, 0x0000},
+	{0x20,  0,    0, 0xF7A2},
+	{0x4D,  1,  764, 0x0000},
+	{0x20,  0,    0, 0xF70B},
+	{0x28,  0,    0, 0x7F3B},
+	{0x69,  1,  765, 0x0000},
+	{0x70,  1,  766, 0x0000},
+	{0x20,  0,    0, 0x7F4E},
+	{0x20,  0,    0, 0xF7AA},
+	{0x20,  0,    0, 0xF7A9},
+	{0x28,  0,    0, 0xF7AF},
+	{0x28,  0,    0, 0x7F89},
+	{0x28,  0,    0, 0x7F87},
+	{0x23,  1,  767, 0x0000},
+	{0x23,  1,  768, 0x0000},
+	{0x20,  0,    0, 0xF794},
+	{0x6E,  1,  769, 0x0000},
+	{0x28,  0,    0, 0xF712},
+	{0x33,  1,  770, 0x0000},
+	{0xB8,  2,  771, 0x0000},
+	{0x61,  1,  773, 0x0000},
+	{0x69,  1,  774, 0x0000},
+	{0x63,  1,  775, 0x0000},
+	{0x61,  1,  776, 0x0000},
+	{0x69,  1,  777, 0x0000},
+	{0x63,  1,  778, 0x0000},
+	{0x20,  0,    0, 0xF715},
+	{0x20,  0,    0, 0xF793},
+	{0x6E,  1,  779, 0x0000},
+	{0x28,  0,    0, 0xF930},
+	{0x28,  0,    0, 0xF934},
+	{0x74,  1,  780, 0x0000},
+	{0x74,  1,  781, 0x0000},
+	{0x74,  1,  782, 0x0000},
+	{0x20,  0,    0, 0xF7A0},
+	{0x6C,  1,  783, 0x0000},
+	{0x64,  1,  784, 0x0000},
+	{0x64,  0,    0, 0xF709},
+	{0xC2,  1,  785, 0x0000},
+	{0xB9,  1,  786, 0x0000},
+	{0xB2,  1,  787, 0x0000},
+	{0xC2,  1,  788, 0x0000},
+	{0xB9,  1,  789, 0x0000},
+	{0xC2,  1,  790, 0x0000},
+	{0xB9,  1,  791, 0x0000},
+	{0x70,  1,  792, 0x0000},
+	{0x68,  0,    0, 0xF720},
+	{0x72,  1,  793, 0x0000},
+	{0x89,  2,  794, 0x0000},
+	{0xAB,  0,    0, 0x00EF},
+	{0x59,  1,  796, 0x0000},
+	{0x61,  1,  797, 0x0000},
+	{0x20,  0,    0, 0x7F48},
+	{0x61,  1,  798, 0x0000},
+	{0x73,  1,  799, 0x0000},
+	{0x6F,  1,  800, 0x0000},
+	{0x28,  0,    0, 0x7F88},
+	{0x28,  0,    0, 0x7F8A},
+	{0x20,  0,    0, 0xF798},
+	{0x38,  1,  801, 0x0000},
+	{0x6D,  2,  802, 0x0000},
+	{0x70,  1,  804, 0x0000},
+	{0x78,  0,    0, 0x7F11},
+	{0x6E,  0,    0, 0x7F10},
+	{0x6C,  0,    0, 0x7F12},
+	{0x78,  0,    0, 0x7F15},
+	{0x6E,  0,    0, 0x7F14},
+	{0x6C,  0,    0, 0x7F16},
+	{0x20,  0,    0, 0xF797},
+	{0x28,  0,    0, 0xF935},
+	{0x65,  1,  805, 0x0000},
+	{0x28,  0,    0, 0xF93C},
+	{0x20,  0,    0, 0xF7A3},
+	{0x6F,  1,  806, 0x0000},
+	{0xB9,  1,  807, 0x0000},
+	{0x20,  0,    0, 0x0092},
+	{0x28,  0,    0, 0x7F27},
+	{0xB9,  1,  808, 0x0000},
+	{0x20,  0,    0, 0x0091},
+	{0xB9,  1,  809, 0x0000},
+	{0x20,  0,    0, 0x0093},
+	{0x6F,  1,  810, 0x0000},
+	{0x28,  0,    0, 0xF937},
+	{0xA4,  0,    0, 0x00F3},
+	{0xA5,  0,    0, 0x00F2},
+	{0x29,  1,  811, 0x0000},
+	{0x6C,  1,  812, 0x0000},
+	{0x74,  1,  813, 0x0000},
+	{0x74,  1,  814, 0x0000},
+	{0x72,  1,  815, 0x0000},
+	{0x6B,  1,  816, 0x0000},
+	{0x61,  1,  817, 0x0000},
+	{0x69,  1,  818, 0x0000},
+	{0x74,  1,  819, 0x0000},
+	{0x28,  0,    0, 0xF93D},
+	{0x77,  1,  820, 0x0000},
+	{0x20,  0,    0, 0x00B2},
+	{0x20,  0,    0, 0x00B1},
+	{0x20,  0,    0, 0x00B3},
+	{0x72,  1,  821, 0x0000},
+	{0x3D,  1,  822, 0x0000},
+	{0x20,  0,    0, 0xF7A4},
+	{0x28,  0,    0, 0x7F4A},
+	{0x28,  0,    0, 0x7F4B},
+	{0x74,  1,  823, 0x0000},
+	{0x20,  0,    0, 0xF716},
+	{0x78,  0,    0, 0x7F19},
+	{0x6E,  0,    0, 0x7F18},
+	{0x63,  1,  824, 0x0000},
+	{0x20,  0,    0, 0x00EB},
+	{0x74,  1,  825, 0x0000},
+	{0x28,  0,    0, 0x00F5},
+	{0x33,  1,  826, 0x0000},
+	{0x68,  0,    0, 0x7F1A},
+	{0x33,  1,  827, 0x0000},
+	{0x38,  1,  828, 0x0000},
+	{0x38,  1,  829, 0x0000},
+	{0x6B,  0,    0, 0xF713},
+	{0x6B,  0,    0, 0xF714},
+};
+
+/* Children of the root, by first byte. */
+
+const casio_uint16_t CASIO_EXPORT casio_fontchar_trie_root[256] = {
+	[0x20] = 1,
+	[0x2A] = 2,
+	[0x41] = 3,
+	[0x42] = 4,
+	[0x43] = 5,
+	[0x44] = 6,
+	[0x45] = 7,
+	[0x46] = 8,
+	[0x47] = 9,
+	[0x48] = 10,
+	[0x49] = 11,
+	[0x4C] = 12,
+	[0x4D] = 13,
+	[0x4E] = 14,
+	[0x4F] = 15,
+	[0x50] = 16,
+	[0x51] = 17,
+	[0x52] = 18,
+	[0x53] = 19,
+	[0x54] = 20,
+	[0x56] = 21,
+	[0x57] = 22,
+	[0x58] = 23,
+	[0x59] = 24,
+	[0x63] = 25,
+	[0x64] = 26,
+	[0x65] = 27,
+	[0x6C] = 28,
+	[0x73] = 29,
+	[0x74] = 30,
+	[0xC2] = 31,
+	[0xCB] = 32,
+	[0xCE] = 33,
+	[0xE2] = 34,
+};
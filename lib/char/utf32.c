@@ -0,0 +1,225 @@
+/* ****************************************************************************
+ * char/utf32.c -- convert between FONTCHARACTER and UTF-32.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#include "char.h"
+
+/**
+ *	casio_fontchar8_to_utf32:
+ *	Convert a FONTCHAR-8 encoded buffer to an UTF-32 encoded buffer.
+ *
+ *	@arg	inbuf		the input buffer reference.
+ *	@arg	inleft		the input buffer size reference.
+ *	@arg	outbuf		the output buffer reference.
+ *	@arg	outleft		the output buffer size reference.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_fontchar8_to_utf32(casio_uint8_t **inbuf,
+	size_t *inleft, casio_uint32_t **outbuf, size_t *outleft)
+{
+	const fontchar_entry_t *e;
+	casio_uint8_t *i = *inbuf;
+	casio_uint32_t *o = *outbuf;
+	size_t il = *inleft, ol = *outleft, run, len;
+	int err = 0;
+
+	while (il) {
+		/* Printable ASCII characters are the same in both encodings. */
+
+		run = casio_fontchar_ascii(i, min(il, ol));
+		for (il -= run, ol -= run; run; run--)
+			*o++ = *i++;
+		if (!il)
+			break;
+
+		/* Look for the character in the tables. */
+
+		len = 1;
+		e = &casio_fontchar_table[0][*i];
+		if (casio_fontchar_leads[*i]) {
+			if (il < 2) {
+				err = casio_error_eof;
+				break;
+			}
+
+			len = 2;
+			e = &casio_fontchar_table[casio_fontchar_leads[*i]][i[1]];
+		}
+
+		if (!e->fontchar_entry_len32) {
+			err = casio_error_seq;
+			break;
+		}
+		if (ol < e->fontchar_entry_len32) {
+			err = casio_error_write;
+			break;
+		}
+
+		memcpy(o, &casio_fontchar_pool32[e->fontchar_entry_off32],
+			e->fontchar_entry_len32 * sizeof(casio_uint32_t));
+		o += e->fontchar_entry_len32;
+		ol -= e->fontchar_entry_len32;
+		i += len;
+		il -= len;
+	}
+
+	*inbuf = i; *inleft = il;
+	*outbuf = o; *outleft = ol;
+	return (err);
+}
+
+/**
+ *	casio_fontchar16_to_utf32:
+ *	Convert a FONTCHAR-16 encoded buffer to an UTF-32 encoded buffer.
+ *
+ *	@arg	inbuf		the input buffer reference.
+ *	@arg	inleft		the input buffer size reference.
+ *	@arg	outbuf		the output buffer reference.
+ *	@arg	outleft		the output buffer size reference.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_fontchar16_to_utf32(FONTCHARACTER **inbuf,
+	size_t *inleft, casio_uint32_t **outbuf, size_t *outleft)
+{
+	const fontchar_entry_t *e;
+	FONTCHARACTER *i = *inbuf;
+	casio_uint32_t *o = *outbuf;
+	size_t il = *inleft, ol = *outleft;
+	int err = 0;
+
+	for (; il; i++, il--) {
+		if (fontchar_isascii(*i) && ol) {
+			*o++ = *i;
+			ol--;
+			continue;
+		}
+
+		if (*i > 0xFF && !casio_fontchar_leads[*i >> 8]) {
+			err = casio_error_seq;
+			break;
+		}
+		e = fontchar_entry(*i);
+		if (!e->fontchar_entry_len32) {
+			err = casio_error_seq;
+			break;
+		}
+		if (ol < e->fontchar_entry_len32) {
+			err = casio_error_write;
+			break;
+		}
+
+		memcpy(o, &casio_fontchar_pool32[e->fontchar_entry_off32],
+			e->fontchar_entry_len32 * sizeof(casio_uint32_t));
+		o += e->fontchar_entry_len32;
+		ol -= e->fontchar_entry_len32;
+	}
+
+	*inbuf = i; *inleft = il;
+	*outbuf = o; *outleft = ol;
+	return (err);
+}
+
+/**
+ *	casio_utf32_to_fontchar8:
+ *	Convert an UTF-32 encoded buffer to a FONTCHAR-8 encoded buffer.
+ *
+ *	@arg	inbuf		the input buffer reference.
+ *	@arg	inleft		the input buffer size reference.
+ *	@arg	outbuf		the output buffer reference.
+ *	@arg	outleft		the output buffer size reference.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_utf32_to_fontchar8(casio_uint32_t **inbuf,
+	size_t *inleft, casio_uint8_t **outbuf, size_t *outleft)
+{
+	casio_uint32_t *i = *inbuf;
+	casio_uint8_t *o = *outbuf;
+	size_t il = *inleft, ol = *outleft;
+	int err = 0, code;
+
+	for (; il; i++, il--) {
+		if (fontchar_isascii(*i) && ol) {
+			*o++ = (casio_uint8_t)*i;
+			ol--;
+			continue;
+		}
+
+		if ((code = casio_find_fontchar(*i)) < 0) {
+			err = casio_error_seq;
+			break;
+		}
+		if (ol < (code > 0xFF ? 2U : 1U)) {
+			err = casio_error_write;
+			break;
+		}
+
+		if (code > 0xFF) {
+			*o++ = (casio_uint8_t)(code >> 8);
+			ol--;
+		}
+		*o++ = (casio_uint8_t)(code & 0xFF);
+		ol--;
+	}
+
+	*inbuf = i; *inleft = il;
+	*outbuf = o; *outleft = ol;
+	return (err);
+}
+
+/**
+ *	casio_utf32_to_fontchar16:
+ *	Convert an UTF-32 encoded buffer to a FONTCHAR-16 encoded buffer.
+ *
+ *	@arg	inbuf		the input buffer reference.
+ *	@arg	inleft		the input buffer size reference.
+ *	@arg	outbuf		the output buffer reference.
+ *	@arg	outleft		the output buffer size reference.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_utf32_to_fontchar16(casio_uint32_t **inbuf,
+	size_t *inleft, FONTCHARACTER **outbuf, size_t *outleft)
+{
+	casio_uint32_t *i = *inbuf;
+	FONTCHARACTER *o = *outbuf;
+	size_t il = *inleft, ol = *outleft;
+	int err = 0, code;
+
+	for (; il; i++, il--) {
+		if (!ol) {
+			err = casio_error_write;
+			break;
+		}
+
+		if (fontchar_isascii(*i))
+			code = (int)*i;
+		else if ((code = casio_find_fontchar(*i)) < 0) {
+			err = casio_error_seq;
+			break;
+		}
+
+		*o++ = (FONTCHARACTER)code;
+		ol--;
+	}
+
+	*inbuf = i; *inleft = il;
+	*outbuf = o; *outleft = ol;
+	return (err);
+}
@@ -0,0 +1,189 @@
+/* ****************************************************************************
+ * char/utf8.c -- convert between FONTCHARACTER and UTF-8.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#include "char.h"
+
+/**
+ *	casio_fontchar8_to_utf8:
+ *	Convert a FONTCHAR-8 encoded buffer to an UTF-8 encoded buffer.
+ *
+ *	@arg	inbuf		the input buffer reference.
+ *	@arg	inleft		the input buffer size reference.
+ *	@arg	outbuf		the output buffer reference.
+ *	@arg	outleft		the output buffer size reference.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_fontchar8_to_utf8(casio_uint8_t **inbuf,
+	size_t *inleft, casio_uint8_t **outbuf, size_t *outleft)
+{
+	const fontchar_entry_t *e;
+	casio_uint8_t *i = *inbuf, *o = *outbuf;
+	size_t il = *inleft, ol = *outleft, run, len;
+	int err = 0;
+
+	while (il) {
+		/* Printable ASCII characters are the same in both encodings. */
+
+		run = casio_fontchar_ascii(i, min(il, ol));
+		memcpy(o, i, run);
+		i += run; il -= run;
+		o += run; ol -= run;
+		if (!il)
+			break;
+
+		/* Look for the character in the tables. */
+
+		len = 1;
+		e = &casio_fontchar_table[0][*i];
+		if (casio_fontchar_leads[*i]) {
+			if (il < 2) {
+				err = casio_error_eof;
+				break;
+			}
+
+			len = 2;
+			e = &casio_fontchar_table[casio_fontchar_leads[*i]][i[1]];
+		}
+
+		if (!e->fontchar_entry_len8) {
+			err = casio_error_seq;
+			break;
+		}
+		if (ol < e->fontchar_entry_len8) {
+			err = casio_error_write;
+			break;
+		}
+
+		memcpy(o, &casio_fontchar_pool8[e->fontchar_entry_off8],
+			e->fontchar_entry_len8);
+		o += e->fontchar_entry_len8;
+		ol -= e->fontchar_entry_len8;
+		i += len;
+		il -= len;
+	}
+
+	*inbuf = i; *inleft = il;
+	*outbuf = o; *outleft = ol;
+	return (err);
+}
+
+/**
+ *	casio_decode_utf8:
+ *	Decode an UTF-8 encoded code point.
+ *
+ *	Overlong sequences, surrogates and code points over U+10FFFF are
+ *	invalid sequences.
+ *
+ *	@arg	buf			the buffer.
+ *	@arg	size		the buffer size.
+ *	@arg	uni			the code point to set.
+ *	@return				the sequence length if > 0, or if < 0 the error code
+ *						is -[returned value].
+ */
+
+int CASIO_EXPORT casio_decode_utf8(const casio_uint8_t *buf, size_t size,
+	casio_uint32_t *uni)
+{
+	casio_uint32_t c = buf[0], minimum;
+	size_t len, n;
+
+	if (c < 0x80) {
+		*uni = c;
+		return (1);
+	} else if ((c & 0xE0) == 0xC0) {
+		len = 2; c &= 0x1F; minimum = 0x80;
+	} else if ((c & 0xF0) == 0xE0) {
+		len = 3; c &= 0x0F; minimum = 0x800;
+	} else if ((c & 0xF8) == 0xF0) {
+		len = 4; c &= 0x07; minimum = 0x10000;
+	} else
+		return (-casio_error_seq);
+
+	for (n = 1; n < len; n++) {
+		if (n == size)
+			return (-casio_error_eof);
+		if ((buf[n] & 0xC0) != 0x80)
+			return (-casio_error_seq);
+		c = (c << 6) | (buf[n] & 0x3F);
+	}
+
+	if (c < minimum || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+		return (-casio_error_seq);
+	*uni = c;
+	return ((int)len);
+}
+
+/**
+ *	casio_utf8_to_fontchar8:
+ *	Convert an UTF-8 encoded buffer to a FONTCHAR-8 encoded buffer.
+ *
+ *	@arg	inbuf		the input buffer reference.
+ *	@arg	inleft		the input buffer size reference.
+ *	@arg	outbuf		the output buffer reference.
+ *	@arg	outleft		the output buffer size reference.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_utf8_to_fontchar8(casio_uint8_t **inbuf,
+	size_t *inleft, casio_uint8_t **outbuf, size_t *outleft)
+{
+	casio_uint8_t *i = *inbuf, *o = *outbuf;
+	size_t il = *inleft, ol = *outleft, run;
+	casio_uint32_t uni;
+	int err = 0, len, code;
+
+	while (il) {
+		/* Printable ASCII characters are the same in both encodings. */
+
+		run = casio_fontchar_ascii(i, min(il, ol));
+		memcpy(o, i, run);
+		i += run; il -= run;
+		o += run; ol -= run;
+		if (!il)
+			break;
+
+		/* Decode the code point and find the character. */
+
+		if ((len = casio_decode_utf8(i, il, &uni)) < 0) {
+			err = -len;
+			break;
+		}
+		if ((code = casio_find_fontchar(uni)) < 0) {
+			err = casio_error_seq;
+			break;
+		}
+		if (ol < (code > 0xFF ? 2U : 1U)) {
+			err = casio_error_write;
+			break;
+		}
+
+		if (code > 0xFF) {
+			*o++ = (casio_uint8_t)(code >> 8);
+			ol--;
+		}
+		*o++ = (casio_uint8_t)(code & 0xFF);
+		ol--;
+		i += len;
+		il -= len;
+	}
+
+	*inbuf = i; *inleft = il;
+	*outbuf = o; *outleft = ol;
+	return (err);
+}
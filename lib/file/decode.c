@@ -19,133 +19,293 @@
 #include "file.h"
 
 /* ---
- * Check using extensions.
+ * Format identification.
  * --- */
 
-/* Decode function. */
+/*	Formats are identified in one pass over a table, using the first bytes
+ *	of the stream. On seekable streams, these bytes are read at once (or
+ *	what is left of the stream if it is shorter), then the stream is moved
+ *	back to where the decoding function of the identified format expects
+ *	it to be; on other streams, only the bytes required by each format
+ *	are read, as we can't go back. */
 
-typedef int decode_func OF((casio_file_t**, casio_stream_t*));
+/* Number of bytes to read at once on seekable streams: the size of the
+ * biggest header we look at, the standard header. */
 
-/* Correspondance type. */
+#define SNIFF_SIZE 0x20
 
-struct corresp {
-	/* extension */
-	const char *ext;
+/* Identification context. */
 
-	/* expected types */
-	casio_filetype_t type;
+struct sniff {
+	/* path, for formats identified using the extension */
+	const char *path;
 
-	/* function */
-	decode_func *decode;
+	/* first bytes of the stream */
+	union {
+		unsigned char             bytes[SNIFF_SIZE];
+		casio_standard_header_t   std;
+		casio_casemul_intheader_t casemul;
+	} buf;
+
+	/* argument for the decoding function */
+	int arg;
 };
 
-/* Correspondances */
-CASIO_LOCAL struct corresp correspondances[] = {
-	{"g1s", casio_filetype_storage, casio_decode_storage},
+/* Identification and decoding functions. */
 
-	/* terminating entry */
-	{NULL,  0,                NULL}
+typedef int sniff_func OF((struct sniff*));
+typedef int decode_func OF((casio_file_t**, casio_stream_t*, struct sniff*,
+	casio_filetype_t, unsigned long));
+
+/* Format type. */
+
+struct format {
+	/* number of bytes required to identify the format, which are the
+	 * bytes the decoding function expects to have been read */
+	size_t size;
+
+	/* types the format can hold (0 if checked by the decoding function) */
+	casio_filetype_t types;
+
+	/* functions */
+	sniff_func  *sniff;
+	decode_func *decode;
 };
 
+/* ---
+ * Identification functions.
+ * --- */
+
 /**
- *	lookup_extension:
- *	Get the function using the type.
+ *	sniff_storage:
+ *	Identify a storage memory file, which has no magic, using its extension.
  *
- *	@arg	path	the path.
- *	@arg	types	the expected types.
- *	@arg	decode	the decode function to set.
- *	@return			the error code (0 if ok).
+ *	@arg	sn		the identification context.
+ *	@return			if the format was identified.
  */
 
-CASIO_LOCAL int lookup_extension(const char *path, casio_filetype_t types,
-	decode_func **func)
+CASIO_LOCAL int sniff_storage(struct sniff *sn)
 {
 	char ext[5];
-	struct corresp *c;
 
-	/* match the extension */
-	if (!casio_getext(path, ext, 5)) return (casio_error_magic);
-	for (c = correspondances - 1; c->ext; c++);
+	if (!sn->path || !casio_getext(sn->path, ext, 5))
+		return (0);
+	return (!strcmp(ext, "g1s"));
+}
+
+/**
+ *	sniff_cas:
+ *	Identify a CAS file.
+ *
+ *	@arg	sn		the identification context.
+ *	@return			if the format was identified.
+ */
+
+CASIO_LOCAL int sniff_cas(struct sniff *sn)
+{
+	return (sn->buf.bytes[0] == ':');
+}
+
+/**
+ *	sniff_grc:
+ *	Identify a GraphCard file.
+ *
+ *	@arg	sn		the identification context.
+ *	@return			if the format was identified.
+ */
+
+CASIO_LOCAL int sniff_grc(struct sniff *sn)
+{
+	return (!sn->buf.bytes[0] && sn->buf.bytes[1] == 0x32
+		&& sn->buf.bytes[2] == ':');
+}
+
+/**
+ *	sniff_casemul:
+ *	Identify a Casemul file, and its endianness.
+ *
+ *	@arg	sn		the identification context.
+ *	@return			if the format was identified.
+ */
+
+CASIO_LOCAL int sniff_casemul(struct sniff *sn)
+{
+	casio_casemul_intheader_t *ch = &sn->buf.casemul;
+	casio_uint32_t ver, siz;
+	int be;
+
+	be = !memcmp(sn->buf.bytes, "CAFS", 4);
+	if (!be && memcmp(sn->buf.bytes, "ACFS", 4))
+		return (0);
+
+	ver = be ? be32toh(ch->casio_casemul_intheader_version)
+		: le32toh(ch->casio_casemul_intheader_version);
+	siz = le32toh(ch->casio_casemul_intheader_size);
+	if (ver != 0x100 || siz != sizeof(casio_casemul_header_t))
+		return (0);
+
+	sn->arg = be;
+	return (1);
+}
+
+/**
+ *	sniff_std:
+ *	Identify a file with a standard header.
+ *
+ *	This is the last resort, the magic is checked while decoding.
+ *
+ *	@arg	sn		the identification context.
+ *	@return			if the format was identified.
+ */
+
+CASIO_LOCAL int sniff_std(struct sniff *sn)
+{
+	(void)sn;
+	return (1);
+}
+
+/* ---
+ * Decoding functions.
+ * --- */
+
+CASIO_LOCAL int decode_storage(casio_file_t **handle, casio_stream_t *buffer,
+	struct sniff *sn, casio_filetype_t types, unsigned long flags)
+{
+	(void)sn; (void)types;
+	return (casio_decode_storage(handle, buffer, flags));
+}
+
+CASIO_LOCAL int decode_cas(casio_file_t **handle, casio_stream_t *buffer,
+	struct sniff *sn, casio_filetype_t types, unsigned long flags)
+{
+	(void)sn; (void)types; (void)flags;
+	return (casio_decode_cas(handle, buffer));
+}
 
-	/* check if correspondance is valid and expected */
-	if (!c->ext) return (casio_error_magic);
-	if (types && !(types & c->type)) return (casio_error_wrong);
+CASIO_LOCAL int decode_grc(casio_file_t **handle, casio_stream_t *buffer,
+	struct sniff *sn, casio_filetype_t types, unsigned long flags)
+{
+	(void)sn; (void)types; (void)flags;
+	return (casio_decode_grc(handle, buffer));
+}
 
-	/* return the decode function */
-	*func = c->decode;
-	return (0);
+CASIO_LOCAL int decode_casemul(casio_file_t **handle, casio_stream_t *buffer,
+	struct sniff *sn, casio_filetype_t types, unsigned long flags)
+{
+	(void)types; (void)flags;
+	return (casio_decode_casemul(handle, buffer, sn->arg));
 }
 
+CASIO_LOCAL int decode_std(casio_file_t **handle, casio_stream_t *buffer,
+	struct sniff *sn, casio_filetype_t types, unsigned long flags)
+{
+	return (casio_decode_std(handle, sn->path, buffer, &sn->buf.std,
+		types, flags));
+}
+
+/* Formats, by number of bytes required to identify them. */
+
+CASIO_LOCAL const struct format formats[] = {
+	{0,          casio_filetype_storage, sniff_storage, decode_storage},
+	{1,          casio_filetype_mcs,     sniff_cas,     decode_cas},
+	{3,          casio_filetype_mcs,     sniff_grc,     decode_grc},
+	{12,         casio_filetype_mcs,     sniff_casemul, decode_casemul},
+	{SNIFF_SIZE, 0,                      sniff_std,     decode_std},
+
+	/* terminating entry */
+	{0, 0, NULL, NULL}
+};
+
 /* ---
  * Main decoding function.
  * --- */
 
 /**
- *	casio_decode:
- *	Decode a file.
+ *	casio_decode_flags:
+ *	Decode a file, with flags.
  *
- *	Read the standard header, correct endianness, check magic numbers,
- *	then read subparts according to the file type.
+ *	Identify the format using the first bytes of the stream, then
+ *	decode the file using the function of this format.
  *
  *	@arg	handle			the handle.
  *	@arg	path			the file path.
  *	@arg	buffer			the buffer to read from.
  *	@arg	expected_types	the expected types.
+ *	@arg	flags			the decoding flags.
  *	@return					the error code (0 if ok).
  */
 
-int CASIO_EXPORT casio_decode(casio_file_t **handle, const char *path,
-	casio_stream_t *buffer, casio_filetype_t expected_types)
+int CASIO_EXPORT casio_decode_flags(casio_file_t **handle, const char *path,
+	casio_stream_t *buffer, casio_filetype_t expected_types,
+	unsigned long flags)
 {
-	int err; decode_func *decode;
-	unsigned char buf[0x20], altbuf[0x20];
-	int casemul_be;
+	int err, seekable = casio_isseekable(buffer);
+	const struct format *f;
+	struct sniff sn;
+	size_t have = 0, avail = SNIFF_SIZE, size;
+	casio_off_t off, end;
 
-	/* Match using extension. */
+	/* On seekable streams, don't read further than the end, as the
+	 * file can be smaller than the bytes we read at once. */
 
-	err = lookup_extension(path, expected_types, &decode);
-	if (err == casio_error_wrong) return (err);
-	else if (!err) return ((*decode)(handle, buffer));
+	if (seekable) {
+		off = casio_tell(buffer);
+		if (casio_getsize(buffer, &end))
+			seekable = 0;
+		else if (end - off < (casio_off_t)SNIFF_SIZE)
+			avail = end < off ? 0 : (size_t)(end - off);
+	}
 
-	/* Identify a CAS file. */
+	/* The content can only be read later if we can go back to it. */
 
-	READ(buf, 1)
-	if (buf[0] == ':') {
-		if (expected_types && !(expected_types & casio_filetype_mcs))
-			return (casio_error_wrong);
-		return (casio_decode_cas(handle, buffer));
-	}
+	if (!seekable)
+		flags &= ~CASIO_DECODE_LAZY;
 
-	/* Identify a GraphCard file. */
+	sn.path = path;
+	sn.arg = 0;
 
-	READ(&buf[1], 2)
-	if (!buf[0] && buf[1] == 0x32 && buf[2] == ':') {
-		if (expected_types && !(expected_types & casio_filetype_mcs))
-			return (casio_error_wrong);
-		return (casio_decode_grc(handle, buffer));
-	}
+	for (f = formats; f->sniff; f++) {
+		/* Get the bytes required to identify the format. */
+
+		if (f->size > avail)
+			continue;
+		if (have < f->size) {
+			size = (seekable ? avail : f->size) - have;
+			READ(&sn.buf.bytes[have], size)
+			have += size;
+		}
 
-	/* Identify a Casemul file. */
+		if (!(*f->sniff)(&sn))
+			continue;
 
-	READ(&buf[3], 9) casemul_be = !memcmp(buf, "CAFS", 4);
-	if (casemul_be || !memcmp(buf, "ACFS", 4)) {
-		casio_casemul_intheader_t *ch = (void*)buf;
-		casio_uint32_t ver, siz;
+		/* Check the type and go back to where the decoding function
+		 * expects the stream to be. */
 
-		ver = casemul_be ? be32toh(ch->casio_casemul_intheader_version)
-			: le32toh(ch->casio_casemul_intheader_version);
-		siz = casemul_be ? le32toh(ch->casio_casemul_intheader_size)
-			: le32toh(ch->casio_casemul_intheader_size);
-		if (ver != 0x100 || siz != sizeof(casio_casemul_header_t))
-			return (casio_error_magic);
-		if (expected_types && !(expected_types & casio_filetype_mcs))
+		if (f->types && expected_types && !(expected_types & f->types))
 			return (casio_error_wrong);
-		return (casio_decode_casemul(handle, buffer, casemul_be));
+		if (have > f->size && (err = casio_seek(buffer,
+		  -(casio_off_t)(have - f->size), CASIO_SEEK_CUR)))
+			return (err);
+
+		return ((*f->decode)(handle, buffer, &sn, expected_types, flags));
 	}
 
-	/* Identify a standard header (send a _copy_). */
+	return (casio_error_magic);
+}
+
+/**
+ *	casio_decode:
+ *	Decode a file.
+ *
+ *	@arg	handle			the handle.
+ *	@arg	path			the file path.
+ *	@arg	buffer			the buffer to read from.
+ *	@arg	expected_types	the expected types.
+ *	@return					the error code (0 if ok).
+ */
 
-	READ(&buf[12], 0x14) memcpy(altbuf, buf, 0x20);
-	return (casio_decode_std(handle, path, buffer,
-		(casio_standard_header_t*)altbuf, expected_types));
+int CASIO_EXPORT casio_decode(casio_file_t **handle, const char *path,
+	casio_stream_t *buffer, casio_filetype_t expected_types)
+{
+	return (casio_decode_flags(handle, path, buffer, expected_types, 0));
 }
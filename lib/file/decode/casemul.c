@@ -33,40 +33,16 @@
  * --- */
 
 /* This utility comes from Microsoft Windows.
- * It makes a 32-bit integer out of two 16-bit integers. */
-
-CASIO_LOCAL casio_uint32_t makelong_le(casio_uint16_t one, casio_uint16_t two)
-{
-	union {
-		casio_uint16_t b8[4];
-		casio_uint32_t b32;
-	} tmp;
-
-	tmp.b8[0] = one >> 8;
-	tmp.b8[1] = one & 0xFF;
-	tmp.b8[2] = two >> 8;
-	tmp.b8[3] = two & 0xFF;
-	return (tmp.b32);
-}
-
-CASIO_LOCAL casio_uint32_t makelong_be(casio_uint16_t one, casio_uint16_t two)
-{
-	union {
-		casio_uint16_t b8[4];
-		casio_uint32_t b32;
-	} tmp;
-
-	tmp.b8[1] = one >> 8;
-	tmp.b8[0] = one & 0xFF;
-	tmp.b8[3] = two >> 8;
-	tmp.b8[2] = two & 0xFF;
-	return (tmp.b32);
-}
+ * It makes a 32-bit integer out of two 16-bit integers, the first one
+ * being the low word; the signatures are made using it out of two-character
+ * constants, and stored in the endianness of the file (e.g. "ILTS" for
+ * `MAKELONG('LI', 'ST')` in little endian files). */
 
 #ifdef  MAKELONG
 # undef MAKELONG
 #endif
-#define MAKELONG(A, B) ((big_endian) ? makelong_be(A, B) : makelong_le(A, B))
+#define MAKELONG(A, B) \
+	htoe32(((casio_uint32_t)((B) & 0xFFFF) << 16) | ((A) & 0xFFFF))
 
 /* ---
  * Utilities.
@@ -152,6 +128,75 @@ CASIO_LOCAL int read_top(casio_stream_t *buffer, char *name,
 	return (0);
 }
 
+/* ---
+ * Numbers.
+ * --- */
+
+/* Numbers are IEEE 754 double precision numbers, in the endianness of
+ * the file. They are read by blocks of this many numbers: */
+
+#define NUMBERS 128
+
+/**
+ *	swap_numbers:
+ *	Reverse the bytes of each number of a block, in place.
+ *
+ *	@arg	raw			the block.
+ *	@arg	count		the number of numbers in the block.
+ */
+
+CASIO_LOCAL void swap_numbers(unsigned char *raw, size_t count)
+{
+	unsigned char t;
+
+	for (; count; count--, raw += 8) {
+		t = raw[0]; raw[0] = raw[7]; raw[7] = t;
+		t = raw[1]; raw[1] = raw[6]; raw[6] = t;
+		t = raw[2]; raw[2] = raw[5]; raw[5] = t;
+		t = raw[3]; raw[3] = raw[4]; raw[4] = t;
+	}
+}
+
+/**
+ *	read_numbers:
+ *	Read numbers into the cells of a main memory file.
+ *
+ *	@arg	file		the main memory file.
+ *	@arg	count		the number of numbers to read.
+ *	@arg	buffer		the buffer to read from.
+ *	@arg	big_endian	whether the file is big endian or not.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int read_numbers(casio_mcsfile_t *file, unsigned long count,
+	casio_stream_t *buffer, int big_endian)
+{
+	const union { casio_uint32_t i; unsigned char c[4]; } host = {1};
+	unsigned char raw[NUMBERS * 8];
+	casio_bcd_t *bcd = file->casio_mcsfile_cell_real;
+	unsigned char *flags = file->casio_mcsfile_cell_flags;
+	int swap = !host.c[0] != !!big_endian;
+	size_t num, i;
+	double value;
+
+	while (count) {
+		num = (size_t)min(count, NUMBERS);
+		READ(raw, num * 8)
+		if (swap)
+			swap_numbers(raw, num);
+
+		for (i = 0; i < num; i++) {
+			memcpy(&value, &raw[i * 8], 8);
+			casio_bcd_fromdouble(bcd++, value);
+			*flags++ = casio_mcscellflag_used;
+		}
+
+		count -= num;
+	}
+
+	return (0);
+}
+
 /* ---
  * Intermediate functions.
  * --- */
@@ -171,9 +216,8 @@ CASIO_LOCAL int read_picture(casio_mcsfile_t **pfile, casio_stream_t *buffer,
 {
 	int err; char name[13]; casio_uint32_t record_length;
 	casio_casemul_pict_header_t pct;
-	unsigned char *rawpx = NULL;
-	unsigned int width, height;
-	size_t rawpxsize;
+	unsigned char raw[2048];
+	unsigned int width, height, y, rows;
 	casio_mcshead_t head;
 
 	*pfile = NULL;
@@ -188,33 +232,30 @@ CASIO_LOCAL int read_picture(casio_mcsfile_t **pfile, casio_stream_t *buffer,
 	height = pct.casio_casemul_pict_header_height;
 	msg((ll_info, "picture dimension is %d*%dpx", width, height));
 
-	/* read all of the pixels */
-	rawpxsize = casio_get_picture_size(NULL,
-		casio_pictureformat_casemul, width, height);
-	rawpx = casio_alloc(1, rawpxsize);
-	if (!rawpx) return (casio_error_alloc);
-	GREAD(rawpx, rawpxsize)
-
 	/* make the head and allocate file */
+	memset(&head, 0, sizeof(head));
 	head.casio_mcshead_type = casio_mcstype_capture;
-	head.casio_mcshead_width = pct.casio_casemul_pict_header_width;
-	head.casio_mcshead_height = pct.casio_casemul_pict_header_height;
+	head.casio_mcshead_width = width;
+	head.casio_mcshead_height = height;
+	head.casio_mcshead_count = 1;
 	memcpy(head.casio_mcshead_name, name, strlen(name) + 1);
 	head.casio_mcshead_id = name[7] - '0';
-	err = casio_make_mcsfile(pfile, &head);
-	if (err) goto fail;
+	if ((err = casio_make_mcsfile(pfile, &head)))
+		return (err);
 
-	/* set the pixels */
-	casio_decode_picture((*pfile)->casio_mcsfile_pic, rawpx,
-		casio_pictureformat_casemul, width, height);
+	/* read the pixels by blocks of rows, right into the picture */
+	if (width) for (y = 0; y < height; y += rows) {
+		rows = min(height - y, sizeof(raw) / width);
+		GREAD(raw, rows * width)
+		casio_decode_picture(&(*pfile)->casio_mcsfile_pic[y], raw,
+			casio_pictureformat_casemul, width, rows);
+	}
 
-	/* finish */
-	err = 0;
+	return (0);
 fail:
-	if (err) casio_free_mcsfile(*pfile);
+	casio_free_mcsfile(*pfile);
 	*pfile = NULL;
-	casio_free(rawpx);
-	return (0);
+	return (err);
 }
 
 /**
@@ -233,9 +274,8 @@ CASIO_LOCAL int read_matrix(casio_mcsfile_t **pfile, casio_stream_t *buffer,
 	int err; char name[13];
 	casio_uint32_t record_length;
 	casio_casemul_mtrx_header_t mtx;
-	unsigned int total, width, height, y, x;
-	double *tab = NULL, *raw;
-	casio_mcshead_t head; casio_mcscell_t **cells;
+	unsigned int width, height;
+	casio_mcshead_t head;
 
 	*pfile = NULL;
 	/* general record things */
@@ -245,54 +285,28 @@ CASIO_LOCAL int read_matrix(casio_mcsfile_t **pfile, casio_stream_t *buffer,
 
 	/* read specific things */
 	DREAD(mtx)
-	width = e32toh(mtx.casio_casemul_mtrx_header_lines) & 0x7FFF;
-	height = e32toh(mtx.casio_casemul_mtrx_header_columns) & 0x7FFF;
-
-	/* read double tab */
-	total = width * height;
-	tab = casio_alloc(total, sizeof(double));
-	if (!tab) return (casio_error_alloc);
-	GREAD(tab, total * sizeof(double))
-	raw = tab;
+	height = e32toh(mtx.casio_casemul_mtrx_header_lines) & 0x7FFF;
+	width = e32toh(mtx.casio_casemul_mtrx_header_columns) & 0x7FFF;
+	msg((ll_info, "matrix dimension is %u*%u", width, height));
 
 	/* make the head and allocate file */
+	memset(&head, 0, sizeof(head));
 	head.casio_mcshead_type = casio_mcstype_matrix;
 	head.casio_mcshead_width = width;
 	head.casio_mcshead_height = height;
 	memcpy(head.casio_mcshead_name, name, strlen(name) + 1);
 	head.casio_mcshead_id = name[4] - 'A' + 1;
-	err = casio_make_mcsfile(pfile, &head);
-	if (err) { casio_free(tab); return (err); }
-
-	/* read the matrix */
-	cells = (*pfile)->casio_mcsfile_cells;
-	for (y = 0; y < height; y++) for (x = 0; x < width; x++) {
-		casio_bcd_t bcd;
-
-		/* read the bcd */
-		casio_bcd_fromdouble(&bcd, *raw++);
-
-#if !defined(LIBCASIO_DISABLED_LOG)
-		if (islog(ll_info)) {
-			char buf[CASIO_BCD_GOODBUFSIZE];
-
-			/* log the bcd */
-			casio_bcdtoa(buf, CASIO_BCD_GOODBUFSIZE, &bcd);
-			msg((ll_info, "[%d][%d] %s", y, x, buf));
-		}
-#endif
+	if ((err = casio_make_mcsfile(pfile, &head)))
+		return (err);
 
-		/* make the cell */
-		cells[y][x].casio_mcscell_real = bcd;
-		cells[y][x].casio_mcscell_flags = casio_mcscellflag_used;
+	/* read the matrix, which is ordered by lines as the cells are */
+	if ((err = read_numbers(*pfile, (unsigned long)width * height,
+	  buffer, big_endian))) {
+		casio_free_mcsfile(*pfile);
+		*pfile = NULL;
+		return (err);
 	}
 
-	/* no error */
-	err = 0;
-fail:
-	if (err) casio_free_mcsfile(*pfile);
-	*pfile = NULL;
-	casio_free(tab);
 	return (0);
 }
 
@@ -309,10 +323,9 @@ fail:
 CASIO_LOCAL int read_list(casio_mcsfile_t **pfile, casio_stream_t *buffer,
 	int big_endian)
 {
-	int err, len, x; char name[13]; casio_uint32_t record_length;
+	int err; unsigned int len; char name[13]; casio_uint32_t record_length;
 	casio_casemul_list_header_t lst;
-	casio_mcshead_t head; casio_mcscell_t **cells;
-	double *tab, *raw;
+	casio_mcshead_t head;
 
 	*pfile = NULL;
 	/* general record things */
@@ -322,52 +335,26 @@ CASIO_LOCAL int read_list(casio_mcsfile_t **pfile, casio_stream_t *buffer,
 
 	/* read specific things */
 	DREAD(lst)
-	len = le32toh(lst.casio_casemul_list_header_lines) & 0x7FFF;
-	msg((ll_info, "%d elements in list", len));
-
-	/* read double tab */
-	tab = casio_alloc(len, 1); if (!tab) return (casio_error_alloc);
-	GREAD(tab, len * sizeof(double))
-	raw = tab;
+	len = e32toh(lst.casio_casemul_list_header_lines) & 0x7FFF;
+	msg((ll_info, "%u elements in list", len));
 
 	/* make head */
+	memset(&head, 0, sizeof(head));
 	head.casio_mcshead_type = casio_mcstype_list;
 	head.casio_mcshead_width = 1;
 	head.casio_mcshead_height = len;
 	memcpy(head.casio_mcshead_name, name, strlen(name) + 1);
 	head.casio_mcshead_id = name[5] - '0';
-	err = casio_make_mcsfile(pfile, &head);
-	if (err) { casio_free(tab); return (err); }
+	if ((err = casio_make_mcsfile(pfile, &head)))
+		return (err);
 
 	/* read the list */
-	cells = (*pfile)->casio_mcsfile_cells;
-	for (x = 0; x < len; x++) {
-		casio_mcscell_t *cell = &cells[x][0];
-
-		/* read bcd */
-		casio_bcd_fromdouble(&cell->casio_mcscell_real, *raw++);
-
-#if !defined(LIBCASIO_DISABLED_LOG)
-		if (islog(ll_info)) {
-			char buf[CASIO_BCD_GOODBUFSIZE];
-
-			/* log information */
-			casio_bcdtoa(buf, CASIO_BCD_GOODBUFSIZE,
-				&cell->casio_mcscell_real);
-			msg((ll_info, "[%d] %s", x, buf));
-		}
-#endif
-
-		/* set the cell */
-		cell->casio_mcscell_flags = casio_mcscellflag_used;
+	if ((err = read_numbers(*pfile, len, buffer, big_endian))) {
+		casio_free_mcsfile(*pfile);
+		*pfile = NULL;
+		return (err);
 	}
 
-	/* no error */
-	err = 0;
-fail:
-	if (err) casio_free_mcsfile(*pfile);
-	*pfile = NULL;
-	casio_free(tab);
 	return (0);
 }
 
@@ -30,14 +30,15 @@ CASIO_EXTERN int CASIO_EXPORT casio_decode_std
 	OF((casio_file_t **casio__handle,
 		const char *casio__path, casio_stream_t *casio__buffer,
 		casio_standard_header_t *casio__standard,
-		casio_filetype_t casio__expected_types));
+		casio_filetype_t casio__expected_types, unsigned long casio__flags));
 
 /* Main decoding functions w/o expected types. */
 CASIO_EXTERN int CASIO_EXPORT casio_decode_casemul
 	OF((casio_file_t **casio__handle, casio_stream_t *casio__buffer,
 		int casio__big_endian));
 CASIO_EXTERN int CASIO_EXPORT casio_decode_storage
-	OF((casio_file_t **casio__handle, casio_stream_t *casio__buffer));
+	OF((casio_file_t **casio__handle, casio_stream_t *casio__buffer,
+		unsigned long casio__flags));
 CASIO_EXTERN int CASIO_EXPORT casio_decode_cas
 	OF((casio_file_t **casio__handle, casio_stream_t *casio__buffer));
 CASIO_EXTERN int CASIO_EXPORT casio_decode_grc
@@ -76,15 +77,29 @@ CASIO_EXTERN int CASIO_EXPORT casio_decode_std_##CASIO__NAME \
 /* Prototypes */
 CASIO_STDFUNC(mcs)
 CASIO_STDFUNC(eact)
-CASIO_STDFUNC(addin)
 CASIO_STDFUNC(lang)
 CASIO_STDFUNC(fkey)
 
-CASIO_CPFUNC(addin)
-CASIO_PRIZMFUNC(addin)
 CASIO_PRIZMFUNC(lang)
 CASIO_PRIZMFUNC(fkey)
 CASIO_PICFUNC(g3p)
 CASIO_PICFUNC(c2p)
 
+/* Add-ins can be decoded lazily, so they also take the decoding flags. */
+CASIO_EXTERN int CASIO_EXPORT casio_decode_std_addin
+	OF((casio_file_t **casio__handle, casio_stream_t *casio__buffer,
+		casio_standard_header_t *casio__std, unsigned long casio__flags));
+CASIO_EXTERN int CASIO_EXPORT casio_decode_std_cp_addin
+	OF((casio_file_t **casio__handle, casio_stream_t *casio__buffer,
+		casio_standard_header_t *casio__std,
+		casio_standard_subheader_t *casio__sub,
+		casio_standard_classpad_subheader_t *casio__cp,
+		unsigned long casio__flags));
+CASIO_EXTERN int CASIO_EXPORT casio_decode_std_cg_addin
+	OF((casio_file_t **casio__handle, casio_stream_t *casio__buffer,
+		casio_standard_header_t *casio__std,
+		casio_standard_subheader_t *casio__sub,
+		casio_standard_prizm_subheader_t *casio__pzm,
+		unsigned long casio__flags));
+
 #endif /* LOCAL_FILE_DECODE_H */
@@ -105,12 +105,13 @@ CASIO_LOCAL int find_decode_function(casio_filefor_t platform,
  *	@arg	buffer			the buffer to read from.
  *	@arg	std				the standard header.
  *	@arg	expected_types	the expected types.
+ *	@arg	flags			the decoding flags.
  *	@return					the error code (0 if ok).
  */
 
 int CASIO_EXPORT casio_decode_std(casio_file_t **h, const char *path,
 	casio_stream_t *buffer, casio_standard_header_t *std,
-	casio_filetype_t expected_types)
+	casio_filetype_t expected_types, unsigned long flags)
 {
 	int err;
 	casio_filetype_t type; casio_filefor_t platform;
@@ -172,6 +173,24 @@ int CASIO_EXPORT casio_decode_std(casio_file_t **h, const char *path,
 		if (expected_types && !(type & expected_types))
 			return (casio_error_wrong);
 
+		/* only add-ins can be decoded lazily; as the content isn't read,
+		 * the checksum can't be checked */
+		if (type != casio_filetype_addin)
+			flags &= ~CASIO_DECODE_LAZY;
+		if (flags & CASIO_DECODE_LAZY) {
+			if (platform == casio_filefor_cp) {
+				casio_standard_classpad_subheader_t shd;
+
+				DREAD(shd)
+				return ((*rd)(h, buffer, std, &hd, &shd, flags));
+			} else if (platform == casio_filefor_cg) {
+				casio_standard_prizm_subheader_t shd;
+
+				DREAD(shd)
+				return ((*rd)(h, buffer, std, &hd, &shd, flags));
+			}
+		}
+
 		/* read and decode for specific platforms */
 		check = casio_checksum32(&hd.casio_standard_subheader_filetype,
 			sizeof(casio_standard_header_t) - 4, check);
@@ -184,12 +203,16 @@ int CASIO_EXPORT casio_decode_std(casio_file_t **h, const char *path,
 
 			/* make the checksum stream */
 			msg((ll_info, "Opening the checksum stream"));
-			err = casio_open_csum32(&csum_stream, buffer, &check);
+			err = casio_open_filter(&csum_stream, buffer);
 			if (err) return (err);
+			casio_filter_csum32(csum_stream, &check);
 
 			/* decode the file content */
 			msg((ll_info, "Decoding the file using the specific function"));
-			err = (*rd)(h, csum_stream, std, &hd, &shd);
+			if (type == casio_filetype_addin)
+				err = (*rd)(h, csum_stream, std, &hd, &shd, flags);
+			else
+				err = (*rd)(h, csum_stream, std, &hd, &shd);
 			casio_close(csum_stream);
 			if (err) return (err);
 		} else if (platform == casio_filefor_cg) {
@@ -202,12 +225,16 @@ int CASIO_EXPORT casio_decode_std(casio_file_t **h, const char *path,
 
 			/* make the checksum stream */
 			msg((ll_info, "Opening the checksum stream"));
-			err = casio_open_csum32(&csum_stream, buffer, &check);
+			err = casio_open_filter(&csum_stream, buffer);
 			if (err) return (err);
+			casio_filter_csum32(csum_stream, &check);
 
 			/* decode the file content */
 			msg((ll_info, "Decoding the file using the specific function"));
-			err = (*rd)(h, csum_stream, std, &hd, &shd);
+			if (type == casio_filetype_addin)
+				err = (*rd)(h, csum_stream, std, &hd, &shd, flags);
+			else
+				err = (*rd)(h, csum_stream, std, &hd, &shd);
 			casio_close(csum_stream);
 			if (err) return (err);
 
@@ -289,6 +316,8 @@ int CASIO_EXPORT casio_decode_std(casio_file_t **h, const char *path,
 		std->casio_standard_header_number));
 
 	/* subdecode. */
+	if (type == casio_filetype_addin)
+		return ((*rd)(h, buffer, std, flags));
 	return ((*rd)(h, buffer, std));
 fail:
 	casio_free_file(*h); *h = NULL;
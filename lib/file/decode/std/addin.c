@@ -18,6 +18,28 @@
  * ************************************************************************* */
 #include "../decode.h"
 
+/**
+ *	make_addin:
+ *	Make the add-in handle, with the content if it is to be read now.
+ *
+ *	@arg	h			the file handle to make.
+ *	@arg	flags		the decoding flags.
+ *	@arg	...			the arguments to `casio_make_addin()`.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int make_addin(casio_file_t **h, unsigned long flags,
+	casio_filefor_t platform, size_t size,
+	const char *name, const char *internal,
+	const casio_version_t *version, const time_t *created)
+{
+	if (flags & CASIO_DECODE_LAZY)
+		return (casio_make_addin_head(h, platform, size, name, internal,
+			version, created));
+	return (casio_make_addin(h, platform, size, name, internal,
+		version, created));
+}
+
 /* ---
  * Add-in for the fx-9860G (G1A).
  * --- */
@@ -28,11 +50,13 @@
  *
  *	@arg	h			the file handle to make.
  *	@arg	buffer		the buffer to read from.
+ *	@arg	std			the standard header.
+ *	@arg	flags		the decoding flags.
  *	@return				the error code (0 if ok).
  */
 
 int CASIO_EXPORT casio_decode_std_addin(casio_file_t **h,
-	casio_stream_t *buffer, casio_standard_header_t *std)
+	casio_stream_t *buffer, casio_standard_header_t *std, unsigned long flags)
 {
 	int err = 0;
 	casio_addin_subheader_t hd; size_t content_size;
@@ -52,7 +76,7 @@ int CASIO_EXPORT casio_decode_std_addin(casio_file_t **h,
 		be32toh(hd.casio_addin_subheader_filesize); /* already corrected */
 	content_size -= sizeof(casio_standard_header_t)
 		+ sizeof(casio_addin_subheader_t);
-	err = casio_make_addin(h, casio_filefor_fx, content_size,
+	err = make_addin(h, flags, casio_filefor_fx, content_size,
 		(char*)hd.casio_addin_subheader_title,
 		(char*)hd.casio_addin_subheader_internal_name, &version, &created);
 	if (err) return (err);
@@ -77,8 +101,12 @@ int CASIO_EXPORT casio_decode_std_addin(casio_file_t **h,
 		hd.casio_addin_subheader_icon, casio_pictureformat_1bit_r,
 		handle->casio_file_width, handle->casio_file_height);
 
-	/* read content */
-	GREAD(handle->casio_file_content, handle->casio_file_size)
+	/* read content, or remember where it is */
+	if (flags & CASIO_DECODE_LAZY) {
+		handle->casio_file_content_stream = buffer;
+		handle->casio_file_content_offset = casio_tell(buffer);
+	} else
+		GREAD(handle->casio_file_content, handle->casio_file_size)
 
 	/* no errors */
 	return (err);
@@ -100,12 +128,14 @@ fail:
  *	@arg	std			the standard header.
  *	@arg	sub			the standard subheader.
  *	@arg	cp			the classpad-specific subheader.
+ *	@arg	flags		the decoding flags.
  *	@return				the error code (0 if ok).
  */
 
 int CASIO_EXPORT casio_decode_std_cp_addin(casio_file_t **h,
 	casio_stream_t *buffer, casio_standard_header_t *std,
-	casio_standard_subheader_t *sub, casio_standard_classpad_subheader_t *cp)
+	casio_standard_subheader_t *sub, casio_standard_classpad_subheader_t *cp,
+	unsigned long flags)
 {
 	int err = 0;
 	casio_file_t *handle;
@@ -123,7 +153,7 @@ int CASIO_EXPORT casio_decode_std_cp_addin(casio_file_t **h,
 		(char*)sub->casio_standard_subheader_timestamp);
 	content_size =
 		be32toh(sub->casio_standard_subheader_filesize) - 0x1000;
-	err = casio_make_addin(h, casio_filefor_cp, content_size,
+	err = make_addin(h, flags, casio_filefor_cp, content_size,
 		(char*)sub->casio_standard_subheader_title,
 		(char*)sub->casio_standard_subheader_internal_name,
 		&version, &created);
@@ -149,8 +179,12 @@ int CASIO_EXPORT casio_decode_std_cp_addin(casio_file_t **h,
 	msg((ll_info, "timestamp is %.24s",
 		ctime(&handle->casio_file_creation_date)));
 
-	/* get content */
-	GREAD(handle->casio_file_content, handle->casio_file_size)
+	/* read content, or remember where it is */
+	if (flags & CASIO_DECODE_LAZY) {
+		handle->casio_file_content_stream = buffer;
+		handle->casio_file_content_offset = casio_tell(buffer);
+	} else
+		GREAD(handle->casio_file_content, handle->casio_file_size)
 
 	/* no error */
 	return (0);
@@ -172,12 +206,14 @@ fail:
  *	@arg	std			the standard header.
  *	@arg	sub			the standard subheader.
  *	@arg	prizm		the prizm-specific subheader.
+ *	@arg	flags		the decoding flags.
  *	@return				the error code (0 if ok).
  */
 
 int CASIO_EXPORT casio_decode_std_cg_addin(casio_file_t **h,
 	casio_stream_t *buffer, casio_standard_header_t *std,
-	casio_standard_subheader_t *sub, casio_standard_prizm_subheader_t *prizm)
+	casio_standard_subheader_t *sub, casio_standard_prizm_subheader_t *prizm,
+	unsigned long flags)
 {
 	int err = 0;
 	casio_prizm_addin_subheader_t cghd; size_t content_size;
@@ -200,7 +236,7 @@ int CASIO_EXPORT casio_decode_std_cg_addin(casio_file_t **h,
 		+ sizeof(casio_prizm_addin_subheader_t)
 		+ sizeof(casio_uint32_t);
 	msg((ll_info, "Content size is %" CASIO_PRIuSIZE, content_size));
-	err = casio_make_addin(h, casio_filefor_cg, content_size,
+	err = make_addin(h, flags, casio_filefor_cg, content_size,
 		(char*)sub->casio_standard_subheader_title,
 		(char*)sub->casio_standard_subheader_internal_name,
 		&version, &created);
@@ -226,8 +262,12 @@ int CASIO_EXPORT casio_decode_std_cg_addin(casio_file_t **h,
 	msg((ll_info, "timestamp is %.24s",
 		ctime(&handle->casio_file_creation_date)));
 
-	/* read content */
-	GREAD(handle->casio_file_content, handle->casio_file_size)
+	/* read content, or remember where it is */
+	if (flags & CASIO_DECODE_LAZY) {
+		handle->casio_file_content_stream = buffer;
+		handle->casio_file_content_offset = casio_tell(buffer);
+	} else
+		GREAD(handle->casio_file_content, handle->casio_file_size)
 
 	/* no error */
 	return (0);
@@ -20,33 +20,21 @@
 #include <zlib.h>
 
 /* ---
- * Obfuscation-related functions.
+ * Prizm Picture decoding function.
  * --- */
 
-/**
- *	g3p_deobfuscate:
- *	De-obfuscate the image data.
- *
- *	@arg	buf			the buffer.
- *	@arg	n			the buffer size.
- */
-
-CASIO_LOCAL void g3p_deobfuscate(unsigned char *buf, size_t n)
-{
-	while (n--) {
-		unsigned char byte = ~*buf;
-		*buf++ = (byte << 5) | (byte >> 3);
-	}
-}
+/* Size of the chunks of deflated data to read at once. */
 
-/* ---
- * Prizm Picture decoding function.
- * --- */
+#define CHUNK_SIZE 2048
 
 /**
  *	casio_decode_std_g3p:
  *	Decode a G3P file.
  *
+ *	The deflated data is read by chunks, then inflated into a buffer
+ *	holding a few rows, which are converted as soon as they are complete,
+ *	so that the full raw image is never in memory.
+ *
  *	@arg	handle		the handle.
  *	@arg	buffer		the buffer to read from.
  *	@arg	std			the standard header.
@@ -57,15 +45,17 @@ CASIO_LOCAL void g3p_deobfuscate(unsigned char *buf, size_t n)
 int CASIO_EXPORT casio_decode_std_g3p(casio_file_t **h, casio_stream_t *buffer,
 	casio_standard_header_t *std, casio_standard_picheader_t *pic)
 {
-	int err = casio_error_alloc, z_err;
+	int err = casio_error_alloc, z_err, z_init = 0;
 	casio_prizm_picture_subheader_t ihd;
-	unsigned int width, height; casio_uint16_t gen;
-	casio_uint16_t rawcol; const char *coldesc; size_t rawsize;
-	uLong inflated_size, adl;
-	size_t deflated_size; casio_uint32_t checksum;
+	unsigned int width, height, y, rows, group; casio_uint16_t gen;
+	casio_uint16_t rawcol; const char *coldesc; size_t rowsize;
+	uLong adl = 0;
+	size_t deflated_size, chunk_size; casio_uint32_t checksum;
 	casio_pictureformat_t picfmt;
-	casio_uint8_t *defbuf = NULL, *infbuf = NULL;
+	casio_uint8_t chunk[CHUNK_SIZE], *rowbuf = NULL;
 	casio_file_t *handle;
+	casio_stream_t *original = buffer;
+	z_stream z;
 
 	*h = NULL;
 	(void)pic;
@@ -93,47 +83,94 @@ int CASIO_EXPORT casio_decode_std_g3p(casio_file_t **h, casio_stream_t *buffer,
 	msg((ll_info, "Generator ID: 0x%04X", gen));
 	msg((ll_info, "-"));
 
-	/* Read the deflated image. */
+	/* Get the deflated data size. */
 
-	deflated_size = be32toh(ihd.casio_prizm_picture_subheader_data_size)
-		- 6; /* FIXME: dangerous */
+	deflated_size = be32toh(ihd.casio_prizm_picture_subheader_data_size);
+	if (deflated_size < 6) {
+		msg((ll_error, "Deflated data size is too small!"));
+		err = casio_error_magic; goto fail;
+	}
+	deflated_size -= 6;
 	msg((ll_info, "Reading %" CASIO_PRIuSIZE "B of deflated data",
 		deflated_size));
+
+	/* Make the handle. */
+
+	err = casio_make_picture(h, width, height);
+	if (err) goto fail;
+	handle = *h;
+
+	/* Make the row buffer; with 4-bit pixels, a row with an odd width
+	 * doesn't end on a byte boundary, so rows are taken two by two. */
+
+	group = (picfmt == casio_pictureformat_4bit_code && width % 2) ? 2 : 1;
+	rowsize = casio_get_picture_size(NULL, picfmt, width, group);
 	err = casio_error_alloc;
-	if (!(defbuf = casio_alloc(deflated_size, 1)))
+	if (!(rowbuf = casio_alloc(rowsize + 1, 1)))
 		goto fail;
-	READ(defbuf, deflated_size)
 
-	/* Unobfuscate if required. */
+	/* Unobfuscate if required, while reading. */
 
 	if (std->casio_standard_header_obfuscated0) {
 		msg((ll_info, "Is obfuscated, let's deobfuscate!"));
-		g3p_deobfuscate(defbuf, deflated_size);
+		if ((err = casio_open_filter(&buffer, original)))
+			goto fail;
+		casio_filter_deobfuscate(buffer);
 	}
 
-	/* Make the destination buffer. */
-
-	rawsize = casio_get_picture_size(NULL, picfmt, width, height);
-	err = casio_error_alloc;
-	if (!(infbuf = casio_alloc(rawsize, 1)))
-		goto fail;
+	/* Prepare the inflating. */
 
-	/* uncompress */
-	inflated_size = (uLong)rawsize;
-	z_err = uncompress(infbuf, &inflated_size, defbuf, (uLong)deflated_size);
-	if (z_err) {
-		msg((ll_fatal, "Zlib error %d: %s", z_err, zError(err)));
-		err = casio_error_magic;
+	memset(&z, 0, sizeof(z));
+	if (inflateInit(&z) != Z_OK) {
+		msg((ll_fatal, "Could not initialize zlib: %s", z.msg));
+		err = casio_error_alloc;
 		goto fail;
 	}
-	casio_free(defbuf); defbuf = NULL;
+	z_init = 1;
+
+	/* Inflate and convert the rows as they come. */
+
+	for (y = 0; y < height; y += rows) {
+		rows = min(group, height - y);
+		z.next_out = rowbuf;
+		z.avail_out = (uInt)casio_get_picture_size(NULL, picfmt, width, rows);
+		rowbuf[z.avail_out] = 0;
+
+		while (z.avail_out) {
+			if (!z.avail_in && deflated_size) {
+				chunk_size = min(deflated_size, CHUNK_SIZE);
+				GREAD(chunk, chunk_size)
+				deflated_size -= chunk_size;
+				z.next_in = chunk;
+				z.avail_in = (uInt)chunk_size;
+			}
+
+			z_err = inflate(&z, Z_NO_FLUSH);
+			if (z_err == Z_STREAM_END && z.avail_out)
+				z_err = Z_DATA_ERROR;
+			if (z_err != Z_OK && z_err != Z_STREAM_END) {
+				msg((ll_fatal, "Zlib error %d: %s", z_err,
+					z.msg ? z.msg : zError(z_err)));
+				err = casio_error_magic;
+				goto fail;
+			}
+		}
+
+		adl = adler32(adl, rowbuf,
+			(uInt)casio_get_picture_size(NULL, picfmt, width, rows));
+		casio_decode_picture(&handle->casio_file_pixels[y], rowbuf,
+			picfmt, width, rows);
+	}
+
+	/* Skip what's left of the deflated data. */
 
-	/* check the checksum */
-	READ(&checksum, sizeof(casio_uint32_t))
-	if (std->casio_standard_header_obfuscated0)
-		g3p_deobfuscate((void*)&checksum, sizeof(casio_uint32_t));
+	if (deflated_size)
+		GSKIP(deflated_size)
+
+	/* Check the checksum. */
+
+	GREAD(&checksum, sizeof(casio_uint32_t))
 	checksum = be32toh(checksum);
-	adl = adler32(0, infbuf, inflated_size);
 	if (adl != (uLong)checksum) {
 		msg((ll_fatal, "Incorrect Adler32 checksum!"));
 		msg((ll_fatal, "Expected 0x%08" CASIO_PRIX32 ", got 0x%08lX",
@@ -142,24 +179,20 @@ int CASIO_EXPORT casio_decode_std_g3p(casio_file_t **h, casio_stream_t *buffer,
 		goto fail;
 	}
 
-	/* make the handle */
-	err = casio_make_picture(h, ihd.casio_prizm_picture_subheader_width,
-		ihd.casio_prizm_picture_subheader_height);
-	if (err) goto fail;
-	handle = *h;
-
-	/* then store it */
-	casio_decode_picture(handle->casio_file_pixels, infbuf,
-		picfmt, handle->casio_file_width, handle->casio_file_height);
-	casio_free(infbuf); infbuf = NULL;
-
 	/* TODO: footers? */
 
 	/* no error */
-	return (0);
+	err = 0;
 fail:
-	casio_free_file(*h); *h = NULL;
-	casio_free(infbuf); casio_free(defbuf);
+	if (z_init)
+		inflateEnd(&z);
+	if (buffer != original)
+		casio_close(buffer);
+	if (err) {
+		casio_free_file(*h);
+		*h = NULL;
+	}
+	casio_free(rowbuf);
 	return (err);
 }
 
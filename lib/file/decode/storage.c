@@ -18,22 +18,94 @@
  * ************************************************************************* */
 #include "decode.h"
 
+/**
+ *	copy_image:
+ *	Copy the rest of a stream into a growable memory stream.
+ *
+ *	@arg	mem			the memory stream to make.
+ *	@arg	buffer		the stream to copy, which must be seekable.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int copy_image(casio_stream_t **mem, casio_stream_t *buffer)
+{
+	unsigned char buf[4096];
+	casio_off_t size;
+	size_t len;
+	ssize_t rd;
+	int err;
+
+	if (!casio_isseekable(buffer)) {
+		msg((ll_error, "The storage memory image should be seekable."));
+		return (casio_error_op);
+	}
+	if ((err = casio_getsize(buffer, &size)))
+		return (err);
+	size -= casio_tell(buffer);
+
+	if ((err = casio_open_membuf(mem)))
+		return (err);
+	for (; size > 0; size -= len) {
+		len = size < (casio_off_t)sizeof(buf) ? (size_t)size : sizeof(buf);
+		if ((rd = casio_read(buffer, buf, len)) < 0) {
+			err = (int)-rd;
+			goto fail;
+		}
+		if (casio_write(*mem, buf, len) < 0) {
+			err = casio_error_write;
+			goto fail;
+		}
+	}
+
+	if ((err = casio_seek(*mem, 0, CASIO_SEEK_SET)))
+		goto fail;
+	return (0);
+fail:
+	casio_close(*mem);
+	return (err);
+}
+
 /**
  *	casio_decode_storage:
  *	Decode a fx-9860G storage memory.
  *
+ *	Only the entry list is read, to make the filesystem index; the files
+ *	are read from the image when they are opened through the filesystem.
+ *	The image is copied in memory, which the filesystem owns, unless the
+ *	`CASIO_DECODE_LAZY` flag is given, in which case it is read from the
+ *	stream, which must then stay opened while the handle is used.
+ *
  *	@arg	handlep		the handle to create.
  *	@arg	buffer		the buffer to read from.
+ *	@arg	flags		the decoding flags.
+ *	@return				the error code (0 if ok).
  */
 
 int CASIO_EXPORT casio_decode_storage(casio_file_t **handlep,
-	casio_stream_t *buffer)
+	casio_stream_t *buffer, unsigned long flags)
 {
-	/* TODO: code this function. */
+	casio_file_t *handle;
+	casio_stream_t *image = buffer;
+	int err;
+
+	if (~flags & CASIO_DECODE_LAZY && (err = copy_image(&image, buffer)))
+		return (err);
+
+	if (!(handle = casio_alloc(1, sizeof(casio_file_t)))) {
+		if (image != buffer)
+			casio_close(image);
+		return (casio_error_alloc);
+	}
+	memset(handle, 0, sizeof(casio_file_t));
+	handle->casio_file_type = casio_filetype_storage;
+	handle->casio_file_for = casio_filefor_fx;
 
-	(void)handlep;
-	(void)buffer;
+	if ((err = casio_open_storage_fs(&handle->casio_file_fs, image,
+	  image != buffer))) {
+		casio_free(handle);
+		return (err);
+	}
 
-	msg((ll_info, "storage memory decoding is not available yet."));
-	return (casio_error_op);
+	*handlep = handle;
+	return (0);
 }
@@ -64,6 +64,18 @@
 # define DWRITE(CASIO__OBJECT) \
 	WRITE(&(CASIO__OBJECT), sizeof(CASIO__OBJECT))
 
+/* ---
+ * Add-in utilities.
+ * --- */
+
+/* Make an add-in without allocating its content, for lazy decoding. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_make_addin_head
+	OF((casio_file_t **casio__handle,
+		casio_filefor_t casio__for, size_t casio__size,
+		const char *casio__name, const char *casio__internal,
+		const casio_version_t *casio__version, const time_t *casio__created));
+
 /* ---
  * Picture utilities.
  * --- */
@@ -164,8 +164,8 @@ fail:
 }
 
 /**
- *	casio_make_addin:
- *	Make an add-in handle.
+ *	casio_make_addin_head:
+ *	Make an add-in handle, without allocating the content.
  *
  *	@arg	h			pointer to the handle to create.
  *	@arg	platform	the platform for which to make the add-in.
@@ -177,7 +177,7 @@ fail:
  *	@return				the error code (0 if ok).
  */
 
-int CASIO_EXPORT casio_make_addin(casio_file_t **h,
+int CASIO_EXPORT casio_make_addin_head(casio_file_t **h,
 	casio_filefor_t platform, size_t size,
 	const char *name, const char *internal,
 	const casio_version_t *version, const time_t *created)
@@ -210,10 +210,6 @@ int CASIO_EXPORT casio_make_addin(casio_file_t **h,
 	handle->casio_file_creation_date = *created;
 	handle->casio_file_size = size;
 
-	/* allocate the content */
-	handle->casio_file_content = casio_alloc(size, 1);
-	if (!handle->casio_file_content) goto fail;
-
 	/* check the platform */
 	titlesize = 8;
 	intsize = 8;
@@ -264,6 +260,80 @@ fail:
 	return (casio_error_alloc);
 }
 
+/**
+ *	casio_make_addin:
+ *	Make an add-in handle.
+ *
+ *	@arg	h			pointer to the handle to create.
+ *	@arg	platform	the platform for which to make the add-in.
+ *	@arg	size		the code size.
+ *	@arg	name		the name.
+ *	@arg	internal	the internal name.
+ *	@arg	version		the version of the add-in.
+ *	@arg	created		the creation date of the add-in.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_make_addin(casio_file_t **h,
+	casio_filefor_t platform, size_t size,
+	const char *name, const char *internal,
+	const casio_version_t *version, const time_t *created)
+{
+	int err;
+
+	err = casio_make_addin_head(h, platform, size, name, internal,
+		version, created);
+	if (err) return (err);
+
+	/* allocate the content */
+	(*h)->casio_file_content = casio_alloc(size, 1);
+	if (!(*h)->casio_file_content) {
+		casio_free_file(*h); *h = NULL;
+		return (casio_error_alloc);
+	}
+
+	return (0);
+}
+
+/**
+ *	casio_load_file_content:
+ *	Load the content of a lazily decoded file.
+ *
+ *	Does nothing if the content is already loaded.
+ *
+ *	@arg	handle		the handle.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_load_file_content(casio_file_t *handle)
+{
+	casio_stream_t *stream = handle->casio_file_content_stream;
+	unsigned char *content;
+	ssize_t rd;
+	int err;
+
+	if (!stream)
+		return (0);
+
+	/* Read the content from where it was left. */
+
+	content = casio_alloc(handle->casio_file_size, 1);
+	if (!content)
+		return (casio_error_alloc);
+	err = casio_seek(stream, handle->casio_file_content_offset,
+		CASIO_SEEK_SET);
+	if (err) goto fail;
+	rd = casio_read(stream, content, handle->casio_file_size);
+	if (rd < 0) { err = (int)-rd; goto fail; }
+
+	handle->casio_file_content = content;
+	handle->casio_file_content_stream = NULL;
+	return (0);
+fail:
+	casio_free(content);
+	return (err);
+}
+
 /* ---
  * Free a handle.
  * --- */
@@ -295,6 +365,12 @@ void CASIO_EXPORT casio_free_file(casio_file_t *handle)
 		handle->casio_file_mcs = NULL;
 	}
 
+	/* storage time! */
+	if (handle->casio_file_type & casio_filetype_storage) {
+		casio_close_fs(handle->casio_file_fs);
+		handle->casio_file_fs = NULL;
+	}
+
 	/* messages time! */
 	if (handle->casio_file_type & casio_filetype_lang
 	 && handle->casio_file_messages) {
@@ -0,0 +1,124 @@
+/* ****************************************************************************
+ * fs/builtin/storage/list.c -- get information about storage memory files.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#include "storage.h"
+
+/**
+ *	fill_stat:
+ *	Fill the file information of a node.
+ *
+ *	@arg	node		the node (NULL for the root).
+ *	@arg	stat		the file information to fill.
+ */
+
+CASIO_LOCAL void fill_stat(const storage_node_t *node, casio_stat_t *stat)
+{
+	memset(stat, 0, sizeof(casio_stat_t));
+	stat->casio_stat_flags = 0;
+	if (!node) {
+		stat->casio_stat_type = CASIO_STAT_TYPE_DIR;
+		return ;
+	}
+
+	stat->casio_stat_type = node->storage_node_type;
+	stat->casio_stat_size = node->storage_node_size;
+}
+
+/**
+ *	casio_storage_stat:
+ *	Get information about a storage memory image element.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	path		the native path.
+ *	@arg	stat		the file information to fill.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_storage_stat(storage_cookie_t *cookie,
+	storage_path_t *path, casio_stat_t *stat)
+{
+	int node = path->storage_path_node;
+
+	fill_stat(node < 0 ? NULL : &cookie->storage_nodes[node], stat);
+	return (0);
+}
+
+/**
+ *	casio_storage_list:
+ *	List the elements of a storage memory image directory.
+ *
+ *	The paths given to the callback are relative to the root, as for
+ *	Protocol 7.00 filesystems.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	path		the native path of the directory.
+ *	@arg	callback	the callback to call for each element.
+ *	@arg	cbcookie	the callback cookie.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_storage_list(storage_cookie_t *cookie,
+	storage_path_t *path, casio_fs_list_func_t *callback, void *cbcookie)
+{
+	const storage_node_t *node, *dir = NULL;
+	casio_pathnode_t *dirnode = NULL, *filenode;
+	casio_stat_t stat;
+	size_t i;
+	int parent = path->storage_path_node, err;
+
+	/* Make the directory path node. */
+
+	if (parent >= 0) {
+		dir = &cookie->storage_nodes[parent];
+		if (dir->storage_node_type != CASIO_STAT_TYPE_DIR)
+			return (casio_error_invalid);
+
+		if ((err = casio_make_pathnode(&dirnode, dir->storage_node_namesize)))
+			return (err);
+		memcpy(dirnode->casio_pathnode_name, dir->storage_node_name,
+			dir->storage_node_namesize);
+	}
+
+	/* List the elements. */
+
+	for (i = 0, node = cookie->storage_nodes; i < cookie->storage_nnodes;
+	  i++, node++) {
+		if (!node->storage_node_type || node->storage_node_parent != parent)
+			continue;
+
+		if ((err = casio_make_pathnode(&filenode,
+		  node->storage_node_namesize)))
+			goto end;
+		memcpy(filenode->casio_pathnode_name, node->storage_node_name,
+			node->storage_node_namesize);
+
+		fill_stat(node, &stat);
+		if (dirnode) {
+			dirnode->casio_pathnode_next = filenode;
+			(*callback)(cbcookie, dirnode, &stat);
+			dirnode->casio_pathnode_next = NULL;
+		} else
+			(*callback)(cbcookie, filenode, &stat);
+		casio_free_pathnode(filenode);
+	}
+
+	err = 0;
+end:
+	casio_free_pathnode(dirnode);
+	return (err);
+}
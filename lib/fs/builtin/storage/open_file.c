@@ -0,0 +1,193 @@
+/* ****************************************************************************
+ * fs/builtin/storage/open_file.c -- open a storage memory file.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * The file streams read the fragments from the image when they are read;
+ * as the image stream is shared, its position is set before each read.
+ * ************************************************************************* */
+#include "storage.h"
+
+/* Cookie structure. */
+
+typedef struct {
+	casio_stream_t           *_stream;
+	const storage_fragment_t *_frags;
+	size_t                    _nfrags;
+
+	casio_off_t _size, _offset;
+	size_t      _frag; /* fragment in which the offset is */
+} file_cookie_t;
+
+/**
+ *	file_read:
+ *	Read from a storage memory file.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	dest		the destination buffer.
+ *	@arg	size		the size to read.
+ *	@return				the size if > 0, or if < 0 the error code is -[returned value].
+ */
+
+CASIO_LOCAL ssize_t file_read(file_cookie_t *cookie, unsigned char *dest,
+	size_t size)
+{
+	const storage_fragment_t *frag;
+	size_t left = size, pos, toread;
+	ssize_t rd;
+	int err;
+
+	if (cookie->_offset + (casio_off_t)size > cookie->_size)
+		return -(casio_error_eof);
+
+	while (left) {
+		/* Find the fragment, starting from the current one as reads are
+		 * mostly sequential. */
+
+		while (cookie->_frag
+		 && cookie->_frags[cookie->_frag].storage_fragment_pos
+		  > cookie->_offset)
+			cookie->_frag--;
+		while (cookie->_frag < cookie->_nfrags - 1
+		 && cookie->_frags[cookie->_frag + 1].storage_fragment_pos
+		  <= cookie->_offset)
+			cookie->_frag++;
+		frag = &cookie->_frags[cookie->_frag];
+
+		/* Read what is in this fragment. */
+
+		pos = (size_t)(cookie->_offset - frag->storage_fragment_pos);
+		toread = min(left, frag->storage_fragment_size - pos);
+		err = casio_seek(cookie->_stream,
+			frag->storage_fragment_offset + (casio_off_t)pos, CASIO_SEEK_SET);
+		if (err)
+			return -(err);
+		rd = casio_read(cookie->_stream, dest, toread);
+		if (rd < 0)
+			return (rd);
+
+		dest += toread;
+		left -= toread;
+		cookie->_offset += toread;
+	}
+
+	return ((ssize_t)size);
+}
+
+/**
+ *	file_seek:
+ *	Move within a storage memory file.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	offset		the offset.
+ *	@arg	whence		the whence.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int file_seek(file_cookie_t *cookie, casio_off_t *offset,
+	casio_whence_t whence)
+{
+	casio_off_t off;
+
+	switch (whence) {
+	case CASIO_SEEK_CUR:
+		off = cookie->_offset + *offset;
+		break;
+	case CASIO_SEEK_END:
+		off = cookie->_size - *offset;
+		break;
+	default /* CASIO_SEEK_SET */:
+		off = *offset;
+		break;
+	}
+
+	if (off < 0)
+		off = 0;
+	else if (off > cookie->_size)
+		off = cookie->_size;
+
+	*offset = off;
+	cookie->_offset = off;
+	return (0);
+}
+
+/**
+ *	file_close:
+ *	Close a storage memory file.
+ *
+ *	@arg	cookie		the cookie.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int file_close(file_cookie_t *cookie)
+{
+	casio_free(cookie);
+	return (0);
+}
+
+/* Callbacks. */
+
+CASIO_LOCAL const casio_streamfuncs_t file_callbacks =
+casio_stream_callbacks_for_virtual(file_close,
+	file_read, NULL, file_seek);
+
+/**
+ *	casio_storage_open:
+ *	Open a storage memory file.
+ *
+ *	The filesystem is read-only.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	path		the native path.
+ *	@arg	size		the file size (unused).
+ *	@arg	mode		the open mode.
+ *	@arg	stream		the stream to make.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_storage_open(storage_cookie_t *cookie,
+	storage_path_t *path, casio_off_t size, casio_openmode_t mode,
+	casio_stream_t **stream)
+{
+	const storage_node_t *node;
+	file_cookie_t *fcookie;
+
+	(void)size;
+	if (mode & (CASIO_OPENMODE_WRITE | CASIO_OPENMODE_TRUNC
+	  | CASIO_OPENMODE_APPEND))
+		return (casio_error_op);
+	if (path->storage_path_node < 0)
+		return (casio_error_invalid);
+	node = &cookie->storage_nodes[path->storage_path_node];
+	if (node->storage_node_type != CASIO_STAT_TYPE_REG)
+		return (casio_error_invalid);
+
+	/* Make the cookie. */
+
+	fcookie = casio_alloc(1, sizeof(file_cookie_t));
+	if (!fcookie)
+		return (casio_error_alloc);
+
+	fcookie->_stream = cookie->storage_stream;
+	fcookie->_frags = &cookie->storage_frags[node->storage_node_frag];
+	fcookie->_nfrags = node->storage_node_nfrags;
+	fcookie->_size = node->storage_node_size;
+	fcookie->_offset = 0;
+	fcookie->_frag = 0;
+
+	return (casio_open_stream(stream, CASIO_OPENMODE_READ, fcookie,
+		&file_callbacks, 0));
+}
@@ -0,0 +1,338 @@
+/* ****************************************************************************
+ * fs/builtin/storage/open_fs.c -- open a storage memory image filesystem.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * The entry list is read once when the filesystem is opened, to make an
+ * index of the directories, files and fragments; the file contents are
+ * only read when the files are, fragment by fragment.
+ * ************************************************************************* */
+#include "storage.h"
+
+/* Sector of the index. */
+
+struct sector {
+	casio_uint32_t logical;
+	casio_off_t    offset;
+};
+
+/**
+ *	storage_close:
+ *	Close a storage memory image filesystem.
+ *
+ *	@arg	cookie		the cookie.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int storage_close(storage_cookie_t *cookie)
+{
+	if (cookie->storage_stream_cl)
+		casio_close(cookie->storage_stream);
+	casio_free(cookie->storage_nodes);
+	casio_free(cookie->storage_frags);
+	casio_free(cookie);
+	return (0);
+}
+
+/* Callbacks. */
+
+CASIO_LOCAL casio_fsfuncs_t storage_callbacks = {
+	(casio_fs_close_t*)&storage_close,
+	(casio_fs_makepath_t*)&casio_make_storage_path,
+	(casio_fs_freepath_t*)&casio_free_storage_path,
+	(casio_fs_stat_t*)&casio_storage_stat,
+	NULL, NULL, NULL, NULL,
+	(casio_fs_list_t*)&casio_storage_list,
+	(casio_fs_open_t*)&casio_storage_open,
+	NULL
+};
+
+/**
+ *	set_name:
+ *	Set the name of a node from its FONTCHARACTER-encoded raw name.
+ *
+ *	@arg	node		the node.
+ *	@arg	raw			the raw name (12 big endian characters).
+ */
+
+CASIO_LOCAL void set_name(storage_node_t *node, const unsigned char *raw)
+{
+	unsigned char *name = node->storage_node_name;
+	unsigned int c;
+	int i;
+
+	for (i = 0; i < 12; i++, raw += 2) {
+		c = (raw[0] << 8) | raw[1];
+		if (!c || c == 0xFFFF)
+			break;
+
+		if (c > 0xFF)
+			*name++ = c >> 8;
+		*name++ = c & 0xFF;
+	}
+
+	node->storage_node_namesize = name - node->storage_node_name;
+}
+
+/**
+ *	find_directory:
+ *	Find a directory node using its ID.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	id			the directory ID.
+ *	@return				the node index (-1 if not found).
+ */
+
+CASIO_LOCAL int find_directory(storage_cookie_t *cookie, unsigned int id)
+{
+	size_t i;
+
+	for (i = 0; i < cookie->storage_nnodes; i++)
+		if (cookie->storage_nodes[i].storage_node_type == CASIO_STAT_TYPE_DIR
+		 && cookie->storage_nodes[i].storage_node_id == id)
+			return ((int)i);
+	return (-1);
+}
+
+/**
+ *	make_index:
+ *	Make the index out of the entry list.
+ *
+ *	Sectors come first in the list, then directories, then files, each
+ *	file being followed by its fragments. Entries without the special
+ *	nibble are deleted; fragments are only taken if they follow an
+ *	active file, as their special nibble isn't accurate.
+ *
+ *	@arg	cookie		the cookie, with the index allocated.
+ *	@arg	entries		the entry list.
+ *	@arg	sectors		the sectors to fill.
+ *	@arg	base		the offset of the image in the stream.
+ */
+
+CASIO_LOCAL void make_index(storage_cookie_t *cookie,
+	const casio_storage_entry_t *entries, struct sector *sectors,
+	casio_off_t base)
+{
+	const casio_storage_entry_t *e = entries;
+	storage_node_t *node = NULL;
+	storage_fragment_t *frag;
+	size_t i, s, nsectors = 0;
+	unsigned int type, id;
+
+	for (i = 0; i < STORAGE_ENTRIES; i++, e++) {
+		type = be16toh(e->casio_storage_entry_type);
+		id = be16toh(e->casio_storage_entry_id);
+
+		switch (type & 0xFFF) {
+		case storage_entrytype_sector: {
+			casio_storage_sector_t raw;
+			casio_uint32_t logical;
+
+			memcpy(&raw, e->casio_storage_entry_raw_subheader, sizeof(raw));
+			logical = be32toh(raw.casio_storage_sector_logical_sector_number);
+			if (logical == 0xFFFFFFFF)
+				break;
+
+			/* The start address is a mapped address, remove the
+			 * memory area bits to get the offset in the image. */
+
+			sectors[nsectors].logical = logical;
+			sectors[nsectors].offset = base
+				+ (be32toh(raw.casio_storage_sector_startaddr) & 0x1FFFFFFF);
+			nsectors++;
+			break;
+		}
+
+		case storage_entrytype_directory:
+		case storage_entrytype_file: {
+			casio_storage_file_t raw;
+			unsigned int parent_type;
+
+			node = NULL;
+			if (!id || !(type & 0xF000))
+				break;
+
+			memcpy(&raw, e->casio_storage_entry_raw_subheader, sizeof(raw));
+			parent_type = be16toh(raw.casio_storage_file_parent_type);
+
+			node = &cookie->storage_nodes[cookie->storage_nnodes];
+			node->storage_node_type = (type & 0xFFF)
+				== storage_entrytype_directory
+				? CASIO_STAT_TYPE_DIR : CASIO_STAT_TYPE_REG;
+			node->storage_node_id = id;
+			node->storage_node_parent = -1;
+			node->storage_node_filetype = 0;
+			node->storage_node_size = 0;
+			node->storage_node_frag = cookie->storage_nfrags;
+			node->storage_node_nfrags = 0;
+			set_name(node, &e->casio_storage_entry_raw_subheader[
+				offsetof(casio_storage_file_t, casio_storage_file_name)]);
+
+			if (node->storage_node_type == CASIO_STAT_TYPE_REG
+			 && (parent_type & 0xFFF) == storage_entrytype_directory)
+				node->storage_node_parent = find_directory(cookie,
+					be16toh(raw.casio_storage_file_parent_id));
+
+			cookie->storage_nnodes++;
+			if (node->storage_node_type == CASIO_STAT_TYPE_DIR)
+				node = NULL;
+			break;
+		}
+
+		case storage_entrytype_fragment: {
+			casio_storage_fragment_t raw;
+			size_t offset, size;
+
+			if (!node)
+				break;
+
+			memcpy(&raw, e->casio_storage_entry_raw_subheader, sizeof(raw));
+			if (be16toh(raw.casio_storage_fragment_parent_id)
+			 != node->storage_node_id)
+				break;
+
+			/* Find the sector the bytes are in. */
+
+			offset = be16toh(raw.casio_storage_fragment_data_offset);
+			size = be16toh(raw.casio_storage_fragment_data_length);
+			for (s = 0; s < nsectors && sectors[s].logical
+			  != be16toh(raw.casio_storage_fragment_sector_id); s++);
+			if (s == nsectors || offset + size > STORAGE_SECTOR) {
+				msg((ll_warn, "Fragment of '%.*s' is out of the storage "
+					"memory, ignoring the file.",
+					(int)node->storage_node_namesize,
+					node->storage_node_name));
+				node->storage_node_type = 0;
+				node = NULL;
+				break;
+			}
+
+			/* Add the fragment. */
+
+			if (!node->storage_node_nfrags)
+				node->storage_node_filetype =
+					be16toh(raw.casio_storage_fragment_file_type);
+
+			frag = &cookie->storage_frags[cookie->storage_nfrags++];
+			frag->storage_fragment_offset = sectors[s].offset + offset;
+			frag->storage_fragment_pos = node->storage_node_size;
+			frag->storage_fragment_size = size;
+			node->storage_node_size += size;
+			node->storage_node_nfrags++;
+			break;
+		}
+		}
+	}
+}
+
+/**
+ *	casio_open_storage_fs:
+ *	Open a storage memory image filesystem.
+ *
+ *	The image starts at the current position in the stream, which must
+ *	be seekable, and stay opened while the filesystem is used; if the
+ *	filesystem should close it, it is closed even if the opening fails.
+ *
+ *	@arg	fs			the filesystem to open.
+ *	@arg	stream		the stream to read the image from.
+ *	@arg	stream_cl	should we close the stream?
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_open_storage_fs(casio_fs_t **fs,
+	casio_stream_t *stream, int stream_cl)
+{
+	storage_cookie_t *cookie = NULL;
+	casio_storage_entry_t *entries = NULL;
+	struct sector *sectors = NULL;
+	size_t i, nsectors = 0, nnodes = 0, nfrags = 0;
+	casio_off_t base;
+	ssize_t rd;
+	int err;
+
+	if (!casio_isseekable(stream)) {
+		msg((ll_error, "The storage memory image should be seekable."));
+		err = casio_error_op;
+		goto fail;
+	}
+
+	/* Read the entry list. */
+
+	err = casio_error_alloc;
+	entries = casio_alloc(STORAGE_ENTRIES, sizeof(casio_storage_entry_t));
+	if (!entries)
+		goto fail;
+
+	base = casio_tell(stream);
+	if ((err = casio_seek(stream, base + STORAGE_OFFSET, CASIO_SEEK_SET)))
+		goto fail;
+	rd = casio_read(stream, entries, STORAGE_SECTOR);
+	if (rd < 0) {
+		err = (int)-rd;
+		goto fail;
+	}
+
+	/* Count the entries to allocate the index. */
+
+	for (i = 0; i < STORAGE_ENTRIES; i++)
+		switch (be16toh(entries[i].casio_storage_entry_type) & 0xFFF) {
+		case storage_entrytype_sector:
+			nsectors++;
+			break;
+		case storage_entrytype_directory:
+		case storage_entrytype_file:
+			nnodes++;
+			break;
+		case storage_entrytype_fragment:
+			nfrags++;
+			break;
+		}
+
+	err = casio_error_alloc;
+	if (!(sectors = casio_alloc(nsectors + 1, sizeof(struct sector)))
+	 || !(cookie = casio_alloc(1, sizeof(storage_cookie_t))))
+		goto fail;
+
+	cookie->storage_stream = stream;
+	cookie->storage_stream_cl = stream_cl;
+	cookie->storage_nnodes = 0;
+	cookie->storage_nfrags = 0;
+	cookie->storage_nodes = casio_alloc(nnodes + 1, sizeof(storage_node_t));
+	cookie->storage_frags = casio_alloc(nfrags + 1,
+		sizeof(storage_fragment_t));
+	if (!cookie->storage_nodes || !cookie->storage_frags)
+		goto fail;
+
+	/* Make the index. */
+
+	make_index(cookie, entries, sectors, base);
+	msg((ll_info, "Storage memory has %lu node(s) and %lu fragment(s).",
+		(unsigned long)cookie->storage_nnodes,
+		(unsigned long)cookie->storage_nfrags));
+
+	casio_free(entries);
+	casio_free(sectors);
+	return (casio_open_fs(fs, cookie, &storage_callbacks));
+
+fail:
+	if (cookie)
+		storage_close(cookie);
+	else if (stream_cl)
+		casio_close(stream);
+	casio_free(sectors);
+	casio_free(entries);
+	return (err);
+}
@@ -0,0 +1,103 @@
+/* ****************************************************************************
+ * fs/builtin/storage/storage.h -- storage memory image filesystem.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#ifndef  LOCAL_FS_BUILTIN_STORAGE_H
+# define LOCAL_FS_BUILTIN_STORAGE_H 1
+# include "../../../internals.h"
+# include <libcasio/format/storage.h>
+
+/* Offset of the storage memory in the image, size of a sector, and
+ * maximum number of entries in the entry list (which occupies the
+ * first sector). */
+
+# define STORAGE_OFFSET  0x270000
+# define STORAGE_SECTOR  0x10000
+# define STORAGE_ENTRIES (STORAGE_SECTOR / sizeof(casio_storage_entry_t))
+
+/* Fragment of a file: where its bytes are in the image, and where they
+ * are in the file. */
+
+typedef struct {
+	casio_off_t    storage_fragment_offset;
+	casio_off_t    storage_fragment_pos;
+	size_t         storage_fragment_size;
+} storage_fragment_t;
+
+/* Node (directory or file) of the index. Directories can only be at the
+ * root, files are either at the root or in a directory.
+ * The name is the FONTCHARACTER-encoded name, with the multi-byte
+ * characters on two bytes. */
+
+typedef struct {
+	unsigned int   storage_node_type; /* 0 if broken */
+	unsigned int   storage_node_id;
+	int            storage_node_parent; /* -1 if at the root */
+	unsigned int   storage_node_filetype;
+
+	size_t         storage_node_namesize;
+	unsigned char  storage_node_name[24];
+
+	/* file data */
+	casio_off_t    storage_node_size;
+	size_t         storage_node_frag;
+	size_t         storage_node_nfrags;
+} storage_node_t;
+
+/* The cookie is the index, made when the filesystem is opened. */
+
+typedef struct {
+	casio_stream_t     *storage_stream;
+	int                 storage_stream_cl;
+
+	size_t              storage_nnodes;
+	storage_node_t     *storage_nodes;
+	size_t              storage_nfrags;
+	storage_fragment_t *storage_frags;
+} storage_cookie_t;
+
+/* The native path is the index of the node (-1 for the root). */
+
+typedef struct {
+	int storage_path_node;
+} storage_path_t;
+
+/* Path conversions. */
+
+CASIO_EXTERN int  CASIO_EXPORT casio_make_storage_path
+	OF((storage_cookie_t *casio__cookie, storage_path_t **casio__path,
+		casio_path_t *casio__array));
+CASIO_EXTERN void CASIO_EXPORT casio_free_storage_path
+	OF((storage_cookie_t *casio__cookie, storage_path_t *casio__path));
+
+/* File information gathering and listing. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_storage_stat
+	OF((storage_cookie_t *casio__cookie, storage_path_t *casio__path,
+		casio_stat_t *casio__stat));
+CASIO_EXTERN int CASIO_EXPORT casio_storage_list
+	OF((storage_cookie_t *casio__cookie, storage_path_t *casio__path,
+		casio_fs_list_func_t *casio__callback, void *casio__cbcookie));
+
+/* Open a file. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_storage_open
+	OF((storage_cookie_t *casio__cookie, storage_path_t *casio__path,
+		casio_off_t casio__size, casio_openmode_t casio__mode,
+		casio_stream_t **casio__stream));
+
+#endif /* LOCAL_FS_BUILTIN_STORAGE_H */
@@ -0,0 +1,106 @@
+/* ****************************************************************************
+ * fs/builtin/storage/topath.c -- make a storage memory image native path.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#include "storage.h"
+
+/**
+ *	find_node:
+ *	Find a node in a directory using its name.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	parent		the parent directory (-1 for the root).
+ *	@arg	pathnode	the path node with the name.
+ *	@return				the node index (-1 if not found).
+ */
+
+CASIO_LOCAL int find_node(storage_cookie_t *cookie, int parent,
+	const casio_pathnode_t *pathnode)
+{
+	const storage_node_t *node = cookie->storage_nodes;
+	size_t i;
+
+	for (i = 0; i < cookie->storage_nnodes; i++, node++)
+		if (node->storage_node_type && node->storage_node_parent == parent
+		 && node->storage_node_namesize == pathnode->casio_pathnode_size
+		 && !memcmp(node->storage_node_name, pathnode->casio_pathnode_name,
+		  pathnode->casio_pathnode_size))
+			return ((int)i);
+	return (-1);
+}
+
+/**
+ *	casio_make_storage_path:
+ *	Make a storage memory image native path.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	ppath		the path to make.
+ *	@arg	array		the path array.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_make_storage_path(storage_cookie_t *cookie,
+	storage_path_t **ppath, casio_path_t *array)
+{
+	const casio_pathnode_t *pathnode = array->casio_path_nodes;
+	int node = -1;
+
+	/* Check the device. */
+
+	if (array->casio_path_device
+	 && strcmp(array->casio_path_device, "fls0"))
+		return (casio_error_invalid);
+
+	/* Find the node (directories can only be at the root). */
+
+	if (pathnode) {
+		node = find_node(cookie, -1, pathnode);
+		pathnode = pathnode->casio_pathnode_next;
+		if (node >= 0 && pathnode) {
+			if (cookie->storage_nodes[node].storage_node_type
+			 != CASIO_STAT_TYPE_DIR || pathnode->casio_pathnode_next)
+				return (casio_error_invalid);
+			node = find_node(cookie, node, pathnode);
+		}
+
+		if (node < 0)
+			return (casio_error_notfound);
+	}
+
+	/* Make the path. */
+
+	*ppath = casio_alloc(1, sizeof(storage_path_t));
+	if (!*ppath)
+		return (casio_error_alloc);
+	(*ppath)->storage_path_node = node;
+	return (0);
+}
+
+/**
+ *	casio_free_storage_path:
+ *	Free a storage memory image native path.
+ *
+ *	@arg	cookie		the cookie (unused).
+ *	@arg	path		the native path.
+ */
+
+void CASIO_EXPORT casio_free_storage_path(storage_cookie_t *cookie,
+	storage_path_t *path)
+{
+	(void)cookie;
+	casio_free(path);
+}
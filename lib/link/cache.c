@@ -0,0 +1,401 @@
+/* ****************************************************************************
+ * link/cache.c -- device information cache.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * The device information (the extended ack data the calculator answers
+ * with when discovering its environment) is cached in a text file, with
+ * one line per device:
+ *
+ *		<key> <timestamp> <identity> <raw information, in hexadecimal>
+ *
+ * The identity is what the link opener could learn about the device without
+ * asking it anything (e.g. its model), or `-` if it couldn't; an entry of
+ * which the identity doesn't match the one of the connected device is
+ * removed, as the key now designates another device.
+ *
+ * An entry is only used if it is well-formed and not older than
+ * `MAX_AGE` seconds, as the information changes when the OS is updated
+ * and the protocol has no cheaper request to check the OS version with;
+ * otherwise, the discovery is made normally and the entry is replaced.
+ * ************************************************************************* */
+#include "link.h"
+#include <time.h>
+
+#define MAX_AGE   (7 * 24 * 60 * 60)
+#define LINE_SIZE (CACHE_KEY_SIZE + CACHE_IDENT_SIZE + 24 \
+	+ 2 * RAW_INFO_SIZE)
+
+CASIO_LOCAL casio_mutex_t cache_lock = 0;
+CASIO_LOCAL char *cache_path = NULL;
+
+/**
+ *	casio_set_link_cache:
+ *	Set the file in which the device information is cached.
+ *
+ *	@arg	path		the path to the file (NULL to disable the cache).
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_set_link_cache(const char *path)
+{
+	char *new_path = NULL;
+	int err;
+
+#ifdef LIBCASIO_DISABLED_FILE
+	if (path)
+		return (casio_error_op);
+#endif
+	if (path) {
+		size_t len = strlen(path) + 1;
+
+		if (!(new_path = casio_alloc(len, 1)))
+			return (casio_error_alloc);
+		memcpy(new_path, path, len);
+	}
+
+	if ((err = casio_lock(&cache_lock))) {
+		casio_free(new_path);
+		return (err);
+	}
+
+	casio_free(cache_path);
+	cache_path = new_path;
+	casio_unlock(&cache_lock);
+	return (0);
+}
+
+#ifndef LIBCASIO_DISABLED_FILE
+
+/* ---
+ * Utilities.
+ * --- */
+
+/**
+ *	read_line:
+ *	Read a line from the cache file, skipping what doesn't fit.
+ *
+ *	@arg	file		the cache file.
+ *	@arg	line		the line buffer, of `LINE_SIZE` bytes.
+ *	@return				if a line was read.
+ */
+
+CASIO_LOCAL int read_line(FILE *file, char *line)
+{
+	int c;
+
+	if (!fgets(line, LINE_SIZE, file))
+		return (0);
+	if (!strchr(line, '\n'))
+		while ((c = fgetc(file)) != EOF && c != '\n');
+	return (1);
+}
+
+/**
+ *	parse_line:
+ *	Parse a line from the cache file.
+ *
+ *	@arg	line		the line (modified).
+ *	@arg	key			the key to get.
+ *	@arg	ident		the identity to get.
+ *	@arg	hex			the raw information in hexadecimal to get.
+ *	@return				if the line is valid and not too old.
+ */
+
+CASIO_LOCAL int parse_line(char *line, const char **key, const char **ident,
+	const char **hex)
+{
+	char *time_field, *ident_field, *data, *end;
+	unsigned long timestamp, now = (unsigned long)time(NULL);
+	int i;
+
+	/* Split the fields. */
+
+	if (!(time_field = strchr(line, ' ')))
+		return (0);
+	*time_field++ = '\0';
+	if (!(ident_field = strchr(time_field, ' ')))
+		return (0);
+	*ident_field++ = '\0';
+	if (!(data = strchr(ident_field, ' ')))
+		return (0);
+	*data++ = '\0';
+
+	/* Check the timestamp. */
+
+	timestamp = strtoul(time_field, &end, 10);
+	if (*end || timestamp > now || now - timestamp > MAX_AGE)
+		return (0);
+
+	/* Check the raw information. */
+
+	for (i = 0; i < 2 * RAW_INFO_SIZE; i++)
+		if (!isxdigit((unsigned char)data[i]))
+			return (0);
+	if (data[i] != '\n' && data[i] != '\0')
+		return (0);
+
+	*key = line;
+	*ident = ident_field;
+	*hex = data;
+	return (1);
+}
+
+/**
+ *	decode_hex:
+ *	Decode the raw information from hexadecimal.
+ *
+ *	@arg	raw			the raw information to get.
+ *	@arg	hex			the raw information in hexadecimal.
+ */
+
+CASIO_LOCAL void decode_hex(unsigned char *raw, const char *hex)
+{
+	int i;
+
+	for (i = 0; i < RAW_INFO_SIZE; i++, hex += 2) {
+		char byte[3];
+
+		byte[0] = hex[0];
+		byte[1] = hex[1];
+		byte[2] = '\0';
+		raw[i] = (unsigned char)strtoul(byte, NULL, 16);
+	}
+}
+
+/**
+ *	valid_field:
+ *	Check if a key or an identity can be used in the cache file.
+ *
+ *	@arg	field		the key or identity.
+ *	@arg	size		the maximum size.
+ *	@return				if the field is valid.
+ */
+
+CASIO_LOCAL int valid_field(const char *field, size_t size)
+{
+	size_t len = 0;
+
+	for (; field[len]; len++)
+		if (isspace((unsigned char)field[len]))
+			return (0);
+	return (len && len <= size);
+}
+
+/**
+ *	rewrite:
+ *	Write the cache file again without the entry for a device and the
+ *	invalid entries, then with the new entry for the device, if any.
+ *	The cache lock must be held.
+ *
+ *	@arg	key			the device key.
+ *	@arg	ident		the device identity.
+ *	@arg	raw			the raw information (NULL to only remove the entry).
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int rewrite(const char *key, const char *ident,
+	const unsigned char *raw)
+{
+	char line[LINE_SIZE], copy[LINE_SIZE], *tmp_path = NULL;
+	const char *line_key, *line_ident, *hex;
+	FILE *old = NULL, *new = NULL;
+	size_t len;
+	int i, err;
+
+	/* Open the new file. */
+
+	err = casio_error_alloc;
+	len = strlen(cache_path);
+	if (!(tmp_path = casio_alloc(len + 5, 1)))
+		goto end;
+	memcpy(tmp_path, cache_path, len);
+	memcpy(&tmp_path[len], ".tmp", 5);
+
+	err = casio_error_write;
+	if (!(new = fopen(tmp_path, "w")))
+		goto end;
+
+	/* Copy the other valid entries. */
+
+	if ((old = fopen(cache_path, "r"))) {
+		while (read_line(old, line)) {
+			memcpy(copy, line, LINE_SIZE);
+			if (!parse_line(line, &line_key, &line_ident, &hex)
+			 || !strcmp(line_key, key))
+				continue;
+			if (fputs(copy, new) < 0
+			 || (!strchr(copy, '\n') && fputc('\n', new) == EOF))
+				goto end;
+		}
+	}
+
+	/* Add the new entry. */
+
+	if (raw) {
+		fprintf(new, "%s %lu %s ", key, (unsigned long)time(NULL), ident);
+		for (i = 0; i < RAW_INFO_SIZE; i++)
+			fprintf(new, "%02X", raw[i]);
+		if (fputc('\n', new) == EOF)
+			goto end;
+	}
+
+	/* Replace the old file. */
+
+	if (old) {
+		fclose(old);
+		old = NULL;
+	}
+	i = fclose(new);
+	new = NULL;
+	if (i)
+		goto end;
+	if (rename(tmp_path, cache_path)) {
+		/* On some platforms, we can't rename over an existing file. */
+
+		remove(cache_path);
+		if (rename(tmp_path, cache_path))
+			goto end;
+	}
+
+	err = 0;
+end:
+	if (old)
+		fclose(old);
+	if (new)
+		fclose(new);
+	if (err && tmp_path)
+		remove(tmp_path);
+	casio_free(tmp_path);
+	return (err);
+}
+
+/* ---
+ * Cache access.
+ * --- */
+
+/**
+ *	casio_get_cached_info:
+ *	Get the raw information of a device from the cache.
+ *
+ *	If the entry for the device has another identity, it is removed.
+ *
+ *	@arg	key			the device key.
+ *	@arg	ident		the device identity (NULL if unknown).
+ *	@arg	raw			the raw information to get.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_get_cached_info(const char *key, const char *ident,
+	unsigned char *raw)
+{
+	char line[LINE_SIZE];
+	const char *line_key, *line_ident, *hex;
+	FILE *file;
+	int err, other = 0;
+
+	if (!ident || !*ident)
+		ident = "-";
+	if (!valid_field(key, CACHE_KEY_SIZE)
+	 || !valid_field(ident, CACHE_IDENT_SIZE))
+		return (casio_error_op);
+	if ((err = casio_lock(&cache_lock)))
+		return (err);
+
+	err = casio_error_op;
+	if (!cache_path)
+		goto end;
+
+	err = casio_error_notfound;
+	if (!(file = fopen(cache_path, "r")))
+		goto end;
+
+	while (read_line(file, line)) {
+		if (!parse_line(line, &line_key, &line_ident, &hex)
+		 || strcmp(line_key, key))
+			continue;
+
+		if (strcmp(line_ident, ident))
+			other = 1;
+		else {
+			decode_hex(raw, hex);
+			err = 0;
+		}
+		break;
+	}
+
+	fclose(file);
+	if (other) {
+		msg((ll_info, "Cached information is for another device."));
+		rewrite(key, ident, NULL);
+	}
+end:
+	casio_unlock(&cache_lock);
+	return (err);
+}
+
+/**
+ *	casio_put_cached_info:
+ *	Put the raw information of a device into the cache.
+ *
+ *	The cache file is written again without the old entry for the device
+ *	and the invalid entries, then with the new entry.
+ *
+ *	@arg	key			the device key.
+ *	@arg	ident		the device identity (NULL if unknown).
+ *	@arg	raw			the raw information.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_put_cached_info(const char *key, const char *ident,
+	const unsigned char *raw)
+{
+	int err;
+
+	if (!ident || !*ident)
+		ident = "-";
+	if (!valid_field(key, CACHE_KEY_SIZE)
+	 || !valid_field(ident, CACHE_IDENT_SIZE))
+		return (casio_error_op);
+	if ((err = casio_lock(&cache_lock)))
+		return (err);
+
+	err = cache_path ? rewrite(key, ident, raw) : casio_error_op;
+	casio_unlock(&cache_lock);
+	return (err);
+}
+
+#else
+
+int CASIO_EXPORT casio_get_cached_info(const char *key, const char *ident,
+	unsigned char *raw)
+{
+	(void)key;
+	(void)ident;
+	(void)raw;
+	return (casio_error_op);
+}
+
+int CASIO_EXPORT casio_put_cached_info(const char *key, const char *ident,
+	const unsigned char *raw)
+{
+	(void)key;
+	(void)ident;
+	(void)raw;
+	return (casio_error_op);
+}
+
+#endif
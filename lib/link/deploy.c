@@ -0,0 +1,547 @@
+/* ****************************************************************************
+ * link/deploy.c -- run a job on every connected calculator.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * The USB streams are opened one after the other by the calling thread, as
+ * this only involves the host; then each worker initializes its link, runs
+ * the job and closes the link, which are the parts where we wait for the
+ * calculator. When no threads are available, the workers are run one
+ * after the other.
+ * ************************************************************************* */
+#include "link.h"
+
+#if defined(__unix__) || defined(__unix) \
+ || (defined(__APPLE__) && defined(__MACH__))
+# include <unistd.h>
+#endif
+
+#if defined(_POSIX_THREADS) && _POSIX_THREADS > 0
+# define USE_PTHREAD 1
+# include <pthread.h>
+#elif !defined(LIBCASIO_DISABLED_WINDOWS)
+# define USE_WINTHREAD 1
+# include <windows.h>
+#endif
+
+/* Maximum number of calculators we deploy on at once. */
+
+#define MAX_TARGETS 128
+
+/* Worker structure. */
+
+typedef struct {
+	casio_stream_t        *_stream;
+	unsigned long          _flags;
+	casio_deploy_job_t    *_job;
+	void                  *_cookie;
+	casio_deploy_result_t *_result;
+
+#if defined(USE_PTHREAD)
+	pthread_t              _thread;
+#elif defined(USE_WINTHREAD)
+	HANDLE                 _thread;
+#endif
+	int                    _started;
+} worker_t;
+
+/* ---
+ * Targets listing.
+ * --- */
+
+/* Targets list. */
+
+typedef struct {
+	int _count;
+	struct {
+		int _bus, _address;
+	} _targets[MAX_TARGETS];
+} targets_t;
+
+#ifndef LIBCASIO_DISABLED_LIBUSB
+/**
+ *	add_target:
+ *	Add a calculator to the targets list.
+ *
+ *	@arg	cookie		the targets list.
+ *	@arg	bus			the bus number.
+ *	@arg	address		the address on the bus.
+ *	@arg	serial		the serial number (unused).
+ */
+
+CASIO_LOCAL void add_target(targets_t *cookie, int bus, int address,
+	const char *serial)
+{
+	(void)serial;
+
+	if (cookie->_count >= MAX_TARGETS)
+		return ;
+	cookie->_targets[cookie->_count]._bus = bus;
+	cookie->_targets[cookie->_count]._address = address;
+	cookie->_count++;
+}
+#endif
+
+/**
+ *	list_targets:
+ *	List the calculators to deploy on.
+ *
+ *	@arg	targets		the targets list to fill.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int list_targets(targets_t *targets)
+{
+	targets->_count = 0;
+
+#ifndef LIBCASIO_DISABLED_LIBUSB
+	{
+		int err = casio_list_libusb((casio_list_libusb_t*)&add_target,
+			targets);
+
+		if (err)
+			return (err);
+	}
+#else
+	/* We can't list the calculators, so let's just take the first one
+	 * we can find. */
+
+	targets->_targets[0]._bus = -1;
+	targets->_targets[0]._address = -1;
+	targets->_count = 1;
+#endif
+
+	return (targets->_count ? 0 : casio_error_nocalc);
+}
+
+/* ---
+ * Workers.
+ * --- */
+
+/**
+ *	run_worker:
+ *	Initialize the link, run the job on it and close it.
+ *
+ *	@arg	worker		the worker.
+ */
+
+CASIO_LOCAL void run_worker(worker_t *worker)
+{
+	casio_deploy_result_t *result = worker->_result;
+	casio_stream_t *stream = worker->_stream, *ns;
+	casio_link_t *handle = NULL;
+	unsigned long start = casio_clock();
+	int err;
+
+	/* Open the SCSI device stream if required. */
+
+	switch ((err = casio_open_seven_scsi(&ns, stream))) {
+	case 0:
+		stream = ns;
+		break;
+
+	case casio_error_op:
+		break;
+
+	default:
+		casio_close(stream);
+		goto end;
+	}
+
+	/* Open the link, run the job, and close the link. */
+
+	err = casio_open_link(&handle, worker->_flags, stream, NULL);
+	if (!err) {
+		err = (*worker->_job)(worker->_cookie, handle, result);
+		casio_close_link(handle);
+	}
+
+end:
+	result->casio_deploy_result_error = err;
+	result->casio_deploy_result_time = casio_clock() - start;
+}
+
+#if defined(USE_PTHREAD)
+CASIO_LOCAL void *worker_thread(void *worker)
+{
+	run_worker((worker_t *)worker);
+	return (NULL);
+}
+#elif defined(USE_WINTHREAD)
+CASIO_LOCAL DWORD WINAPI worker_thread(LPVOID worker)
+{
+	run_worker((worker_t *)worker);
+	return (0);
+}
+#endif
+
+/**
+ *	start_worker:
+ *	Start a worker in its own thread, if possible.
+ *
+ *	@arg	worker		the worker.
+ */
+
+CASIO_LOCAL void start_worker(worker_t *worker)
+{
+#if defined(USE_PTHREAD)
+	if (!pthread_create(&worker->_thread, NULL, &worker_thread, worker)) {
+		worker->_started = 1;
+		return ;
+	}
+#elif defined(USE_WINTHREAD)
+	worker->_thread = CreateThread(NULL, 0, &worker_thread, worker, 0, NULL);
+	if (worker->_thread) {
+		worker->_started = 1;
+		return ;
+	}
+#endif
+
+	/* No thread, run the worker here. */
+
+	run_worker(worker);
+}
+
+/**
+ *	join_worker:
+ *	Wait for a worker to finish.
+ *
+ *	@arg	worker		the worker.
+ */
+
+CASIO_LOCAL void join_worker(worker_t *worker)
+{
+	if (!worker->_started)
+		return ;
+
+#if defined(USE_PTHREAD)
+	pthread_join(worker->_thread, NULL);
+#elif defined(USE_WINTHREAD)
+	WaitForSingleObject(worker->_thread, INFINITE);
+	CloseHandle(worker->_thread);
+#endif
+	worker->_started = 0;
+}
+
+/* ---
+ * Main functions.
+ * --- */
+
+/**
+ *	casio_deploy:
+ *	Run a job on every connected calculator.
+ *
+ *	@arg	reportp		the report to make.
+ *	@arg	flags		the link flags.
+ *	@arg	job			the job to run.
+ *	@arg	cookie		the cookie to pass to the job.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_deploy(casio_deploy_report_t **reportp,
+	unsigned long flags, casio_deploy_job_t *job, void *cookie)
+{
+	casio_deploy_report_t *report;
+	casio_deploy_result_t *results;
+	worker_t *workers;
+	targets_t targets;
+	unsigned long start = casio_clock();
+	int err, i;
+
+	*reportp = NULL;
+
+	/* List the calculators. */
+
+	msg((ll_info, "Looking for USB-connected calculators."));
+	if ((err = list_targets(&targets)))
+		return (err);
+	msg((ll_info, "Deploying on %d calculator(s).", targets._count));
+
+	/* Allocate the report and the workers. */
+
+	report = casio_alloc(1, sizeof(casio_deploy_report_t)
+		+ targets._count * sizeof(casio_deploy_result_t));
+	if (!report)
+		return (casio_error_alloc);
+	workers = casio_alloc(targets._count, sizeof(worker_t));
+	if (!workers) {
+		casio_free(report);
+		return (casio_error_alloc);
+	}
+
+	results = (casio_deploy_result_t *)&report[1];
+	report->casio_deploy_report_count = targets._count;
+	report->casio_deploy_report_failed = 0;
+	report->casio_deploy_report_skipped = 0;
+	report->casio_deploy_report_size = 0;
+	report->casio_deploy_report_results = results;
+
+	/* Open the streams and start the workers. */
+
+	for (i = 0; i < targets._count; i++) {
+		worker_t *worker = &workers[i];
+		casio_deploy_result_t *result = &results[i];
+
+		result->casio_deploy_result_bus = targets._targets[i]._bus;
+		result->casio_deploy_result_address = targets._targets[i]._address;
+		result->casio_deploy_result_size = 0;
+		result->casio_deploy_result_time = 0;
+		result->casio_deploy_result_skipped = 0;
+
+		worker->_flags = flags;
+		worker->_job = job;
+		worker->_cookie = cookie;
+		worker->_result = result;
+		worker->_started = 0;
+
+		err = casio_open_usb_stream(&worker->_stream,
+			targets._targets[i]._bus, targets._targets[i]._address);
+		if (err == casio_error_op)
+			err = casio_error_nocalc;
+		if (err) {
+			msg((ll_error, "Could not open the calculator on bus %d, "
+				"address %d.", result->casio_deploy_result_bus,
+				result->casio_deploy_result_address));
+			result->casio_deploy_result_error = err;
+			continue;
+		}
+
+		start_worker(worker);
+	}
+
+	/* Wait for the workers and aggregate the results. */
+
+	for (i = 0; i < targets._count; i++) {
+		join_worker(&workers[i]);
+
+		if (results[i].casio_deploy_result_error)
+			report->casio_deploy_report_failed++;
+		report->casio_deploy_report_size +=
+			results[i].casio_deploy_result_size;
+		report->casio_deploy_report_skipped +=
+			results[i].casio_deploy_result_skipped;
+	}
+
+	report->casio_deploy_report_time = casio_clock() - start;
+	casio_free(workers);
+
+	*reportp = report;
+	return (0);
+}
+
+/**
+ *	casio_free_deploy_report:
+ *	Free a deployment report.
+ *
+ *	@arg	report		the report to free.
+ */
+
+void CASIO_EXPORT casio_free_deploy_report(casio_deploy_report_t *report)
+{
+	casio_free(report);
+}
+
+/* ---
+ * Built-in jobs.
+ * --- */
+
+/**
+ *	make_path:
+ *	Make the path to a file.
+ *
+ *	@arg	path		the path to make.
+ *	@arg	file		the file.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int make_path(casio_path_t *path, const casio_deploy_file_t *file)
+{
+	casio_pathnode_t **node = &path->casio_path_nodes;
+	const char *names[2];
+	int i, err;
+
+	path->casio_path_flags = casio_pathflag_rel;
+	path->casio_path_device = file->casio_deploy_file_device;
+	path->casio_path_nodes = NULL;
+
+	names[0] = file->casio_deploy_file_dirname;
+	names[1] = file->casio_deploy_file_filename;
+	for (i = 0; i < 2; i++) {
+		size_t len;
+
+		if (!names[i] || !(len = strlen(names[i])))
+			continue;
+		if ((err = casio_make_pathnode(node, len)))
+			return (err);
+		memcpy((*node)->casio_pathnode_name, names[i], len);
+		node = &(*node)->casio_pathnode_next;
+	}
+
+	return (0);
+}
+
+/**
+ *	free_path:
+ *	Free the nodes of a path.
+ *
+ *	@arg	path		the path.
+ */
+
+CASIO_LOCAL void free_path(casio_path_t *path)
+{
+	casio_pathnode_t *node = path->casio_path_nodes, *next;
+
+	for (; node; node = next) {
+		next = node->casio_pathnode_next;
+		casio_free_pathnode(node);
+	}
+	path->casio_path_nodes = NULL;
+}
+
+/**
+ *	send_file:
+ *	Send a file on a calculator.
+ *
+ *	@arg	fs			the Protocol 7.00 filesystem.
+ *	@arg	file		the file to send.
+ *	@arg	flags		the deployment flags.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int send_file(casio_fs_t *fs, const casio_deploy_file_t *file,
+	unsigned int flags)
+{
+	casio_path_t path;
+	casio_stream_t *stream = NULL;
+	const unsigned char *data = file->casio_deploy_file_data;
+	size_t size = file->casio_deploy_file_size;
+	int err;
+
+	if (!size)
+		return (casio_error_empty);
+	if ((err = make_path(&path, file)))
+		goto end;
+
+	/* Optimize the storage if there isn't enough space. */
+
+	if (flags & CASIO_DEPLOY_OPTIMIZE) {
+		size_t capacity;
+
+		if ((err = casio_getfreemem(fs, &path, &capacity)))
+			goto end;
+		if (size > capacity
+		 && (err = casio_optimize(fs, file->casio_deploy_file_device)))
+			goto end;
+	}
+
+	/* Open the file and send the data. */
+
+	err = casio_open(fs, &stream, &path, size, CASIO_OPENMODE_WRITE
+		| (flags & CASIO_DEPLOY_OW ? CASIO_OPENMODE_OW : 0));
+	if (err)
+		goto end;
+
+	while (size) {
+		size_t tosend = size;
+		ssize_t ssize;
+
+		if (tosend > CASIO_SEVEN_MAX_RAWDATA_SIZE)
+			tosend = CASIO_SEVEN_MAX_RAWDATA_SIZE;
+		ssize = casio_write(stream, data, tosend);
+		if (ssize < 0) {
+			err = (int)-ssize;
+			goto end;
+		}
+
+		data += tosend;
+		size -= tosend;
+	}
+
+end:
+	if (stream)
+		casio_close(stream);
+	free_path(&path);
+	return (err);
+}
+
+/**
+ *	casio_deploy_send:
+ *	Send files on a calculator.
+ *
+ *	@arg	cookie		the files to send.
+ *	@arg	handle		the link handle.
+ *	@arg	result		the result to fill.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_deploy_send(void *cookie, casio_link_t *handle,
+	casio_deploy_result_t *result)
+{
+	const casio_deploy_files_t *files = cookie;
+	const casio_deploy_file_t *file;
+	casio_fs_t *fs;
+	int i, err = 0;
+
+	if ((err = casio_open_seven_fs(&fs, handle)))
+		return (err);
+
+	file = files->casio_deploy_files_files;
+	for (i = 0; i < files->casio_deploy_files_count; i++, file++) {
+		err = send_file(fs, file, files->casio_deploy_files_flags);
+		if (err == casio_error_noow) {
+			/* The file already exists and we didn't want to
+			 * overwrite it, so let's go on with the others. */
+
+			msg((ll_info, "'%s' already exists, skipping it.",
+				file->casio_deploy_file_filename));
+			result->casio_deploy_result_skipped++;
+			err = 0;
+			continue;
+		}
+		if (err)
+			break;
+
+		result->casio_deploy_result_size += file->casio_deploy_file_size;
+	}
+
+	casio_close_fs(fs);
+	return (err);
+}
+
+/**
+ *	casio_deploy_optimize:
+ *	Optimize a storage device on a calculator.
+ *
+ *	@arg	cookie		the storage device name.
+ *	@arg	handle		the link handle.
+ *	@arg	result		the result to fill (unused).
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_deploy_optimize(void *cookie, casio_link_t *handle,
+	casio_deploy_result_t *result)
+{
+	casio_fs_t *fs;
+	int err;
+
+	(void)result;
+	if ((err = casio_open_seven_fs(&fs, handle)))
+		return (err);
+
+	err = casio_optimize(fs, (const char *)cookie);
+	casio_close_fs(fs);
+	return (err);
+}
@@ -31,3 +31,18 @@ const casio_link_info_t* CASIO_EXPORT casio_get_link_info(casio_link_t *handle)
 	if (!handle) return (NULL);
 	return (&handle->casio_link_info);
 }
+
+/**
+ *	casio_get_link_response:
+ *	Get the last packet received on the link.
+ *
+ *	@arg	handle		the link handle.
+ *	@return				the packet pointer.
+ */
+
+const casio_seven_packet_t* CASIO_EXPORT casio_get_link_response(
+	casio_link_t *handle)
+{
+	if (!handle) return (NULL);
+	return (&handle->casio_link_response);
+}
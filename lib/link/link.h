@@ -47,6 +47,40 @@ CASIO_EXTERN int CASIO_EXPORT casio_open_seven_scsi
 # define casio_linkflag_disc     0x0080 /* make the dev. discovery */
 # define casio_linkflag_ended    0x0100 /* the communication has ended. */
 
+/* Protocol 7.00 packet decoder state (see `seven/receive.c`). */
+
+typedef struct casio_seven_decoder_s {
+	int           casio_seven_decoder_state;
+	unsigned int  casio_seven_decoder_flags;
+	int           casio_seven_decoder_check_sum;
+	long          casio_seven_decoder_tries;
+
+	/* bytes in the receive buffer, and bytes wanted in it */
+	size_t        casio_seven_decoder_received;
+	size_t        casio_seven_decoder_target;
+
+	/* bytes left to skip, and the error to return once skipped */
+	unsigned long casio_seven_decoder_skip;
+	int           casio_seven_decoder_skiperr;
+
+	/* normal packets */
+	unsigned int  casio_seven_decoder_subtype;
+	unsigned int  casio_seven_decoder_data_size;
+	int           casio_seven_decoder_extended;
+
+	/* screen packets */
+	int           casio_seven_decoder_typzlen;
+	unsigned long casio_seven_decoder_image_size;
+	size_t        casio_seven_decoder_hdsize;
+} casio_seven_decoder_t;
+
+/* Size of the raw link information (extended ack data), and maximum sizes
+ * of a device information cache key and identity (see `cache.c`). */
+
+# define RAW_INFO_SIZE 164
+# define CACHE_KEY_SIZE 64
+# define CACHE_IDENT_SIZE 32
+
 /* Link handle structure. */
 struct casio_link_s {
 	/* flags - see above */
@@ -66,6 +100,11 @@ struct casio_link_s {
 	casio_seven_type_t   casio_link_curr_type;
 	unsigned int         casio_link_last_command;
 
+	/* raw link information, and device information cache key and identity */
+	unsigned char        casio_link_raw_info[RAW_INFO_SIZE];
+	char                 casio_link_cache_key[CACHE_KEY_SIZE + 1];
+	char                 casio_link_cache_ident[CACHE_IDENT_SIZE + 1];
+
 	/* MCS head */
 	casio_mcshead_t casio_link_mcshead;
 
@@ -76,7 +115,8 @@ struct casio_link_s {
 	size_t        casio_link_send_buffers_size[2];
 	unsigned char casio_link_send_buffers[2][MAX_PACKET_SIZE];
 
-	/* Raw receiving packet buffers. */
+	/* Raw receiving packet buffers, and the decoder state. */
+	casio_seven_decoder_t casio_link_decoder;
 	unsigned char casio_link_recv_buffer[MAX_PACKET_SIZE];
 };
 
@@ -91,6 +131,18 @@ CASIO_EXTERN int CASIO_EXPORT casio_seven_decode_command
 CASIO_EXTERN int CASIO_EXPORT casio_seven_decode_ack
 	OF((casio_link_t *casio__handle,
 		const unsigned char *casio__raw, unsigned int casio__raw_size));
+CASIO_EXTERN int CASIO_EXPORT casio_seven_decode_info
+	OF((casio_link_info_t *casio__info,
+		const unsigned char *casio__raw, unsigned int casio__raw_size));
+
+/* Device information cache. */
+
+CASIO_EXTERN int CASIO_EXPORT casio_get_cached_info
+	OF((const char *casio__key, const char *casio__ident,
+		unsigned char *casio__raw));
+CASIO_EXTERN int CASIO_EXPORT casio_put_cached_info
+	OF((const char *casio__key, const char *casio__ident,
+		const unsigned char *casio__raw));
 
 /* Special send functions. */
 
@@ -36,6 +36,26 @@
 
 int CASIO_EXPORT casio_open_link(casio_link_t **h, unsigned long flags,
 	casio_stream_t *stream, const casio_streamattrs_t *settings)
+{
+	return (casio_open_link_key(h, flags, stream, settings, NULL, NULL));
+}
+
+/**
+ *	casio_open_link_key:
+ *	Open a link handle, with a device key for the information cache.
+ *
+ *	@arg	h				the handle to create
+ *	@arg	flags			the flags.
+ *	@arg	stream			the stream to use.
+ *	@arg	settings		the stream settings to use.
+ *	@arg	key				the device key (NULL if none).
+ *	@arg	ident			the device identity (NULL if unknown).
+ *	@return					the error (0 if ok)
+ */
+
+int CASIO_EXPORT casio_open_link_key(casio_link_t **h, unsigned long flags,
+	casio_stream_t *stream, const casio_streamattrs_t *settings,
+	const char *key, const char *ident)
 {
 	int err = 0;
 	casio_link_t *handle;
@@ -55,6 +75,10 @@ int CASIO_EXPORT casio_open_link(casio_link_t **h, unsigned long flags,
 	memset(handle, 0, sizeof(casio_link_t)); /* important! */
 	casio_init_lock(&handle->casio_link_lock);
 	handle->casio_link_stream = stream;
+	if (key && strlen(key) <= CACHE_KEY_SIZE)
+		strcpy(handle->casio_link_cache_key, key);
+	if (ident && strlen(ident) <= CACHE_IDENT_SIZE)
+		strcpy(handle->casio_link_cache_ident, ident);
 
 	/* Initialize the flags. */
 
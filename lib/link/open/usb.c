@@ -83,3 +83,57 @@ int CASIO_EXPORT casio_open_usb(casio_link_t **handle, unsigned long flags,
 
 	return (0);
 }
+
+#ifndef LIBCASIO_DISABLED_LIBUSB
+/**
+ *	casio_open_usb_serial:
+ *	Open a USB communication with the calculator with the given serial
+ *	number, using the device information cache if enabled.
+ *
+ *	The model, which is known without asking the calculator anything
+ *	(calculators using SCSI commands are the fx-CG ones), is used as the
+ *	identity of the device in the cache.
+ *
+ *	@arg	handle		the link handle to make.
+ *	@arg	flags		the link flags.
+ *	@arg	serial		the serial number.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_open_usb_serial(casio_link_t **handle,
+	unsigned long flags, const char *serial)
+{
+	int err;
+	casio_stream_t *stream, *ns;
+	char key[CACHE_KEY_SIZE + 1];
+	const char *ident = "usb:6101";
+
+	*handle = NULL;
+	if (!serial || strlen(serial) > CACHE_KEY_SIZE - 4)
+		return (casio_error_op);
+	if ((err = casio_openusb_libusb_serial(&stream, serial)))
+		return (err);
+
+	/* Open the SCSI device stream if required. */
+
+	switch ((err = casio_open_seven_scsi(&ns, stream))) {
+	case 0:
+		stream = ns;
+		ident = "usb:6102";
+		break;
+
+	case casio_error_op:
+		break;
+
+	default:
+		casio_close(stream);
+		return (err);
+	}
+
+	/* Open the link based on the stream. */
+
+	strcpy(key, "usb:");
+	strcpy(&key[4], serial);
+	return (casio_open_link_key(handle, flags, stream, NULL, key, ident));
+}
+#endif
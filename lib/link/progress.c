@@ -0,0 +1,152 @@
+/* ****************************************************************************
+ * link/progress.c -- coalesced progress reporting.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#include "link.h"
+#include <limits.h>
+
+/**
+ *	casio_init_progress:
+ *	Initialize a progress tracker.
+ *
+ *	@arg	progress	the progress tracker to initialize.
+ *	@arg	func		the callback to call.
+ *	@arg	cookie		the cookie to pass to the callback.
+ *	@arg	interval	the minimum time between two calls (in ms).
+ *	@arg	step		the minimum progression between two calls
+ *						(in hundredths of percent).
+ *	@arg	size		the total number of bytes (0 if unknown).
+ *	@arg	block		the number of bytes in a packet (0 for full
+ *						protocol 7.00 data packets).
+ */
+
+void CASIO_EXPORT casio_init_progress(casio_progress_t *progress,
+	casio_progress_func_t *func, void *cookie,
+	unsigned long interval, unsigned int step, unsigned long size,
+	unsigned long block)
+{
+	memset(progress, 0, sizeof(casio_progress_t));
+	progress->casio_progress_func = func;
+	progress->casio_progress_cookie = cookie;
+	progress->casio_progress_interval = interval;
+	progress->casio_progress_step = step;
+	progress->casio_progress_block = block ? block
+		: CASIO_SEVEN_MAX_RAWDATA_SIZE;
+	progress->casio_progress_info.casio_progress_info_total_size = size;
+}
+
+/**
+ *	per_second:
+ *	Get `n * 1000 / ms` without overflowing, for rates and times.
+ *
+ *	@arg	n			the number of bytes or milliseconds.
+ *	@arg	ms			the number of milliseconds or bytes per second.
+ *	@return				the result.
+ */
+
+CASIO_LOCAL unsigned long per_second(unsigned long n, unsigned long ms)
+{
+	if (n <= ULONG_MAX / 1000)
+		return (n * 1000 / ms);
+	if (ms > ULONG_MAX / 1000)
+		return (n / ms * 1000 + n % ms / (ms / 1000));
+	return (n / ms * 1000 + n % ms * 1000 / ms);
+}
+
+/**
+ *	casio_progress:
+ *	Progress callback feeding a progress tracker.
+ *
+ *	@arg	vprogress	the progress tracker.
+ *	@arg	id			the current packet ID.
+ *	@arg	total		the total number of packets.
+ */
+
+void CASIO_EXPORT casio_progress(void *vprogress, unsigned int id,
+	unsigned int total)
+{
+	casio_progress_t *progress = vprogress;
+	casio_progress_info_t *info = &progress->casio_progress_info;
+	unsigned long now = casio_clock(), size, delta, total_size;
+
+	/* Initialization. */
+
+	if (id > total) {
+		progress->casio_progress_start = now;
+		progress->casio_progress_last = now;
+		progress->casio_progress_last_id = 0;
+		progress->casio_progress_last_size = 0;
+
+		info->casio_progress_info_id = 0;
+		info->casio_progress_info_total = 0;
+		info->casio_progress_info_size = 0;
+		info->casio_progress_info_rate = 0;
+		info->casio_progress_info_average = 0;
+		info->casio_progress_info_elapsed = 0;
+		info->casio_progress_info_eta = 0;
+
+		(*progress->casio_progress_func)(progress->casio_progress_cookie,
+			info);
+		return ;
+	}
+
+	/* Compute the transferred bytes; if we don't know the total number
+	 * of bytes, we suppose all packets are full. */
+
+	total_size = info->casio_progress_info_total_size;
+	if (!total_size)
+		total_size = (unsigned long)total * progress->casio_progress_block;
+	size = (unsigned long)id * progress->casio_progress_block;
+	if (size > total_size || id == total)
+		size = total_size;
+
+	info->casio_progress_info_id = id;
+	info->casio_progress_info_total = total;
+	info->casio_progress_info_size = size;
+
+	/* Check if we should call the callback. */
+
+	if (id != total) {
+		if (now - progress->casio_progress_last
+		  < progress->casio_progress_interval)
+			return ;
+		if ((unsigned long)(id - progress->casio_progress_last_id) * 10000
+		  < (unsigned long)progress->casio_progress_step * total)
+			return ;
+	}
+
+	/* Compute the rates and the estimated remaining time. */
+
+	delta = now - progress->casio_progress_last;
+	if (delta)
+		info->casio_progress_info_rate =
+			per_second(size - progress->casio_progress_last_size, delta);
+
+	info->casio_progress_info_elapsed = now - progress->casio_progress_start;
+	if (info->casio_progress_info_elapsed)
+		info->casio_progress_info_average =
+			per_second(size, info->casio_progress_info_elapsed);
+	info->casio_progress_info_eta = info->casio_progress_info_average
+		? per_second(total_size - size, info->casio_progress_info_average)
+		: 0;
+
+	progress->casio_progress_last = now;
+	progress->casio_progress_last_id = id;
+	progress->casio_progress_last_size = size;
+
+	(*progress->casio_progress_func)(progress->casio_progress_cookie, info);
+}
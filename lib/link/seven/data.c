@@ -44,19 +44,23 @@ int CASIO_EXPORT casio_seven_send_data_packet(casio_link_t *handle,
 	unsigned int total, unsigned int id,
 	const void *data, unsigned int datasize, int resp)
 {
-	unsigned char buf[8 + CASIO_SEVEN_MAX_RAWDATA_SIZE];
+	unsigned char head[8];
+	casio_iovec_t iov[2];
 
 	if (datasize > CASIO_SEVEN_MAX_RAWDATA_SIZE)
 		return (casio_error_op);
 
-	/* make new buffer */
-	casio_putascii(buf, total, 4);
-	casio_putascii(&buf[4], id, 4);
-	memcpy(&buf[8], data, datasize);
+	/* make the header, the data is sent from where it is */
+	casio_putascii(head, total, 4);
+	casio_putascii(&head[4], id, 4);
+	iov[0].casio_iovec_base = head;
+	iov[0].casio_iovec_len = 8;
+	iov[1].casio_iovec_base = data;
+	iov[1].casio_iovec_len = datasize;
 
 	/* send packet */
-	return (casio_seven_send_ext(handle, casio_seven_type_data,
-		handle->casio_link_last_command, buf, 8 + datasize, resp));
+	return (casio_seven_send_extv(handle, casio_seven_type_data,
+		handle->casio_link_last_command, iov, 2, resp));
 }
 
 /**
@@ -183,22 +183,20 @@ CASIO_LOCAL void cpy_string(char *dest, const char *src, size_t n)
 }
 
 /**
- *	casio_seven_decode_ack:
- *	Get data from ack data field.
+ *	casio_seven_decode_info:
+ *	Get the link information from extended ack data.
  *
  *	Layout is described in the fxReverse projet documentation.
  *
- *	@arg	handle		the handle
+ *	@arg	info		the link information to fill
  *	@arg	data		the raw data
  *	@arg	data_size	the raw data size
  *	@return				if there was an error
  */
 
-int CASIO_EXPORT casio_seven_decode_ack(casio_link_t *handle,
+int CASIO_EXPORT casio_seven_decode_info(casio_link_info_t *info,
 	const unsigned char *data, unsigned int data_size)
 {
-	casio_seven_packet_t *packet = &handle->casio_link_response;
-	casio_link_info_t *info = &packet->casio_seven_packet_info;
 	const packetdata_ackext_t *d = (const void*)data;
 
 	/* check the data size */
@@ -292,3 +290,26 @@ int CASIO_EXPORT casio_seven_decode_ack(casio_link_t *handle,
 	/* no error */
 	return (0);
 }
+
+/**
+ *	casio_seven_decode_ack:
+ *	Get data from ack data field.
+ *
+ *	The raw data is kept, for the device information cache.
+ *
+ *	@arg	handle		the handle
+ *	@arg	data		the raw data
+ *	@arg	data_size	the raw data size
+ *	@return				if there was an error
+ */
+
+int CASIO_EXPORT casio_seven_decode_ack(casio_link_t *handle,
+	const unsigned char *data, unsigned int data_size)
+{
+	if (casio_seven_decode_info(
+	  &handle->casio_link_response.casio_seven_packet_info, data, data_size))
+		return (1);
+
+	memcpy(handle->casio_link_raw_info, data, RAW_INFO_SIZE);
+	return (0);
+}
@@ -46,6 +46,17 @@ int CASIO_EXPORT casio_seven_start(casio_link_t *handle)
 		}
 	} elsemsg((ll_info, "Initial check is for noobz."));
 
+	/* use the cached device information if we can */
+	if (handle->casio_link_flags & casio_linkflag_disc
+	 && handle->casio_link_cache_key[0]
+	 && !casio_get_cached_info(handle->casio_link_cache_key,
+	  handle->casio_link_cache_ident, handle->casio_link_raw_info)
+	 && !casio_seven_decode_info(&handle->casio_link_info,
+	  handle->casio_link_raw_info, RAW_INFO_SIZE)) {
+		msg((ll_info, "Using the cached device information."));
+		goto getenv;
+	}
+
 	/* discover environment */
 	if (handle->casio_link_flags & casio_linkflag_disc) {
 		msg((ll_info, "Checking the environment."));
@@ -60,8 +71,15 @@ int CASIO_EXPORT casio_seven_start(casio_link_t *handle)
 		}
 	}
 
-	/* save server, get environment based on hardware id */
+	/* save server, and cache it if required */
 	handle->casio_link_info = response.casio_seven_packet_info;
+	if (handle->casio_link_flags & casio_linkflag_disc
+	 && handle->casio_link_cache_key[0])
+		casio_put_cached_info(handle->casio_link_cache_key,
+			handle->casio_link_cache_ident, handle->casio_link_raw_info);
+
+getenv:
+	/* get environment based on hardware id */
 	casio_seven_getenv(&handle->casio_link_env,
 		handle->casio_link_info.casio_link_info_hwid);
 	msg((ll_info, "Environment is '%s'",
@@ -157,219 +157,137 @@ CASIO_LOCAL const char *gettermstring(casio_seven_term_t code)
 }
 
 /* ---
- * Main receiving function.
+ * Packet decoding state machine.
  * --- */
 
-/**
- *	casio_seven_decode:
- *	Receive a packet.
+/* The decoder is a state machine, which state is kept in the link handle
+ * (see `lib/link/link.h`). Each state waits for the receive buffer to be
+ * filled up to a given size (the "target"), then decides what to do next.
+ * The bytes can be given by small chunks, so that packets can be decoded
+ * without blocking, or the blocking receiving function can read exactly
+ * what is needed to progress, as before.
  *
- *	This is the main receiving function. It receives, parses, and returns
- *	if everything has been successfully done or not.
- *	It uses buffered I/O to read progressively all of the packet.
+ * Here are the states: */
+
+#define DS_START    0 /* first three bytes (CAL or type) */
+#define DS_CAL      1 /* CAL value */
+#define DS_ALIGN    2 /* aligning on a screen packet */
+#define DS_SCRTYPE  3 /* screen type (TYP01, TYPZ1, TYPZ2) */
+#define DS_TYPZ     4 /* TYPZ size and subheader */
+#define DS_SCREEN   5 /* screen content and checksum */
+#define DS_SUBTYPE  6 /* subtype and extended flag */
+#define DS_SIZE     7 /* extended packet data size */
+#define DS_DATA     8 /* data and checksum */
+#define DS_ZERO     9 /* binary zero after some packets */
+#define DS_SKIP    10 /* skipping oversized content */
+#define DS_DONE    11 /* the packet is complete */
+
+#define buffer  handle->casio_link_recv_buffer
+#define decoder handle->casio_link_decoder
+
+/**
+ *	reset_decoder:
+ *	Reset the decoder to the beginning of a packet.
  *
  *	@arg	handle		the link handle
- *	@arg	scralign	shall we align screen?
- *	@return				the error (0 if ok)
  */
 
-#define buffer handle->casio_link_recv_buffer
-#define COMPLETE_PACKET(N) { \
-	ssize_t COMP_PACKET_err = casio_read(handle->casio_link_stream, \
-		&buffer[received], (size_t)N); \
-	received += COMP_PACKET_err >= 0 ? COMP_PACKET_err : 0; if (COMP_PACKET_err < 0) return -(COMP_PACKET_err); }
-
-CASIO_LOCAL int casio_seven_decode(casio_link_t *handle, int scralign)
+CASIO_LOCAL void reset_decoder(casio_link_t *handle)
 {
-	size_t received = 0;
-	int check_sum = 1, is_extended;
-	unsigned long csum, csum_ex;
-	unsigned int subtype, data_size;
-
-	/* Get first three bytes, check if is CAL. */
-
-	do {
-		COMPLETE_PACKET(3)
-		if (memcmp(buffer, "CAL", 3))
-			break;
-
-		/* get the CAL value */
-		msg((ll_info, "is the magic CAL!"));
-		COMPLETE_PACKET(4) /* TODO: check if is 00D0, and what is it? */
-		msg((ll_info, "CAL value is %.4s", &buffer[3]));
-		check_sum = 0;
-
-		/* good as new! */
-		received = 0;
-		msg((ll_info, "Restart receiving the packet."));
-	} while (1);
+	decoder.casio_seven_decoder_state = DS_START;
+	decoder.casio_seven_decoder_check_sum = 1;
+	decoder.casio_seven_decoder_received = 0;
+	decoder.casio_seven_decoder_target = 3;
+	decoder.casio_seven_decoder_tries = MAX_PACKET_SIZE + 1;
+}
 
-	/* Align on the screen if required. */
+/**
+ *	skip_then_fail:
+ *	Skip some bytes, then fail with an error.
+ *
+ *	@arg	handle		the link handle
+ *	@arg	size		the number of bytes to skip.
+ *	@arg	err			the error to return once the bytes are skipped.
+ *	@return				the error code (0 if ok).
+ */
 
-	if (scralign) {
-		int tries = MAX_PACKET_SIZE + 1;
+CASIO_LOCAL int skip_then_fail(casio_link_t *handle, unsigned long size,
+	int err)
+{
+	if (!size)
+		return (err);
 
-		/* Adjust. */
+	decoder.casio_seven_decoder_state = DS_SKIP;
+	decoder.casio_seven_decoder_skip = size;
+	decoder.casio_seven_decoder_skiperr = err;
+	return (0);
+}
 
-		while (memcmp(buffer, "\x0BTY", 3)) {
-			if (!--tries)
-				return (casio_error_unknown);
+/**
+ *	start_screen:
+ *	Prepare receiving the screen content, once the header is received.
+ *
+ *	@arg	handle		the link handle
+ *	@return				the error code (0 if ok).
+ */
 
-			buffer[0] = buffer[1];
-			buffer[1] = buffer[2];
-			received = 2;
-			COMPLETE_PACKET(1)
-		}
-	}
+CASIO_LOCAL int start_screen(casio_link_t *handle)
+{
+	unsigned long image_size = decoder.casio_seven_decoder_image_size;
+	int check_sum = decoder.casio_seven_decoder_check_sum;
+
+	/* check if we should skip */
+	if (!response.casio_seven_packet_pictype
+	 || image_size > CASIO_SEVEN_MAX_VRAM_SIZE)
+		return (skip_then_fail(handle, image_size + check_sum * 2,
+			casio_error_unknown));
+
+	/* complete packet */
+	msg((ll_info, "Get screen content (%luo)", image_size));
+	decoder.casio_seven_decoder_hdsize = decoder.casio_seven_decoder_received;
+	decoder.casio_seven_decoder_target += image_size + check_sum * 2;
+	decoder.casio_seven_decoder_state = DS_SCREEN;
+	return (0);
+}
 
-	/* Get the type. */
+/**
+ *	start_type:
+ *	Get the type, once the first three bytes are received and aligned.
+ *
+ *	@arg	handle		the link handle
+ */
 
+CASIO_LOCAL void start_type(casio_link_t *handle)
+{
 	response.casio_seven_packet_type = buffer[0];
 
 	/* Image has a particular format starting from here, look for it now! */
 
 	if (response.casio_seven_packet_type == casio_seven_type_ohp) {
-		unsigned int image_size;
-		size_t hdsize;
-
 		msg((ll_info, "Johnson, this is a screen."));
-		COMPLETE_PACKET(3)
-
-		/* get image by its type */
-		if (!memcmp(&buffer[1], "TYP01", 5)) {
-			msg((ll_info, "This is normal VRAM, we know it !"));
-			response.casio_seven_packet_pictype = casio_pictureformat_1bit;
-			response.casio_seven_packet_width = 128;
-			response.casio_seven_packet_height = 64;
-			image_size = 1024;
-		} else if (!memcmp(&buffer[1], "TYPZ1", 5)
-		 || !memcmp(&buffer[1], "TYPZ2", 5)) {
-			int typz_size_length; /* size field length */
-			casio_typz_t *s = (void*)&buffer[6];
-
-			msg((ll_info, "Prizm VRAM!"));
-			if (buffer[5] == '1')
-				typz_size_length = 6;
-			else /* '2' */
-				typz_size_length = 8;
-
-			COMPLETE_PACKET(typz_size_length)
-			COMPLETE_PACKET(sizeof(casio_typz_t))
-
-			image_size = casio_getascii(&buffer[6], typz_size_length);
-			s = (void*)&buffer[6 + typz_size_length];
-
-			response.casio_seven_packet_width =
-				casio_getascii(s->casio_typz_width, 4);
-			response.casio_seven_packet_height =
-				casio_getascii(s->casio_typz_height, 4);
-
-			/* check the type */
-			response.casio_seven_packet_pictype = 0;
-			if (!memcmp(s->casio_typz_enc, "RC2", 3))
-				response.casio_seven_packet_pictype =
-					casio_pictureformat_16bit;
-			else if (!memcmp(s->casio_typz_enc, "RC3", 3))
-				response.casio_seven_packet_pictype =
-					casio_pictureformat_4bit_rgb;
-			else if (!memcmp(s->casio_typz_enc, "RM2", 3))
-				response.casio_seven_packet_pictype =
-					casio_pictureformat_2bit_dual;
-			elsemsg((ll_error, "Unknown encoding: %.3s", s->casio_typz_enc));
-
-			/* FIXME: check size according to format? */
-			msg((ll_info, "Image size: %uB", image_size));
-			check_sum = 1;
-		} else {
-			msg((ll_error, "Unknown picture encoding: %.5s", &buffer[1]));
-			return (casio_error_csum);
-		}
-
-		/* check if we should skip */
-		if (!response.casio_seven_packet_pictype
-		 || image_size > CASIO_SEVEN_MAX_VRAM_SIZE) {
-			casio_skip(handle->casio_link_stream, image_size + check_sum * 2);
-			return (casio_error_unknown);
-		}
-
-		/* complete packet */
-		hdsize = received;
-		msg((ll_info, "Get screen content (%uo)", image_size));
-		COMPLETE_PACKET(image_size)
-		memcpy(&response.casio_seven_packet_vram, &buffer[hdsize], image_size);
-
-		/* check the sum */
-		if (check_sum) {
-			COMPLETE_PACKET(2)
-
-			/* calculate the checksums */
-			csum    = checksub8(buffer, received, 0);
-			csum_ex = casio_getascii(&buffer[received - 2], 2);
-
-			/* check them */
-			if (csum != csum_ex) {
-				msg((ll_error, "Checksum problem: expected 0x%02lX, "
-					"got 0x%02lX", csum_ex, csum));
-				return (casio_error_csum);
-			}
-		}
-		check_sum = 1;
-
-		/* log */
-		msg((ll_info,
-			"received the following [screen] packet (%" CASIO_PRIuSIZE "o) :",
-			received));
-		mem((ll_info, buffer, received));
-
-		/* and return the packet */
-		return (0);
+		decoder.casio_seven_decoder_target = 6;
+		decoder.casio_seven_decoder_state = DS_SCRTYPE;
+		return ;
 	}
 
 	/* type, subtype and extended */
-	COMPLETE_PACKET(1) subtype = casio_getascii(&buffer[1], 2);
-
-	/* - extended (beginning) - */
-	data_size = 0;
-	is_extended = (buffer[3] == '1');
-	if (is_extended) {
-		/* get data size */
-		COMPLETE_PACKET(4)
-		data_size = casio_getascii(&buffer[4], 4);
-
-		/* check data size */
-		if (data_size > 8 + CASIO_SEVEN_MAX_ENCDATA_SIZE) {
-			int err;
-
-			msg((ll_warn,
-				"Was 0x%02X/0x%02X extended packet with %u data bytes",
-				response.casio_seven_packet_type, subtype, data_size));
-			msg((ll_warn, "That's bigger than our internal buffer size, "
-				"skipping."));
-			err = casio_skip(handle->casio_link_stream, data_size + 2);
-			if (err) return (err);
-			return (casio_error_csum);
-		}
+	decoder.casio_seven_decoder_target = 4;
+	decoder.casio_seven_decoder_state = DS_SUBTYPE;
+}
 
-		/* get data */
-		COMPLETE_PACKET(data_size + 2)
-	} else
-		COMPLETE_PACKET(2)
-
-	/* log */
-	msg((ll_info, "received the following [normal] packet (%uo) :",
-		received));
-	mem((ll_info, buffer, received));
-
-	/* calculate checksum */
-	csum_ex = checksub8(buffer, received, 0);
-	csum    = casio_getascii(&buffer[received - 2], 2);
-	if (csum_ex != csum)
-		return (casio_error_csum);
+/**
+ *	interpret:
+ *	Get the fields out of a complete normal packet.
+ *
+ *	@arg	handle		the link handle
+ *	@return				the error code (0 if ok).
+ */
 
-	/* check if we should read a binary zero */
-	if (response.casio_seven_packet_type
-	 == casio_seven_type_cmd && subtype == casio_seven_cmdosu_upandrun)
-		COMPLETE_PACKET(1)
+CASIO_LOCAL int interpret(casio_link_t *handle)
+{
+	unsigned int subtype = decoder.casio_seven_decoder_subtype;
+	unsigned int data_size = decoder.casio_seven_decoder_data_size;
+	int is_extended = decoder.casio_seven_decoder_extended;
 
 	/* - extended (finish) - */
 	if (is_extended)
@@ -447,10 +365,415 @@ CASIO_LOCAL int casio_seven_decode(casio_link_t *handle, int scralign)
 		return (casio_error_unknown);
 	}
 
-	/* finally, return the packet */
+	/* finally, the packet is complete */
+	decoder.casio_seven_decoder_state = DS_DONE;
 	return (0);
 }
 
+/**
+ *	step:
+ *	Make the decoder progress, once the buffer is filled up to the target.
+ *
+ *	@arg	handle		the link handle
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int step(casio_link_t *handle)
+{
+	size_t received = decoder.casio_seven_decoder_received;
+	unsigned long csum, csum_ex;
+
+	switch (decoder.casio_seven_decoder_state) {
+	case DS_START:
+		/* Check if is CAL. */
+
+		if (!memcmp(buffer, "CAL", 3)) {
+			msg((ll_info, "is the magic CAL!"));
+			decoder.casio_seven_decoder_target = 7;
+			decoder.casio_seven_decoder_state = DS_CAL;
+			break;
+		}
+
+		/* Align on the screen if required. */
+
+		if (decoder.casio_seven_decoder_flags
+		  & CASIO_SEVEN_RECEIVEFLAG_SCRALIGN) {
+			decoder.casio_seven_decoder_state = DS_ALIGN;
+			return (step(handle));
+		}
+
+		start_type(handle);
+		break;
+
+	case DS_CAL:
+		/* TODO: check if is 00D0, and what is it? */
+		msg((ll_info, "CAL value is %.4s", &buffer[3]));
+
+		/* good as new! */
+		msg((ll_info, "Restart receiving the packet."));
+		decoder.casio_seven_decoder_check_sum = 0;
+		decoder.casio_seven_decoder_received = 0;
+		decoder.casio_seven_decoder_target = 3;
+		decoder.casio_seven_decoder_state = DS_START;
+		break;
+
+	case DS_ALIGN:
+		if (!memcmp(buffer, "\x0BTY", 3)) {
+			start_type(handle);
+			break;
+		}
+
+		if (!--decoder.casio_seven_decoder_tries)
+			return (casio_error_unknown);
+
+		buffer[0] = buffer[1];
+		buffer[1] = buffer[2];
+		decoder.casio_seven_decoder_received = 2;
+		break;
+
+	case DS_SCRTYPE:
+		/* get image by its type */
+		if (!memcmp(&buffer[1], "TYP01", 5)) {
+			msg((ll_info, "This is normal VRAM, we know it !"));
+			response.casio_seven_packet_pictype = casio_pictureformat_1bit;
+			response.casio_seven_packet_width = 128;
+			response.casio_seven_packet_height = 64;
+			decoder.casio_seven_decoder_image_size = 1024;
+			return (start_screen(handle));
+		} else if (!memcmp(&buffer[1], "TYPZ1", 5)
+		 || !memcmp(&buffer[1], "TYPZ2", 5)) {
+			msg((ll_info, "Prizm VRAM!"));
+			if (buffer[5] == '1')
+				decoder.casio_seven_decoder_typzlen = 6;
+			else /* '2' */
+				decoder.casio_seven_decoder_typzlen = 8;
+
+			decoder.casio_seven_decoder_target +=
+				decoder.casio_seven_decoder_typzlen + sizeof(casio_typz_t);
+			decoder.casio_seven_decoder_state = DS_TYPZ;
+			break;
+		}
+
+		msg((ll_error, "Unknown picture encoding: %.5s", &buffer[1]));
+		return (casio_error_csum);
+
+	case DS_TYPZ: {
+		int typz_size_length = decoder.casio_seven_decoder_typzlen;
+		casio_typz_t *s = (void*)&buffer[6 + typz_size_length];
+
+		decoder.casio_seven_decoder_image_size =
+			casio_getascii(&buffer[6], typz_size_length);
+		response.casio_seven_packet_width =
+			casio_getascii(s->casio_typz_width, 4);
+		response.casio_seven_packet_height =
+			casio_getascii(s->casio_typz_height, 4);
+
+		/* check the type */
+		response.casio_seven_packet_pictype = 0;
+		if (!memcmp(s->casio_typz_enc, "RC2", 3))
+			response.casio_seven_packet_pictype =
+				casio_pictureformat_16bit;
+		else if (!memcmp(s->casio_typz_enc, "RC3", 3))
+			response.casio_seven_packet_pictype =
+				casio_pictureformat_4bit_rgb;
+		else if (!memcmp(s->casio_typz_enc, "RM2", 3))
+			response.casio_seven_packet_pictype =
+				casio_pictureformat_2bit_dual;
+		elsemsg((ll_error, "Unknown encoding: %.3s", s->casio_typz_enc));
+
+		/* FIXME: check size according to format? */
+		msg((ll_info, "Image size: %luB",
+			decoder.casio_seven_decoder_image_size));
+		decoder.casio_seven_decoder_check_sum = 1;
+		return (start_screen(handle));
+	}
+
+	case DS_SCREEN:
+		/* check the sum */
+		if (decoder.casio_seven_decoder_check_sum) {
+			/* calculate the checksums */
+			csum    = checksub8(buffer, received, 0);
+			csum_ex = casio_getascii(&buffer[received - 2], 2);
+
+			/* check them */
+			if (csum != csum_ex) {
+				msg((ll_error, "Checksum problem: expected 0x%02lX, "
+					"got 0x%02lX", csum_ex, csum));
+				return (casio_error_csum);
+			}
+		}
+
+		memcpy(&response.casio_seven_packet_vram,
+			&buffer[decoder.casio_seven_decoder_hdsize],
+			decoder.casio_seven_decoder_image_size);
+
+		/* log */
+		msg((ll_info,
+			"received the following [screen] packet (%" CASIO_PRIuSIZE "o) :",
+			received));
+		mem((ll_info, buffer, received));
+
+		/* and the packet is complete */
+		decoder.casio_seven_decoder_state = DS_DONE;
+		break;
+
+	case DS_SUBTYPE:
+		decoder.casio_seven_decoder_subtype = casio_getascii(&buffer[1], 2);
+
+		/* - extended (beginning) - */
+		decoder.casio_seven_decoder_data_size = 0;
+		decoder.casio_seven_decoder_extended = (buffer[3] == '1');
+		if (decoder.casio_seven_decoder_extended) {
+			decoder.casio_seven_decoder_target = 8;
+			decoder.casio_seven_decoder_state = DS_SIZE;
+		} else {
+			decoder.casio_seven_decoder_target = 6;
+			decoder.casio_seven_decoder_state = DS_DATA;
+		}
+		break;
+
+	case DS_SIZE: {
+		unsigned int data_size = casio_getascii(&buffer[4], 4);
+
+		/* check data size */
+		if (data_size > 8 + CASIO_SEVEN_MAX_ENCDATA_SIZE) {
+			msg((ll_warn,
+				"Was 0x%02X/0x%02X extended packet with %u data bytes",
+				response.casio_seven_packet_type,
+				decoder.casio_seven_decoder_subtype, data_size));
+			msg((ll_warn, "That's bigger than our internal buffer size, "
+				"skipping."));
+			return (skip_then_fail(handle, data_size + 2, casio_error_csum));
+		}
+
+		/* get data */
+		decoder.casio_seven_decoder_data_size = data_size;
+		decoder.casio_seven_decoder_target = 8 + data_size + 2;
+		decoder.casio_seven_decoder_state = DS_DATA;
+		break;
+	}
+
+	case DS_DATA:
+		/* log */
+		msg((ll_info, "received the following [normal] packet (%uo) :",
+			received));
+		mem((ll_info, buffer, received));
+
+		/* calculate checksum */
+		csum_ex = checksub8(buffer, received, 0);
+		csum    = casio_getascii(&buffer[received - 2], 2);
+		if (csum_ex != csum)
+			return (casio_error_csum);
+
+		/* check if we should read a binary zero */
+		if (response.casio_seven_packet_type == casio_seven_type_cmd
+		 && decoder.casio_seven_decoder_subtype
+		 == casio_seven_cmdosu_upandrun) {
+			decoder.casio_seven_decoder_target++;
+			decoder.casio_seven_decoder_state = DS_ZERO;
+			break;
+		}
+
+		return (interpret(handle));
+
+	case DS_ZERO:
+		return (interpret(handle));
+	}
+
+	return (0);
+}
+
+/**
+ *	advance:
+ *	Tell the decoder that bytes were received.
+ *
+ *	When not skipping, the bytes must have been put in the receive buffer,
+ *	right after the bytes already received.
+ *
+ *	@arg	handle		the link handle
+ *	@arg	size		the number of bytes received.
+ *	@return				the error code (0 if a packet is complete,
+ *						casio_error_eof if more bytes are needed).
+ */
+
+CASIO_LOCAL int advance(casio_link_t *handle, size_t size)
+{
+	int err;
+
+	if (decoder.casio_seven_decoder_state == DS_SKIP) {
+		decoder.casio_seven_decoder_skip -= size;
+		if (decoder.casio_seven_decoder_skip)
+			return (casio_error_eof);
+
+		err = decoder.casio_seven_decoder_skiperr;
+		goto end;
+	}
+
+	decoder.casio_seven_decoder_received += size;
+	while (decoder.casio_seven_decoder_received
+	 == decoder.casio_seven_decoder_target) {
+		if ((err = step(handle)))
+			goto end;
+		if (decoder.casio_seven_decoder_state == DS_DONE)
+			goto end;
+		if (decoder.casio_seven_decoder_state == DS_SKIP)
+			return (casio_error_eof);
+	}
+
+	return (casio_error_eof);
+end:
+	reset_decoder(handle);
+	return (err);
+}
+
+/* ---
+ * Packet decoding interface.
+ * --- */
+
+/**
+ *	casio_seven_reset_decoder:
+ *	Reset the packet decoder, to start decoding a new packet.
+ *
+ *	@arg	handle		the link handle
+ *	@arg	flags		the receive flags (only `SCRALIGN` is used).
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_seven_reset_decoder(casio_link_t *handle,
+	unsigned int flags)
+{
+	if (!handle)
+		return (casio_error_init);
+
+	reset_decoder(handle);
+	decoder.casio_seven_decoder_flags = flags;
+	return (0);
+}
+
+/**
+ *	casio_seven_decoder_need:
+ *	Get the number of bytes the decoder needs before it can progress.
+ *
+ *	Giving it more is allowed, but these bytes may belong to the next
+ *	packet: blocking streams should be read for exactly this amount.
+ *
+ *	@arg	handle		the link handle
+ *	@return				the number of bytes.
+ */
+
+size_t CASIO_EXPORT casio_seven_decoder_need(casio_link_t *handle)
+{
+	if (!decoder.casio_seven_decoder_target)
+		reset_decoder(handle);
+	if (decoder.casio_seven_decoder_state == DS_SKIP)
+		return ((size_t)decoder.casio_seven_decoder_skip);
+	return (decoder.casio_seven_decoder_target
+		- decoder.casio_seven_decoder_received);
+}
+
+/**
+ *	casio_seven_decode_chunk:
+ *	Give some received bytes to the packet decoder.
+ *
+ *	The decoder keeps its state between calls, so the bytes can be given
+ *	in chunks of any size. When a packet is complete, it is decoded into
+ *	the response packet (see `casio_get_link_response()`), and the number
+ *	of bytes that were used is given; the remaining bytes should be given
+ *	again, as they belong to the next packet.
+ *
+ *	After an error, the decoder starts decoding a new packet.
+ *
+ *	@arg	handle		the link handle
+ *	@arg	data		the received bytes.
+ *	@arg	size		the number of received bytes.
+ *	@arg	consumed	the number of bytes used (may be NULL).
+ *	@return				the error code (0 if a packet is complete,
+ *						casio_error_eof if all of the bytes were used
+ *						without completing a packet).
+ */
+
+int CASIO_EXPORT casio_seven_decode_chunk(casio_link_t *handle,
+	const void *data, size_t size, size_t *consumed)
+{
+	const unsigned char *d = data;
+	size_t left = size;
+	int err = casio_error_eof;
+
+	if (!handle)
+		return (casio_error_init);
+
+	while (left) {
+		size_t len = casio_seven_decoder_need(handle);
+
+		if (len > left)
+			len = left;
+		if (decoder.casio_seven_decoder_state != DS_SKIP)
+			memcpy(&buffer[decoder.casio_seven_decoder_received], d, len);
+		d += len;
+		left -= len;
+
+		err = advance(handle, len);
+		if (err != casio_error_eof)
+			break;
+	}
+
+	if (consumed)
+		*consumed = size - left;
+	return (err);
+}
+
+/* ---
+ * Main receiving function.
+ * --- */
+
+/**
+ *	casio_seven_decode:
+ *	Receive a packet.
+ *
+ *	This is the main receiving function. It receives, parses, and returns
+ *	if everything has been successfully done or not.
+ *	It reads progressively all of the packet, exactly what the decoder
+ *	needs each time, directly into the receive buffer.
+ *
+ *	@arg	handle		the link handle
+ *	@arg	scralign	shall we align screen?
+ *	@return				the error (0 if ok)
+ */
+
+CASIO_LOCAL int casio_seven_decode(casio_link_t *handle, int scralign)
+{
+	int err;
+
+	casio_seven_reset_decoder(handle,
+		scralign ? CASIO_SEVEN_RECEIVEFLAG_SCRALIGN : 0);
+
+	do {
+		size_t need = casio_seven_decoder_need(handle);
+
+		if (decoder.casio_seven_decoder_state == DS_SKIP) {
+			if ((err = casio_skip(handle->casio_link_stream, need)))
+				break;
+		} else {
+			ssize_t ssize = casio_read(handle->casio_link_stream,
+				&buffer[decoder.casio_seven_decoder_received], need);
+
+			if (ssize < 0) {
+				err = (int)-ssize;
+				break;
+			}
+		}
+
+		err = advance(handle, need);
+	} while (err == casio_error_eof);
+
+	if (err)
+		reset_decoder(handle);
+	return (err);
+}
+
+#undef buffer
+#undef decoder
+
 /* ---
  * Receiving function with error management.
  * --- */
@@ -306,7 +306,8 @@ CASIO_LOCAL casio_streamfuncs_t seven_scsi_funcs = {
 	(casio_stream_write_t *)seven_scsi_write,
 	NULL,
 	NULL,
-	(casio_stream_scsi_t *)seven_scsi_request
+	(casio_stream_scsi_t *)seven_scsi_request,
+	NULL
 };
 
 int CASIO_EXPORT casio_open_seven_scsi(casio_stream_t **streamp,
@@ -46,33 +46,36 @@
  *	Send a buffer.
  *
  *	@arg	handle		the link handle
- *	@arg	buf			the buffer to send (NULL if normal buffer)
- *	@arg	bufsize		the buffer size
+ *	@arg	iov			the buffers to send (NULL if normal buffer)
+ *	@arg	iovcnt		the number of buffers
  *	@arg	resp		check response (is yes for 99.9% of the cases)
  *	@return				if worked (0 if none)
  */
 
 CASIO_LOCAL int casio_seven_send_buf(casio_link_t *handle,
-	const unsigned char *buf, size_t bufsize, int resp)
+	const casio_iovec_t *iov, int iovcnt, int resp)
 {
 	int err; int wasresend = 0, resp_err = 0, retries = 3;
+	casio_iovec_t bufvec;
 
 	/* check if handler is initialized */
 	if (!handle) return (casio_error_init);
 
 	/* check if user wants to shift
-	 *	with hack: if `buf` is non-NULL, we simply want to send
+	 *	with hack: if `iov` is non-NULL, we simply want to send
 	 *  a custom packet */
-	if (!buf && !resp) {
+	if (!iov && !resp) {
 		if (handle->casio_link_flags & casio_linkflag_shifted)
 			return (casio_error_shift);
 		else handle->casio_link_flags |= casio_linkflag_shifted;
 	}
 
 	/* get buffer */
-	if (!buf) {
-		buf = buffer;
-		bufsize = buffer_size;
+	if (!iov) {
+		bufvec.casio_iovec_base = buffer;
+		bufvec.casio_iovec_len = buffer_size;
+		iov = &bufvec;
+		iovcnt = 1;
 	}
 
 	/* sending loop */
@@ -85,13 +88,20 @@ CASIO_LOCAL int casio_seven_send_buf(casio_link_t *handle,
 				return (casio_error_damned);
 			}
 
-			switch_buffer();
-			buf = buffer; bufsize = buffer_size;
+			/* custom packets are only sent once, and packets that were
+			 * not made in the send buffer are never sent while shifted,
+			 * so we only have to reload the buffer here. */
+
+			if (iov == &bufvec) {
+				switch_buffer();
+				bufvec.casio_iovec_base = buffer;
+				bufvec.casio_iovec_len = buffer_size;
+			}
 			msg((ll_warn, "resend request was received, resend it goes"));
 		}
 
 		/* send prepared packet */
-		ssize_t ssize = casio_write(handle->casio_link_stream, buf, bufsize);
+		ssize_t ssize = casio_writev(handle->casio_link_stream, iov, iovcnt);
 		err = ssize < 0 ? -ssize : 0;
 		if (err) return (err);
 
@@ -162,6 +172,66 @@ int CASIO_EXPORT casio_seven_send_ext(casio_link_t *handle,
 	casio_seven_type_t type, unsigned int subtype,
 	const void *data, unsigned int size, int resp)
 {
+	casio_iovec_t iov;
+
+	iov.casio_iovec_base = data;
+	iov.casio_iovec_len = size;
+	return (casio_seven_send_extv(handle, type, subtype, &iov, 1, resp));
+}
+
+/* Maximum number of data buffers for the direct sending of a packet
+ * (the header and the checksum are two other buffers). */
+
+#define MAX_DIRECT_IOV 6
+
+/**
+ *	needs_encoding:
+ *	Check if some raw data needs encoding.
+ *
+ *	@arg	iov			the data buffers.
+ *	@arg	iovcnt		the number of data buffers.
+ *	@return				if the data needs encoding.
+ */
+
+CASIO_LOCAL int needs_encoding(const casio_iovec_t *iov, int iovcnt)
+{
+	for (; iovcnt; iov++, iovcnt--) {
+		const unsigned char *p = iov->casio_iovec_base;
+		size_t left = iov->casio_iovec_len;
+
+		for (; left; p++, left--)
+			if (*p < 0x20 || *p == '\\')
+				return (1);
+	}
+
+	return (0);
+}
+
+/**
+ *	casio_seven_send_extv:
+ *	Send an extended packet, which data is split in several buffers.
+ *
+ *	When the response is checked, no shifting is going on and the data
+ *	doesn't need to be encoded, the header, the data and the checksum
+ *	are sent as they are using a scatter-gather write, without copying
+ *	the data into the send buffer.
+ *
+ *	@arg	handle		the link handle
+ *	@arg	type		the packet type
+ *	@arg	subtype		the packet subtype
+ *	@arg	data		the packet data buffers
+ *	@arg	count		the number of packet data buffers
+ *	@arg	resp		check response (is yes for 99.9% of the cases)
+ *	@return				if it worked
+ */
+
+int CASIO_EXPORT casio_seven_send_extv(casio_link_t *handle,
+	casio_seven_type_t type, unsigned int subtype,
+	const casio_iovec_t *data, int count, int resp)
+{
+	unsigned int size = 0;
+	int i;
+
 	/* check if should be a binary zero at end of packet */
 	int binary_zero = (type == casio_seven_type_cmd
 		&& subtype == casio_seven_cmdosu_upandrun);
@@ -172,8 +242,53 @@ int CASIO_EXPORT casio_seven_send_ext(casio_link_t *handle,
 	buffer[0] = (unsigned char)type;
 	casio_putascii(&buffer[1], subtype, 2);
 	buffer[3] = '1';
+
+	/* - direct sending - */
+	if (resp && !binary_zero && count <= MAX_DIRECT_IOV
+	 && ~handle->casio_link_flags & casio_linkflag_shifted
+	 && !needs_encoding(data, count)) {
+		casio_iovec_t iov[MAX_DIRECT_IOV + 2];
+		int cs;
+
+		for (i = 0; i < count; i++)
+			size += (unsigned int)data[i].casio_iovec_len;
+		casio_putascii(&buffer[4], size, 4);
+
+		/* the checksum is computed on the header (minus the type)
+		 * and on the data; it is stored right after the header, in the
+		 * send buffer, as we have no use for the rest of it. */
+
+		cs = casio_checksum_sub(&buffer[1], 7, 0);
+		for (i = 0; i < count; i++)
+			cs = casio_checksum_sub((void*)data[i].casio_iovec_base,
+				data[i].casio_iovec_len, cs);
+		casio_putascii(&buffer[8], cs, 2);
+		buffer_size = 0;
+
+		iov[0].casio_iovec_base = buffer;
+		iov[0].casio_iovec_len = 8;
+		memcpy(&iov[1], data, count * sizeof(casio_iovec_t));
+		iov[count + 1].casio_iovec_base = &buffer[8];
+		iov[count + 1].casio_iovec_len = 2;
+
+		/* log packet */
+		msg((ll_info, "sending the following extended packet :"));
+		mem((ll_info, buffer, 8));
+		for (i = 0; i < count; i++)
+			mem((ll_info, data[i].casio_iovec_base,
+				data[i].casio_iovec_len));
+		mem((ll_info, &buffer[8], 2));
+
+		/* send it */
+		handle->casio_link_curr_type = type;
+		return (casio_seven_send_buf(handle, iov, count + 2, resp));
+	}
+
 	/* - data - */
-	size = casio_seven_encoderaw(&buffer[8], data, size);
+	for (i = 0; i < count; i++)
+		size += casio_seven_encoderaw(&buffer[8 + size],
+			data[i].casio_iovec_base,
+			(unsigned int)data[i].casio_iovec_len);
 	casio_putascii(&buffer[4], size, 4);
 	/* - checksum - */
 	casio_putascii(&buffer[8 + size], checksub8(buffer, 8 + size + 2), 2);
@@ -194,7 +309,8 @@ int CASIO_EXPORT casio_seven_send_ext(casio_link_t *handle,
  *	Send the last packet again.
  *
  *	Useful for when resending wasn't managed in one of the previous functions.
- *	Only used for unshifting right now.
+ *	Only used for unshifting right now, so only packets made in the send
+ *	buffer (which includes all packets sent while shifted) can be sent again.
  *
  *	@arg	handle		the link handle
  *	@return				if it worked
@@ -227,10 +343,15 @@ int CASIO_EXPORT casio_seven_send_err_resend(casio_link_t *handle)
 	static const unsigned char resend_buf[] =
 		{casio_seven_type_nak, '0', '1', '0', '6', 'F', 0};
 
+	casio_iovec_t iov;
+
+	iov.casio_iovec_base = resend_buf;
+	iov.casio_iovec_len = 6;
+
 	/* send packet */
 	msg((ll_info, "sending resend packet:"));
 	mem((ll_info, resend_buf, 6));
-	return (casio_seven_send_buf(handle, resend_buf, 6, 0));
+	return (casio_seven_send_buf(handle, &iov, 1, 0));
 }
 
 /**
@@ -246,8 +367,13 @@ int CASIO_EXPORT casio_seven_send_timeout_check(casio_link_t *handle)
 	static const unsigned char check_buf[] =
 		{casio_seven_type_chk, '0', '1', '0', '6', 'F', 0};
 
+	casio_iovec_t iov;
+
+	iov.casio_iovec_base = check_buf;
+	iov.casio_iovec_len = 6;
+
 	/* send packet */
 	msg((ll_info, "sending timeout check packet:"));
 	mem((ll_info, check_buf, 6));
-	return (casio_seven_send_buf(handle, check_buf, 6, 0));
+	return (casio_seven_send_buf(handle, &iov, 1, 0));
 }
@@ -174,7 +174,7 @@ CASIO_LOCAL int request_alphamem(sevenmcs_t *cookie, casio_mcsfile_t **mcsfile)
 		/* var name (will be completed in the loop): */ "", "",
 		/* group: */ "ALPHA MEM",
 		/* dirname: */ "$GLOBAL",
-		"", ""
+		"", "", 0
 	};
 
 	/* Allocate the alpha memory file. */
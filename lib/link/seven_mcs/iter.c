@@ -39,7 +39,7 @@ const casio_mcshead_t casio_sevenmcs_list_alpha_entry = {
 	/* name: */ "ALPHA MEM", "",
 	/* group: */ "ALPHA MEM",
 	/* dirname: */ "$GLOBAL",
-	"", ""
+	"", "", 0
 };
 const casio_mcshead_t casio_sevenmcs_list_setup_entry = {
 	0, casio_mcstype_setup, 0,
@@ -48,7 +48,7 @@ const casio_mcshead_t casio_sevenmcs_list_setup_entry = {
 	/* name: */ "SETUP", "",
 	/* group: */ "SETUP",
 	/* dirname: */ "$GLOBAL",
-	"", ""
+	"", "", 0
 };
 
 /**
@@ -123,6 +123,7 @@ CASIO_LOCAL int next_entry(struct thecookie *cookie, void **ptr)
 			head->casio_mcshead_group[0] = 0;
 
 		casio_correct_mcshead(head, 0);
+		casio_key_mcshead(head);
 
 		/* Send an ACK. */
 
@@ -0,0 +1,161 @@
+/* ****************************************************************************
+ * link/usage/backup_mcs.c -- backup the main memory in one session.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Getting the files of the main memory one by one through the MCS interface
+ * requires a request, a role swap and a data flow for each file. Instead,
+ * the "request all files transfer" command makes the calculator send all of
+ * its main memory files in one session, as if it was sending them to
+ * another calculator, which is way faster on loaded calculators.
+ * ************************************************************************* */
+#include "usage.h"
+
+struct thecookie {
+	int                    _count;
+	int                    _err;
+	casio_mcs_t           *_mcs;
+	casio_link_progress_t *_disp;
+	void                  *_disp_cookie;
+};
+
+/**
+ *	copy_arg:
+ *	Copy a command argument into a head field.
+ *
+ *	@arg	dest		the destination field.
+ *	@arg	arg			the argument (NULL if absent).
+ *	@arg	size		the maximum size of the field.
+ */
+
+CASIO_LOCAL void copy_arg(char *dest, const char *arg, size_t size)
+{
+	if (arg) {
+		strncpy(dest, arg, size);
+		dest[size] = 0;
+	} else
+		dest[0] = 0;
+}
+
+/**
+ *	receive_file:
+ *	Receive a main memory file and put it into the destination.
+ *
+ *	@arg	vcookie		the cookie (uncasted).
+ *	@arg	handle		the link handle.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int receive_file(void *vcookie, casio_link_t *handle)
+{
+	struct thecookie *cookie = (void*)vcookie;
+	casio_stream_t  *data_stream = NULL;
+	casio_mcsfile_t *mcsfile = NULL;
+	casio_mcshead_t  head;
+	int err;
+
+	/* Make the head out of the command. */
+	memset(&head, 0, sizeof(head));
+	head.casio_mcshead_flags = casio_mcsfor_mcs;
+	head.casio_mcshead_size = response.casio_seven_packet_filesize;
+	head.casio_mcshead_rawtype = response.casio_seven_packet_mcstype;
+	copy_arg(head.casio_mcshead_dirname,
+		response.casio_seven_packet_args[0], 8);
+	copy_arg(head.casio_mcshead_name,
+		response.casio_seven_packet_args[1], 12);
+	copy_arg(head.casio_mcshead_group,
+		response.casio_seven_packet_args[2], 16);
+	casio_correct_mcshead(&head, 0);
+
+	/* Decode the file as it arrives. */
+	err = casio_seven_open_data_stream(&data_stream, handle, 0,
+		cookie->_disp, cookie->_disp_cookie);
+	if (err) goto fail;
+	err = casio_decode_mcsfile(&mcsfile, &head, data_stream);
+	casio_close(data_stream);
+	if (err) goto fail;
+
+	/* Put it into the destination, which takes ownership of it. */
+	msg((ll_info, "Got '%.16s' / '%.12s'.", head.casio_mcshead_group,
+		head.casio_mcshead_name));
+	if ((err = casio_put_mcsfile(cookie->_mcs, mcsfile, 1)))
+		goto fail;
+
+	/* Send the final ack and return. */
+	cookie->_count++;
+	return (casio_seven_send_ack(handle, 1));
+fail:
+	if (!cookie->_err)
+		cookie->_err = err;
+	return (casio_error_unknown);
+}
+
+/**
+ *	casio_backup_mcs:
+ *	Backup all of the main memory files.
+ *
+ *	The progress displayer is called for the data flow of each file.
+ *
+ *	@arg	handle		the link handle.
+ *	@arg	mcs			the main memory to put the files into.
+ *	@arg	disp		the progress displayer.
+ *	@arg	dcookie		the progress displayer cookie.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_backup_mcs(casio_link_t *handle, casio_mcs_t *mcs,
+	casio_link_progress_t *disp, void *dcookie)
+{
+	int err; struct thecookie cookie;
+
+	/* Make the appropriate checks. */
+	chk_handle(handle);
+	chk_seven(handle);
+	chk_active(handle);
+	if (!mcs) return (casio_error_invalid);
+
+	/* Send the command. */
+	msg((ll_info, "Sending the command."));
+	if ((err = casio_seven_send_cmdmcs_reqall(handle)))
+		return (err);
+	else if (response.casio_seven_packet_type == casio_seven_type_nak
+	 && response.casio_seven_packet_code == casio_seven_err_other) {
+		msg((ll_fatal, "Main memory backup seems unsupported."));
+		return (casio_error_command);
+	} else if (response.casio_seven_packet_type != casio_seven_type_ack) {
+		msg((ll_fatal, "Didn't receive an ACK or a NAK...?"));
+		return (casio_error_unknown);
+	}
+
+	/* Prepare the cookie. */
+	cookie._count = 0;
+	cookie._err = 0;
+	cookie._mcs = mcs;
+	cookie._disp = disp;
+	cookie._disp_cookie = dcookie;
+
+	msg((ll_info, "Preparing the callbacks and running the server."));
+	memset(handle->casio_link_seven_callbacks, 0,
+		256 * sizeof(casio_seven_server_func_t*));
+	handle->casio_link_seven_callbacks[casio_seven_cmdmcs_sendfile] =
+		&receive_file;
+	err = casio_seven_serve(handle, handle->casio_link_seven_callbacks,
+		&cookie);
+	if (err) return (err);
+
+	msg((ll_info, "Got %d file(s).", cookie._count));
+	return (cookie._err);
+}
@@ -89,6 +89,9 @@ int CASIO_EXPORT casio_localmcs_find(localmcs_t *cookie,
 		pfile = &cookie->localmcs_files[i];
 		*pfile = NULL; /* important: the entry is possibly not initialized! */
 		cookie->localmcs_count++;
+	} else if (!*pfile) {
+		/* We're taking a free slot, increment the file count. */
+		cookie->localmcs_count++;
 	}
 
 	*ppfile = pfile;
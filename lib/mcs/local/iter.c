@@ -37,10 +37,13 @@ CASIO_LOCAL int CASIO_EXPORT next_mcsfile(localmcs_iter_t *cookie,
 {
 	casio_mcsfile_t *file;
 
-	if (cookie->id >= cookie->mcs->localmcs_count)
-		return (casio_error_iter);
+	/* Skip the free slots. */
+	do {
+		if (cookie->id >= cookie->mcs->localmcs_size)
+			return (casio_error_iter);
+		file = cookie->mcs->localmcs_files[cookie->id++];
+	} while (!file);
 
-	file = cookie->mcs->localmcs_files[cookie->id++];
 	*nextp = &file->casio_mcsfile_head;
 	return (0);
 }
@@ -78,7 +81,7 @@ int CASIO_EXPORT casio_localmcs_iter(localmcs_t *cookie, casio_iter_t **iterp)
 	localmcs_iter_t *icookie;
 
 	icookie = casio_alloc(1, sizeof(*icookie));
-	if (!cookie)
+	if (!icookie)
 		return (casio_error_alloc);
 
 	icookie->mcs = cookie;
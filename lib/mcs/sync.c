@@ -0,0 +1,232 @@
+/* ****************************************************************************
+ * mcs/sync.c -- synchronize a main memory with another.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#include "mcs.h"
+
+/**
+ *	collect_heads:
+ *	Get the heads of all of the files of a main memory.
+ *
+ *	The heads are copied as the iterator has to be ended before getting
+ *	files (for link main memories, it keeps the link busy).
+ *
+ *	@arg	mcs		the main memory.
+ *	@arg	headsp	the heads to allocate.
+ *	@arg	countp	the number of heads to get.
+ *	@return			the error code (0 if ok).
+ */
+
+CASIO_LOCAL int collect_heads(casio_mcs_t *mcs, casio_mcshead_t **headsp,
+	int *countp)
+{
+	casio_iter_t *iter;
+	casio_mcshead_t *head, *heads = NULL, *new_heads;
+	int err, count = 0, alloc = 0;
+
+	if ((err = casio_iter_mcsfiles(&iter, mcs)))
+		return (err);
+
+	while (!(err = casio_next_mcshead(iter, &head))) {
+		if (count == alloc) {
+			alloc = alloc ? alloc * 2 : 32;
+			new_heads = casio_alloc(alloc, sizeof(casio_mcshead_t));
+			if (!new_heads) {
+				err = casio_error_alloc;
+				break;
+			}
+
+			if (heads)
+				memcpy(new_heads, heads, count * sizeof(casio_mcshead_t));
+			casio_free(heads);
+			heads = new_heads;
+		}
+
+		memcpy(&heads[count++], head, sizeof(casio_mcshead_t));
+	}
+
+	casio_end(iter);
+	if (err != casio_error_iter) {
+		casio_free(heads);
+		return (err);
+	}
+
+	*headsp = heads;
+	*countp = count;
+	return (0);
+}
+
+/**
+ *	heads_differ:
+ *	Check if the heads of two matching files tell the files are different.
+ *
+ *	@arg	first	the first head.
+ *	@arg	second	the second head.
+ *	@return			if the files are different.
+ */
+
+CASIO_LOCAL int heads_differ(const casio_mcshead_t *first,
+	const casio_mcshead_t *second)
+{
+	return (first->casio_mcshead_type != second->casio_mcshead_type
+	 || first->casio_mcshead_size != second->casio_mcshead_size
+	 || first->casio_mcshead_count != second->casio_mcshead_count
+	 || first->casio_mcshead_width != second->casio_mcshead_width
+	 || first->casio_mcshead_height != second->casio_mcshead_height);
+}
+
+/**
+ *	same_content:
+ *	Check if a file has the same content on both sides.
+ *
+ *	@arg	dest	the destination main memory.
+ *	@arg	file	the file from the source.
+ *	@arg	head	the head of the file on the destination.
+ *	@return			if the content is the same.
+ */
+
+CASIO_LOCAL int same_content(casio_mcs_t *dest, casio_mcsfile_t *file,
+	casio_mcshead_t *head)
+{
+	casio_mcsfile_t *dest_file = NULL;
+	int same;
+
+	if (casio_get_mcsfile(dest, &dest_file, head))
+		return (0);
+
+	same = casio_fingerprint_mcsfile(file)
+		== casio_fingerprint_mcsfile(dest_file);
+	casio_free_mcsfile(dest_file);
+	return (same);
+}
+
+/**
+ *	casio_sync_mcs:
+ *	Synchronize a main memory with another one.
+ *
+ *	@arg	dest	the destination main memory.
+ *	@arg	source	the source main memory.
+ *	@arg	flags	the synchronization flags.
+ *	@arg	report	the report to fill (NULL if not needed).
+ *	@return			the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_sync_mcs(casio_mcs_t *dest, casio_mcs_t *source,
+	unsigned long flags, casio_mcssync_report_t *report)
+{
+	casio_mcssync_report_t our_report;
+	casio_mcshead_t *dest_heads = NULL, *source_heads = NULL;
+	casio_mcshead_t *head, *dest_head;
+	casio_mcsfile_t *file;
+	unsigned long size;
+	int dest_count, source_count, i, j, err;
+	char *seen = NULL;
+
+	if (!report)
+		report = &our_report;
+	memset(report, 0, sizeof(casio_mcssync_report_t));
+
+	/* List both sides. */
+
+	if ((err = collect_heads(dest, &dest_heads, &dest_count))
+	 || (err = collect_heads(source, &source_heads, &source_count)))
+		goto end;
+
+	err = casio_error_alloc;
+	if (!(seen = casio_alloc(dest_count + 1, 1)))
+		goto end;
+	memset(seen, 0, dest_count + 1);
+
+	/* Transfer the added and modified files. */
+
+	for (i = 0; i < source_count; i++) {
+		head = &source_heads[i];
+		size = head->casio_mcshead_size;
+
+		/* Find the file on the destination. */
+
+		dest_head = NULL;
+		for (j = 0; j < dest_count; j++) {
+			if (!seen[j] && casio_match_mcsfiles(head, &dest_heads[j]) == 1) {
+				seen[j] = 1;
+				dest_head = &dest_heads[j];
+				break;
+			}
+		}
+
+		/* If the heads are the same, the files are the same, unless the
+		 * size is unknown (special files) or we check the content. */
+
+		if (dest_head && !heads_differ(head, dest_head) && size
+		 && ~flags & CASIO_MCSSYNC_CONTENT) {
+			report->casio_mcssync_report_unchanged++;
+			report->casio_mcssync_report_saved += size;
+			continue;
+		}
+
+		/* Get the file. */
+
+		file = NULL;
+		if ((err = casio_get_mcsfile(source, &file, head)))
+			goto end;
+		size = file->casio_mcsfile_head.casio_mcshead_size;
+
+		if (dest_head && !heads_differ(head, dest_head)
+		 && same_content(dest, file, dest_head)) {
+			casio_free_mcsfile(file);
+			report->casio_mcssync_report_unchanged++;
+			report->casio_mcssync_report_saved += size;
+			continue;
+		}
+
+		/* Put it on the destination, which takes ownership of it. */
+
+		msg((ll_info, "Transferring '%.16s' / '%.12s'.",
+			head->casio_mcshead_group, head->casio_mcshead_name));
+		if ((err = casio_put_mcsfile(dest, file, 1)))
+			goto end;
+
+		if (dest_head)
+			report->casio_mcssync_report_modified++;
+		else
+			report->casio_mcssync_report_added++;
+		report->casio_mcssync_report_transferred += size;
+	}
+
+	/* Delete the removed files. */
+
+	if (flags & CASIO_MCSSYNC_DELETE) {
+		for (j = 0; j < dest_count; j++) {
+			if (seen[j])
+				continue;
+
+			msg((ll_info, "Deleting '%.16s' / '%.12s'.",
+				dest_heads[j].casio_mcshead_group,
+				dest_heads[j].casio_mcshead_name));
+			if ((err = casio_delete_mcsfile(dest, &dest_heads[j])))
+				goto end;
+			report->casio_mcssync_report_deleted++;
+		}
+	}
+
+	err = 0;
+end:
+	casio_free(seen);
+	casio_free(dest_heads);
+	casio_free(source_heads);
+	return (err);
+}
@@ -0,0 +1,420 @@
+/* ****************************************************************************
+ * mcsfile/cells.c -- get and set the cells of a main memory file.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#include "mcsfile.h"
+
+/**
+ *	check_file:
+ *	Check that a file has cells.
+ *
+ *	@arg	handle		the file.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int check_file(const casio_mcsfile_t *handle)
+{
+	const casio_mcshead_t *head = &handle->casio_mcsfile_head;
+
+	if (~head->casio_mcshead_flags & casio_mcsflag_valid)
+		return (casio_error_invalid);
+	switch (head->casio_mcshead_type) {
+	case casio_mcstype_list: case casio_mcstype_mat:
+	case casio_mcstype_vct:  case casio_mcstype_ssheet:
+		return (0);
+	default:
+		return (casio_error_invalid);
+	}
+}
+
+/**
+ *	check_cell:
+ *	Check that a file has cells, and that a cell is in it.
+ *
+ *	@arg	handle		the file.
+ *	@arg	x			the abscissa of the cell.
+ *	@arg	y			the ordinate of the cell.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int check_cell(const casio_mcsfile_t *handle,
+	unsigned int x, unsigned int y)
+{
+	const casio_mcshead_t *head = &handle->casio_mcsfile_head;
+	int err;
+
+	if ((err = check_file(handle)))
+		return (err);
+	if (x >= head->casio_mcshead_width || y >= head->casio_mcshead_height)
+		return (casio_error_invalid);
+	return (0);
+}
+
+/**
+ *	find_cell:
+ *	Find a cell in a spreadsheet.
+ *
+ *	@arg	handle		the spreadsheet.
+ *	@arg	x			the abscissa of the cell.
+ *	@arg	y			the ordinate of the cell.
+ *	@arg	ip			the index of the cell, or where to insert it.
+ *	@return				if the cell was found.
+ */
+
+CASIO_LOCAL int find_cell(const casio_mcsfile_t *handle,
+	unsigned int x, unsigned int y, unsigned long *ip)
+{
+	unsigned long lo = handle->casio_mcsfile_cell_columns[x];
+	unsigned long hi = handle->casio_mcsfile_cell_columns[x + 1];
+	unsigned long mid;
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (handle->casio_mcsfile_cell_rows[mid] < y)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	*ip = lo;
+	return (lo < handle->casio_mcsfile_cell_columns[x + 1]
+	 && handle->casio_mcsfile_cell_rows[lo] == y);
+}
+
+/**
+ *	insert:
+ *	Copy an array into a bigger one, leaving an element for insertion.
+ *
+ *	@arg	dest		the destination array.
+ *	@arg	src			the source array.
+ *	@arg	count		the number of elements in the source array.
+ *	@arg	size		the size of an element.
+ *	@arg	i			the index of the element to insert.
+ */
+
+CASIO_LOCAL void insert(void *dest, const void *src, unsigned long count,
+	size_t size, unsigned long i)
+{
+	unsigned char *d = dest;
+	const unsigned char *s = src;
+
+	if (count) {
+		memcpy(d, s, i * size);
+		memcpy(&d[(i + 1) * size], &s[i * size], (count - i) * size);
+	}
+	memset(&d[i * size], 0, size);
+}
+
+/**
+ *	insert_cell:
+ *	Insert an empty cell in a spreadsheet.
+ *
+ *	@arg	handle		the spreadsheet.
+ *	@arg	x			the abscissa of the cell.
+ *	@arg	y			the ordinate of the cell.
+ *	@arg	i			the index of the cell.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int insert_cell(casio_mcsfile_t *handle,
+	unsigned int x, unsigned int y, unsigned long i)
+{
+	unsigned long count = cell_count(handle), c;
+	unsigned char *flags;
+	casio_bcd_t *real, *imgn = NULL;
+	unsigned int *rows;
+
+	/* Allocate all of the arrays first, so that the file is left
+	 * untouched if one of them can't be allocated. */
+
+	flags = casio_alloc(count + 1, 1);
+	real = casio_alloc(count + 1, sizeof(casio_bcd_t));
+	rows = casio_alloc(count + 1, sizeof(unsigned int));
+	if (handle->casio_mcsfile_cell_imgn)
+		imgn = casio_alloc(count + 1, sizeof(casio_bcd_t));
+	if (!flags || !real || !rows
+	 || (handle->casio_mcsfile_cell_imgn && !imgn)) {
+		casio_free(flags);
+		casio_free(real);
+		casio_free(rows);
+		casio_free(imgn);
+		return (casio_error_alloc);
+	}
+
+	/* Copy the cells around the new one. */
+
+	insert(flags, handle->casio_mcsfile_cell_flags, count, 1, i);
+	insert(real, handle->casio_mcsfile_cell_real, count,
+		sizeof(casio_bcd_t), i);
+	insert(rows, handle->casio_mcsfile_cell_rows, count,
+		sizeof(unsigned int), i);
+	rows[i] = y;
+	if (imgn)
+		insert(imgn, handle->casio_mcsfile_cell_imgn, count,
+			sizeof(casio_bcd_t), i);
+
+	casio_free(handle->casio_mcsfile_cell_flags);
+	casio_free(handle->casio_mcsfile_cell_real);
+	casio_free(handle->casio_mcsfile_cell_rows);
+	casio_free(handle->casio_mcsfile_cell_imgn);
+	handle->casio_mcsfile_cell_flags = flags;
+	handle->casio_mcsfile_cell_real = real;
+	handle->casio_mcsfile_cell_rows = rows;
+	handle->casio_mcsfile_cell_imgn = imgn;
+
+	/* The following columns now start one cell later. */
+
+	for (c = x + 1; c <= handle->casio_mcsfile_head.casio_mcshead_width; c++)
+		handle->casio_mcsfile_cell_columns[c]++;
+	handle->casio_mcsfile_head.casio_mcshead_count = (int)(count + 1);
+	return (0);
+}
+
+/**
+ *	casio_make_mcscells_imgn:
+ *	Allocate the imaginary parts of the cells, if not already allocated.
+ *
+ *	@arg	handle		the file.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_make_mcscells_imgn(casio_mcsfile_t *handle)
+{
+	unsigned long count;
+	int err;
+
+	if (handle->casio_mcsfile_cell_imgn)
+		return (0);
+	if ((err = check_file(handle)))
+		return (err);
+	if ((err = casio_unshare_mcsfile(handle)))
+		return (err);
+
+	count = cell_count(handle);
+	if (!count)
+		return (0);
+	handle->casio_mcsfile_cell_imgn = casio_alloc(count, sizeof(casio_bcd_t));
+	if (!handle->casio_mcsfile_cell_imgn)
+		return (casio_error_alloc);
+	memset(handle->casio_mcsfile_cell_imgn, 0, count * sizeof(casio_bcd_t));
+	return (0);
+}
+
+/**
+ *	casio_get_mcscell:
+ *	Get a cell.
+ *
+ *	For spreadsheets, the cells which aren't stored are unused cells.
+ *
+ *	@arg	handle		the file.
+ *	@arg	x			the abscissa of the cell.
+ *	@arg	y			the ordinate of the cell.
+ *	@arg	cell		the cell to fill.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_get_mcscell(const casio_mcsfile_t *handle,
+	unsigned int x, unsigned int y, casio_mcscell_t *cell)
+{
+	unsigned long i;
+	int err;
+
+	if ((err = check_cell(handle, x, y)))
+		return (err);
+
+	if (handle->casio_mcsfile_cell_columns) {
+		if (!find_cell(handle, x, y, &i)) {
+			memset(cell, 0, sizeof(casio_mcscell_t));
+			return (0);
+		}
+	} else
+		i = casio_mcscell_index(handle, x, y);
+
+	cell->casio_mcscell_flags = handle->casio_mcsfile_cell_flags[i];
+	cell->casio_mcscell_real = handle->casio_mcsfile_cell_real[i];
+	if (handle->casio_mcsfile_cell_imgn)
+		cell->casio_mcscell_imgn = handle->casio_mcsfile_cell_imgn[i];
+	else
+		memset(&cell->casio_mcscell_imgn, 0, sizeof(casio_bcd_t));
+
+	return (0);
+}
+
+/**
+ *	casio_set_mcscell:
+ *	Set a cell.
+ *
+ *	The content of the file is unshared first if required.
+ *	For spreadsheets, the cell is stored if it wasn't and if it is used;
+ *	unused cells which are stored stay stored.
+ *
+ *	@arg	handle		the file.
+ *	@arg	x			the abscissa of the cell.
+ *	@arg	y			the ordinate of the cell.
+ *	@arg	cell		the cell.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_set_mcscell(casio_mcsfile_t *handle,
+	unsigned int x, unsigned int y, const casio_mcscell_t *cell)
+{
+	unsigned long i;
+	int err;
+
+	if ((err = check_cell(handle, x, y))
+	 || (err = casio_unshare_mcsfile(handle)))
+		return (err);
+
+	if (handle->casio_mcsfile_cell_columns) {
+		if (!find_cell(handle, x, y, &i)) {
+			if (!cell->casio_mcscell_flags)
+				return (0);
+			if ((err = insert_cell(handle, x, y, i)))
+				return (err);
+		}
+	} else
+		i = casio_mcscell_index(handle, x, y);
+
+	if (casio_bcd_has_special(&cell->casio_mcscell_real)
+	 && (err = casio_make_mcscells_imgn(handle)))
+		return (err);
+
+	handle->casio_mcsfile_cell_flags[i] =
+		(unsigned char)cell->casio_mcscell_flags;
+	handle->casio_mcsfile_cell_real[i] = cell->casio_mcscell_real;
+	if (handle->casio_mcsfile_cell_imgn)
+		handle->casio_mcsfile_cell_imgn[i] = cell->casio_mcscell_imgn;
+
+	return (0);
+}
+
+/* ---
+ * Iterate on the used cells.
+ * --- */
+
+typedef struct mcscells_iter_s {
+	casio_mcsfile_t *file;
+	unsigned long index;
+	unsigned int column;
+	casio_mcscell_entry_t entry;
+} mcscells_iter_t;
+
+/**
+ *	next_mcscell:
+ *	Get the next used cell.
+ *
+ *	Cells are given row by row for dense files, and column by column for
+ *	spreadsheets, which is the order they are stored in.
+ *
+ *	@arg	cookie		the iteration cookie.
+ *	@arg	nextp		the next element to get.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int CASIO_EXPORT next_mcscell(mcscells_iter_t *cookie,
+	void **nextp)
+{
+	casio_mcsfile_t *file = cookie->file;
+	casio_mcscell_entry_t *entry = &cookie->entry;
+	unsigned long count = cell_count(file), i;
+	unsigned int width = file->casio_mcsfile_head.casio_mcshead_width;
+
+	/* Skip the unused cells. */
+
+	do {
+		if (cookie->index >= count)
+			return (casio_error_iter);
+		i = cookie->index++;
+	} while (!(file->casio_mcsfile_cell_flags[i] & casio_mcscellflag_used));
+
+	/* Find where the cell is. */
+
+	if (file->casio_mcsfile_cell_columns) {
+		while (file->casio_mcsfile_cell_columns[cookie->column + 1] <= i)
+			cookie->column++;
+		entry->casio_mcscell_entry_x = cookie->column;
+		entry->casio_mcscell_entry_y = file->casio_mcsfile_cell_rows[i];
+	} else {
+		entry->casio_mcscell_entry_x = (unsigned int)(i % width);
+		entry->casio_mcscell_entry_y = (unsigned int)(i / width);
+	}
+
+	/* Get the cell. */
+
+	entry->casio_mcscell_entry_cell.casio_mcscell_flags =
+		file->casio_mcsfile_cell_flags[i];
+	entry->casio_mcscell_entry_cell.casio_mcscell_real =
+		file->casio_mcsfile_cell_real[i];
+	if (file->casio_mcsfile_cell_imgn)
+		entry->casio_mcscell_entry_cell.casio_mcscell_imgn =
+			file->casio_mcsfile_cell_imgn[i];
+	else
+		memset(&entry->casio_mcscell_entry_cell.casio_mcscell_imgn, 0,
+			sizeof(casio_bcd_t));
+
+	*nextp = entry;
+	return (0);
+}
+
+/**
+ *	end_iter:
+ *	End the iterator.
+ *
+ *	@arg	cookie		the iteration cookie.
+ */
+
+CASIO_LOCAL void CASIO_EXPORT end_iter(mcscells_iter_t *cookie)
+{
+	casio_free(cookie);
+}
+
+CASIO_LOCAL casio_iter_funcs_t const mcscells_iter_funcs = {
+	(casio_next_t *)next_mcscell,
+	NULL,
+	(casio_end_t *)end_iter
+};
+
+/**
+ *	casio_iter_mcscells:
+ *	Iterate on the used cells of a main memory file.
+ *
+ *	The file must not be modified while iterating.
+ *
+ *	@arg	iterp		the iterator to make.
+ *	@arg	handle		the file.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_iter_mcscells(casio_iter_t **iterp,
+	casio_mcsfile_t *handle)
+{
+	mcscells_iter_t *cookie;
+	int err;
+
+	if ((err = check_file(handle)))
+		return (err);
+
+	cookie = casio_alloc(1, sizeof(*cookie));
+	if (!cookie)
+		return (casio_error_alloc);
+
+	cookie->file = handle;
+	cookie->index = 0;
+	cookie->column = 0;
+
+	return (casio_iter(iterp, cookie, &mcscells_iter_funcs));
+}
@@ -19,37 +19,44 @@
 #include "mcsfile.h"
 
 /**
- *	casio_copy_mcsfile:
- *	Copy an MCS file.
+ *	copy_content:
+ *	Copy the content of an MCS file into a prepared file.
  *
- *	@arg	handle	the destination file.
+ *	@arg	handle	the destination file, prepared with the source head.
  *	@arg	orig	the source file.
  *	@return			the error code (0 if ok).
  */
 
-int CASIO_EXPORT casio_copy_mcsfile(casio_mcsfile_t *handle,
-	casio_mcsfile_t *orig)
+CASIO_LOCAL int copy_content(casio_mcsfile_t *handle, casio_mcsfile_t *orig)
 {
-	int err; casio_mcshead_t *head;
-	int n; unsigned int y, wd, ht;
-
-	/* Prepare the new file. */
-	err = casio_prepare_mcsfile(handle, &orig->casio_mcsfile_head);
-	if (err) return (err);
-	head = &handle->casio_mcsfile_head;
+	casio_mcshead_t *head = &handle->casio_mcsfile_head;
+	int n, err; unsigned int y; unsigned long count;
 
 	/* Copy the data. */
 	switch (head->casio_mcshead_type) {
 	case casio_mcstype_list: case casio_mcstype_mat:
 	case casio_mcstype_vct:  case casio_mcstype_ssheet:
-		wd = head->casio_mcshead_width;
-		ht = head->casio_mcshead_height;
-		msg((ll_info, "Copying %d*%d matrix", wd, ht));
-
-		for (y = 0; y < ht; y++) {
-			memcpy(handle->casio_mcsfile_cells[y],
-				orig->casio_mcsfile_cells[y],
-				wd * sizeof(casio_mcscell_t));
+		count = cell_count(handle);
+		msg((ll_info, "Copying %u*%u matrix", head->casio_mcshead_width,
+			head->casio_mcshead_height));
+		if (handle->casio_mcsfile_cell_columns)
+			memcpy(handle->casio_mcsfile_cell_columns,
+				orig->casio_mcsfile_cell_columns,
+				(head->casio_mcshead_width + 1) * sizeof(unsigned long));
+		if (!count) break;
+
+		if (handle->casio_mcsfile_cell_rows)
+			memcpy(handle->casio_mcsfile_cell_rows,
+				orig->casio_mcsfile_cell_rows, count * sizeof(unsigned int));
+		memcpy(handle->casio_mcsfile_cell_flags,
+			orig->casio_mcsfile_cell_flags, count);
+		memcpy(handle->casio_mcsfile_cell_real,
+			orig->casio_mcsfile_cell_real, count * sizeof(casio_bcd_t));
+		if (orig->casio_mcsfile_cell_imgn) {
+			if ((err = casio_make_mcscells_imgn(handle)))
+				return (err);
+			memcpy(handle->casio_mcsfile_cell_imgn,
+				orig->casio_mcsfile_cell_imgn, count * sizeof(casio_bcd_t));
 		}
 		break;
 
@@ -80,6 +87,115 @@ int CASIO_EXPORT casio_copy_mcsfile(casio_mcsfile_t *handle,
 		break;
 	}
 
+	return (0);
+}
+
+/**
+ *	move_file:
+ *	Move a file structure, keeping the destination allocation flag.
+ *
+ *	The variables and picture directories can point into the structure
+ *	itself, so these pointers are corrected.
+ *
+ *	@arg	handle	the destination file.
+ *	@arg	orig	the source file.
+ */
+
+CASIO_LOCAL void move_file(casio_mcsfile_t *handle, casio_mcsfile_t *orig)
+{
+	unsigned long alloc;
+
+	alloc = handle->casio_mcsfile_head.casio_mcshead_flags
+		& casio_mcsflag_alloc;
+	memcpy(handle, orig, sizeof(casio_mcsfile_t));
+	if (orig->casio_mcsfile_vars == &orig->casio_mcsfile_var)
+		handle->casio_mcsfile_vars = &handle->casio_mcsfile_var;
+	if (orig->casio_mcsfile_pics == &orig->casio_mcsfile_pic)
+		handle->casio_mcsfile_pics = &handle->casio_mcsfile_pic;
+
+	handle->casio_mcsfile_head.casio_mcshead_flags &= ~casio_mcsflag_alloc;
+	handle->casio_mcsfile_head.casio_mcshead_flags |= alloc;
+}
+
+/**
+ *	casio_copy_mcsfile:
+ *	Copy an MCS file.
+ *
+ *	The content is not copied but shared with the original file; see
+ *	`casio_unshare_mcsfile()`.
+ *
+ *	@arg	handle	the destination file.
+ *	@arg	orig	the source file.
+ *	@return			the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_copy_mcsfile(casio_mcsfile_t *handle,
+	casio_mcsfile_t *orig)
+{
+	unsigned int *refs = orig->casio_mcsfile_refs;
+	unsigned long alloc;
+
+	/* Make the reference counter if the content isn't shared yet. */
+	if (!refs) {
+		refs = casio_alloc(1, sizeof(unsigned int));
+		if (!refs) return (casio_error_alloc);
+		*refs = 1;
+		orig->casio_mcsfile_refs = refs;
+	}
+
+	/* Free the previous content of the destination. */
+	alloc = handle->casio_mcsfile_head.casio_mcshead_flags
+		& casio_mcsflag_alloc;
+	if (handle->casio_mcsfile_head.casio_mcshead_flags & casio_mcsflag_valid) {
+		handle->casio_mcsfile_head.casio_mcshead_flags &= ~casio_mcsflag_alloc;
+		casio_free_mcsfile(handle);
+	}
+
+	/* Share the content. */
+	handle->casio_mcsfile_head.casio_mcshead_flags = alloc;
+	move_file(handle, orig);
+	(*refs)++;
+
+	/* No error! */
+	return (0);
+}
+
+/**
+ *	casio_unshare_mcsfile:
+ *	Make sure the content of an MCS file isn't shared with other files,
+ *	so that it can be modified.
+ *
+ *	@arg	handle	the file.
+ *	@return			the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_unshare_mcsfile(casio_mcsfile_t *handle)
+{
+	int err; casio_mcsfile_t copy;
+	unsigned int *refs = handle->casio_mcsfile_refs;
+
+	/* Check if the content is still shared. */
+	if (!refs)
+		return (0);
+	if (*refs == 1) {
+		casio_free(refs);
+		handle->casio_mcsfile_refs = NULL;
+		return (0);
+	}
+
+	/* Copy the content. */
+	copy.casio_mcsfile_head.casio_mcshead_flags = 0;
+	err = casio_prepare_mcsfile(&copy, &handle->casio_mcsfile_head);
+	if (err) return (err);
+	if ((err = copy_content(&copy, handle))) {
+		casio_free_mcsfile(&copy);
+		return (err);
+	}
+
+	/* Release the shared content, use ours. */
+	(*refs)--;
+	move_file(handle, &copy);
+
 	/* No error! */
 	return (0);
 }
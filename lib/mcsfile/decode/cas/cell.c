@@ -41,6 +41,7 @@ CASIO_LOCAL int decode_cell(casio_stream_t *buffer, casio_mcscell_t *cell,
 	casio_casbcd_t wkg;
 
 	cell->casio_mcscell_flags = casio_mcscellflag_used;
+	memset(&cell->casio_mcscell_imgn, 0, sizeof(casio_bcd_t));
 
 	/* read position */
 	DREAD(fx) *x = be16toh(fx) - 1;
@@ -89,8 +90,9 @@ int CASIO_EXPORT casio_decode_caspart_matrix(casio_mcsfile_t *handle,
 	err = decode_cell(buffer, &cell, &x, &y);
 	if (err) return (err);
 
-	/* save the cell (FIXME: secure) */
-	handle->casio_mcsfile_cells[y][x] = cell;
+	/* save the cell */
+	if ((err = casio_set_mcscell(handle, x, y, &cell)))
+		return (err);
 
 	/* check if its the last cell */
 	if (y == handle->casio_mcsfile_head.casio_mcshead_height - 1
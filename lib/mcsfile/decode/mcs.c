@@ -115,6 +115,7 @@ int CASIO_EXPORT casio_decode_mcsfile_head(casio_mcshead_t *head,
 	/* Make the lib abstract types out of this raw information. */
 
 	casio_correct_mcshead(head, 0);
+	casio_key_mcshead(head);
 	msg((ll_info, "libcasio file type is 0x%08lX", head->casio_mcshead_type));
 
 	ifmsg(casio_mcshead_uses_id(head), (ll_info,
@@ -179,15 +180,16 @@ int CASIO_EXPORT casio_decode_mcsfile(casio_mcsfile_t **handle,
 
 		msg((ll_info, "Making a limited buffer of "
 			"0x%" CASIO_PRIXSIZE " bytes", head.casio_mcshead_size));
-		err = casio_open_limited(&lbuf, buffer, head.casio_mcshead_size);
+		err = casio_open_filter(&lbuf, buffer);
 		if (err)
 			goto fail;
+		casio_filter_limit(lbuf, head.casio_mcshead_size);
 
 		/* Call the decode error. */
 
 		msg((ll_info, "Decoding the file with the specific function."));
 		err = (*decode)(handle, lbuf, &head);
-		alterr = casio_empty_limited(lbuf);
+		alterr = casio_empty_filter(lbuf);
 		casio_close(lbuf);
 
 		/* Check the error. */
@@ -18,6 +18,10 @@
  * ************************************************************************* */
 #include "../decode.h"
 
+/* Number of cells read at once. */
+
+#define CELLS 64
+
 /**
  *	casio_decode_mcs_cells:
  *	Decode a cells tab.
@@ -34,9 +38,9 @@ int CASIO_EXPORT casio_decode_mcs_cells(casio_mcsfile_t **h,
 	int err = casio_error_alloc;
 	casio_mcs_cellsheader_t hd;
 	casio_mcsfile_t *handle;
-	casio_mcscell_t **tab;
+	casio_mcsbcd_t raw[CELLS];
 	int one_imgn = 0;
-	unsigned long cw, ch, cx, cy;
+	unsigned long cw, ch, i, count, num;
 
 	/* Read header. */
 
@@ -62,50 +66,50 @@ int CASIO_EXPORT casio_decode_mcs_cells(casio_mcsfile_t **h,
 		return (err);
 	handle = *h;
 
-	/* Main copying loop. */
-
-	tab = handle->casio_mcsfile_cells;
-	for (cy = 0; cy < ch; cy++) for (cx = 0; cx < cw; cx++) {
-		casio_mcscell_t *cell = &tab[cy][cx];
-		casio_mcsbcd_t   rawbcd;
-
-		/* Read the cell. */
+	/* Main copying loop; the cells are stored in the same order as
+	 * in the planes, they are read and converted by blocks. */
 
-		GDREAD(rawbcd)
-
-		/* store it. */
-		one_imgn |= casio_bcd_frommcs(&cell->casio_mcscell_real, &rawbcd);
-		cell->casio_mcscell_flags = casio_mcscellflag_used;
+	count = cw * ch;
+	for (i = 0; i < count; i += num) {
+		num = min(count - i, CELLS);
+		GREAD(raw, num * sizeof(casio_mcsbcd_t))
+		one_imgn |= casio_bcd_frommcs_array(
+			&handle->casio_mcsfile_cell_real[i], raw, num);
 	}
+	memset(handle->casio_mcsfile_cell_flags, casio_mcscellflag_used, count);
 
 	/* check imaginary parts */
-	if (one_imgn) for (cy = 0; cy < ch; cy++) for (cx = 0; cx < cw; cx++) {
-		casio_mcscell_t *cell = &tab[cy][cx];
-		casio_mcsbcd_t   rawbcd;
-
-		GDREAD(rawbcd)
-		casio_bcd_frommcs(&cell->casio_mcscell_imgn, &rawbcd);
+	if (one_imgn) {
+		if ((err = casio_make_mcscells_imgn(handle)))
+			goto fail;
+
+		for (i = 0; i < count; i += num) {
+			num = min(count - i, CELLS);
+			GREAD(raw, num * sizeof(casio_mcsbcd_t))
+			casio_bcd_frommcs_array(&handle->casio_mcsfile_cell_imgn[i],
+				raw, num);
+		}
 	}
 
 #if !defined(LIBCASIO_DISABLED_LOG)
 	/* logging loop */
 	if (islog(ll_info)) {
 		char rbuf[CASIO_BCD_GOODBUFSIZE], ibuf[CASIO_BCD_GOODBUFSIZE];
-		for (cy = 0; cy < ch; cy++) for (cx = 0; cx < cw; cx++) {
+		for (i = 0; i < count; i++) {
 			casio_bcdtoa(rbuf, CASIO_BCD_GOODBUFSIZE,
-				&tab[cy][cx].casio_mcscell_real);
+				&handle->casio_mcsfile_cell_real[i]);
 
-			if (casio_bcd_has_special(&tab[cy][cx].casio_mcscell_real)) {
-				casio_bcd_t ibcd = tab[cy][cx].casio_mcscell_imgn;
+			if (casio_bcd_has_special(&handle->casio_mcsfile_cell_real[i])) {
+				casio_bcd_t ibcd = handle->casio_mcsfile_cell_imgn[i];
 				int sign = casio_bcd_is_negative(&ibcd) ? '-' : '+';
 				ibcd.casio_bcd_flags &= ~casio_bcdflag_neg;
 
 				casio_bcdtoa(ibuf, CASIO_BCD_GOODBUFSIZE, &ibcd);
 				msg((ll_info, "[%lu][%lu] %s %c %si",
-					cy, cx, rbuf, sign, ibuf));
+					i / cw, i % cw, rbuf, sign, ibuf));
 			} else
 				msg((ll_info, "[%lu][%lu] %s",
-					cy, cx, rbuf));
+					i / cw, i % cw, rbuf));
 		}
 	}
 #endif
@@ -18,10 +18,65 @@
  * ************************************************************************* */
 #include "../decode.h"
 
+/* Temporary cells, in the order they are stored in the file: column by
+ * column, then row by row. */
+
+struct cells {
+	unsigned long count, alloc;
+	unsigned int *rows;
+	casio_bcd_t *real;
+};
+
+/**
+ *	add_cell:
+ *	Add a cell to the temporary cells.
+ *
+ *	@arg	cells		the temporary cells.
+ *	@arg	y			the row of the cell.
+ *	@arg	raw			the raw cell.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int add_cell(struct cells *cells, unsigned int y,
+	const casio_mcsbcd_t *raw)
+{
+	unsigned int *rows;
+	casio_bcd_t *real;
+
+	if (cells->count == cells->alloc) {
+		cells->alloc = cells->alloc ? cells->alloc * 2 : 64;
+		rows = casio_alloc(cells->alloc, sizeof(unsigned int));
+		real = casio_alloc(cells->alloc, sizeof(casio_bcd_t));
+		if (!rows || !real) {
+			casio_free(rows);
+			casio_free(real);
+			return (casio_error_alloc);
+		}
+
+		if (cells->count) {
+			memcpy(rows, cells->rows, cells->count * sizeof(unsigned int));
+			memcpy(real, cells->real, cells->count * sizeof(casio_bcd_t));
+		}
+		casio_free(cells->rows);
+		casio_free(cells->real);
+		cells->rows = rows;
+		cells->real = real;
+	}
+
+	cells->rows[cells->count] = y;
+	casio_bcd_frommcs(&cells->real[cells->count], raw);
+	cells->count++;
+	return (0);
+}
+
 /**
  *	casio_decode_mcs_spreadsheet:
  *	Decode a spreadsheet.
  *
+ *	Only the used cells are read and stored, so the time and memory this
+ *	takes is proportional to the number of used cells, not to the size of
+ *	the spreadsheet.
+ *
  *	@arg	h			the handle to make.
  *	@arg	buffer		the buffer to read from.
  *	@arg	head		the pre-filled head to complete and use.
@@ -35,10 +90,11 @@ int CASIO_EXPORT casio_decode_mcs_spreadsheet(casio_mcsfile_t **h,
 	casio_mcsfile_t *handle;
 	casio_mcs_spreadsheet_header_t hd;
 	casio_mcs_spreadsheet_subheader_t shd;
-	casio_mcscell_t *cells = NULL, **tab;
-	unsigned long colcount; int cells_count = 0;
-	unsigned long rows = 0, cols = 0;
-	unsigned long x, y;
+	casio_uint32_t *column_directory = NULL;
+	unsigned long *columns = NULL;
+	struct cells cells = {0, 0, NULL, NULL};
+	unsigned long colcount, c;
+	unsigned int rows = 0, cols = 0, y;
 
 	/* Read the header. */
 
@@ -56,84 +112,83 @@ int CASIO_EXPORT casio_decode_mcs_spreadsheet(casio_mcsfile_t **h,
 
 	/* Prepare. */
 
-	cells = casio_alloc(1000 * colcount, sizeof(casio_mcscell_t));
-	memset(cells, 0, sizeof(casio_mcscell_t) * 1000 * colcount);
+	err = casio_error_alloc;
+	column_directory = casio_alloc(colcount, sizeof(casio_uint32_t));
+	columns = casio_alloc(colcount + 1, sizeof(unsigned long));
+	if ((colcount && !column_directory) || !columns)
+		goto fail;
 
 	msg((ll_info, "%lu columns to read!", colcount));
 
-	if (colcount) {
-		casio_uint32_t column_directory[25]; /* FIXME */
-		unsigned long c;
-
-		/* get the column directory */
-		GREAD(&column_directory, sizeof(casio_uint32_t) * colcount)
-
-		/* browse columns */
-		for (c = 0; c < colcount; c++) {
-			unsigned char row_directory[0x80];
-			unsigned char *rd = row_directory;
-			int bit = 1 << 7;
-
-			/* check if column is empty */
-			if (!column_directory[c])
-				continue;
-
-			/* get the row directory */
-			GREAD(&row_directory, (size_t)0x80)
-
-			/* explore each cell */
-			for (y = 0; y < 1000; y++) {
-				/* check if used */
-				if (*rd & bit) {
-					casio_mcscell_t *cell;
-					casio_mcsbcd_t rawcell;
-
-					/* get cell */
-					GDREAD(rawcell)
-
-					/* read cell */
-					cell = &cells[c * 1000 + 1];
-					casio_bcd_frommcs(&cell->casio_mcscell_real, &rawcell);
-					cell->casio_mcscell_flags = casio_mcscellflag_used;
-
-					/* check things (max row, max col, cells count) */
-					rows = max(rows, y);
-					cols = c;
-					cells_count++;
-				}
-
-				/* iterate bit and rd */
-				rd += (bit & 1);
-				bit = (bit >> 1) | ((bit & 1) << 7);
-			}
-		}
-	}
+	/* Get the column directory. */
+
+	if (colcount)
+		GREAD(column_directory, sizeof(casio_uint32_t) * colcount)
+
+	/* Browse the columns. */
+
+	for (c = 0; c < colcount; c++) {
+		unsigned char row_directory[0x80];
+		unsigned char *rd = row_directory;
+		int bit = 1 << 7;
+
+		columns[c] = cells.count;
+
+		/* check if column is empty */
+		if (!column_directory[c])
+			continue;
 
-	/* We have max rows and columns, increment to have sizes. */
+		/* get the row directory */
+		GREAD(&row_directory, (size_t)0x80)
 
-	rows++;
-	cols++;
+		/* get each used cell */
+		for (y = 0; y < 1000; y++) {
+			if (*rd & bit) {
+				casio_mcsbcd_t rawcell;
 
-	/* Create final tab. */
+				GDREAD(rawcell)
+				if ((err = add_cell(&cells, y, &rawcell)))
+					goto fail;
 
-	head->casio_mcshead_width = 0; head->casio_mcshead_height = 0;
-	if (cells_count) {
-		head->casio_mcshead_width = cols;
-		head->casio_mcshead_height = rows;
+				rows = max(rows, y + 1);
+				cols = c + 1;
+			}
+
+			/* iterate bit and rd */
+			rd += (bit & 1);
+			bit = (bit >> 1) | ((bit & 1) << 7);
+		}
 	}
+	columns[colcount] = cells.count;
+
+	/* Create the final file. */
+
+	head->casio_mcshead_width = cols;
+	head->casio_mcshead_height = rows;
+	head->casio_mcshead_count = (int)cells.count;
 	err = casio_make_mcsfile(h, head);
-	if (err) return (err);
+	if (err) goto fail;
 	handle = *h;
 
-	/* Main copying loop. */
-
-	tab = handle->casio_mcsfile_cells;
-	for (y = 0; y < head->casio_mcshead_height; y++)
-	  for (x = 0; x < head->casio_mcshead_width; x++)
-		tab[y][x] = cells[x * 1000 + y];
+	/* Copy the cells; as the columns after the last used column are
+	 * dropped, the column index array is truncated. */
+
+	memcpy(handle->casio_mcsfile_cell_columns, columns,
+		(cols + 1) * sizeof(unsigned long));
+	if (cells.count) {
+		memset(handle->casio_mcsfile_cell_flags, casio_mcscellflag_used,
+			cells.count);
+		memcpy(handle->casio_mcsfile_cell_real, cells.real,
+			cells.count * sizeof(casio_bcd_t));
+		memcpy(handle->casio_mcsfile_cell_rows, cells.rows,
+			cells.count * sizeof(unsigned int));
+	}
 
 	err = 0;
 fail:
-	casio_free(cells);
+	casio_free(column_directory);
+	casio_free(columns);
+	casio_free(cells.rows);
+	casio_free(cells.real);
 	return (err);
 }
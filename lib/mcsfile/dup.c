@@ -35,6 +35,7 @@ int CASIO_EXPORT casio_duplicate_mcsfile(casio_mcsfile_t **h,
 	/* Make the handle. */
 	*h = casio_alloc(1, sizeof(casio_mcsfile_t)); handle = *h;
 	if (!handle) return (casio_error_alloc);
+	handle->casio_mcsfile_head.casio_mcshead_flags = 0;
 
 	/* Copy the file. */
 	err = casio_copy_mcsfile(handle, orig);
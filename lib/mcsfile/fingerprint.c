@@ -0,0 +1,178 @@
+/* ****************************************************************************
+ * mcsfile/fingerprint.c -- make a fingerprint of a main memory file.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * The fingerprint is a 32-bit FNV-1a hash of the decoded content, so that
+ * it doesn't depend on the format the file was read from. It is made to
+ * detect changes, not to resist attacks.
+ * ************************************************************************* */
+#include "mcsfile.h"
+
+#define FNV_OFFSET 0x811C9DC5UL
+#define FNV_PRIME  0x01000193UL
+
+/**
+ *	hash:
+ *	Add bytes to the fingerprint.
+ *
+ *	@arg	fp		the current fingerprint.
+ *	@arg	mem		the bytes.
+ *	@arg	size	the number of bytes.
+ *	@return			the new fingerprint.
+ */
+
+CASIO_LOCAL casio_uint32_t hash(casio_uint32_t fp, const void *mem,
+	size_t size)
+{
+	const unsigned char *m = mem;
+
+	while (size--)
+		fp = ((fp ^ *m++) * FNV_PRIME) & 0xFFFFFFFFUL;
+	return (fp);
+}
+
+/**
+ *	hash_uint:
+ *	Add an integer to the fingerprint, in big endian.
+ *
+ *	@arg	fp		the current fingerprint.
+ *	@arg	value	the integer.
+ *	@return			the new fingerprint.
+ */
+
+CASIO_LOCAL casio_uint32_t hash_uint(casio_uint32_t fp, unsigned int value)
+{
+	unsigned char bytes[4];
+
+	bytes[0] = (value >> 24) & 0xFF;
+	bytes[1] = (value >> 16) & 0xFF;
+	bytes[2] = (value >>  8) & 0xFF;
+	bytes[3] =  value        & 0xFF;
+	return (hash(fp, bytes, 4));
+}
+
+/**
+ *	hash_bcd:
+ *	Add a BCD number to the fingerprint.
+ *
+ *	@arg	fp		the current fingerprint.
+ *	@arg	bcd		the number.
+ *	@return			the new fingerprint.
+ */
+
+CASIO_LOCAL casio_uint32_t hash_bcd(casio_uint32_t fp, const casio_bcd_t *bcd)
+{
+	fp = hash(fp, &bcd->casio_bcd_flags, 1);
+	fp = hash(fp, &bcd->casio_bcd_exp, 1);
+	return (hash(fp, bcd->casio_bcd_mant, CASIO_BCD_MANTISSA_SIZE));
+}
+
+/**
+ *	hash_cells:
+ *	Add cells to the fingerprint.
+ *
+ *	The cells are added field by field, as the padding bytes of the
+ *	structure are undefined.
+ *
+ *	@arg	fp		the current fingerprint.
+ *	@arg	cells	the cells.
+ *	@arg	count	the number of cells.
+ *	@return			the new fingerprint.
+ */
+
+CASIO_LOCAL casio_uint32_t hash_cells(casio_uint32_t fp,
+	const casio_mcscell_t *cells, size_t count)
+{
+	for (; count; count--, cells++) {
+		fp = hash_uint(fp, cells->casio_mcscell_flags);
+		fp = hash_bcd(fp, &cells->casio_mcscell_real);
+		fp = hash_bcd(fp, &cells->casio_mcscell_imgn);
+	}
+
+	return (fp);
+}
+
+/**
+ *	casio_fingerprint_mcsfile:
+ *	Make the fingerprint of a main memory file content.
+ *
+ *	Two files with the same content have the same fingerprint; two files
+ *	with different contents most probably don't.
+ *
+ *	@arg	file	the main memory file.
+ *	@return			the fingerprint.
+ */
+
+casio_uint32_t CASIO_EXPORT casio_fingerprint_mcsfile(
+	const casio_mcsfile_t *file)
+{
+	const casio_mcshead_t *head = &file->casio_mcsfile_head;
+	casio_uint32_t fp = FNV_OFFSET;
+	unsigned long width = head->casio_mcshead_width;
+	unsigned long height = head->casio_mcshead_height;
+	const casio_bcd_t zero = {0, 0, {0}};
+	unsigned long i; unsigned int y; int n;
+
+	switch (head->casio_mcshead_type) {
+	case casio_mcstype_list: case casio_mcstype_mat:
+	case casio_mcstype_vct:  case casio_mcstype_ssheet:
+		if (file->casio_mcsfile_cell_columns) {
+			for (i = 0; i <= width; i++)
+				fp = hash_uint(fp,
+					(unsigned int)file->casio_mcsfile_cell_columns[i]);
+			for (i = 0; i < cell_count(file); i++)
+				fp = hash_uint(fp, file->casio_mcsfile_cell_rows[i]);
+		}
+		for (i = 0; i < cell_count(file); i++) {
+			fp = hash_uint(fp, file->casio_mcsfile_cell_flags[i]);
+			fp = hash_bcd(fp, &file->casio_mcsfile_cell_real[i]);
+			fp = hash_bcd(fp, file->casio_mcsfile_cell_imgn
+				? &file->casio_mcsfile_cell_imgn[i] : &zero);
+		}
+		break;
+
+	case casio_mcstype_alphamem:
+		fp = hash_cells(fp, file->casio_mcsfile_vars,
+			head->casio_mcshead_count);
+		break;
+
+	case casio_mcstype_pict: case casio_mcstype_capt:
+		for (n = 0; n < head->casio_mcshead_count; n++)
+		  for (y = 0; y < height; y++)
+			fp = hash(fp, file->casio_mcsfile_pics[n][y],
+				width * sizeof(casio_pixel_t));
+		break;
+
+	case casio_mcstype_setup:
+		fp = hash_uint(fp, file->casio_mcsfile_setup.casio_setup_iflags);
+		fp = hash_uint(fp, file->casio_mcsfile_setup.casio_setup_wflags);
+		fp = hash_uint(fp, file->casio_mcsfile_setup.casio_setup_mflags);
+		fp = hash(fp, file->casio_mcsfile_setup.casio_setup_vals,
+			casio_setup_nvals);
+		break;
+
+	case casio_mcstype_end: case casio_mcstype_string: break;
+
+	default:
+		if (file->casio_mcsfile_content)
+			fp = hash(fp, file->casio_mcsfile_content,
+				head->casio_mcshead_size);
+		break;
+	}
+
+	return (fp);
+}
@@ -19,28 +19,25 @@
 #include "mcsfile.h"
 
 /**
- *	casio_free_mcsfile:
- *	Free an MCS file handle content.
+ *	free_content:
+ *	Free the allocated content of an MCS file.
  *
- *	@arg	handle		the main memory file handle to free.
+ *	@arg	handle		the main memory file handle.
  */
 
-void CASIO_EXPORT casio_free_mcsfile(casio_mcsfile_t *handle)
+CASIO_LOCAL void free_content(casio_mcsfile_t *handle)
 {
 	int i;
 
-	/* check if exists */
-	if (!handle) return ;
-
 	switch (handle->casio_mcsfile_head.casio_mcshead_type) {
 	/* free the cells */
 	case casio_mcstype_mat:  case casio_mcstype_vct:
 	case casio_mcstype_list: case casio_mcstype_ssheet:
-		if (handle->casio_mcsfile_head.casio_mcshead_width
-		 && handle->casio_mcsfile_head.casio_mcshead_height) {
-			casio_free(handle->casio_mcsfile_cells[0]);
-			casio_free(handle->casio_mcsfile_cells);
-		}
+		casio_free(handle->casio_mcsfile_cell_flags);
+		casio_free(handle->casio_mcsfile_cell_real);
+		casio_free(handle->casio_mcsfile_cell_imgn);
+		casio_free(handle->casio_mcsfile_cell_rows);
+		casio_free(handle->casio_mcsfile_cell_columns);
 		break;
 
 	/* free the set of pixels */
@@ -67,7 +64,34 @@ void CASIO_EXPORT casio_free_mcsfile(casio_mcsfile_t *handle)
 	default:
 		casio_free(handle->casio_mcsfile_content);
 	}
+}
+
+/**
+ *	casio_free_mcsfile:
+ *	Free an MCS file handle content.
+ *
+ *	If the content is shared with other files, it is only freed with
+ *	the last one.
+ *
+ *	@arg	handle		the main memory file handle to free.
+ */
+
+void CASIO_EXPORT casio_free_mcsfile(casio_mcsfile_t *handle)
+{
+	unsigned int *refs;
+
+	/* check if exists */
+	if (!handle) return ;
+
+	/* release our reference to the content */
+	refs = handle->casio_mcsfile_refs;
+	handle->casio_mcsfile_refs = NULL;
+	if (refs && --*refs)
+		goto end;
+	casio_free(refs);
+	free_content(handle);
 
+end:
 	/* free the content */
 	handle->casio_mcsfile_head.casio_mcshead_flags &= ~casio_mcsflag_valid;
 	if (handle->casio_mcsfile_head.casio_mcshead_flags & casio_mcsflag_alloc)
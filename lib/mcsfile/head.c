@@ -50,6 +50,11 @@ int CASIO_EXPORT casio_correct_mcshead(casio_mcshead_t *head,
 	msg((ll_info, "Converting head from info type 0x%02X to 0x%02X",
 		inifor >> 24, mcsfor >> 24));
 
+	/* The type and names might change, so the key might not be up to
+	 * date anymore. */
+
+	head->casio_mcshead_flags &= ~casio_mcsflag_keyed;
+
 	/* If we ought to convert from any specific type,
 	 * we have to convert to abstract first. */
 
@@ -18,6 +18,93 @@
  * ************************************************************************* */
 #include "mcsfile.h"
 
+#define FNV_OFFSET 0x811C9DC5UL
+#define FNV_PRIME  0x01000193UL
+
+/**
+ *	hash:
+ *	Add a string to a key (FNV-1a).
+ *
+ *	@arg	key		the current key.
+ *	@arg	str		the string.
+ *	@arg	size	the maximum size of the string.
+ *	@return			the new key.
+ */
+
+CASIO_LOCAL casio_uint32_t hash(casio_uint32_t key, const char *str,
+	size_t size)
+{
+	for (; size && *str; size--)
+		key = ((key ^ (unsigned char)*str++) * FNV_PRIME) & 0xFFFFFFFFUL;
+
+	/* Separate the fields. */
+	return (((key ^ 0xFF) * FNV_PRIME) & 0xFFFFFFFFUL);
+}
+
+/**
+ *	hash_uint:
+ *	Add an integer to a key.
+ *
+ *	@arg	key		the current key.
+ *	@arg	value	the integer.
+ *	@return			the new key.
+ */
+
+CASIO_LOCAL casio_uint32_t hash_uint(casio_uint32_t key, unsigned long value)
+{
+	int i;
+
+	for (i = 24; i >= 0; i -= 8)
+		key = ((key ^ ((value >> i) & 0xFF)) * FNV_PRIME) & 0xFFFFFFFFUL;
+	return (key);
+}
+
+/**
+ *	casio_key_mcshead:
+ *	Compute the matching key of a head.
+ *
+ *	The key is made out of what `casio_match_mcsfiles()` compares, so that
+ *	matching heads have the same key.
+ *
+ *	@arg	head	the head.
+ *	@return			the key.
+ */
+
+casio_uint32_t CASIO_EXPORT casio_key_mcshead(casio_mcshead_t *head)
+{
+	casio_uint32_t key = FNV_OFFSET;
+	unsigned long mcsfor;
+
+	key = hash_uint(key, head->casio_mcshead_type);
+	if (head->casio_mcshead_type) {
+		if (casio_mcshead_uses_id(head))
+			key = hash_uint(key, head->casio_mcshead_id);
+		else
+			key = hash(key, head->casio_mcshead_name, 12);
+	} else {
+		mcsfor = head->casio_mcshead_flags & casio_mcsfor_mask;
+		key = hash_uint(key, mcsfor >> 24);
+		switch (mcsfor) {
+		case casio_mcsfor_mcs:
+			key = hash(key, head->casio_mcshead_group, 16);
+			key = hash(key, head->casio_mcshead_dirname, 8);
+			key = hash(key, head->casio_mcshead_name, 8);
+			break;
+
+		case casio_mcsfor_cas:
+		case casio_mcsfor_caspro:
+			key = hash(key, head->casio_mcshead_datatype, 2);
+			break;
+
+		default: break;
+		}
+	}
+
+	head->casio_mcshead_key = key;
+	head->casio_mcshead_flags |= casio_mcsflag_keyed;
+	return (key);
+}
+
 /**
  *	casio_match_mcsfiles:
  *	Check if two main memory files match.
@@ -34,6 +121,13 @@ int casio_match_mcsfiles(casio_mcshead_t *first, casio_mcshead_t *second)
 	/* Check that the two heads are defined. */
 	if (!first || !second) return (casio_error_invalid);
 
+	/* If both heads have a key, the heads can only match if the keys
+	 * are the same (but they could be the same by chance). */
+	if (first->casio_mcshead_flags & second->casio_mcshead_flags
+	  & casio_mcsflag_keyed
+	 && first->casio_mcshead_key != second->casio_mcshead_key)
+		return (0);
+
 	/* Compare. */
 	if (first->casio_mcshead_type != second->casio_mcshead_type)
 		return (0);
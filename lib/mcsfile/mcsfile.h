@@ -63,6 +63,20 @@
 # define DWRITE(CASIO__OBJECT) \
 	WRITE(&(CASIO__OBJECT), sizeof(CASIO__OBJECT))
 
+/* ---
+ * Cell utilities.
+ * --- */
+
+/* Number of cells stored in the planes (spreadsheets only store the
+ * used cells). */
+
+# define cell_count(H) \
+	((H)->casio_mcsfile_head.casio_mcshead_type == casio_mcstype_ssheet \
+	? ((H)->casio_mcsfile_head.casio_mcshead_count > 0 \
+		? (unsigned long)(H)->casio_mcsfile_head.casio_mcshead_count : 0) \
+	: (unsigned long)(H)->casio_mcsfile_head.casio_mcshead_width \
+		* (H)->casio_mcsfile_head.casio_mcshead_height)
+
 /* ---
  * Picture utilities.
  * --- */
@@ -35,7 +35,7 @@ int CASIO_EXPORT casio_prepare_mcsfile(casio_mcsfile_t *handle,
 	const casio_mcshead_t *rawhead)
 {
 	casio_mcshead_t *head;
-	unsigned int y, wd, ht;
+	unsigned long wd, ht, count;
 	int i, j;
 
 	/* Check the validity of the handle. */
@@ -49,6 +49,7 @@ int CASIO_EXPORT casio_prepare_mcsfile(casio_mcsfile_t *handle,
 	memcpy(&handle->casio_mcsfile_head, rawhead, sizeof(casio_mcshead_t));
 	head->casio_mcshead_flags &= ~casio_mcsflag_alloc;
 	head->casio_mcshead_flags |=  casio_mcsflag_valid;
+	casio_key_mcshead(head);
 
 	switch (head->casio_mcshead_type) {
 	/* allocate the cells */
@@ -56,20 +57,45 @@ int CASIO_EXPORT casio_prepare_mcsfile(casio_mcsfile_t *handle,
 	case casio_mcstype_vct:  case casio_mcstype_ssheet:
 		wd = head->casio_mcshead_width;
 		ht = head->casio_mcshead_height;
-		msg((ll_info, "Preparing %d*%d matrix", wd, ht));
-
-		if (wd && ht) {
-			handle->casio_mcsfile_cells =
-				casio_alloc(ht, sizeof(casio_mcscell_t*));
-			if (!handle->casio_mcsfile_cells) goto fail;
-			handle->casio_mcsfile_cells[0] =
-				casio_alloc(wd * ht, sizeof(casio_mcscell_t));
-			if (!handle->casio_mcsfile_cells[0]) {
-				casio_free(handle->casio_mcsfile_cells); goto fail; }
-
-			for (y = 1; y < ht; y++)
-				handle->casio_mcsfile_cells[y] = &handle->casio_mcsfile_cells
-					[0][handle->casio_mcsfile_head.casio_mcshead_width * y];
+		count = cell_count(handle);
+		msg((ll_info, "Preparing %lu*%lu matrix", wd, ht));
+
+		/* spreadsheets only store the used cells, the columns tell where
+		 * they are (all of the columns are empty for now) */
+		if (head->casio_mcshead_type == casio_mcstype_ssheet) {
+			handle->casio_mcsfile_cell_columns =
+				casio_alloc(wd + 1, sizeof(unsigned long));
+			if (!handle->casio_mcsfile_cell_columns) goto fail;
+			memset(handle->casio_mcsfile_cell_columns, 0,
+				(wd + 1) * sizeof(unsigned long));
+
+			if (count) {
+				handle->casio_mcsfile_cell_rows =
+					casio_alloc(count, sizeof(unsigned int));
+				if (!handle->casio_mcsfile_cell_rows) {
+					casio_free(handle->casio_mcsfile_cell_columns);
+					goto fail;
+				}
+			}
+		}
+
+		/* the imaginary parts are only allocated when required */
+		if (count) {
+			handle->casio_mcsfile_cell_flags = casio_alloc(count, 1);
+			handle->casio_mcsfile_cell_real =
+				casio_alloc(count, sizeof(casio_bcd_t));
+			if (!handle->casio_mcsfile_cell_flags
+			 || !handle->casio_mcsfile_cell_real) {
+				casio_free(handle->casio_mcsfile_cell_flags);
+				casio_free(handle->casio_mcsfile_cell_real);
+				casio_free(handle->casio_mcsfile_cell_rows);
+				casio_free(handle->casio_mcsfile_cell_columns);
+				goto fail;
+			}
+
+			memset(handle->casio_mcsfile_cell_flags, 0, count);
+			memset(handle->casio_mcsfile_cell_real, 0,
+				count * sizeof(casio_bcd_t));
 		}
 		break;
 
@@ -270,6 +270,24 @@ CASIO_LOCAL const struct group_corresp mcs_groups[] = {
 	{NULL, 0, NULL}
 };
 
+/*	Indexes of the groups in `mcs_groups`, sorted by group name (byte order),
+ *	for the binary search in `find_group`. The table above keeps its order as
+ *	it is the order in which the files are sorted.
+ *	As no group name is a prefix of another, the name of a group is the only
+ *	name that can be at the beginning of the full group name. */
+
+CASIO_LOCAL const unsigned char mcs_groups_sorted[] = {
+	22 /* 3DGRAPH */,   23 /* @GEOM */,     24 /* @PROBSIM */,
+	 1 /* ALPHA MEM */, 11 /* CAPT */,      14 /* CONICS */,
+	15 /* DYNA MEM */,  17 /* ECON4_ */,    16 /* Econ3Now */,
+	18 /* FINANCIAL */,  3 /* LIST */,       4 /* LISTFILE */,
+	 5 /* MAT */,       25 /* PICTPLOT */,  10 /* PICTURE */,
+	 7 /* PROGRAM */,   19 /* RECURSION */, 13 /* S-SHEET */,
+	 0 /* SETUP */,     20 /* STAT */,       2 /* STRING */,
+	12 /* SYSTEM */,    21 /* TABLE */,      9 /* V-WIN */,
+	 6 /* VCT */,        8 /* Y=DATA */
+};
+
 /* ---
  * Main functions.
  * --- */
@@ -303,6 +321,36 @@ CASIO_LOCAL int get_number(const char *s, int *num, int isnum)
 	return (0);
 }
 
+/**
+ *	find_group:
+ *	Find the group correspondance from the full group name.
+ *
+ *	@arg	gname		the full group name.
+ *	@return				the group correspondance (NULL if not found).
+ */
+
+CASIO_LOCAL const struct group_corresp *find_group(const char *gname)
+{
+	const struct group_corresp *g;
+	size_t lo = 0, hi = sizeof(mcs_groups_sorted), mid;
+	int cmp;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		g = &mcs_groups[mcs_groups_sorted[mid]];
+
+		cmp = strncmp(g->name, gname, strlen(g->name));
+		if (!cmp)
+			return (g);
+		if (cmp < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return (NULL);
+}
+
 /**
  *	casio_correct_mcshead_from_mcs:
  *	Make libcasio abstract data from raw MCS identification data.
@@ -325,21 +373,10 @@ int CASIO_EXPORT casio_correct_mcshead_from_mcs(casio_mcshead_t *head)
 
 	/* Look for group correspondance. */
 
-	for (g = mcs_groups; g->types; g++) {
-		size_t pl = strlen(g->name);
-
-		/* Check if our pattern is there. */
-
-		if (strncmp(g->name, gname, pl))
-			continue;
-		if ((g->flags & arg)
-		 && get_number(&gname[pl], &gid, g->flags & arg_is_num))
-			continue;
-
-		break;
-	}
-
-	if (!g->types)
+	if (!(g = find_group(gname)))
+		goto notfound;
+	if ((g->flags & arg)
+	 && get_number(&gname[strlen(g->name)], &gid, g->flags & arg_is_num))
 		goto notfound;
 
 	/* Look for the type correspondance. */
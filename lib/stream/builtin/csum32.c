@@ -18,70 +18,8 @@
  * ************************************************************************* */
 #include "../../internals.h"
 
-/* ---
- * Cookie structure.
- * --- */
-
-struct thecookie {
-	casio_stream_t *_stream;
-	casio_uint32_t *_checksum;
-};
-
-/* ---
- * Callbacks.
- * --- */
-
-/**
- *	csum32_read:
- *	Read from this stream.
- *
- *	@arg	cookie		the cookie.
- *	@arg	data		the data pointer.
- *	@arg	size		the data size.
- *	@return				the size if > 0, or if < 0 the error code is -[returned value].
- */
-
-CASIO_LOCAL ssize_t csum32_read(struct thecookie *cookie,
-	unsigned char *dest, size_t size)
-{
-	int err;
-
-	/* Make the call. */
-
-	ssize_t ssize = casio_read(cookie->_stream, dest, size);
-	if (ssize < 0) {
-		err = -ssize;
-		return -(err);
-	}
-
-	/* Make the checksum. */
-
-	*cookie->_checksum = casio_checksum32(dest, size, *cookie->_checksum);
-	return size;
-}
-
-/**
- *	csum32_close:
- *	Close the stream.
- *
- *	@arg	cookie		the cookie.
- *	@return				the error code (0 if ok).
- */
-
-CASIO_LOCAL int csum32_close(struct thecookie *cookie)
-{
-	casio_free(cookie);
-	return (0);
-}
-
-/* Callbacks. */
-CASIO_LOCAL const casio_streamfuncs_t csum32_callbacks =
-casio_stream_callbacks_for_virtual(csum32_close,
-	csum32_read, NULL, NULL);
-
-/* ---
- * Main functions.
- * --- */
+/* 32-bit checksum streams are now filter streams with only a 32-bit
+ * checksum; this function is kept for compatibility. */
 
 /**
  *	casio_open_csum32:
@@ -96,24 +34,10 @@ casio_stream_callbacks_for_virtual(csum32_close,
 int CASIO_EXPORT casio_open_csum32(casio_stream_t **stream,
 	casio_stream_t *original, casio_uint32_t *csum)
 {
-	struct thecookie *cookie = NULL;
-	casio_openmode_t openmode;
-
-	if (!casio_isreadable(original))
-		return (casio_error_op);
-
-	/* Allocate the cookie. */
-
-	cookie = casio_alloc(1, sizeof(struct thecookie));
-	if (!cookie) return (casio_error_alloc);
-
-	/* Fill the cookie. */
-
-	cookie->_stream   = original;
-	cookie->_checksum = csum;
-
-	/* Initialize and return da stream. */
+	int err;
 
-	openmode = casio_get_openmode(original) & CASIO_OPENMODE_READ;
-	return (casio_open_stream(stream, openmode, cookie, &csum32_callbacks, 0));
+	if ((err = casio_open_filter(stream, original)))
+		return (err);
+	casio_filter_csum32(*stream, csum);
+	return (0);
 }
@@ -55,9 +55,11 @@ CASIO_LOCAL ssize_t casio_file_read(file_cookie_t *cookie,
 	size_t recv;
 	size_t copiedsize = 0;
 
-	/* Main receiving loop. */
+	/* Main receiving loop; errno is checked when nothing is read, so
+	 * it shouldn't be left from a previous call. */
 
 	recv = 0;
+	errno = 0;
 	do {
 		/* Read. */
 
@@ -171,6 +173,39 @@ CASIO_LOCAL ssize_t casio_file_write(file_cookie_t *cookie,
 	return sent;
 }
 
+/**
+ *	casio_file_writev:
+ *	Write several buffers to a FILE.
+ *
+ *	As the FILE interface is buffered, gathering the buffers beforehand
+ *	would only make an additional copy.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	iov			the buffers.
+ *	@arg	iovcnt		the number of buffers.
+ *	@return				the size written if > 0, or if < 0 the error code is -[returned value].
+ */
+
+CASIO_LOCAL ssize_t casio_file_writev(file_cookie_t *cookie,
+	const casio_iovec_t *iov, int iovcnt)
+{
+	size_t size = 0;
+
+	for (; iovcnt; iov++, iovcnt--) {
+		ssize_t ssize;
+
+		if (!iov->casio_iovec_len)
+			continue;
+		ssize = casio_file_write(cookie, iov->casio_iovec_base,
+			iov->casio_iovec_len);
+		if (ssize < 0)
+			return (ssize);
+		size += iov->casio_iovec_len;
+	}
+
+	return (size);
+}
+
 /**
  *	casio_file_seek:
  *	Seek within a file.
@@ -184,6 +219,7 @@ CASIO_LOCAL ssize_t casio_file_write(file_cookie_t *cookie,
 CASIO_LOCAL int casio_file_seek(file_cookie_t *cookie, casio_off_t *offset,
 	casio_whence_t whence)
 {
+	FILE *f = cookie->_rstream ? cookie->_rstream : cookie->_wstream;
 	int wh;
 
 	/* Seek. */
@@ -191,12 +227,12 @@ CASIO_LOCAL int casio_file_seek(file_cookie_t *cookie, casio_off_t *offset,
 	wh = whence == CASIO_SEEK_SET ? SEEK_SET
 		: whence == CASIO_SEEK_CUR ? SEEK_CUR
 		: SEEK_END;
-	if (fseek(cookie->_rstream, (long)*offset, wh) < 0)
+	if (fseek(f, (long)*offset, wh) < 0)
 		return (casio_error_op); /* TODO: check errno? */
 
 	/* Hide. */
 
-	*offset = (casio_off_t)ftell(cookie->_rstream);
+	*offset = (casio_off_t)ftell(f);
 	return (0);
 }
 
@@ -223,9 +259,13 @@ CASIO_LOCAL int casio_file_close(file_cookie_t *cookie)
  * Opening functions.
  * --- */
 
-CASIO_LOCAL const casio_streamfuncs_t casio_file_callbacks =
-casio_stream_callbacks_for_virtual(casio_file_close, casio_file_read,
-	casio_file_write, casio_file_seek);
+CASIO_LOCAL const casio_streamfuncs_t casio_file_callbacks = {
+	(casio_stream_close_t *)&casio_file_close, NULL,
+	(casio_stream_read_t *)&casio_file_read,
+	(casio_stream_write_t *)&casio_file_write,
+	(casio_stream_seek_t *)&casio_file_seek, NULL, NULL,
+	(casio_stream_writev_t *)&casio_file_writev
+};
 
 /**
  *	casio_open_stream_file:
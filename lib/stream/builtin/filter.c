@@ -0,0 +1,328 @@
+/* ****************************************************************************
+ * stream/builtin/filter.c -- filter chain stream.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Instead of stacking one stream per operation (limit, checksum, ...),
+ * which makes each read go through all of the layers, the filters are
+ * registered on one stream, which applies all of them in one pass over
+ * each buffer it reads.
+ *
+ * Checksums registered before the deobfuscation are made on the original
+ * bytes, the ones registered after it are made on the deobfuscated bytes.
+ * ************************************************************************* */
+#include "../../internals.h"
+
+/* Filter flags. */
+
+#define FILTER_LIMIT     0x0001 /* the size is limited */
+#define FILTER_DEOBF     0x0002 /* deobfuscate the data */
+#define FILTER_CSUM32    0x0004 /* 32-bit checksum on the original data */
+#define FILTER_CSUMSUB   0x0008 /* sub checksum on the original data */
+#define FILTER_CSUM32_D  0x0010 /* 32-bit checksum on the deobf. data */
+#define FILTER_CSUMSUB_D 0x0020 /* sub checksum on the deobf. data */
+
+/* Cookie structure. */
+
+typedef struct {
+	casio_stream_t *_stream;
+	unsigned int    _flags;
+
+	/* Limit. */
+
+	size_t          _left;
+
+	/* Checksums. */
+
+	casio_uint32_t *_csum32;
+	int            *_csumsub;
+} filter_cookie_t;
+
+/* ---
+ * Callbacks.
+ * --- */
+
+/**
+ *	filter_read:
+ *	Read from a filter stream.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	dest		the destination buffer.
+ *	@arg	size		the size to read.
+ *	@return				the size if > 0, or if < 0 the error code is -[returned value].
+ */
+
+CASIO_LOCAL ssize_t filter_read(filter_cookie_t *cookie,
+	unsigned char *dest, size_t size)
+{
+	unsigned int flags = cookie->_flags;
+	ssize_t ssize;
+	int err;
+
+	/* Check the limit. */
+
+	if (flags & FILTER_LIMIT && size > cookie->_left) {
+		/* First, skip the required bytes. */
+
+		size = cookie->_left;
+		cookie->_left = 0;
+		if ((err = casio_skip(cookie->_stream, size)))
+			return -(err);
+
+		/* Once the skip is done successfully, we return that we
+		 * have an EOF. */
+
+		return -(casio_error_eof);
+	}
+
+	/* Read. */
+
+	ssize = casio_read(cookie->_stream, dest, size);
+	if (ssize < 0) {
+		if (flags & FILTER_LIMIT)
+			cookie->_left = 0; /* XXX: depends on the error? */
+		return (ssize);
+	}
+	if (flags & FILTER_LIMIT)
+		cookie->_left -= size;
+
+	/* Apply the filters. */
+
+	if (flags & ~FILTER_LIMIT) {
+		casio_uint32_t cs32 = cookie->_csum32 ? *cookie->_csum32 : 0;
+		int cssub = cookie->_csumsub ? *cookie->_csumsub : 0;
+		unsigned char *p = dest;
+		size_t left = size;
+
+		for (; left; p++, left--) {
+			unsigned int c = *p;
+
+			if (flags & FILTER_CSUM32)
+				cs32 += c;
+			if (flags & FILTER_CSUMSUB)
+				cssub -= c;
+			if (flags & FILTER_DEOBF) {
+				c = ~c & 0xFF;
+				c = ((c << 5) | (c >> 3)) & 0xFF;
+				*p = (unsigned char)c;
+			}
+			if (flags & FILTER_CSUM32_D)
+				cs32 += c;
+			if (flags & FILTER_CSUMSUB_D)
+				cssub -= c;
+		}
+
+		if (cookie->_csum32)
+			*cookie->_csum32 = cs32;
+		if (cookie->_csumsub)
+			*cookie->_csumsub = cssub & 255;
+	}
+
+	return (size);
+}
+
+/**
+ *	filter_close:
+ *	Close a filter stream.
+ *
+ *	@arg	cookie		the cookie.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int filter_close(filter_cookie_t *cookie)
+{
+	casio_free(cookie);
+	return (0);
+}
+
+/* Callbacks. */
+
+CASIO_LOCAL const casio_streamfuncs_t filter_callbacks =
+casio_stream_callbacks_for_virtual(filter_close,
+	filter_read, NULL, NULL);
+
+/* ---
+ * Main functions.
+ * --- */
+
+/**
+ *	casio_open_filter:
+ *	Open a filter stream, with no filters.
+ *
+ *	@arg	stream		the stream to make.
+ *	@arg	original	the original stream.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_open_filter(casio_stream_t **stream,
+	casio_stream_t *original)
+{
+	filter_cookie_t *cookie;
+
+	if (!casio_isreadable(original))
+		return (casio_error_op);
+
+	/* Allocate the cookie. */
+
+	cookie = casio_alloc(1, sizeof(filter_cookie_t));
+	if (!cookie)
+		return (casio_error_alloc);
+
+	/* Fill the cookie. */
+
+	cookie->_stream = original;
+	cookie->_flags = 0;
+	cookie->_left = 0;
+	cookie->_csum32 = NULL;
+	cookie->_csumsub = NULL;
+
+	/* Initialize and return the stream. */
+
+	return (casio_open_stream(stream, CASIO_OPENMODE_READ, cookie,
+		&filter_callbacks, 0));
+}
+
+/**
+ *	get_cookie:
+ *	Get the cookie of a filter stream.
+ *
+ *	@arg	stream		the stream.
+ *	@return				the cookie (NULL if not a filter stream).
+ */
+
+CASIO_LOCAL filter_cookie_t *get_cookie(casio_stream_t *stream)
+{
+	const casio_streamfuncs_t *funcs = casio_get_streamfuncs(stream);
+
+	if (!funcs || funcs->casio_streamfuncs_close
+	 != filter_callbacks.casio_streamfuncs_close)
+		return (NULL);
+	return ((filter_cookie_t *)casio_get_cookie(stream));
+}
+
+/**
+ *	casio_filter_limit:
+ *	Limit the number of bytes that can be read from a filter stream,
+ *	starting from now.
+ *
+ *	@arg	stream		the filter stream.
+ *	@arg	size		the number of bytes that can be read.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_filter_limit(casio_stream_t *stream, size_t size)
+{
+	filter_cookie_t *cookie = get_cookie(stream);
+
+	if (!cookie)
+		return (casio_error_op);
+
+	cookie->_flags |= FILTER_LIMIT;
+	cookie->_left = size;
+	return (0);
+}
+
+/**
+ *	casio_filter_csum32:
+ *	Calculate a 32-bit checksum on what is read from a filter stream.
+ *
+ *	@arg	stream		the filter stream.
+ *	@arg	csum		the checksum to update.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_filter_csum32(casio_stream_t *stream,
+	casio_uint32_t *csum)
+{
+	filter_cookie_t *cookie = get_cookie(stream);
+
+	if (!cookie || cookie->_csum32)
+		return (casio_error_op);
+
+	cookie->_flags |= cookie->_flags & FILTER_DEOBF
+		? FILTER_CSUM32_D : FILTER_CSUM32;
+	cookie->_csum32 = csum;
+	return (0);
+}
+
+/**
+ *	casio_filter_csumsub:
+ *	Calculate a CASIOWIN checksum on what is read from a filter stream.
+ *
+ *	@arg	stream		the filter stream.
+ *	@arg	csum		the checksum to update.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_filter_csumsub(casio_stream_t *stream, int *csum)
+{
+	filter_cookie_t *cookie = get_cookie(stream);
+
+	if (!cookie || cookie->_csumsub)
+		return (casio_error_op);
+
+	cookie->_flags |= cookie->_flags & FILTER_DEOBF
+		? FILTER_CSUMSUB_D : FILTER_CSUMSUB;
+	cookie->_csumsub = csum;
+	return (0);
+}
+
+/**
+ *	casio_filter_deobfuscate:
+ *	Deobfuscate what is read from a filter stream, the way obfuscated
+ *	Prizm pictures are.
+ *
+ *	@arg	stream		the filter stream.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_filter_deobfuscate(casio_stream_t *stream)
+{
+	filter_cookie_t *cookie = get_cookie(stream);
+
+	if (!cookie)
+		return (casio_error_op);
+
+	cookie->_flags |= FILTER_DEOBF;
+	return (0);
+}
+
+/**
+ *	casio_empty_filter:
+ *	Skip what is left to read from a limited filter stream.
+ *
+ *	@arg	stream		the filter stream.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_empty_filter(casio_stream_t *stream)
+{
+	filter_cookie_t *cookie = get_cookie(stream);
+	int err;
+
+	if (!cookie || ~cookie->_flags & FILTER_LIMIT)
+		return (casio_error_op);
+
+	/* If the skipped bytes don't have to go through the other filters,
+	 * we can skip them directly on the original stream. */
+
+	if (cookie->_flags == FILTER_LIMIT)
+		err = casio_skip(cookie->_stream, cookie->_left);
+	else
+		err = casio_skip(stream, cookie->_left);
+	cookie->_left = 0;
+	return (err);
+}
@@ -31,8 +31,7 @@ int CASIO_EXPORT casio_libusb_close(cookie_libusb_t *cookie)
 {
 	if (cookie->_handle)
 		libusb_close(cookie->_handle);
-	if (cookie->_context)
-		libusb_exit(cookie->_context);
+	casio_libusb_release();
 	casio_free(cookie);
 	return (0);
 }
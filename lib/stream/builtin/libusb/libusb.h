@@ -35,7 +35,6 @@
 #  define BUFSIZE 2048
 
 typedef struct {
-	libusb_context *_context;
 	libusb_device_handle *_handle;
 
 	/* Timeouts. */
@@ -46,8 +45,27 @@ typedef struct {
 
 	ssize_t _start, _end;
 	unsigned char _buffer[BUFSIZE];
+
+	/* Gathering buffer for scatter-gather writes. */
+
+	unsigned char _wbuffer[BUFSIZE];
 } cookie_libusb_t;
 
+/* Shared context and device table management.
+ * `MAX_DEVICES` is the maximum number of calculators in the table,
+ * `SERIAL_SIZE` the maximum size of a serial number we keep. */
+
+#  define MAX_DEVICES 128
+#  define SERIAL_SIZE 63
+
+CASIO_EXTERN int  CASIO_EXPORT casio_libusb_acquire
+	OF((libusb_context **casio__context));
+CASIO_EXTERN void CASIO_EXPORT casio_libusb_release
+	OF((void));
+CASIO_EXTERN int  CASIO_EXPORT casio_libusb_find
+	OF((int casio__bus, int casio__address, const char *casio__serial,
+		libusb_device **casio__device, unsigned int *casio__product));
+
 /* General callbacks. */
 
 CASIO_EXTERN int CASIO_EXPORT casio_libusb_close
@@ -64,6 +82,9 @@ CASIO_EXTERN ssize_t CASIO_EXPORT casio_libusb_read
 CASIO_EXTERN ssize_t CASIO_EXPORT casio_libusb_write
 	OF((cookie_libusb_t *casio__cookie,
 		const unsigned char *casio__data, size_t casio__size));
+CASIO_EXTERN ssize_t CASIO_EXPORT casio_libusb_writev
+	OF((cookie_libusb_t *casio__cookie,
+		const casio_iovec_t *casio__iov, int casio__iovcnt));
 
 /* SCSI callbacks. */
 
@@ -0,0 +1,613 @@
+/* ****************************************************************************
+ * stream/builtin/libusb/manager.c -- shared libusb context and device table.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Creating a libusb context and enumerating the whole bus each time a
+ * stream is opened gets slow when a lot of calculators are plugged in,
+ * so one context is shared by the whole process, with a table of the
+ * CASIO devices that is kept up to date using the hotplug events when
+ * libusb supports them, or by enumerating the bus again otherwise.
+ *
+ * Hotplug callbacks are only called when libusb events are handled, which
+ * is either when we handle them or when a transfer on an opened stream is
+ * made, in any thread; so they don't take the lock of the table, which
+ * could be held by a thread waiting for libusb, but only queue the events
+ * with their own lock, for the table to be updated with the lock held.
+ * For the same reason, the lock isn't held while making requests to the
+ * devices (e.g. reading their serial number).
+ * ************************************************************************* */
+#include "libusb.h"
+#ifndef LIBCASIO_DISABLED_LIBUSB
+
+/* Device entry. */
+
+typedef struct {
+	libusb_device *_device;
+	int            _bus, _address;
+	unsigned int   _product;
+	int            _stale;
+
+	/* Serial number, read once the first time it is required. */
+
+	int            _has_serial;
+	char           _serial[SERIAL_SIZE + 1];
+} libusb_entry_t;
+
+/* Manager structure. */
+
+CASIO_LOCAL struct {
+	casio_mutex_t   _lock;
+	libusb_context *_context;
+	int             _refcount;
+
+	/* Hotplug, and the events queued by the callback (if there are too
+	 * many of them, the bus is enumerated again). */
+
+	int             _hotplug;
+	libusb_hotplug_callback_handle _hotplug_handle;
+
+	casio_mutex_t   _events_lock;
+	int             _nevents, _overflow;
+	struct {
+		libusb_device *_device;
+		int            _arrived;
+	}               _events[MAX_DEVICES];
+
+	/* Device table. */
+
+	int             _count;
+	libusb_entry_t  _entries[MAX_DEVICES];
+} manager;
+
+/* ---
+ * Device table management.
+ * --- */
+
+/**
+ *	add_device:
+ *	Add a device to the table if it is a CASIO calculator.
+ *
+ *	@arg	device		the device to add.
+ */
+
+CASIO_LOCAL void add_device(libusb_device *device)
+{
+	struct libusb_device_descriptor descriptor;
+	libusb_entry_t *entry;
+	int i;
+
+	if (libusb_get_device_descriptor(device, &descriptor)
+	 || descriptor.idVendor != 0x07cf
+	 || (descriptor.idProduct != 0x6101 && descriptor.idProduct != 0x6102))
+		return ;
+
+	/* Check if the device is already in the table. */
+
+	for (i = 0; i < manager._count; i++) {
+		if (manager._entries[i]._device == device) {
+			manager._entries[i]._stale = 0;
+			return ;
+		}
+	}
+
+	if (manager._count >= MAX_DEVICES) {
+		msg((ll_warn, "Too many calculators, ignoring one."));
+		return ;
+	}
+
+	/* Add the entry. */
+
+	entry = &manager._entries[manager._count++];
+	entry->_device = libusb_ref_device(device);
+	entry->_bus = libusb_get_bus_number(device);
+	entry->_address = libusb_get_device_address(device);
+	entry->_product = descriptor.idProduct;
+	entry->_stale = 0;
+	entry->_has_serial = 0;
+	entry->_serial[0] = '\0';
+
+	msg((ll_info, "Calculator arrived on bus %d, address %d.",
+		entry->_bus, entry->_address));
+}
+
+/**
+ *	remove_entry:
+ *	Remove an entry from the table.
+ *
+ *	@arg	id			the entry index.
+ */
+
+CASIO_LOCAL void remove_entry(int id)
+{
+	msg((ll_info, "Calculator left bus %d, address %d.",
+		manager._entries[id]._bus, manager._entries[id]._address));
+
+	libusb_unref_device(manager._entries[id]._device);
+	if (id != --manager._count)
+		memcpy(&manager._entries[id], &manager._entries[manager._count],
+			sizeof(libusb_entry_t));
+}
+
+/**
+ *	remove_device:
+ *	Remove a device from the table, if it is in it.
+ *
+ *	@arg	device		the device to remove.
+ */
+
+CASIO_LOCAL void remove_device(libusb_device *device)
+{
+	int i;
+
+	for (i = 0; i < manager._count; i++) {
+		if (manager._entries[i]._device == device) {
+			remove_entry(i);
+			return ;
+		}
+	}
+}
+
+/**
+ *	hotplug_callback:
+ *	Called by libusb when a calculator arrives or leaves.
+ *
+ *	@arg	context		the libusb context.
+ *	@arg	device		the device.
+ *	@arg	event		the event.
+ *	@arg	cookie		the cookie (unused).
+ *	@return				0, in order to stay registered.
+ */
+
+CASIO_LOCAL int LIBUSB_CALL hotplug_callback(libusb_context *context,
+	libusb_device *device, libusb_hotplug_event event, void *cookie)
+{
+	int queued = 0;
+
+	(void)context;
+	(void)cookie;
+
+	libusb_ref_device(device);
+	if (!casio_lock(&manager._events_lock)) {
+		if (manager._nevents < MAX_DEVICES) {
+			manager._events[manager._nevents]._device = device;
+			manager._events[manager._nevents]._arrived =
+				event == LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED;
+			manager._nevents++;
+			queued = 1;
+		} else
+			manager._overflow = 1;
+		casio_unlock(&manager._events_lock);
+	}
+
+	if (!queued)
+		libusb_unref_device(device);
+	return (0);
+}
+
+/**
+ *	rescan:
+ *	Enumerate the bus again, for when hotplug is not available.
+ *
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int rescan(void)
+{
+	libusb_device **device_list;
+	int i, device_count;
+
+	device_count = libusb_get_device_list(manager._context, &device_list);
+	if (device_count < 0) {
+		msg((ll_fatal, "couldn't get device list."));
+		return (casio_error_nocalc);
+	}
+
+	/* Mark all of the known devices as stale, add the new ones and
+	 * unmark the ones that are still here, and remove the stale ones. */
+
+	for (i = 0; i < manager._count; i++)
+		manager._entries[i]._stale = 1;
+	for (i = 0; i < device_count; i++)
+		add_device(device_list[i]);
+	for (i = manager._count - 1; i >= 0; i--)
+		if (manager._entries[i]._stale)
+			remove_entry(i);
+
+	libusb_free_device_list(device_list, 1);
+	return (0);
+}
+
+/**
+ *	apply_events:
+ *	Update the device table with the events queued by the hotplug callback.
+ *	The lock must be held.
+ *
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int apply_events(void)
+{
+	struct {
+		libusb_device *_device;
+		int            _arrived;
+	} events[MAX_DEVICES];
+	int i, count, overflow, err;
+
+	/* Take the events, as the callback can queue others meanwhile. */
+
+	if ((err = casio_lock(&manager._events_lock)))
+		return (err);
+	count = manager._nevents;
+	overflow = manager._overflow;
+	memcpy(events, manager._events, count * sizeof(events[0]));
+	manager._nevents = 0;
+	manager._overflow = 0;
+	casio_unlock(&manager._events_lock);
+
+	for (i = 0; i < count; i++) {
+		if (events[i]._arrived)
+			add_device(events[i]._device);
+		else
+			remove_device(events[i]._device);
+		libusb_unref_device(events[i]._device);
+	}
+
+	return (overflow ? rescan() : 0);
+}
+
+/**
+ *	refresh:
+ *	Bring the device table up to date.
+ *	The lock must be held.
+ *
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int refresh(void)
+{
+	struct timeval tv;
+
+	if (!manager._hotplug)
+		return (rescan());
+
+	/* Handle the pending hotplug events, without waiting. */
+
+	tv.tv_sec = 0;
+	tv.tv_usec = 0;
+	libusb_handle_events_timeout_completed(manager._context, &tv, NULL);
+	return (apply_events());
+}
+
+/**
+ *	read_serial:
+ *	Read the serial number of a device.
+ *	The lock must not be held, as this makes requests to the device.
+ *
+ *	@arg	device		the device.
+ *	@arg	serial		the serial number to set (SERIAL_SIZE + 1 bytes).
+ *	@return				whether the serial number could be read.
+ */
+
+CASIO_LOCAL int read_serial(libusb_device *device, char *serial)
+{
+	struct libusb_device_descriptor descriptor;
+	libusb_device_handle *dhandle;
+	int len;
+
+	if (libusb_get_device_descriptor(device, &descriptor)
+	 || !descriptor.iSerialNumber
+	 || libusb_open(device, &dhandle))
+		return (0);
+
+	len = libusb_get_string_descriptor_ascii(dhandle,
+		descriptor.iSerialNumber, (unsigned char *)serial, SERIAL_SIZE + 1);
+	libusb_close(dhandle);
+
+	if (len < 0)
+		return (0);
+	serial[len > SERIAL_SIZE ? SERIAL_SIZE : len] = '\0';
+	return (1);
+}
+
+/**
+ *	read_serials:
+ *	Read the serial numbers which haven't been read yet in the table.
+ *	The lock must be held, and is released while the devices are asked.
+ *
+ *	@return				the error code (0 if ok), the lock not being held
+ *						anymore if it isn't 0.
+ */
+
+CASIO_LOCAL int read_serials(void)
+{
+	struct {
+		libusb_device *device;
+		int            has_serial;
+		char           serial[SERIAL_SIZE + 1];
+	} toread[MAX_DEVICES];
+	int i, j, count = 0, err;
+
+	/* Copy the devices, and ask them without the lock held. */
+
+	for (i = 0; i < manager._count; i++)
+		if (!manager._entries[i]._has_serial)
+			toread[count++].device = libusb_ref_device(
+				manager._entries[i]._device);
+	if (!count)
+		return (0);
+	casio_unlock(&manager._lock);
+
+	for (j = 0; j < count; j++)
+		toread[j].has_serial = read_serial(toread[j].device,
+			toread[j].serial);
+
+	/* Store them in the entries, which might have left meanwhile. */
+
+	err = casio_lock(&manager._lock);
+	for (j = 0; j < count; j++) {
+		for (i = 0; !err && i < manager._count; i++) {
+			libusb_entry_t *entry = &manager._entries[i];
+
+			if (entry->_device != toread[j].device)
+				continue;
+			if (toread[j].has_serial) {
+				memcpy(entry->_serial, toread[j].serial, SERIAL_SIZE + 1);
+				entry->_has_serial = 1;
+			}
+			break;
+		}
+		libusb_unref_device(toread[j].device);
+	}
+
+	return (err);
+}
+
+/* ---
+ * Context management.
+ * --- */
+
+/**
+ *	casio_libusb_acquire:
+ *	Get a reference to the shared libusb context, creating it and
+ *	filling the device table if required.
+ *
+ *	@arg	context		the context to get.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_libusb_acquire(libusb_context **context)
+{
+	int err;
+
+	if ((err = casio_lock(&manager._lock)))
+		return (err);
+
+	if (!manager._context) {
+		if (libusb_init(&manager._context)) {
+			msg((ll_fatal, "Couldn't create libusb context."));
+			manager._context = NULL;
+			casio_unlock(&manager._lock);
+			return (casio_error_nocalc);
+		}
+
+		manager._count = 0;
+		manager._hotplug = 0;
+
+		/* Register the hotplug callback; with the `ENUMERATE` flag,
+		 * it is called for the devices already there. */
+
+		if (libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG)
+		 && !libusb_hotplug_register_callback(manager._context,
+		  LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED
+		  | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT,
+		  LIBUSB_HOTPLUG_ENUMERATE, 0x07cf,
+		  LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY,
+		  &hotplug_callback, NULL, &manager._hotplug_handle)) {
+			manager._hotplug = 1;
+			apply_events();
+		}
+
+		if (!manager._hotplug) {
+			msg((ll_info, "Hotplug unavailable, the bus will be "
+				"enumerated each time."));
+			rescan();
+		}
+	}
+
+	manager._refcount++;
+	*context = manager._context;
+	casio_unlock(&manager._lock);
+	return (0);
+}
+
+/**
+ *	casio_libusb_release:
+ *	Release a reference to the shared libusb context.
+ *
+ *	The context is kept once it is not referenced anymore, so that the
+ *	device table doesn't have to be made again for the next stream;
+ *	use `casio_exit_libusb` to free it.
+ */
+
+void CASIO_EXPORT casio_libusb_release(void)
+{
+	if (casio_lock(&manager._lock))
+		return ;
+	if (manager._refcount)
+		manager._refcount--;
+	casio_unlock(&manager._lock);
+}
+
+/**
+ *	casio_libusb_find:
+ *	Find a calculator in the device table.
+ *
+ *	@arg	bus			the bus (-1 if any).
+ *	@arg	address		the address on the bus (-1 if any).
+ *	@arg	serial		the serial number (NULL if any).
+ *	@arg	device		the device to get (with a reference on it).
+ *	@arg	product		the product identifier to get.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_libusb_find(int bus, int address, const char *serial,
+	libusb_device **device, unsigned int *product)
+{
+	libusb_entry_t *entry;
+	int i, err;
+
+	if ((err = casio_lock(&manager._lock)))
+		return (err);
+	if (!manager._context) {
+		casio_unlock(&manager._lock);
+		return (casio_error_op);
+	}
+
+	err = refresh();
+	if (err)
+		goto end;
+	if (serial && (err = read_serials()))
+		return (err);
+
+	err = casio_error_nocalc;
+	for (i = 0; i < manager._count; i++) {
+		entry = &manager._entries[i];
+
+		if (bus >= 0) {
+			if (entry->_bus != bus)
+				continue;
+			if (address >= 0 && entry->_address != address)
+				continue;
+		}
+
+		if (serial && (!entry->_has_serial
+		 || strcmp(entry->_serial, serial)))
+			continue;
+
+		*device = libusb_ref_device(entry->_device);
+		*product = entry->_product;
+		err = 0;
+		break;
+	}
+
+end:
+	casio_unlock(&manager._lock);
+	return (err);
+}
+
+/* ---
+ * Public functions.
+ * --- */
+
+/**
+ *	casio_list_libusb:
+ *	List the calculators connected through USB.
+ *
+ *	The callback is called without the lock held, so it can open the
+ *	calculators it is given.
+ *
+ *	@arg	callback	the callback.
+ *	@arg	cookie		the cookie to pass to the callback.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_list_libusb(casio_list_libusb_t *callback,
+	void *cookie)
+{
+	libusb_context *context;
+	struct {
+		int  bus, address, has_serial;
+		char serial[SERIAL_SIZE + 1];
+	} found[MAX_DEVICES];
+	int i, count, err;
+
+	if ((err = casio_libusb_acquire(&context)))
+		return (err);
+	if ((err = casio_lock(&manager._lock)))
+		goto end;
+
+	/* Copy what is required from the table. */
+
+	if ((err = refresh())) {
+		casio_unlock(&manager._lock);
+		goto end;
+	}
+	if ((err = read_serials()))
+		goto end;
+
+	count = manager._count;
+	for (i = 0; i < count; i++) {
+		libusb_entry_t *entry = &manager._entries[i];
+
+		found[i].bus = entry->_bus;
+		found[i].address = entry->_address;
+		found[i].has_serial = entry->_has_serial;
+		memcpy(found[i].serial, entry->_serial, SERIAL_SIZE + 1);
+	}
+
+	casio_unlock(&manager._lock);
+
+	/* Call the callback. */
+
+	for (i = 0; i < count; i++)
+		(*callback)(cookie, found[i].bus, found[i].address,
+			found[i].has_serial ? found[i].serial : NULL);
+
+end:
+	casio_libusb_release();
+	return (err);
+}
+
+/**
+ *	casio_exit_libusb:
+ *	Free the shared libusb context and the device table, if no stream
+ *	uses them anymore.
+ *
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_exit_libusb(void)
+{
+	int err;
+
+	if ((err = casio_lock(&manager._lock)))
+		return (err);
+
+	if (manager._refcount) {
+		casio_unlock(&manager._lock);
+		return (casio_error_op);
+	}
+
+	if (manager._context) {
+		if (manager._hotplug) {
+			libusb_hotplug_deregister_callback(manager._context,
+				manager._hotplug_handle);
+			apply_events();
+		}
+		while (manager._count)
+			remove_entry(manager._count - 1);
+
+		libusb_exit(manager._context);
+		manager._context = NULL;
+		manager._hotplug = 0;
+	}
+
+	casio_unlock(&manager._lock);
+	return (0);
+}
+
+#endif
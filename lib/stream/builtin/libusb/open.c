@@ -27,98 +27,53 @@ CASIO_LOCAL const casio_streamfuncs_t casio_libusb_callbacks = {
 	(casio_stream_read_t *)&casio_libusb_read,
 	(casio_stream_write_t *)&casio_libusb_write,
 	NULL, NULL,
-	(casio_stream_scsi_t *)&casio_libusb_scsi_request
+	(casio_stream_scsi_t *)&casio_libusb_scsi_request,
+	(casio_stream_writev_t *)&casio_libusb_writev
 };
 
 /**
- *	casio_openusb_libusb:
- *	Initialize a stream with USB device using libusb.
+ *	open_libusb:
+ *	Initialize a stream with a USB device from the device table.
  *
- *	@arg	handle		the handle to create.
+ *	@arg	stream		the stream to make.
  *	@arg	bus			the bus number (-1 if both bus and address aren't set).
  *	@arg	address		the address on the bus (-1 if any address).
- *	@return				the error code (0 if you're a knoop).
+ *	@arg	serial		the serial number (NULL if any).
+ *	@return				the error code (0 if ok).
  */
 
-int CASIO_EXPORT casio_openusb_libusb(casio_stream_t **stream,
-	int bus, int address)
+CASIO_LOCAL int open_libusb(casio_stream_t **stream,
+	int bus, int address, const char *serial)
 {
-	int err = 0, uerr, id, device_count;
-	libusb_context *context = NULL;
-	libusb_device *calc = NULL, **device_list = NULL;
+	int err = 0, uerr;
+	unsigned int product;
+	libusb_context *context;
+	libusb_device *calc = NULL;
 	libusb_device_handle *dhandle = NULL;
 	cookie_libusb_t *cookie = NULL;
 	casio_openmode_t openmode = CASIO_OPENMODE_USB;
 
-	/* Open up context. */
+	/* Get the shared context. */
 
-	if (libusb_init(&context)) {
-		msg((ll_fatal, "Couldn't create libusb context."));
-		return (casio_error_nocalc);
-	}
+	if ((err = casio_libusb_acquire(&context)))
+		return (err);
 
-	/* Get device list. */
+	/* Look for the calculator in the device table. */
 
-	msg((ll_info, "Getting the device list"));
-	device_count = libusb_get_device_list(context, &device_list);
-	if (device_count < 0) {
-		msg((ll_fatal, "couldn't get device list."));
-		err = casio_error_nocalc;
+	msg((ll_info, "Looking for the calculator"));
+	if ((err = casio_libusb_find(bus, address, serial, &calc, &product)))
 		goto fail;
-	}
-
-	/* Look for the calculator. */
-
-	for (id = 0; id < device_count; id++) {
-		struct libusb_device_descriptor descriptor;
-
-		/* Check the position on the bus. */
-
-		if (bus >= 0) {
-			if (libusb_get_bus_number(device_list[id]) != bus)
-				continue;
-			if (address >= 0
-			 && libusb_get_device_address(device_list[id]) != address)
-				continue;
-		}
 
-		/* Get the device descriptor. */
-
-		if (libusb_get_device_descriptor(device_list[id], &descriptor))
-			continue;
-
-		/* Check if is a CASIO Protocol 7.00 device. */
-
-		if (descriptor.idVendor  == 0x07cf
-		 && descriptor.idProduct == 0x6101) {
-			openmode |= CASIO_OPENMODE_READ | CASIO_OPENMODE_WRITE;
-			calc = device_list[id];
-			break;
-		}
-
-		/* Check if is a CASIO SCSI device. */
-
-		if (descriptor.idVendor  == 0x07cf
-		 && descriptor.idProduct == 0x6102) {
-			openmode |= CASIO_OPENMODE_SCSI;
-			calc = device_list[id];
-			break;
-		}
-	}
-
-	/* The calculator wasn't found. */
-
-	if (!calc) {
-		libusb_free_device_list(device_list, 1);
-		err = casio_error_nocalc;
-		goto fail;
-	}
+	if (product == 0x6101) /* CASIO Protocol 7.00 device */
+		openmode |= CASIO_OPENMODE_READ | CASIO_OPENMODE_WRITE;
+	else /* CASIO SCSI device */
+		openmode |= CASIO_OPENMODE_SCSI;
 
 	/* Get calculator handle. */
 
 	msg((ll_info, "getting the device handle"));
 	uerr = libusb_open(calc, &dhandle);
-	libusb_free_device_list(device_list, 1);
+	libusb_unref_device(calc);
 
 	/* Check if we have the handle. */
 
@@ -163,6 +118,7 @@ int CASIO_EXPORT casio_openusb_libusb(casio_stream_t **stream,
 		default:
 			msg((ll_fatal, "libusb returned %d: %s",
 				uerr, libusb_error_name(uerr)));
+			err = casio_error_unknown;
 			goto fail;
 	}
 
@@ -192,6 +148,7 @@ int CASIO_EXPORT casio_openusb_libusb(casio_stream_t **stream,
 		default:
 			msg((ll_info, "libusb returned %d: %s",
 				uerr, libusb_error_name(uerr)));
+			err = casio_error_unknown;
 			goto fail;
 	}
 
@@ -201,7 +158,6 @@ int CASIO_EXPORT casio_openusb_libusb(casio_stream_t **stream,
 	err = casio_error_alloc;
 	if (!cookie)
 		goto fail;
-	cookie->_context = context;
 	cookie->_handle = dhandle;
 	cookie->_start = 0;
 	cookie->_end = -1;
@@ -214,9 +170,41 @@ fail:
 		casio_free(cookie);
 	if (dhandle)
 		libusb_close(dhandle);
-	if (context)
-		libusb_exit(context);
+	casio_libusb_release();
 	return (err);
 }
 
+/**
+ *	casio_openusb_libusb:
+ *	Initialize a stream with USB device using libusb.
+ *
+ *	@arg	handle		the handle to create.
+ *	@arg	bus			the bus number (-1 if both bus and address aren't set).
+ *	@arg	address		the address on the bus (-1 if any address).
+ *	@return				the error code (0 if you're a knoop).
+ */
+
+int CASIO_EXPORT casio_openusb_libusb(casio_stream_t **stream,
+	int bus, int address)
+{
+	return (open_libusb(stream, bus, address, NULL));
+}
+
+/**
+ *	casio_openusb_libusb_serial:
+ *	Initialize a stream with the USB device having the given serial number.
+ *
+ *	@arg	stream		the stream to make.
+ *	@arg	serial		the serial number.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_openusb_libusb_serial(casio_stream_t **stream,
+	const char *serial)
+{
+	if (!serial)
+		return (casio_error_op);
+	return (open_libusb(stream, -1, -1, serial));
+}
+
 #endif
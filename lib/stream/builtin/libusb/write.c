@@ -55,4 +55,54 @@ ssize_t CASIO_EXPORT casio_libusb_write(cookie_libusb_t *cookie,
 	return (sent);
 }
 
+/**
+ *	casio_libusb_writev:
+ *	Write several buffers using libusb cookie.
+ *
+ *	A bulk transfer needs a contiguous buffer, and each transfer costs at
+ *	least one bus frame, so the buffers are gathered into one transfer
+ *	when they fit in the cookie's write buffer.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	iov			the buffers.
+ *	@arg	iovcnt		the number of buffers.
+ *	@return				the size written if > 0, or if < 0 the error code is -[returned value].
+ */
+
+ssize_t CASIO_EXPORT casio_libusb_writev(cookie_libusb_t *cookie,
+	const casio_iovec_t *iov, int iovcnt)
+{
+	size_t size = 0;
+	ssize_t ssize;
+	int i;
+
+	for (i = 0; i < iovcnt; i++)
+		size += iov[i].casio_iovec_len;
+
+	if (size <= BUFSIZE) {
+		unsigned char *p = cookie->_wbuffer;
+
+		for (i = 0; i < iovcnt; i++) {
+			memcpy(p, iov[i].casio_iovec_base, iov[i].casio_iovec_len);
+			p += iov[i].casio_iovec_len;
+		}
+
+		ssize = casio_libusb_write(cookie, cookie->_wbuffer, size);
+		return (ssize < 0 ? ssize : (ssize_t)size);
+	}
+
+	/* Too big to gather, make one transfer per buffer. */
+
+	for (i = 0; i < iovcnt; i++) {
+		if (!iov[i].casio_iovec_len)
+			continue;
+		ssize = casio_libusb_write(cookie, iov[i].casio_iovec_base,
+			iov[i].casio_iovec_len);
+		if (ssize < 0)
+			return (ssize);
+	}
+
+	return (size);
+}
+
 #endif
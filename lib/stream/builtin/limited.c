@@ -18,81 +18,8 @@
  * ************************************************************************* */
 #include "../../internals.h"
 
-/* Cookie structure. */
-
-typedef struct {
-	char            _magic[8];
-	casio_stream_t *_stream;
-	size_t          _left;
-} limited_cookie_t;
-
-/* ---
- * Callbacks.
- * --- */
-
-/**
- *	casio_limited_read:
- *	Read from a limited stream.
- *
- *	@arg	vcookie		the cookie (uncasted).
- *	@arg	data		the data pointer.
- *	@arg	size		the data size.
- *	@return				the size if > 0, or if < 0 the error code is -[returned value].
- */
-
-CASIO_LOCAL ssize_t casio_limited_read(void *vcookie, unsigned char *dest,
-	size_t size)
-{
-	int err; limited_cookie_t *cookie = (void*)vcookie;
-	size_t left; size_t copiedsize;
-
-	if (size > cookie->_left) {
-		/* First, skip the required bytes. */
-
-		left = cookie->_left;
-		cookie->_left = 0;
-		if ((err = casio_skip(cookie->_stream, left))) {
-			return -(err);
-		}
-
-		/* Once the skip is done successfully, we return that we
-		 * have an EOF. */
-		return -(casio_error_eof);
-	}
-
-	ssize_t ssize = casio_read(cookie->_stream, dest, size);
-	if (ssize < 0) {
-		cookie->_left = 0; /* XXX: depends on the error? */
-		err = -ssize;
-		return -(err);
-	}
-	cookie->_left -= size;
-	return size;
-}
-
-/**
- *	casio_limited_close:
- *	Close a limited stream.
- *
- *	@arg	vcookie		the cookie (uncasted).
- *	@return				the error code (0 if ok).
- */
-
-CASIO_LOCAL int casio_limited_close(void *vcookie)
-{
-	casio_free(vcookie);
-	return (0);
-}
-
-/* Callbacks. */
-
-CASIO_LOCAL const casio_streamfuncs_t casio_limited_callbacks =
-casio_stream_callbacks_for_virtual(casio_limited_close,
-	casio_limited_read, NULL, NULL);
-
-/* ---
- * Main functions.
- * --- */
+/* Limited streams are now filter streams with only a limit; these
+ * functions are kept for compatibility. */
 
 /**
  *	casio_open_limited:
@@ -107,26 +34,12 @@ casio_stream_callbacks_for_virtual(casio_limited_close,
 int CASIO_EXPORT casio_open_limited(casio_stream_t **stream,
 	casio_stream_t *original, size_t size)
 {
-	limited_cookie_t *cookie = NULL;
-
-	/* FIXME: check original stream */
-	/* allocate the cookie */
-
-	cookie = casio_alloc(1, sizeof(limited_cookie_t));
-	if (!cookie)
-		return (casio_error_alloc);
-
-	/* Fill the cookie. */
+	int err;
 
-	memcpy(cookie->_magic, "LIMITED\x7F", 8);
-	cookie->_stream = original;
-	cookie->_left = size;
-
-	/* Initialize da stream. */
-
-	return (casio_open_stream(stream,
-		casio_get_openmode(original) & CASIO_OPENMODE_READ,
-		cookie, &casio_limited_callbacks, 0));
+	if ((err = casio_open_filter(stream, original)))
+		return (err);
+	casio_filter_limit(*stream, size);
+	return (0);
 }
 
 /**
@@ -139,11 +52,5 @@ int CASIO_EXPORT casio_open_limited(casio_stream_t **stream,
 
 int CASIO_EXPORT casio_empty_limited(casio_stream_t *stream)
 {
-	int err; limited_cookie_t *cookie = (void*)casio_get_cookie(stream);
-
-	if (!cookie || memcmp(cookie->_magic, "LIMITED\x7F", 8))
-		return (casio_error_op);
-	err = casio_skip(cookie->_stream, cookie->_left);
-	cookie->_left = 0;
-	return (err);
+	return (casio_empty_filter(stream));
 }
@@ -0,0 +1,456 @@
+/* ****************************************************************************
+ * stream/builtin/membuf.c -- growable memory stream.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * The memory is kept as a list of chunks, which are never moved once they
+ * are allocated: when the last chunk is full, another one, twice as big
+ * (up to a maximum), is added. All chunks but the last one are full.
+ *
+ * The chunk list is kept as an iovec list, so that it can be given to the
+ * user as is.
+ * ************************************************************************* */
+#include "../../internals.h"
+
+#define FIRST_CHUNK_SIZE     4096
+#define MAX_CHUNK_SIZE    1048576
+
+/* Cookie structure. */
+
+typedef struct {
+	/* Chunks (`_caps` are the allocated sizes, the used sizes are
+	 * in the iovecs). */
+
+	int            _count, _alloc;
+	casio_iovec_t *_iov;
+	size_t        *_caps;
+
+	/* Total size and current position (chunk and offset in it). */
+
+	casio_off_t    _size, _offset;
+	int            _chunk;
+	size_t         _choff;
+} membuf_cookie_t;
+
+/* ---
+ * Utilities.
+ * --- */
+
+/**
+ *	add_chunk:
+ *	Add a chunk at the end of the chunk list.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	cap			the size of the chunk to add.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int add_chunk(membuf_cookie_t *cookie, size_t cap)
+{
+	void *data;
+
+	/* Make some space in the chunk list. */
+
+	if (cookie->_count == cookie->_alloc) {
+		int alloc = cookie->_alloc ? cookie->_alloc * 2 : 8;
+		casio_iovec_t *iov;
+		size_t *caps;
+
+		iov = casio_alloc(alloc, sizeof(casio_iovec_t));
+		caps = casio_alloc(alloc, sizeof(size_t));
+		if (!iov || !caps) {
+			casio_free(iov);
+			casio_free(caps);
+			return (casio_error_alloc);
+		}
+
+		if (cookie->_count) {
+			memcpy(iov, cookie->_iov, cookie->_count * sizeof(casio_iovec_t));
+			memcpy(caps, cookie->_caps, cookie->_count * sizeof(size_t));
+		}
+		casio_free(cookie->_iov);
+		casio_free(cookie->_caps);
+		cookie->_iov = iov;
+		cookie->_caps = caps;
+		cookie->_alloc = alloc;
+	}
+
+	/* Allocate the chunk. */
+
+	if (!(data = casio_alloc(cap, 1)))
+		return (casio_error_alloc);
+
+	cookie->_iov[cookie->_count].casio_iovec_base = data;
+	cookie->_iov[cookie->_count].casio_iovec_len = 0;
+	cookie->_caps[cookie->_count] = cap;
+	cookie->_count++;
+	return (0);
+}
+
+/**
+ *	chunk_data:
+ *	Get the data of a chunk.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	id			the chunk number.
+ *	@return				the chunk data.
+ */
+
+#define chunk_data(COOKIE, ID) \
+	((unsigned char *)(COOKIE)->_iov[(ID)].casio_iovec_base)
+
+/* ---
+ * Callbacks.
+ * --- */
+
+/**
+ *	membuf_read:
+ *	Read from a growable memory area.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	dest		the destination buffer.
+ *	@arg	size		the size to read.
+ *	@return				the size if > 0, or if < 0 the error code is -[returned value].
+ */
+
+CASIO_LOCAL ssize_t membuf_read(membuf_cookie_t *cookie,
+	unsigned char *dest, size_t size)
+{
+	size_t left = size;
+
+	if ((casio_off_t)size > cookie->_size - cookie->_offset)
+		return -(casio_error_eof);
+
+	while (left) {
+		size_t len = cookie->_iov[cookie->_chunk].casio_iovec_len
+			- cookie->_choff;
+
+		if (!len) {
+			cookie->_chunk++;
+			cookie->_choff = 0;
+			continue;
+		}
+
+		if (len > left)
+			len = left;
+		memcpy(dest, &chunk_data(cookie, cookie->_chunk)[cookie->_choff],
+			len);
+		dest += len;
+		left -= len;
+		cookie->_choff += len;
+	}
+
+	cookie->_offset += size;
+	return (size);
+}
+
+/**
+ *	membuf_write:
+ *	Write to a growable memory area.
+ *
+ *	Existing data is overwritten, then what's left is appended,
+ *	adding chunks when required.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	data		the source buffer.
+ *	@arg	size		the size to write.
+ *	@return				the size written if > 0, or if < 0 the error code is -[returned value].
+ */
+
+CASIO_LOCAL ssize_t membuf_write(membuf_cookie_t *cookie,
+	const unsigned char *data, size_t size)
+{
+	size_t left = size;
+	int err;
+
+	while (left) {
+		size_t len;
+
+		if (cookie->_chunk == cookie->_count
+		 || cookie->_choff == cookie->_caps[cookie->_chunk]) {
+			/* Get to the next chunk, add one if we are at the end. */
+
+			if (cookie->_chunk + 1 >= cookie->_count) {
+				size_t cap = cookie->_count
+					? cookie->_caps[cookie->_count - 1] * 2
+					: FIRST_CHUNK_SIZE;
+
+				if (cap > MAX_CHUNK_SIZE)
+					cap = MAX_CHUNK_SIZE;
+				if (cap < FIRST_CHUNK_SIZE)
+					cap = FIRST_CHUNK_SIZE;
+				if ((err = add_chunk(cookie, cap)))
+					return (-err);
+			}
+
+			if (cookie->_chunk < cookie->_count - 1
+			 || cookie->_choff)
+				cookie->_chunk++;
+			cookie->_choff = 0;
+			continue;
+		}
+
+		len = cookie->_caps[cookie->_chunk] - cookie->_choff;
+		if (len > left)
+			len = left;
+		memcpy(&chunk_data(cookie, cookie->_chunk)[cookie->_choff],
+			data, len);
+		data += len;
+		left -= len;
+		cookie->_choff += len;
+
+		/* Update the used size of the chunk if we went further. */
+
+		if (cookie->_iov[cookie->_chunk].casio_iovec_len < cookie->_choff)
+			cookie->_iov[cookie->_chunk].casio_iovec_len = cookie->_choff;
+	}
+
+	cookie->_offset += size;
+	if (cookie->_size < cookie->_offset)
+		cookie->_size = cookie->_offset;
+	return (size);
+}
+
+/**
+ *	membuf_seek:
+ *	Move within a growable memory area.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	offset		the offset.
+ *	@arg	whence		the whence.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int membuf_seek(membuf_cookie_t *cookie, casio_off_t *offset,
+	casio_whence_t whence)
+{
+	casio_off_t off, left;
+	int id;
+
+	/* Get the offset. */
+
+	switch (whence) {
+	case CASIO_SEEK_CUR:
+		off = cookie->_offset + *offset;
+		break;
+	case CASIO_SEEK_END:
+		off = cookie->_size - *offset;
+		break;
+	default /* CASIO_SEEK_SET */:
+		off = *offset;
+		break;
+	}
+
+	/* Check the bounds (we can't seek beyond the end, as we would
+	 * have to fill the gap). */
+
+	if (off < 0)
+		off = 0;
+	else if (off > cookie->_size)
+		off = cookie->_size;
+
+	/* Find the chunk. */
+
+	left = off;
+	for (id = 0; id < cookie->_count
+	 && left > (casio_off_t)cookie->_iov[id].casio_iovec_len; id++)
+		left -= (casio_off_t)cookie->_iov[id].casio_iovec_len;
+
+	cookie->_chunk = id;
+	cookie->_choff = (size_t)left;
+	cookie->_offset = off;
+	*offset = off;
+	return (0);
+}
+
+/**
+ *	membuf_close:
+ *	Close a growable memory area.
+ *
+ *	@arg	cookie		the cookie.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int membuf_close(membuf_cookie_t *cookie)
+{
+	int id;
+
+	for (id = 0; id < cookie->_count; id++)
+		casio_free((void *)cookie->_iov[id].casio_iovec_base);
+	casio_free(cookie->_iov);
+	casio_free(cookie->_caps);
+	casio_free(cookie);
+	return (0);
+}
+
+/* Callbacks. */
+
+CASIO_LOCAL const casio_streamfuncs_t membuf_callbacks =
+casio_stream_callbacks_for_virtual(membuf_close,
+	membuf_read, membuf_write, membuf_seek);
+
+/* ---
+ * Main functions.
+ * --- */
+
+/**
+ *	casio_open_membuf:
+ *	Open a growable memory stream.
+ *
+ *	@arg	stream		the stream to make.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_open_membuf(casio_stream_t **stream)
+{
+	membuf_cookie_t *cookie;
+
+	/* Allocate the cookie. */
+
+	cookie = casio_alloc(1, sizeof(membuf_cookie_t));
+	if (!cookie)
+		return (casio_error_alloc);
+
+	/* Fill the cookie. */
+
+	cookie->_count = 0;
+	cookie->_alloc = 0;
+	cookie->_iov = NULL;
+	cookie->_caps = NULL;
+	cookie->_size = 0;
+	cookie->_offset = 0;
+	cookie->_chunk = 0;
+	cookie->_choff = 0;
+
+	/* Initialize and return the stream. */
+
+	return (casio_open_stream(stream, CASIO_OPENMODE_READ
+		| CASIO_OPENMODE_WRITE | CASIO_OPENMODE_SEEK, cookie,
+		&membuf_callbacks, 0));
+}
+
+/**
+ *	get_cookie:
+ *	Get the cookie of a growable memory stream.
+ *
+ *	@arg	stream		the stream.
+ *	@return				the cookie (NULL if not a growable memory stream).
+ */
+
+CASIO_LOCAL membuf_cookie_t *get_cookie(casio_stream_t *stream)
+{
+	const casio_streamfuncs_t *funcs = casio_get_streamfuncs(stream);
+
+	if (!funcs || funcs->casio_streamfuncs_close
+	 != membuf_callbacks.casio_streamfuncs_close)
+		return (NULL);
+	return ((membuf_cookie_t *)casio_get_cookie(stream));
+}
+
+/**
+ *	casio_get_membuf_iovec:
+ *	Get the contents of a growable memory stream as a list of buffers.
+ *
+ *	The buffers belong to the stream, and stay valid until the next
+ *	write on it or until it is closed.
+ *
+ *	@arg	stream		the stream.
+ *	@arg	iov			the buffers to get.
+ *	@arg	iovcnt		the number of buffers to get.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_get_membuf_iovec(casio_stream_t *stream,
+	const casio_iovec_t **iov, int *iovcnt)
+{
+	membuf_cookie_t *cookie = get_cookie(stream);
+	int count;
+
+	if (!cookie)
+		return (casio_error_op);
+
+	/* Trailing empty chunks are not given. */
+
+	for (count = cookie->_count; count
+	 && !cookie->_iov[count - 1].casio_iovec_len; count--);
+
+	*iov = cookie->_iov;
+	*iovcnt = count;
+	return (0);
+}
+
+/**
+ *	casio_get_membuf:
+ *	Get the contents of a growable memory stream as a contiguous buffer.
+ *
+ *	If the contents are spread across several chunks, they are merged
+ *	into one first, which will be used by the stream from then on (so the
+ *	next calls won't have to copy anything).
+ *
+ *	The buffer belongs to the stream, and stays valid until the next
+ *	write on it or until it is closed.
+ *
+ *	@arg	stream		the stream.
+ *	@arg	data		the buffer to get.
+ *	@arg	size		the buffer size to get.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_get_membuf(casio_stream_t *stream,
+	const void **data, size_t *size)
+{
+	membuf_cookie_t *cookie = get_cookie(stream);
+	unsigned char *merged, *p;
+	int id;
+
+	if (!cookie)
+		return (casio_error_op);
+
+	if (!cookie->_size) {
+		*data = NULL;
+		*size = 0;
+		return (0);
+	}
+
+	if (cookie->_iov[0].casio_iovec_len != (size_t)cookie->_size) {
+		/* Merge all of the chunks into one. */
+
+		if (!(merged = casio_alloc((size_t)cookie->_size, 1)))
+			return (casio_error_alloc);
+
+		p = merged;
+		for (id = 0; id < cookie->_count; id++) {
+			memcpy(p, cookie->_iov[id].casio_iovec_base,
+				cookie->_iov[id].casio_iovec_len);
+			p += cookie->_iov[id].casio_iovec_len;
+			casio_free((void *)cookie->_iov[id].casio_iovec_base);
+		}
+
+		cookie->_iov[0].casio_iovec_base = merged;
+		cookie->_iov[0].casio_iovec_len = (size_t)cookie->_size;
+		cookie->_caps[0] = (size_t)cookie->_size;
+		cookie->_count = 1;
+
+		/* Get the position back into the merged chunk. */
+
+		cookie->_chunk = 0;
+		cookie->_choff = (size_t)cookie->_offset;
+	}
+
+	*data = cookie->_iov[0].casio_iovec_base;
+	*size = (size_t)cookie->_size;
+	return (0);
+}
@@ -0,0 +1,689 @@
+/* ****************************************************************************
+ * stream/builtin/record.c -- built-in recording and replaying streams.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * A record log starts with the "CASIOREC" magic, then is a sequence of
+ * records, each of them made of:
+ *
+ * - the record type (one byte): 'R' for data read from the device,
+ *   'W' for data written to it, 'r' and 'w' for failed reads and writes;
+ * - the delay since the previous record (or since the log was started),
+ *   in milliseconds;
+ * - for 'R' and 'W', the data size followed by the data; for 'r' and 'w',
+ *   the libcasio error code.
+ *
+ * Numbers are encoded using seven bits per byte, least significant group
+ * first, the most significant bit being set if another byte follows.
+ * ************************************************************************* */
+#include "../../internals.h"
+
+#define MAGIC "CASIOREC"
+#define MAGIC_SIZE 8
+
+/* ---
+ * Utilities.
+ * --- */
+
+/**
+ *	put_number:
+ *	Encode a number.
+ *
+ *	@arg	buf			the buffer to encode the number into.
+ *	@arg	num			the number to encode.
+ *	@return				the number of bytes used.
+ */
+
+CASIO_LOCAL size_t put_number(unsigned char *buf, unsigned long num)
+{
+	size_t size = 0;
+
+	while (num > 0x7F) {
+		buf[size++] = (unsigned char)(num & 0x7F) | 0x80;
+		num >>= 7;
+	}
+
+	buf[size++] = (unsigned char)num;
+	return (size);
+}
+
+/**
+ *	get_number:
+ *	Decode a number from a stream.
+ *
+ *	@arg	stream		the stream to read from.
+ *	@arg	num			the number to decode.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int get_number(casio_stream_t *stream, unsigned long *num)
+{
+	unsigned char byte; unsigned int shift = 0;
+	ssize_t ssize;
+
+	*num = 0;
+	do {
+		ssize = casio_read(stream, &byte, 1);
+		if (ssize < 0)
+			return ((int)-ssize);
+		if (shift >= sizeof(unsigned long) * 8)
+			return (casio_error_magic);
+
+		*num |= (unsigned long)(byte & 0x7F) << shift;
+		shift += 7;
+	} while (byte & 0x80);
+
+	return (0);
+}
+
+/* ---
+ * Recording stream.
+ * --- */
+
+/* Cookie structure. */
+
+typedef struct {
+	casio_stream_t *_stream;
+	casio_stream_t *_log;
+	unsigned long   _last;
+	int             _logerr;
+} record_cookie_t;
+
+/**
+ *	record_entry:
+ *	Add an entry to the log.
+ *
+ *	If the log can't be written to anymore, the recording stops but the
+ *	exchanges with the original stream go on: the recorder shall never be
+ *	the cause of a communication failure.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	type		the record type.
+ *	@arg	num			the data size or the error code.
+ *	@arg	data		the data (NULL if none).
+ */
+
+CASIO_LOCAL void record_entry(record_cookie_t *cookie, int type,
+	unsigned long num, const unsigned char *data)
+{
+	unsigned char head[1 + 2 * (sizeof(unsigned long) * 8 / 7 + 1)];
+	unsigned long now; size_t size;
+	ssize_t ssize;
+
+	if (cookie->_logerr)
+		return ;
+
+	/* Make the header. */
+
+	now = casio_clock();
+	head[0] = (unsigned char)type;
+	size = 1;
+	size += put_number(&head[size], now - cookie->_last);
+	size += put_number(&head[size], num);
+	cookie->_last = now;
+
+	/* Write the header and the data. */
+
+	ssize = casio_write(cookie->_log, head, size);
+	if (ssize >= 0 && data && num)
+		ssize = casio_write(cookie->_log, data, (size_t)num);
+	if (ssize < 0) {
+		msg((ll_error, "Could not write to the log (%s), stop recording.",
+			casio_strerror((int)-ssize)));
+		cookie->_logerr = 1;
+	}
+}
+
+/**
+ *	record_read:
+ *	Read from the original stream and record what was read.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	dest		the destination buffer.
+ *	@arg	size		the size to read.
+ *	@return				the size if > 0, or if < 0 the error code is -[returned value].
+ */
+
+CASIO_LOCAL ssize_t record_read(record_cookie_t *cookie,
+	unsigned char *dest, size_t size)
+{
+	ssize_t ssize;
+
+	/* There is no partial success: if it has succeeded, all of the
+	 * requested data has been read. */
+
+	ssize = casio_read(cookie->_stream, dest, size);
+	if (ssize < 0)
+		record_entry(cookie, 'r', (unsigned long)-ssize, NULL);
+	else
+		record_entry(cookie, 'R', (unsigned long)size, dest);
+
+	return (ssize);
+}
+
+/**
+ *	record_write:
+ *	Write to the original stream and record what was written.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	data		the source buffer.
+ *	@arg	size		the size to write.
+ *	@return				the size written if > 0, or if < 0 the error code is -[returned value].
+ */
+
+CASIO_LOCAL ssize_t record_write(record_cookie_t *cookie,
+	const unsigned char *data, size_t size)
+{
+	ssize_t ssize;
+
+	ssize = casio_write(cookie->_stream, data, size);
+	if (ssize < 0)
+		record_entry(cookie, 'w', (unsigned long)-ssize, NULL);
+	else
+		record_entry(cookie, 'W', (unsigned long)size, data);
+
+	return (ssize);
+}
+
+/**
+ *	record_writev:
+ *	Write several buffers to the original stream and record them.
+ *
+ *	Buffers are recorded one after the other, as replaying doesn't care
+ *	about how writes were split.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	iov			the buffers.
+ *	@arg	iovcnt		the number of buffers.
+ *	@return				the size written if > 0, or if < 0 the error code is -[returned value].
+ */
+
+CASIO_LOCAL ssize_t record_writev(record_cookie_t *cookie,
+	const casio_iovec_t *iov, int iovcnt)
+{
+	ssize_t ssize;
+	int i;
+
+	ssize = casio_writev(cookie->_stream, iov, iovcnt);
+	if (ssize < 0)
+		record_entry(cookie, 'w', (unsigned long)-ssize, NULL);
+	else for (i = 0; i < iovcnt; i++) {
+		if (iov[i].casio_iovec_len)
+			record_entry(cookie, 'W', (unsigned long)iov[i].casio_iovec_len,
+				iov[i].casio_iovec_base);
+	}
+
+	return (ssize);
+}
+
+/**
+ *	record_settm:
+ *	Set the timeouts of the original stream.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	timeouts	the timeouts.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int record_settm(record_cookie_t *cookie,
+	const casio_timeouts_t *timeouts)
+{
+	return (casio_set_timeouts(cookie->_stream, timeouts));
+}
+
+/**
+ *	record_setattrs:
+ *	Set the attributes of the original stream.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	attrs		the attributes.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int record_setattrs(record_cookie_t *cookie,
+	const casio_streamattrs_t *attrs)
+{
+	return (casio_set_attrs(cookie->_stream, attrs));
+}
+
+/**
+ *	record_scsi:
+ *	Make an SCSI request on the original stream (not recorded).
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	request		the request.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int record_scsi(record_cookie_t *cookie, casio_scsi_t *request)
+{
+	return (casio_scsi_request(cookie->_stream, request));
+}
+
+/**
+ *	record_close:
+ *	Close the recording stream, the original stream and the log.
+ *
+ *	@arg	cookie		the cookie.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int record_close(record_cookie_t *cookie)
+{
+	casio_close(cookie->_stream);
+	casio_close(cookie->_log);
+	casio_free(cookie);
+	return (0);
+}
+
+/* Callbacks. */
+
+CASIO_LOCAL const casio_streamfuncs_t record_callbacks = {
+	(casio_stream_close_t *)&record_close,
+	(casio_stream_settm_t *)&record_settm,
+	(casio_stream_read_t *)&record_read,
+	(casio_stream_write_t *)&record_write,
+	NULL,
+	(casio_stream_setattrs_t *)&record_setattrs,
+	(casio_stream_scsi_t *)&record_scsi,
+	(casio_stream_writev_t *)&record_writev
+};
+
+/**
+ *	casio_open_record:
+ *	Open a recording stream.
+ *
+ *	@arg	stream		the stream to make.
+ *	@arg	original	the original stream.
+ *	@arg	log			the stream to write the log to.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_open_record(casio_stream_t **stream,
+	casio_stream_t *original, casio_stream_t *log)
+{
+	record_cookie_t *cookie = NULL;
+	casio_openmode_t mode;
+	ssize_t ssize;
+
+	if (!original || !casio_iswritable(log))
+		return (casio_error_op);
+
+	/* Allocate the cookie. */
+
+	cookie = casio_alloc(1, sizeof(record_cookie_t));
+	if (!cookie)
+		return (casio_error_alloc);
+
+	/* Write the magic. */
+
+	ssize = casio_write(log, MAGIC, MAGIC_SIZE);
+	if (ssize < 0) {
+		casio_free(cookie);
+		return ((int)-ssize);
+	}
+
+	/* Fill the cookie. */
+
+	cookie->_stream = original;
+	cookie->_log = log;
+	cookie->_last = casio_clock();
+	cookie->_logerr = 0;
+
+	/* Initialize and return the stream. */
+
+	mode = casio_get_openmode(original) & (CASIO_OPENMODE_READ
+		| CASIO_OPENMODE_WRITE | CASIO_OPENMODE_SERIAL
+		| CASIO_OPENMODE_SCSI | CASIO_OPENMODE_USB);
+	return (casio_open_stream(stream, mode, cookie, &record_callbacks, 0));
+}
+
+/* ---
+ * Replaying stream.
+ * --- */
+
+/* Cookie structure. */
+
+typedef struct {
+	casio_stream_t *_log;
+	unsigned int    _flags;
+	unsigned long   _last;
+
+	/* Current record. */
+
+	int             _type;
+	unsigned long   _left;
+} replay_cookie_t;
+
+/**
+ *	replay_next:
+ *	Get to the next record.
+ *
+ *	@arg	cookie		the cookie.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int replay_next(replay_cookie_t *cookie)
+{
+	int err; unsigned char type;
+	unsigned long delay;
+	ssize_t ssize;
+
+	/* Skip what's left of the current record. */
+
+	if (cookie->_left && (cookie->_type == 'R' || cookie->_type == 'W')) {
+		err = casio_skip(cookie->_log, (size_t)cookie->_left);
+		if (err)
+			return (err);
+	}
+
+	cookie->_type = 0;
+	cookie->_left = 0;
+
+	/* Read the record header. */
+
+	ssize = casio_read(cookie->_log, &type, 1);
+	if (ssize < 0)
+		return ((int)-ssize);
+	if (type != 'R' && type != 'W' && type != 'r' && type != 'w') {
+		msg((ll_error, "Unknown record type 0x%02X", type));
+		return (casio_error_magic);
+	}
+
+	if ((err = get_number(cookie->_log, &delay))
+	 || (err = get_number(cookie->_log, &cookie->_left)))
+		return (err == casio_error_eof ? casio_error_magic : err);
+
+	/* Respect the recorded pace if required. */
+
+	if (cookie->_flags & CASIO_REPLAYFLAG_PACE) {
+		unsigned long elapsed = casio_clock() - cookie->_last;
+
+		if (elapsed < delay)
+			casio_sleep(delay - elapsed);
+		cookie->_last = casio_clock();
+	}
+
+	cookie->_type = type;
+	return (0);
+}
+
+/**
+ *	replay_check:
+ *	Check that the written data corresponds to the recorded data.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	data		the written data.
+ *	@arg	size		the written data size.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int replay_check(replay_cookie_t *cookie,
+	const unsigned char *data, size_t size)
+{
+	unsigned char buf[256];
+	ssize_t ssize;
+
+	while (size) {
+		size_t len = min(size, sizeof(buf));
+
+		ssize = casio_read(cookie->_log, buf, len);
+		if (ssize < 0)
+			return ((int)-ssize);
+		if (memcmp(buf, data, len)) {
+			msg((ll_error, "Written data differs from the recording."));
+			return (casio_error_write);
+		}
+
+		data += len;
+		size -= len;
+	}
+
+	return (0);
+}
+
+/**
+ *	replay_read:
+ *	Read recorded data.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	dest		the destination buffer.
+ *	@arg	size		the size to read.
+ *	@return				the size if > 0, or if < 0 the error code is -[returned value].
+ */
+
+CASIO_LOCAL ssize_t replay_read(replay_cookie_t *cookie,
+	unsigned char *dest, size_t size)
+{
+	int err; size_t copiedsize = 0;
+	ssize_t ssize;
+
+	while (size) {
+		size_t len;
+
+		if (!cookie->_left || cookie->_type == 'r' || cookie->_type == 'w') {
+			if (cookie->_type == 'r') {
+				/* Replay the error, then go on. */
+
+				err = (int)cookie->_left;
+				cookie->_type = 0;
+				cookie->_left = 0;
+				return (-err);
+			}
+
+			if (cookie->_type == 'w'
+			 && cookie->_flags & CASIO_REPLAYFLAG_CHECK) {
+				msg((ll_error, "Expected a write, got a read."));
+				return (-casio_error_read);
+			}
+
+			if ((err = replay_next(cookie)))
+				return (-err);
+			continue;
+		}
+
+		if (cookie->_type == 'W') {
+			/* The recorded session wrote something we didn't. */
+
+			if (cookie->_flags & CASIO_REPLAYFLAG_CHECK) {
+				msg((ll_error, "Expected a write, got a read."));
+				return (-casio_error_read);
+			}
+
+			if ((err = replay_next(cookie)))
+				return (-err);
+			continue;
+		}
+
+		/* Read from the current record. */
+
+		len = size;
+		if ((unsigned long)len > cookie->_left)
+			len = (size_t)cookie->_left;
+
+		ssize = casio_read(cookie->_log, dest, len);
+		if (ssize < 0)
+			return (ssize);
+
+		cookie->_left -= len;
+		dest += len;
+		size -= len;
+		copiedsize += len;
+	}
+
+	return ((ssize_t)copiedsize);
+}
+
+/**
+ *	replay_write:
+ *	Check written data against the recording.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	data		the source buffer.
+ *	@arg	size		the size to write.
+ *	@return				the size written if > 0, or if < 0 the error code is -[returned value].
+ */
+
+CASIO_LOCAL ssize_t replay_write(replay_cookie_t *cookie,
+	const unsigned char *data, size_t size)
+{
+	int err; size_t writtensize = 0;
+
+	while (size) {
+		size_t len;
+
+		if (cookie->_type == 'w') {
+			/* Replay the error. */
+
+			err = (int)cookie->_left;
+			cookie->_type = 0;
+			cookie->_left = 0;
+			return (-err);
+		}
+
+		if (!cookie->_type || (!cookie->_left
+		 && (cookie->_type == 'R' || cookie->_type == 'W'))) {
+			err = replay_next(cookie);
+			if (err == casio_error_eof
+			 && ~cookie->_flags & CASIO_REPLAYFLAG_CHECK)
+				break;
+			if (err)
+				return (-err);
+			continue;
+		}
+
+		if (cookie->_type != 'W') {
+			/* The recorded session didn't write that; what it has read
+			 * next is kept for the next read. */
+
+			if (cookie->_flags & CASIO_REPLAYFLAG_CHECK) {
+				msg((ll_error, "Expected a read, got a write."));
+				return (-casio_error_write);
+			}
+
+			break;
+		}
+
+		/* Consume the current record. */
+
+		len = size;
+		if ((unsigned long)len > cookie->_left)
+			len = (size_t)cookie->_left;
+
+		if (cookie->_flags & CASIO_REPLAYFLAG_CHECK)
+			err = replay_check(cookie, data, len);
+		else
+			err = casio_skip(cookie->_log, len);
+		if (err)
+			return (-err);
+
+		cookie->_left -= len;
+		data += len;
+		size -= len;
+		writtensize += len;
+	}
+
+	return ((ssize_t)(writtensize + size));
+}
+
+/**
+ *	replay_settm:
+ *	Set the timeouts (ignored).
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	timeouts	the timeouts.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int replay_settm(replay_cookie_t *cookie,
+	const casio_timeouts_t *timeouts)
+{
+	(void)cookie;
+	(void)timeouts;
+	return (0);
+}
+
+/**
+ *	replay_close:
+ *	Close the replaying stream and the log.
+ *
+ *	@arg	cookie		the cookie.
+ *	@return				the error code (0 if ok).
+ */
+
+CASIO_LOCAL int replay_close(replay_cookie_t *cookie)
+{
+	casio_close(cookie->_log);
+	casio_free(cookie);
+	return (0);
+}
+
+/* Callbacks. */
+
+CASIO_LOCAL const casio_streamfuncs_t replay_callbacks = {
+	(casio_stream_close_t *)&replay_close,
+	(casio_stream_settm_t *)&replay_settm,
+	(casio_stream_read_t *)&replay_read,
+	(casio_stream_write_t *)&replay_write,
+	NULL, NULL, NULL, NULL
+};
+
+/**
+ *	casio_open_replay:
+ *	Open a replaying stream.
+ *
+ *	@arg	stream		the stream to make.
+ *	@arg	log			the stream to read the log from.
+ *	@arg	flags		the replay flags.
+ *	@return				the error code (0 if ok).
+ */
+
+int CASIO_EXPORT casio_open_replay(casio_stream_t **stream,
+	casio_stream_t *log, unsigned int flags)
+{
+	replay_cookie_t *cookie = NULL;
+	unsigned char magic[MAGIC_SIZE];
+	ssize_t ssize;
+
+	if (!casio_isreadable(log))
+		return (casio_error_op);
+
+	/* Check the magic. */
+
+	ssize = casio_read(log, magic, MAGIC_SIZE);
+	if (ssize < 0)
+		return ((int)-ssize);
+	if (memcmp(magic, MAGIC, MAGIC_SIZE))
+		return (casio_error_magic);
+
+	/* Allocate and fill the cookie. */
+
+	cookie = casio_alloc(1, sizeof(replay_cookie_t));
+	if (!cookie)
+		return (casio_error_alloc);
+
+	cookie->_log = log;
+	cookie->_flags = flags;
+	cookie->_last = casio_clock();
+	cookie->_type = 0;
+	cookie->_left = 0;
+
+	/* Initialize and return the stream. */
+
+	return (casio_open_stream(stream,
+		CASIO_OPENMODE_READ | CASIO_OPENMODE_WRITE,
+		cookie, &replay_callbacks, 0));
+}
@@ -21,10 +21,16 @@
 
 /* Callbacks. */
 
-CASIO_LOCAL const casio_streamfuncs_t casio_streams_callbacks =
-casio_stream_callbacks_for_serial(casio_streams_close,
-	casio_streams_setattrs, casio_streams_settm,
-	casio_streams_read, casio_streams_write);
+CASIO_LOCAL const casio_streamfuncs_t casio_streams_callbacks = {
+	(casio_stream_close_t *)&casio_streams_close,
+	(casio_stream_settm_t *)&casio_streams_settm,
+	(casio_stream_read_t *)&casio_streams_read,
+	(casio_stream_write_t *)&casio_streams_write,
+	NULL,
+	(casio_stream_setattrs_t *)&casio_streams_setattrs,
+	NULL,
+	(casio_stream_writev_t *)&casio_streams_writev
+};
 
 /**
  *	casio_opencom_streams:
@@ -24,6 +24,7 @@
 #  include <sys/ioctl.h>
 #  include <fcntl.h>
 #  include <unistd.h>
+#  include <sys/uio.h>
 #  include <errno.h>
 #  include <termios.h>
 
@@ -57,6 +58,9 @@ CASIO_EXTERN ssize_t CASIO_EXPORT casio_streams_read
 CASIO_EXTERN ssize_t CASIO_EXPORT casio_streams_write
 	OF((streams_cookie_t *casio__cookie,
 		const unsigned char *casio__data, size_t casio__size));
+CASIO_EXTERN ssize_t CASIO_EXPORT casio_streams_writev
+	OF((streams_cookie_t *casio__cookie,
+		const casio_iovec_t *casio__iov, int casio__iovcnt));
 
 /* Serial callbacks. */
 
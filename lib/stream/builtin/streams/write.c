@@ -57,4 +57,71 @@ ssize_t CASIO_EXPORT casio_streams_write(streams_cookie_t *cookie,
 	return (writtensize);
 }
 
+/* The maximum number of buffers we give to `writev()` at once. */
+
+#define MAX_IOV 16
+
+/**
+ *	casio_streams_writev:
+ *	Write several buffers to a terminal, using `writev()`.
+ *
+ *	@arg	cookie		the cookie.
+ *	@arg	iov			the buffers.
+ *	@arg	iovcnt		the number of buffers.
+ *	@return				the size written if > 0, or if < 0 the error code is -[returned value].
+ */
+
+ssize_t CASIO_EXPORT casio_streams_writev(streams_cookie_t *cookie,
+	const casio_iovec_t *iov, int iovcnt)
+{
+	int fd = cookie->_writefd;
+	struct iovec vec[MAX_IOV];
+	size_t writtensize = 0;
+	int cnt;
+
+	while (iovcnt) {
+		/* Make up the system buffers out of ours. */
+
+		for (cnt = 0; cnt < iovcnt && cnt < MAX_IOV; cnt++) {
+			vec[cnt].iov_base = (void *)iov[cnt].casio_iovec_base;
+			vec[cnt].iov_len = iov[cnt].casio_iovec_len;
+		}
+		iov += cnt;
+		iovcnt -= cnt;
+
+		/* Send, taking care of partial writes. */
+
+		while (cnt) {
+			ssize_t wr = writev(fd, vec, cnt);
+			size_t left;
+			int i;
+
+			if (wr < 0) switch (errno) {
+				case EINTR:
+					continue;
+				case ENODEV:
+					return -(casio_error_nocalc);
+				default:
+					msg((ll_fatal, "errno was %d: %s", errno,
+						strerror(errno)));
+					return -(casio_error_unknown);
+			}
+
+			writtensize += (size_t)wr;
+			left = (size_t)wr;
+			for (i = 0; i < cnt && left >= vec[i].iov_len; i++)
+				left -= vec[i].iov_len;
+			if (i < cnt) {
+				vec[i].iov_base = &((char *)vec[i].iov_base)[left];
+				vec[i].iov_len -= left;
+			}
+
+			memmove(vec, &vec[i], (cnt - i) * sizeof(struct iovec));
+			cnt -= i;
+		}
+	}
+
+	return (writtensize);
+}
+
 #endif
@@ -27,7 +27,7 @@ CASIO_LOCAL const casio_streamfuncs_t casio_windows_callbacks = {
 	(casio_stream_read_t*)&casio_windows_read,
 	(casio_stream_write_t*)&casio_windows_write,
 	(casio_stream_seek_t*)&casio_windows_seek,
-	(casio_stream_setattrs_t*)&casio_windows_setattrs, NULL
+	(casio_stream_setattrs_t*)&casio_windows_setattrs, NULL, NULL
 };
 
 /**
@@ -74,6 +74,21 @@ void* CASIO_EXPORT casio_get_cookie(casio_stream_t *stream)
 	return (stream->casio_stream_cookie);
 }
 
+/**
+ *	casio_get_streamfuncs:
+ *	Get the stream callbacks.
+ *
+ *	@arg	stream		the stream.
+ *	@return				the callbacks.
+ */
+
+const casio_streamfuncs_t* CASIO_EXPORT casio_get_streamfuncs(
+	casio_stream_t *stream)
+{
+	if (!stream) return (NULL);
+	return (&stream->casio_stream_callbacks);
+}
+
 /**
  *	casio_get_lasterr:
  *	Get the last error.
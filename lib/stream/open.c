@@ -60,9 +60,24 @@ int CASIO_EXPORT casio_open_stream(casio_stream_t **pstream,
 	if ((mode & CASIO_OPENMODE_WRITE) && callbacks->casio_streamfuncs_write) {
 		stream->casio_stream_mode |= CASIO_OPENMODE_WRITE;
 		c->casio_streamfuncs_write = callbacks->casio_streamfuncs_write;
+		c->casio_streamfuncs_writev = callbacks->casio_streamfuncs_writev;
+	}
+	if ((stream->casio_stream_mode
+	  & (CASIO_OPENMODE_READ | CASIO_OPENMODE_WRITE))
+	 && callbacks->casio_streamfuncs_seek) {
+		/* Having a seek callback doesn't mean the stream is seekable
+		 * (e.g. files can be pipes), so check by not moving, unless
+		 * we were told. If it isn't, bytes are skipped by reading. */
+
+		casio_off_t off = 0;
+
+		if ((mode & CASIO_OPENMODE_SEEK)
+		 || !(*callbacks->casio_streamfuncs_seek)(cookie, &off,
+		  CASIO_SEEK_CUR)) {
+			stream->casio_stream_mode |= CASIO_OPENMODE_SEEK;
+			c->casio_streamfuncs_seek  = callbacks->casio_streamfuncs_seek;
+		}
 	}
-	if (mode & (CASIO_OPENMODE_READ | CASIO_OPENMODE_WRITE))
-		c->casio_streamfuncs_seek  = callbacks->casio_streamfuncs_seek;
 
 	if ((mode & CASIO_OPENMODE_SERIAL)
 	 && callbacks->casio_streamfuncs_setattrs) {
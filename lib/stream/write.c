@@ -59,6 +59,83 @@ fail:
 	return ssize;
 }
 
+/* The gathering buffer size for streams without a scatter-gather write
+ * callback. Protocol 7.00 packets, for which this is mostly used,
+ * are usually smaller than this. */
+
+#define GATHER_SIZE 1024
+
+/**
+ *	casio_writev:
+ *	Write several buffers to a libcasio stream, as if they were one.
+ *
+ *	If the stream has no scatter-gather write callback, the buffers are
+ *	gathered into one when they are small enough, so that only one
+ *	write is made; otherwise, they are written one after the other.
+ *
+ *	@arg	stream		the stream to write to.
+ *	@arg	iov			the buffers to write.
+ *	@arg	iovcnt		the number of buffers.
+ *	@return				the size written if > 0, or if < 0 the error code is -[returned value].
+ */
+
+ssize_t CASIO_EXPORT casio_writev(casio_stream_t *stream,
+	const casio_iovec_t *iov, int iovcnt)
+{
+	int err = casio_error_ok, i;
+	size_t size = 0;
+	ssize_t ssize = 0;
+	casio_stream_writev_t *writev;
+
+	/* check if we can write */
+	failure(~stream->casio_stream_mode & CASIO_OPENMODE_WRITE,
+		casio_error_write);
+
+	/* get the total size */
+	for (i = 0; i < iovcnt; i++)
+		size += iov[i].casio_iovec_len;
+	if (size == 0)
+		return (0);
+
+	/* write */
+	writev = getcb(stream, writev);
+	if (writev)
+		ssize = (*writev)(stream->casio_stream_cookie, iov, iovcnt);
+	else if (size <= GATHER_SIZE) {
+		unsigned char buf[GATHER_SIZE], *p = buf;
+
+		for (i = 0; i < iovcnt; i++) {
+			memcpy(p, iov[i].casio_iovec_base, iov[i].casio_iovec_len);
+			p += iov[i].casio_iovec_len;
+		}
+
+		ssize = (*getcb(stream, write))(stream->casio_stream_cookie,
+			buf, size);
+	} else for (i = 0; i < iovcnt; i++) {
+		if (!iov[i].casio_iovec_len)
+			continue;
+
+		ssize = (*getcb(stream, write))(stream->casio_stream_cookie,
+			iov[i].casio_iovec_base, iov[i].casio_iovec_len);
+		if (ssize < 0)
+			break;
+	}
+
+	if (ssize < 0) {
+		err = -ssize;
+		msg((ll_error, "Stream writing failure: %s", casio_strerror(err)));
+		goto fail;
+	}
+
+	/* move the cursor and return */
+	stream->casio_stream_offset += size;
+	stream->casio_stream_lasterr = 0;
+	return ((ssize_t)size);
+fail:
+	stream->casio_stream_lasterr = err;
+	return (-(ssize_t)err);
+}
+
 /**
  *	casio_write_char:
  *	Write a character to a libcasio stream.
@@ -0,0 +1,87 @@
+/* ****************************************************************************
+ * utils/clock.c -- get a monotonic clock value.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of libcasio.
+ * libcasio is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3.0 of the License,
+ * or (at your option) any later version.
+ *
+ * libcasio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libcasio; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************* */
+#include "../internals.h"
+
+/* ---
+ * Microsoft Windows environment.
+ * --- */
+
+#if defined(__WINDOWS__)
+# define default_callback &casio_winclock
+# include <windows.h>
+
+CASIO_LOCAL unsigned long casio_winclock(void)
+{
+	return ((unsigned long)GetTickCount());
+}
+
+/* ---
+ * UNIX environments.
+ * --- */
+
+#elif defined(__unix__) || defined(__unix)
+# define default_callback &casio_unixclock
+# include <time.h>
+
+CASIO_LOCAL unsigned long casio_unixclock(void)
+{
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts))
+		return (0);
+	return ((unsigned long)ts.tv_sec * 1000
+		+ (unsigned long)ts.tv_nsec / 1000000);
+}
+
+/* ---
+ * Default.
+ * --- */
+
+#else
+# define default_callback NULL
+#endif
+
+CASIO_LOCAL casio_clock_t *casio_clock_callback = default_callback;
+
+/**
+ *	casio_set_clock:
+ *	Set the clock function.
+ *
+ *	@arg	func	the function to set.
+ */
+
+void CASIO_EXPORT casio_set_clock(casio_clock_t *func)
+{
+	casio_clock_callback = func;
+}
+
+/**
+ *	casio_clock:
+ *	Get the current value of the monotonic clock.
+ *
+ *	@return			the clock value in milliseconds (0 if there is none).
+ */
+
+unsigned long CASIO_EXPORT casio_clock(void)
+{
+	if (!casio_clock_callback)
+		return (0);
+
+	return ((*casio_clock_callback)());
+}
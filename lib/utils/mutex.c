@@ -18,6 +18,18 @@
  * ************************************************************************* */
 #include "../internals.h"
 
+/* Taking the mutex has to be atomic for it to be usable from several
+ * threads; GCC and compatible compilers have built-ins for this. */
+
+#if defined(__GNUC__) \
+	&& (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+# define take(M)    __sync_lock_test_and_set((M), 1)
+# define release(M) __sync_lock_release(M)
+#else
+# define take(M)    (*(volatile casio_mutex_t*)(M) ? 1 : (*(M) = 1, 0))
+# define release(M) (*(M) = 0)
+#endif
+
 /**
  *	casio_init_lock:
  *	Initialize a mutex.
@@ -42,13 +54,12 @@ int  CASIO_EXPORT casio_lock(casio_mutex_t *mutex)
 {
 	int err;
 
-	if (!*mutex) goto unlocked;
+	if (!take(mutex))
+		return (0);
 	if ((err = casio_sleep(0))) return (err);
-	while (*(volatile casio_mutex_t*)mutex)
+	while (take(mutex))
 		casio_sleep(5);
 
-unlocked:
-	*mutex = 1;
 	return (0);
 }
 
@@ -62,8 +73,7 @@ unlocked:
 
 int  CASIO_EXPORT casio_trylock(casio_mutex_t *mutex)
 {
-	if (*mutex) return (casio_error_lock);
-	*mutex = 1;
+	if (take(mutex)) return (casio_error_lock);
 	return (0);
 }
 
@@ -76,5 +86,5 @@ int  CASIO_EXPORT casio_trylock(casio_mutex_t *mutex)
 
 void CASIO_EXPORT casio_unlock(casio_mutex_t *mutex)
 {
-	*mutex = 0;
+	release(mutex);
 }
@@ -157,7 +157,7 @@ FOOT;
 
 static const char help_main_part0[] =
 "Usage: " BIN " [--version|-v] [--help|-h] [--no-init] [--no-exit]\n"
-"          [--storage <fls0>] [--com <device>]\n"
+"          [--storage <fls0>] [--com <device>|--all]\n"
 "          <subcommand> [options...]\n"
 "\n"
 "Subcommands you can use are:\n"
@@ -179,6 +179,8 @@ static const char help_main_part0[] =
 "                    calculator connected using a USB-to-serial cable.\n"
 "                    If this option isn't used, the program will look for a\n"
 "                    calculator connected using direct USB.\n"
+"  --all             Run the subcommand on all of the calculators connected\n"
+"                    using direct USB at once (send and optimize only).\n"
 "  --storage <abc0>  The storage device with which to interact (fls0, crd0).\n"
 "                    Default storage device is '" DEFAULT_STORAGE "'.\n"
 "  --no-exit         Does not terminate connection when action is completed.\n"
@@ -287,6 +289,7 @@ int parse_args(int ac, char **av, args_t *args)
 		{"help",            no_argument, NULL, 'h'},
 		{"version",         no_argument, NULL, 'v'},
 		{"com",       required_argument, NULL, 'c'},
+		{"all",             no_argument, NULL, 'a'},
 		{"storage",   required_argument, NULL, 's'},
 		{"force",           no_argument, NULL, 'f'},
 		{"output",    required_argument, NULL, 'o'},
@@ -315,6 +318,7 @@ int parse_args(int ac, char **av, args_t *args)
 	args->local = NULL;
 	args->force = 0;
 	args->com = 0;
+	args->all = 0;
 	args->storage = DEFAULT_STORAGE;
 	args->initflags = CASIO_LINKFLAG_ACTIVE | CASIO_LINKFLAG_CHECK
 		| CASIO_LINKFLAG_TERM;
@@ -346,6 +350,8 @@ int parse_args(int ac, char **av, args_t *args)
 
 		/* com port */
 		case 'c': args->com = optarg; break;
+		/* all devices */
+		case 'a': args->all = 1; break;
 		/* storage */
 		case 's': args->storage = optarg; break;
 		/* force no initialization */
@@ -458,6 +464,11 @@ int parse_args(int ac, char **av, args_t *args)
 	else if (args->newdir && !memchr(args->newdir, '\0', 9))
 		fprintf(stderr,
 			"Destination directory name must have 8 chars or less!\n");
+	else if (args->all && args->com)
+		fprintf(stderr, "--all can't be used with --com!\n");
+	else if (args->all && args->menu != mn_send
+	 && args->menu != mn_optimize)
+		fprintf(stderr, "--all can only be used with send and optimize!\n");
 	else if (!memchr(args->storage, '\0', 5))
 		fprintf(stderr, "Storage device (%s) should be 4 chars long!\n",
 			args->storage);
@@ -0,0 +1,162 @@
+/* *****************************************************************************
+ * p7/deploy.c -- p7 all-devices mode.
+ * Copyright (C) 2017 Thomas "Cakeisalie5" Touhey <thomas@touhey.fr>
+ *
+ * This file is part of p7utils.
+ * p7utils is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2.0 of the License,
+ * or (at your option) any later version.
+ *
+ * p7utils is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with p7utils; if not, see <http://www.gnu.org/licenses/>.
+ * ************************************************************************** */
+#include "main.h"
+#include <stdlib.h>
+
+/**
+ *	read_local:
+ *	Read the whole local file, so that it is shared by all of the workers.
+ *
+ *	@arg	file	the local file.
+ *	@arg	datap	the data to allocate.
+ *	@arg	sizep	the data size to get.
+ *	@return			the error code (0 if ok).
+ */
+
+static int read_local(FILE *file, void **datap, size_t *sizep)
+{
+	long size;
+	void *data;
+
+	if (fseek(file, 0, SEEK_END) || (size = ftell(file)) < 0)
+		return (casio_error_read);
+	rewind(file);
+	if (!size)
+		return (casio_error_empty);
+
+	if (!(data = malloc(size)))
+		return (casio_error_alloc);
+	if (fread(data, 1, size, file) != (size_t)size) {
+		free(data);
+		return (casio_error_read);
+	}
+
+	*datap = data;
+	*sizep = size;
+	return (0);
+}
+
+/**
+ *	put_report:
+ *	Display the deployment report.
+ *
+ *	@arg	report	the report.
+ */
+
+static void put_report(const casio_deploy_report_t *report)
+{
+	const casio_deploy_result_t *result;
+	unsigned long time;
+	int i;
+
+	result = report->casio_deploy_report_results;
+	for (i = 0; i < report->casio_deploy_report_count; i++, result++) {
+		if (result->casio_deploy_result_bus >= 0)
+			printf("Calculator #%d (bus %03d, address %03d): ", i + 1,
+				result->casio_deploy_result_bus,
+				result->casio_deploy_result_address);
+		else
+			printf("Calculator #%d: ", i + 1);
+
+		if (result->casio_deploy_result_error)
+			printf("error: %s\n",
+				casio_strerror(result->casio_deploy_result_error));
+		else if (result->casio_deploy_result_skipped)
+			printf("ok, file already there, skipped\n");
+		else
+			printf("ok, %lu bytes in %lu.%03lus\n",
+				result->casio_deploy_result_size,
+				result->casio_deploy_result_time / 1000,
+				result->casio_deploy_result_time % 1000);
+	}
+
+	time = report->casio_deploy_report_time;
+	printf("Done on %d out of %d calculator(s), %lu bytes in %lu.%03lus",
+		report->casio_deploy_report_count
+		- report->casio_deploy_report_failed,
+		report->casio_deploy_report_count,
+		report->casio_deploy_report_size, time / 1000, time % 1000);
+	if (time) /* divide first, not to overflow a 32-bit long */
+		printf(" (%lu KiB/s)",
+			report->casio_deploy_report_size / 1024 * 1000 / time);
+	fputc('\n', stdout);
+}
+
+/**
+ *	deploy:
+ *	Run the subcommand on all of the connected calculators.
+ *
+ *	@arg	args	the parsed arguments.
+ *	@return			the program return code.
+ */
+
+int deploy(args_t *args)
+{
+	casio_deploy_report_t *report = NULL;
+	casio_deploy_file_t file;
+	casio_deploy_files_t files;
+	void *data = NULL;
+	int err, ret;
+
+	switch (args->menu) {
+	case mn_send:
+		/* Read the local file once. */
+
+		err = read_local(args->local, &data, &file.casio_deploy_file_size);
+		if (err)
+			break;
+
+		file.casio_deploy_file_device = args->storage;
+		file.casio_deploy_file_dirname = args->dirname;
+		file.casio_deploy_file_filename = args->filename;
+		file.casio_deploy_file_data = data;
+
+		files.casio_deploy_files_flags = CASIO_DEPLOY_OPTIMIZE
+			| (args->force ? CASIO_DEPLOY_OW : 0);
+		files.casio_deploy_files_count = 1;
+		files.casio_deploy_files_files = &file;
+
+		err = casio_deploy(&report, args->initflags,
+			&casio_deploy_send, &files);
+		break;
+
+	case mn_optimize:
+		err = casio_deploy(&report, args->initflags,
+			&casio_deploy_optimize, (void *)args->storage);
+		break;
+
+	default:
+		fprintf(stderr, "This subcommand can't be used with --all.\n");
+		return (1);
+	}
+
+	if (args->local && args->local != stdout)
+		fclose(args->local);
+	free(data);
+
+	if (err) {
+		fprintf(stderr, "Could not deploy: %s\n", casio_strerror(err));
+		return (1);
+	}
+
+	put_report(report);
+	ret = report->casio_deploy_report_failed ? 1 : 0;
+	casio_free_deploy_report(report);
+	return (ret);
+}
@@ -112,32 +112,34 @@ static int sendfile_confirm(void)
  *	sendfile_display:
  *	File sending nice display.
  *
- *	"Initialization" is when id > total (called in main).
+ *	Called by the progress tracker, which limits the number of calls.
+ *	"Initialization" is when no packet has been sent yet.
  *
- *	@arg	id			data packet ID
- *	@arg	total		total number of data packets
+ *	@arg	cookie		the cookie (unused).
+ *	@arg	info		the progress information.
  */
 
 static int sendfile_display_initialized = 0;
-static void sendfile_display(void *cookie, unsigned int id, unsigned int total)
-{
-	(void)cookie;
+static char sendfile_display_buf[50] =
+	"\r|---------------------------------------| 00.00%";
 
-	/* here's the buffer */
-	static char buf[50] =
-		"\r|---------------------------------------| 00.00%";
-	static char *bar = &buf[2];
-
-	/* initialize */
+static void sendfile_display(void *cookie, const casio_progress_info_t *info)
+{
+	static char *bar = &sendfile_display_buf[2];
 	static int pos;
+	unsigned int id = info->casio_progress_info_id;
+	unsigned int total = info->casio_progress_info_total;
+	unsigned long eta = info->casio_progress_info_eta / 1000;
+	(void)cookie;
 
 	/* if is initialize, fill */
-	if (id > total) {
+	if (!total) {
 		pos = 0;
 		/* indicate that is has been initialized */
 		sendfile_display_initialized = 1;
 		/* put initial buffer */
-		fputs(buf, stdout);
+		fputs(sendfile_display_buf, stdout);
+		fflush(stdout);
 		/* we're done */
 		return ;
 	}
@@ -148,13 +150,29 @@ static void sendfile_display(void *cookie, unsigned int id, unsigned int total)
 	while (pos <= current) bar[pos++] = '#';
 	/* - % - */
 	unsigned int percent = 10000 * id / total;
-	sprintf(&buf[43], "%02u.%02u", (percent / 100) % 100, percent % 100);
+	sprintf(&sendfile_display_buf[43], "%02u.%02u",
+		(percent / 100) % 100, percent % 100);
 
-	/* put it */
-	fputs(buf, stdout);
+	/* put it, with the rate and the remaining time */
+	printf("%s %lu KiB/s, %lu:%02lu left\x1B[K", sendfile_display_buf,
+		info->casio_progress_info_rate / 1024, eta / 60, eta % 60);
 	fflush(stdout);
 }
 
+/**
+ *	sendfile_display_end:
+ *	End the file sending display with a message.
+ *
+ *	@arg	msg			the message.
+ */
+
+static void sendfile_display_end(const char *msg)
+{
+	if (!sendfile_display_initialized)
+		return ;
+	printf("%.42s %s\x1B[K\n", sendfile_display_buf, msg);
+}
+
 /**
  *	print_file_info:
  *	File listing callback.
@@ -308,6 +326,7 @@ int main(int ac, char **av)
 	casio_path_t path = { 0 };
 	char data_buffer[CASIO_SEVEN_MAX_RAWDATA_SIZE];
 	casio_stream_t *filestream = NULL;
+	casio_progress_t progress;
 	path.casio_path_nodes = NULL; // Just for be sure
 	ssize_t ssize;
 
@@ -316,6 +335,11 @@ int main(int ac, char **av)
 	if (!parse_args(ac, av, &args))
 		return (0);
 
+	/* Run on all of the calculators if required. */
+
+	if (args.all)
+		return (deploy(&args));
+
 	/* Initialize the link. */
 
 	if (args.com)
@@ -401,8 +425,10 @@ int main(int ac, char **av)
 				break;
 
 			/* Setup disp */
-			casio_seven_set_disp(filestream, sendfile_display, NULL);
-			sendfile_display(NULL, 1, 0);
+			casio_init_progress(&progress, &sendfile_display, NULL,
+				100, 50, filesize, 0);
+			casio_seven_set_disp(filestream, &casio_progress, &progress);
+			casio_progress(&progress, 1, 0);
 
 			/* Write loop */
 			do
@@ -491,8 +517,7 @@ int main(int ac, char **av)
 	if (err && err != casio_error_noow)
 		goto fail;
 
-	if (sendfile_display_initialized)
-		puts("\b\b\b\b\b\bTransfer complete.");
+	sendfile_display_end("Transfer complete.");
 	if (args.local && args.local != stdout) fclose(args.local);
 
 	/* Terminate communication and de-initialize link handle. */
@@ -509,8 +534,7 @@ int main(int ac, char **av)
 	/* Then we're good */
 	return (0);
 fail:
-	if (sendfile_display_initialized)
-		puts("\b\b\b\b\b\bError !");
+	sendfile_display_end("Error !");
 
 	/* close the file */
 	if (args.local && args.local != stdout) fclose(args.local);
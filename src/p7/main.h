@@ -47,6 +47,7 @@ typedef struct {
 
 	/* other options */
 	const char *com, *storage;
+	int all;
 } args_t;
 
 /* Parsing function */
@@ -58,4 +59,7 @@ int list_devices(void);
 /* Dumping function */
 int dump(casio_link_t *handle);
 
+/* All-devices mode function */
+int deploy(args_t *args);
+
 #endif /* MAIN_H */
@@ -1,6 +1,6 @@
 #!/usr/bin/make -f
 #disable:
 libs_static:
-	@echo libusb libcasio
+	@echo libusb pthread libcasio
 libs:
 	@echo libcasio
@@ -58,10 +58,12 @@ typedef struct {
 
 	char buf[50], *bar;
 	int init, pos;
+
+	casio_progress_t progress;
 } osdisp_t;
 
 extern void osdisp_init(osdisp_t *cookie, const char *init,
-	const char *success);
+	const char *success, unsigned long size, unsigned long block);
 extern void osdisp(void *cookie, unsigned int id, unsigned int total);
 
 extern void osdisp_interrupt(osdisp_t *cookie);
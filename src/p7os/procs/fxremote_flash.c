@@ -70,7 +70,8 @@ static int send_sector(casio_link_t *handle, casio_stream_t *buffer,
 		unsigned long buf = 0x88030000, left = size;
 		int num, total;
 
-		osdisp_init(&osdisp_cookie, osdisp_string, "Flashwriting.");
+		osdisp_init(&osdisp_cookie, osdisp_string, "Flashwriting.",
+			size, 0x3FC);
 		sprintf(osdisp_string, "Copying sector at 0x%08lX (%lu bytes).",
 			addr, size);
 
@@ -179,7 +180,8 @@ int fxremote_flash(args_t *args)
 	{
 		int num = 1, total = ((args->eraseflash ? 0xA0280000 : top) - 0xA0010000) / 0x10000;
 
-		osdisp_init(&osdisp_cookie, "Clearing the sectors.", "Cleared!");
+		osdisp_init(&osdisp_cookie, "Clearing the sectors.", "Cleared!",
+			0, 0x10000);
 		osdisp(&osdisp_cookie, 1, 0);
 		for (addr = 0xA0010000; addr < (args->eraseflash ? 0xA0280000 : top); addr += 0x10000) {
 			casio_uint32_t localaddr;
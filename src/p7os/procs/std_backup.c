@@ -38,7 +38,7 @@ int backup_rom(args_t *args)
 	if (err) return (err);
 
 	/* Use the "standard" way. */
-	osdisp_init(&osdisp_cookie, "Gathering the OS...", "Backed up!");
+	osdisp_init(&osdisp_cookie, "Gathering the OS...", "Backed up!", 0, 0);
 	err = casio_backup_rom(link, args->local, osdisp, &osdisp_cookie);
 	if (err) { osdisp_interrupt(&osdisp_cookie); goto fail; }
 	osdisp_success(&osdisp_cookie);
@@ -42,7 +42,8 @@ int prepare(args_t *args)
 	if (err) goto fail;
 
 	/* Upload and run. */
-	osdisp_init(&osdisp_cookie, "Uploading the Update.Exe...", "Uploaded!");
+	osdisp_init(&osdisp_cookie, "Uploading the Update.Exe...", "Uploaded!",
+		(unsigned long)usize, 0);
 	err = casio_upload_and_run(link, args->uexe, usize,
 		0x88024000, 0x88024000, osdisp, &osdisp_cookie);
 	if (err) {
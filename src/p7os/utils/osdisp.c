@@ -24,41 +24,43 @@
  * --- */
 
 /**
- *	osdisp:
+ *	display:
  *	Nice little loading bar.
  *
  *	Taken from `src/p7/main.c`.
- *	"Initialization" is when id > total (called in main).
+ *	Called by the progress tracker, which limits the number of calls.
+ *	"Initialization" is when no packet has been sent yet.
  *
- *	@arg	id		data packet ID.
- *	@arg	total	total number of packets.
+ *	@arg	vcookie	the display cookie.
+ *	@arg	info	the progress information.
  */
 
-void osdisp(void *vcookie, unsigned int id, unsigned int total)
+static void display(void *vcookie, const casio_progress_info_t *info)
 {
 	osdisp_t *cookie = (void*)vcookie;
+	unsigned int id = info->casio_progress_info_id;
+	unsigned int total = info->casio_progress_info_total;
+	unsigned long eta = info->casio_progress_info_eta / 1000;
 	int current; unsigned int percent;
 
 	/* if is initialize, fill */
-	if (id > total) {
+	if (!total) {
 		/* initialize */
 		strcpy(cookie->buf,
 			"\r|---------------------------------------| 00.00%");
 		cookie->bar = &cookie->buf[2];
 		cookie->pos = 0;
-		cookie->init = 1;
 
-		/* put message and initial buffer. */
-		printf("%s\n%s", cookie->msg, cookie->buf);
+		/* put message and initial buffer, only once */
+		if (!cookie->init)
+			printf("%s\n", cookie->msg);
+		printf("%s", cookie->buf);
+		cookie->init = 1;
 
-		/* save cursor position and we're done */
-		fputs("\x1B[s", stdout);
+		fflush(stdout);
 		return ;
 	}
 
-	/* id and total start from 1, let them start from zero */
-	id--; total--;
-
 	/* modify buffer */
 	/* - # - */
 	current = 38 * id / total;
@@ -68,13 +70,28 @@ void osdisp(void *vcookie, unsigned int id, unsigned int total)
 	sprintf(&cookie->buf[43], "%02u.%02u",
 		percent / 100 % 100, percent % 100);
 
-	/* put it */
-	printf("%s", cookie->buf);
-	/* force cursor position */
-	fputs("\x1B""8", stdout);
+	/* put it, with the rate and the remaining time */
+	printf("%s %lu KiB/s, %lu:%02lu left\x1B[K", cookie->buf,
+		info->casio_progress_info_rate / 1024, eta / 60, eta % 60);
 	fflush(stdout);
 }
 
+/**
+ *	osdisp:
+ *	Progress callback, forwarding to the progress tracker.
+ *
+ *	@arg	vcookie	the display cookie.
+ *	@arg	id		data packet ID.
+ *	@arg	total	total number of packets.
+ */
+
+void osdisp(void *vcookie, unsigned int id, unsigned int total)
+{
+	osdisp_t *cookie = (void*)vcookie;
+
+	casio_progress(&cookie->progress, id, total);
+}
+
 /* ---
  * Initialization, miscallaneous actions.
  * --- */
@@ -86,14 +103,21 @@ void osdisp(void *vcookie, unsigned int id, unsigned int total)
  *	@arg	cookie		the display cookie to initialize.
  *	@arg	init		the initial message.
  *	@arg	success		the success message.
+ *	@arg	size		the total number of bytes (0 if unknown).
+ *	@arg	block		the number of bytes in a packet (0 for full
+ *						protocol 7.00 data packets).
  */
 
-void osdisp_init(osdisp_t *cookie, const char *init, const char *success)
+void osdisp_init(osdisp_t *cookie, const char *init, const char *success,
+	unsigned long size, unsigned long block)
 {
 	cookie->msg = init;
 	cookie->success = success;
 	cookie->init = 0;
 	cookie->pos = 0;
+
+	casio_init_progress(&cookie->progress, &display, cookie, 100, 50,
+		size, block);
 }
 
 /**
@@ -107,7 +131,7 @@ void osdisp_interrupt(osdisp_t *cookie)
 {
 	/* interrupt loading bar */
 	if (cookie->init)
-		printf("\b\b\b\b\b\bError!\n");
+		printf("%.42s Error!\x1B[K\n", cookie->buf);
 }
 
 /**
@@ -119,5 +143,8 @@ void osdisp_interrupt(osdisp_t *cookie)
 
 void osdisp_success(osdisp_t *cookie)
 {
-	printf("\b\b\b\b\b\b%s\n", cookie->success);
+	if (cookie->init)
+		printf("%.42s %s\x1B[K\n", cookie->buf, cookie->success);
+	else
+		printf("%s\n", cookie->success);
 }